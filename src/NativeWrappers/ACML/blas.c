@@ -1,7 +1,57 @@
 #include "acml.h"
 #include "wrapper_common.h"
+#include "small_matrix.h"
+#include "stats.h"
+#include <stddef.h>
 
 enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=113, CblasConjNoTrans=114};
+enum CBLAS_UPLO {CblasUpper=121, CblasLower=122};
+enum CBLAS_DIAG {CblasNonUnit=131, CblasUnit=132};
+enum CBLAS_SIDE {CblasLeft=141, CblasRight=142};
+
+/* Copies the strictly lower triangle of the packed n by n matrix c to its upper triangle. */
+static void s_mirror_lower(const int n, float c[]){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[(size_t)i * n + j] = c[(size_t)j * n + i];
+		}
+	}
+}
+
+static void d_mirror_lower(const int n, double c[]){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[(size_t)i * n + j] = c[(size_t)j * n + i];
+		}
+	}
+}
+
+/* The complex versions take the interleaved real and imaginary parts, and conjugate the copies of a Hermitian matrix. */
+static void c_mirror_lower(const int n, float c[], const int conjugate){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[2 * ((size_t)i * n + j)] = c[2 * ((size_t)j * n + i)];
+			c[2 * ((size_t)i * n + j) + 1] = conjugate ? -c[2 * ((size_t)j * n + i) + 1] : c[2 * ((size_t)j * n + i) + 1];
+		}
+	}
+}
+
+static void z_mirror_lower(const int n, double c[], const int conjugate){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[2 * ((size_t)i * n + j)] = c[2 * ((size_t)j * n + i)];
+			c[2 * ((size_t)i * n + j) + 1] = conjugate ? -c[2 * ((size_t)j * n + i) + 1] : c[2 * ((size_t)j * n + i) + 1];
+		}
+	}
+}
 
 DLLEXPORT void s_axpy(const int n, const float alpha, float x[], float y[]){
 	saxpy(n, alpha, x, 1, y, 1);
@@ -51,30 +101,391 @@ DLLEXPORT doublecomplex z_dot_product(int n, doublecomplex x[], doublecomplex y[
 	return zdotu(n, x, 1, y, 1);
 }
 
+DLLEXPORT void s_matrix_vector_multiply(const enum TRANSPOSE transA, const int m, const int n, float alpha, float a[], float x[], float beta, float y[]){
+	NATIVE_STATS_BEGIN;
+
+	sgemv(transA, m, n, alpha, a, m, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_s_matrix_vector_multiply, 2.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void d_matrix_vector_multiply(const enum TRANSPOSE transA, const int m, const int n, double alpha, double a[], double x[], double beta, double y[]){
+	NATIVE_STATS_BEGIN;
+
+	dgemv(transA, m, n, alpha, a, m, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_d_matrix_vector_multiply, 2.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void c_matrix_vector_multiply(const enum TRANSPOSE transA, const int m, const int n, complex alpha, complex a[], complex x[], complex beta, complex y[]){
+	NATIVE_STATS_BEGIN;
+
+	cgemv(transA, m, n, &alpha, a, m, x, 1, &beta, y, 1);
+
+	NATIVE_STATS_END(STATS_c_matrix_vector_multiply, 8.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void z_matrix_vector_multiply(const enum TRANSPOSE transA, const int m, const int n, doublecomplex alpha, doublecomplex a[], doublecomplex x[], doublecomplex beta, doublecomplex y[]){
+	NATIVE_STATS_BEGIN;
+
+	zgemv(transA, m, n, &alpha, a, m, x, 1, &beta, y, 1);
+
+	NATIVE_STATS_END(STATS_z_matrix_vector_multiply, 8.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void s_rank1_update(const int m, const int n, float alpha, float x[], float y[], float a[]){
+	NATIVE_STATS_BEGIN;
+
+	sger(m, n, alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_s_rank1_update, 2.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void d_rank1_update(const int m, const int n, double alpha, double x[], double y[], double a[]){
+	NATIVE_STATS_BEGIN;
+
+	dger(m, n, alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_d_rank1_update, 2.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void c_rank1_update(const int m, const int n, complex alpha, complex x[], complex y[], complex a[]){
+	NATIVE_STATS_BEGIN;
+
+	cgeru(m, n, &alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_c_rank1_update, 8.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void z_rank1_update(const int m, const int n, doublecomplex alpha, doublecomplex x[], doublecomplex y[], doublecomplex a[]){
+	NATIVE_STATS_BEGIN;
+
+	zgeru(m, n, &alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_z_rank1_update, 8.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+// Only the lower triangle of a is read.
+DLLEXPORT void s_symmetric_matrix_vector_multiply(const int n, float alpha, float a[], float x[], float beta, float y[]){
+	NATIVE_STATS_BEGIN;
+
+	ssymv('L', n, alpha, a, n, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_s_symmetric_matrix_vector_multiply, 2.0 * n * n, (0.5 * n * n + 2.0 * n) * sizeof(a[0]));
+}
+
+DLLEXPORT void d_symmetric_matrix_vector_multiply(const int n, double alpha, double a[], double x[], double beta, double y[]){
+	NATIVE_STATS_BEGIN;
+
+	dsymv('L', n, alpha, a, n, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_d_symmetric_matrix_vector_multiply, 2.0 * n * n, (0.5 * n * n + 2.0 * n) * sizeof(a[0]));
+}
+
 DLLEXPORT void s_matrix_multiply(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, float alpha, float x[], float y[], float beta, float c[]){
-	int lda = transA == CblasNoTrans ? m : k;
-	int ldb = transB == CblasNoTrans ? k : n;
+	NATIVE_STATS_BEGIN;
+
+	if (m != n || n != k || !small_sgemm(transA != CblasNoTrans, transB != CblasNoTrans, n, alpha, x, y, beta, c)){
+		int lda = transA == CblasNoTrans ? m : k;
+		int ldb = transB == CblasNoTrans ? k : n;
+
+		sgemm(transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+	}
 
-	sgemm(transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+	NATIVE_STATS_END(STATS_s_matrix_multiply, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
 }
 
 DLLEXPORT void d_matrix_multiply(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, double alpha, double x[], double y[], double beta, double c[]){
-	int lda = transA == CblasNoTrans ? m : k;
-	int ldb = transB == CblasNoTrans ? k : n;
+	NATIVE_STATS_BEGIN;
+
+	if (m != n || n != k || !small_dgemm(transA != CblasNoTrans, transB != CblasNoTrans, n, alpha, x, y, beta, c)){
+		int lda = transA == CblasNoTrans ? m : k;
+		int ldb = transB == CblasNoTrans ? k : n;
 
-	dgemm(transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+		dgemm(transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+	}
+
+	NATIVE_STATS_END(STATS_d_matrix_multiply, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
 }
 
 DLLEXPORT void c_matrix_multiply(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, complex alpha, complex x[], complex y[], complex beta, complex c[]){
+	NATIVE_STATS_BEGIN;
+
 	int lda = transA == CblasNoTrans ? m : k;
 	int ldb = transB == CblasNoTrans ? k : n;
 
 	cgemm(transA, transB, m, n, k, &alpha, x, lda, y, ldb, &beta, c, m);
+
+	NATIVE_STATS_END(STATS_c_matrix_multiply, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
 }
 
 DLLEXPORT void z_matrix_multiply(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, doublecomplex alpha, doublecomplex x[], doublecomplex y[], doublecomplex beta, doublecomplex c[]){
+	NATIVE_STATS_BEGIN;
+
 	int lda = transA == CblasNoTrans ? m : k;
 	int ldb = transB == CblasNoTrans ? k : n;
 
 	zgemm(transA, transB, m, n, k, &alpha, x, lda, y, ldb, &beta, c, m);
+
+	NATIVE_STATS_END(STATS_z_matrix_multiply, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void s_matrix_multiply_ld(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, float alpha, float x[], const int x_offset, const int ldx, float y[], const int y_offset, const int ldy, float beta, float c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	sgemm(transA, transB, m, n, k, alpha, x + x_offset, ldx, y + y_offset, ldy, beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_s_matrix_multiply_ld, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void d_matrix_multiply_ld(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, double alpha, double x[], const int x_offset, const int ldx, double y[], const int y_offset, const int ldy, double beta, double c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	dgemm(transA, transB, m, n, k, alpha, x + x_offset, ldx, y + y_offset, ldy, beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_d_matrix_multiply_ld, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void c_matrix_multiply_ld(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, complex alpha, complex x[], const int x_offset, const int ldx, complex y[], const int y_offset, const int ldy, complex beta, complex c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	cgemm(transA, transB, m, n, k, &alpha, x + x_offset, ldx, y + y_offset, ldy, &beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_c_matrix_multiply_ld, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void z_matrix_multiply_ld(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, doublecomplex alpha, doublecomplex x[], const int x_offset, const int ldx, doublecomplex y[], const int y_offset, const int ldy, doublecomplex beta, doublecomplex c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	zgemm(transA, transB, m, n, k, &alpha, x + x_offset, ldx, y + y_offset, ldy, &beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_z_matrix_multiply_ld, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void s_symmetric_rank_k_update(const enum TRANSPOSE trans, const int n, const int k, float alpha, float a[], float beta, float c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	ssyrk('L', trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		s_mirror_lower(n, c);
+	}
+
+	NATIVE_STATS_END(STATS_s_symmetric_rank_k_update, 1.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void d_symmetric_rank_k_update(const enum TRANSPOSE trans, const int n, const int k, double alpha, double a[], double beta, double c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	dsyrk('L', trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		d_mirror_lower(n, c);
+	}
+
+	NATIVE_STATS_END(STATS_d_symmetric_rank_k_update, 1.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void c_symmetric_rank_k_update(const enum TRANSPOSE trans, const int n, const int k, complex alpha, complex a[], complex beta, complex c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	csyrk('L', trans, n, k, &alpha, a, lda, &beta, c, n);
+
+	if (mirror){
+		c_mirror_lower(n, (float*)c, 0);
+	}
+
+	NATIVE_STATS_END(STATS_c_symmetric_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void z_symmetric_rank_k_update(const enum TRANSPOSE trans, const int n, const int k, doublecomplex alpha, doublecomplex a[], doublecomplex beta, doublecomplex c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	zsyrk('L', trans, n, k, &alpha, a, lda, &beta, c, n);
+
+	if (mirror){
+		z_mirror_lower(n, (double*)c, 0);
+	}
+
+	NATIVE_STATS_END(STATS_z_symmetric_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void c_hermitian_rank_k_update(const enum TRANSPOSE trans, const int n, const int k, float alpha, complex a[], float beta, complex c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	cherk('L', trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		c_mirror_lower(n, (float*)c, 1);
+	}
+
+	NATIVE_STATS_END(STATS_c_hermitian_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void z_hermitian_rank_k_update(const enum TRANSPOSE trans, const int n, const int k, double alpha, doublecomplex a[], double beta, doublecomplex c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	zherk('L', trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		z_mirror_lower(n, (double*)c, 1);
+	}
+
+	NATIVE_STATS_END(STATS_z_hermitian_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void s_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, float alpha, float a[], float b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	strsm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_s_triangular_solve, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void d_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, double alpha, double a[], double b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	dtrsm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_d_triangular_solve, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void c_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, complex alpha, complex a[], complex b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	ctrsm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_c_triangular_solve, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void z_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, doublecomplex alpha, doublecomplex a[], doublecomplex b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	ztrsm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_z_triangular_solve, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void s_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, float alpha, float a[], float b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	strmm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_s_triangular_multiply, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void d_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, double alpha, double a[], double b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	dtrmm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_d_triangular_multiply, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void c_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, complex alpha, complex a[], complex b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	ctrmm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_c_triangular_multiply, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void z_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, doublecomplex alpha, doublecomplex a[], doublecomplex b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	ztrmm(side == CblasLeft ? 'L' : 'R', uplo == CblasUpper ? 'U' : 'L', trans == CblasNoTrans ? 'N' : trans == CblasTrans ? 'T' : 'C', diag == CblasUnit ? 'U' : 'N', m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_z_triangular_multiply, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void s_matrix_multiply_batch(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, float alpha, float x[], const int x_stride, float y[], const int y_stride, float beta, float c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		sgemm(transA, transB, m, n, k, alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, beta, c + (size_t)i * c_stride, m);
+	}
+
+	NATIVE_STATS_END(STATS_s_matrix_multiply_batch, 2.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
+}
+
+DLLEXPORT void d_matrix_multiply_batch(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, double alpha, double x[], const int x_stride, double y[], const int y_stride, double beta, double c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		dgemm(transA, transB, m, n, k, alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, beta, c + (size_t)i * c_stride, m);
+	}
+
+	NATIVE_STATS_END(STATS_d_matrix_multiply_batch, 2.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
+}
+
+DLLEXPORT void c_matrix_multiply_batch(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, complex alpha, complex x[], const int x_stride, complex y[], const int y_stride, complex beta, complex c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		cgemm(transA, transB, m, n, k, &alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, &beta, c + (size_t)i * c_stride, m);
+	}
+
+	NATIVE_STATS_END(STATS_c_matrix_multiply_batch, 8.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
+}
+
+DLLEXPORT void z_matrix_multiply_batch(const enum TRANSPOSE transA, const enum TRANSPOSE transB, const int m, const int n, const int k, doublecomplex alpha, doublecomplex x[], const int x_stride, doublecomplex y[], const int y_stride, doublecomplex beta, doublecomplex c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		zgemm(transA, transB, m, n, k, &alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, &beta, c + (size_t)i * c_stride, m);
+	}
+
+	NATIVE_STATS_END(STATS_z_matrix_multiply_batch, 8.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
 }
@@ -1,12 +1,23 @@
 ﻿#include "acml.h"
 #include "wrapper_common.h"
+#include "scratch.h"
+#include "small_matrix.h"
+#include "stats.h"
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 extern "C"{
 
 	DLLEXPORT int s_lu_factor(int m, float a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_s_lu_factor, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_factor(m, a, ipiv, info)){
+			return info;
+		}
+
 		sgetrf(m, m, a, m,ipiv,&info);
 		for(int i = 0; i < m; ++i ){
 			ipiv[i] -= 1;
@@ -16,7 +27,13 @@ extern "C"{
 
 	DLLEXPORT int d_lu_factor(int m, double a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_d_lu_factor, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_factor(m, a, ipiv, info)){
+			return info;
+		}
+
 		dgetrf(m, m,a, m, ipiv, &info);
 		for(int i = 0; i < m; ++i ){
 			ipiv[i] -= 1;
@@ -26,6 +43,8 @@ extern "C"{
 
 	DLLEXPORT int c_lu_factor(int m, complex a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_c_lu_factor, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
 		cgetrf(m, m, a, m,ipiv, &info);
 		for(int i = 0; i < m; ++i ){
@@ -36,6 +55,8 @@ extern "C"{
 
 	DLLEXPORT int z_lu_factor(int m, doublecomplex a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_z_lu_factor, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
 		zgetrf(m, m, a, m, ipiv, &info);
 		for(int i = 0; i < m; ++i ){
@@ -45,76 +66,102 @@ extern "C"{
 	}
 
 	DLLEXPORT int s_lu_inverse(int n, float a[], float work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_s_lu_inverse, native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::inverse(n, a, info)){
+			return info;
+		}
+
 		sgetrf(n, n, a, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		SGETRI(&n, a, &n, ipiv, work, &lwork, &info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int d_lu_inverse(int n, double a[], double work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_d_lu_inverse, native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::inverse(n, a, info)){
+			return info;
+		}
+
 		dgetrf(n, n, a, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		DGETRI(&n, a, &n, ipiv, work, &lwork, &info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int c_lu_inverse(int n, complex a[], complex work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_c_lu_inverse, 4 * (native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		cgetrf(n, n, a, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		CGETRI(&n, a, &n, ipiv, work, &lwork, &info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int z_lu_inverse(int n, doublecomplex a[], doublecomplex work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_z_lu_inverse, 4 * (native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		zgetrf(n, n, a, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		ZGETRI(&n, a, &n, ipiv, work, &lwork, &info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int s_lu_inverse_factored(int n, float a[], int ipiv[], float work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_s_lu_inverse_factored, native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		if (small_matrix::lu_inverse_factored(n, a, ipiv, info)){
+			return info;
+		}
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
 		}
-		int info = 0;
 		SGETRI(&n, a, &n, ipiv, work, &lwork, &info);
 
 		for(i = 0; i < n; ++i ){
@@ -125,12 +172,18 @@ extern "C"{
 
 	DLLEXPORT int d_lu_inverse_factored(int n, double a[], int ipiv[], double work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_d_lu_inverse_factored, native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		if (small_matrix::lu_inverse_factored(n, a, ipiv, info)){
+			return info;
+		}
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
 		}
 
-		int info = 0;
 		DGETRI(&n, a, &n, ipiv, work, &lwork, &info);
 
 		for(i = 0; i < n; ++i ){
@@ -141,6 +194,8 @@ extern "C"{
 
 	DLLEXPORT int c_lu_inverse_factored(int n, complex a[], int ipiv[], complex work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_c_lu_inverse_factored, 4 * (native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -157,6 +212,8 @@ extern "C"{
 
 	DLLEXPORT int z_lu_inverse_factored(int n, doublecomplex a[], int ipiv[], doublecomplex work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_z_lu_inverse_factored, 4 * (native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -173,7 +230,13 @@ extern "C"{
 
 	DLLEXPORT int s_lu_solve_factored(int n, int nrhs, float a[], int ipiv[], float b[])
 	{
+		NativeStatsScope stats(STATS_s_lu_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_solve_factored(n, nrhs, a, ipiv, b)){
+			return info;
+		}
+
 		int i;    
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -189,7 +252,13 @@ extern "C"{
 
 	DLLEXPORT int  d_lu_solve_factored(int n, int nrhs, double a[], int ipiv[], double b[])
 	{
+		NativeStatsScope stats(STATS_d_lu_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_solve_factored(n, nrhs, a, ipiv, b)){
+			return info;
+		}
+
 		int i;    
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -205,6 +274,8 @@ extern "C"{
 
 	DLLEXPORT int c_lu_solve_factored(int n, int nrhs, complex a[], int ipiv[], complex b[])
 	{
+		NativeStatsScope stats(STATS_c_lu_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
 		int i;    
 		for(i = 0; i < n; ++i ){
@@ -221,6 +292,8 @@ extern "C"{
 
 	DLLEXPORT int z_lu_solve_factored(int n, int nrhs, doublecomplex a[], int ipiv[], doublecomplex b[])
 	{
+		NativeStatsScope stats(STATS_z_lu_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
 		int i;    
 		for(i = 0; i < n; ++i ){
@@ -235,98 +308,312 @@ extern "C"{
 		return info;
 	}
 
+	DLLEXPORT int s_lu_condition(char norm, int n, float a[], float anorm, float* rcond)
+	{
+		NativeStatsScope stats(STATS_s_lu_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		int info = 0;
+		sgecon(norm, n, a, n, anorm, rcond, &info);
+		return info;
+	}
+
+	DLLEXPORT int d_lu_condition(char norm, int n, double a[], double anorm, double* rcond)
+	{
+		NativeStatsScope stats(STATS_d_lu_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		int info = 0;
+		dgecon(norm, n, a, n, anorm, rcond, &info);
+		return info;
+	}
+
+	DLLEXPORT int c_lu_condition(char norm, int n, complex a[], float anorm, float* rcond)
+	{
+		NativeStatsScope stats(STATS_c_lu_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		int info = 0;
+		cgecon(norm, n, a, n, anorm, rcond, &info);
+		return info;
+	}
+
+	DLLEXPORT int z_lu_condition(char norm, int n, doublecomplex a[], double anorm, double* rcond)
+	{
+		NativeStatsScope stats(STATS_z_lu_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		int info = 0;
+		zgecon(norm, n, a, n, anorm, rcond, &info);
+		return info;
+	}
+
+	DLLEXPORT int s_lu_determinant(int n, float a[], int ipiv[], float* log_abs, float* sign)
+	{
+		NativeStatsScope stats(STATS_s_lu_determinant, native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would.
+		*log_abs = 0;
+		*sign = 1;
+		for (int i = 0; i < n; ++i)
+		{
+			float u = a[i * n + i];
+			if (u == 0)
+			{
+				*log_abs = -std::numeric_limits<float>::infinity();
+				*sign = 0;
+				return i + 1;
+			}
+
+			if ((u < 0) != (ipiv[i] != i))
+			{
+				*sign = -*sign;
+			}
+
+			*log_abs += std::log(std::abs(u));
+		}
+
+		return 0;
+	}
+
+	DLLEXPORT int d_lu_determinant(int n, double a[], int ipiv[], double* log_abs, double* sign)
+	{
+		NativeStatsScope stats(STATS_d_lu_determinant, native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would.
+		*log_abs = 0;
+		*sign = 1;
+		for (int i = 0; i < n; ++i)
+		{
+			double u = a[i * n + i];
+			if (u == 0)
+			{
+				*log_abs = -std::numeric_limits<double>::infinity();
+				*sign = 0;
+				return i + 1;
+			}
+
+			if ((u < 0) != (ipiv[i] != i))
+			{
+				*sign = -*sign;
+			}
+
+			*log_abs += std::log(std::abs(u));
+		}
+
+		return 0;
+	}
+
+	DLLEXPORT int c_lu_determinant(int n, complex a[], int ipiv[], float* log_abs, complex* sign)
+	{
+		NativeStatsScope stats(STATS_c_lu_determinant, 4 * native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would;
+		// the sign is the product of the pivots' phases.
+		*log_abs = 0;
+		sign->real = 1;
+		sign->imag = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			complex u = a[i * n + i];
+			float magnitude = std::hypot(u.real, u.imag);
+			if (magnitude == 0)
+			{
+				*log_abs = -std::numeric_limits<float>::infinity();
+				sign->real = 0;
+				sign->imag = 0;
+				return i + 1;
+			}
+
+			float phase_re = u.real / magnitude;
+			float phase_im = u.imag / magnitude;
+			if (ipiv[i] != i)
+			{
+				phase_re = -phase_re;
+				phase_im = -phase_im;
+			}
+
+			float sign_re = sign->real * phase_re - sign->imag * phase_im;
+			sign->imag = sign->real * phase_im + sign->imag * phase_re;
+			sign->real = sign_re;
+			*log_abs += std::log(magnitude);
+		}
+
+		return 0;
+	}
+
+	DLLEXPORT int z_lu_determinant(int n, doublecomplex a[], int ipiv[], double* log_abs, doublecomplex* sign)
+	{
+		NativeStatsScope stats(STATS_z_lu_determinant, 4 * native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would;
+		// the sign is the product of the pivots' phases.
+		*log_abs = 0;
+		sign->real = 1;
+		sign->imag = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			doublecomplex u = a[i * n + i];
+			double magnitude = std::hypot(u.real, u.imag);
+			if (magnitude == 0)
+			{
+				*log_abs = -std::numeric_limits<double>::infinity();
+				sign->real = 0;
+				sign->imag = 0;
+				return i + 1;
+			}
+
+			double phase_re = u.real / magnitude;
+			double phase_im = u.imag / magnitude;
+			if (ipiv[i] != i)
+			{
+				phase_re = -phase_re;
+				phase_im = -phase_im;
+			}
+
+			double sign_re = sign->real * phase_re - sign->imag * phase_im;
+			sign->imag = sign->real * phase_im + sign->imag * phase_re;
+			sign->real = sign_re;
+			*log_abs += std::log(magnitude);
+		}
+
+		return 0;
+	}
+
 	DLLEXPORT int s_lu_solve(int n, int nrhs, float a[], float b[])
+	try
 	{
-		float* clone = new float[n*n];
+		NativeStatsScope stats(STATS_s_lu_solve, native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		float* clone = scratch.alloc<float>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(float));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::lu_factor(n, clone, ipiv, info)){
+			if (info == 0){
+				small_matrix::lu_solve_factored(n, nrhs, clone, ipiv, b);
+			}
+			return info;
+		}
+
 		sgetrf(n, n, clone, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		sgetrs(trans, n, nrhs, clone, n, ipiv, b, n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int d_lu_solve(int n, int nrhs, double a[], double b[])
+	try
 	{
-		double* clone = new double[n*n];
+		NativeStatsScope stats(STATS_d_lu_solve, native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(double));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::lu_factor(n, clone, ipiv, info)){
+			if (info == 0){
+				small_matrix::lu_solve_factored(n, nrhs, clone, ipiv, b);
+			}
+			return info;
+		}
+
 		dgetrf(n, n, clone, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		dgetrs(trans, n, nrhs, clone, n, ipiv, b, n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int c_lu_solve(int n, int nrhs, complex a[], complex b[])
+	try
 	{
-		complex* clone = new complex[n*n];
+		NativeStatsScope stats(STATS_c_lu_solve, 4 * (native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		complex* clone = scratch.alloc<complex>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(complex));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		cgetrf(n, n, clone, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		cgetrs(trans, n, nrhs, clone, n, ipiv, b, n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int z_lu_solve(int n, int nrhs, doublecomplex a[],  doublecomplex b[])
+	try
 	{
-		doublecomplex* clone = new doublecomplex[n*n];
+		NativeStatsScope stats(STATS_z_lu_solve, 4 * (native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		doublecomplex* clone = scratch.alloc<doublecomplex>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(doublecomplex));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		zgetrf(n, n, clone, n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		zgetrs(trans, n, nrhs, clone, n, ipiv, b, n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	// Solves in single precision and refines the solution with double precision residuals. iterations
+	// receives the number of refinement steps, or a negative value when the solve fell back to
+	// double precision (see dsgesv).
+	DLLEXPORT int d_lu_solve_mixed(int n, int nrhs, double a[], double b[], int* iterations)
+	try
+	{
+		NativeStatsScope stats(STATS_d_lu_solve_mixed, native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
+		std::memcpy(clone, a, n*n*sizeof(double));
+		double* x = scratch.alloc<double>(n*nrhs);
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		dsgesv(n, nrhs, clone, n, ipiv, b, n, x, n, iterations, &info);
+
+		if (info == 0){
+			std::memcpy(b, x, n*nrhs*sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int s_cholesky_factor(int n, float a[]){
+		NativeStatsScope stats(STATS_s_cholesky_factor, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
-		spotrf(uplo, n, a, n, &info);
+		if (!small_matrix::cholesky_factor(n, a, info)){
+			spotrf(uplo, n, a, n, &info);
+		}
 		for (int i = 0; i < n; ++i)
 		{
 			int index = i * n;
@@ -339,9 +626,13 @@ extern "C"{
 	}
 
 	DLLEXPORT int d_cholesky_factor(int n, double* a){
+		NativeStatsScope stats(STATS_d_cholesky_factor, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
-		dpotrf(uplo, n, a, n, &info);
+		if (!small_matrix::cholesky_factor(n, a, info)){
+			dpotrf(uplo, n, a, n, &info);
+		}
 		for (int i = 0; i < n; ++i)
 		{
 			int index = i * n;
@@ -354,6 +645,8 @@ extern "C"{
 	}
 
 	DLLEXPORT int c_cholesky_factor(int n, complex a[]){
+		NativeStatsScope stats(STATS_c_cholesky_factor, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		complex zero = {0.0f, 0.0f};
@@ -370,6 +663,8 @@ extern "C"{
 	}
 
 	DLLEXPORT int z_cholesky_factor(int n, doublecomplex a[]){
+		NativeStatsScope stats(STATS_z_cholesky_factor, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		doublecomplex zero = {0.0, 0.0};
@@ -386,91 +681,157 @@ extern "C"{
 	}
 
 	DLLEXPORT int s_cholesky_solve(int n, int nrhs, float a[], float b[])
+	try
 	{
-		float* clone = new float[n*n];
+		NativeStatsScope stats(STATS_s_cholesky_solve, native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		float* clone = scratch.alloc<float>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(float));
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_factor(n, clone, info)){
+			if (info == 0){
+				small_matrix::cholesky_solve_factored(n, nrhs, clone, b);
+			}
+			return info;
+		}
+
 		spotrf(uplo, n, clone, n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		spotrs(uplo, n, nrhs, clone, n, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int d_cholesky_solve(int n, int nrhs, double a[], double b[])
+	try
 	{
-		double* clone = new double[n*n];
+		NativeStatsScope stats(STATS_d_cholesky_solve, native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(double));
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_factor(n, clone, info)){
+			if (info == 0){
+				small_matrix::cholesky_solve_factored(n, nrhs, clone, b);
+			}
+			return info;
+		}
+
 		dpotrf(uplo, n, clone, n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		dpotrs(uplo, n, nrhs, clone, n, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int c_cholesky_solve(int n, int nrhs, complex a[], complex b[])
+	try
 	{
-		complex* clone = new complex[n*n];
+		NativeStatsScope stats(STATS_c_cholesky_solve, 4 * (native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		complex* clone = scratch.alloc<complex>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(complex));
 		char uplo = 'L';
 		int info = 0;
 		cpotrf(uplo, n, clone, n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		cpotrs(uplo, n, nrhs, clone, n, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int z_cholesky_solve(int n, int nrhs, doublecomplex a[], doublecomplex b[])
+	try
 	{
-		doublecomplex* clone = new doublecomplex[n*n];
+		NativeStatsScope stats(STATS_z_cholesky_solve, 4 * (native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		doublecomplex* clone = scratch.alloc<doublecomplex>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(doublecomplex));
 		char uplo = 'L';
 		int info = 0;
 		zpotrf(uplo, n, clone, n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		zpotrs(uplo, n, nrhs, clone, n, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	// The Cholesky counterpart of d_lu_solve_mixed (see dsposv).
+	DLLEXPORT int d_cholesky_solve_mixed(int n, int nrhs, double a[], double b[], int* iterations)
+	try
+	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_mixed, native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
+		std::memcpy(clone, a, n*n*sizeof(double));
+		double* x = scratch.alloc<double>(n*nrhs);
+		char uplo = 'L';
+		int info = 0;
+		dsposv(uplo, n, nrhs, clone, n, b, n, x, n, iterations, &info);
+
+		if (info == 0){
+			std::memcpy(b, x, n*nrhs*sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int s_cholesky_solve_factored(int n, int nrhs, float a[], float b[])
 	{
+		NativeStatsScope stats(STATS_s_cholesky_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_solve_factored(n, nrhs, a, b)){
+			return info;
+		}
+
 		spotrs(uplo, n, nrhs, a, n, b, n, &info);
 		return info;
 	}
 
 	DLLEXPORT int d_cholesky_solve_factored(int n, int nrhs, double a[], double b[])
 	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_solve_factored(n, nrhs, a, b)){
+			return info;
+		}
+
 		dpotrs(uplo, n, nrhs, a, n, b, n, &info);
 		return info;
 	}
 
 	DLLEXPORT int c_cholesky_solve_factored(int n, int nrhs, complex a[], complex b[])
 	{
+		NativeStatsScope stats(STATS_c_cholesky_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		cpotrs(uplo, n, nrhs, a, n, b, n, &info);
@@ -479,445 +840,2805 @@ extern "C"{
 
 	DLLEXPORT int z_cholesky_solve_factored(int n, int nrhs, doublecomplex a[], doublecomplex b[])
 	{
+		NativeStatsScope stats(STATS_z_cholesky_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		zpotrs(uplo, n, nrhs, a, n, b, n, &info);
 		return info;
 	}
 
-	DLLEXPORT int s_qr_factor(int m, int n, float r[], float tau[], float q[], float work[], int len)
+	DLLEXPORT int s_cholesky_condition(int n, float a[], float anorm, float* rcond)
 	{
+		NativeStatsScope stats(STATS_s_cholesky_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
 		int info = 0;
-		SGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+		spocon('L', n, a, n, anorm, rcond, &info);
+		return info;
+	}
 
-		for (int i = 0; i < m; ++i)
-		{
-			for (int j = 0; j < m && j < n; ++j)
-			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
-			}
-		}
+	DLLEXPORT int d_cholesky_condition(int n, double a[], double anorm, double* rcond)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			SORGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			SORGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
+		int info = 0;
+		dpocon('L', n, a, n, anorm, rcond, &info);
+		return info;
+	}
+
+	DLLEXPORT int c_cholesky_condition(int n, complex a[], float anorm, float* rcond)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
 
+		int info = 0;
+		cpocon('L', n, a, n, anorm, rcond, &info);
 		return info;
 	}
 
-	DLLEXPORT int d_qr_factor(int m, int n, double r[], double tau[], double q[], double work[], int len)
+	DLLEXPORT int z_cholesky_condition(int n, doublecomplex a[], double anorm, double* rcond)
 	{
+		NativeStatsScope stats(STATS_z_cholesky_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
 		int info = 0;
-		DGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+		zpocon('L', n, a, n, anorm, rcond, &info);
+		return info;
+	}
 
-		for (int i = 0; i < m; ++i)
+	DLLEXPORT int s_ldlt_factor(int n, float a[], int ipiv[])
+	{
+		NativeStatsScope stats(STATS_s_ldlt_factor, native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		ssytrf(uplo, n, a, n, ipiv, &info);
+
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
+		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < m && j < n; ++j)
+			if (ipiv[i] > 0)
 			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
+				ipiv[i] -= 1;
 			}
 		}
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			DORGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			DORGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
-
 		return info;
 	}
 
-	DLLEXPORT int c_qr_factor(int m, int n, complex r[], complex tau[], complex q[], complex work[], int len)
+	DLLEXPORT int d_ldlt_factor(int n, double a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_d_ldlt_factor, native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
 		int info = 0;
-		CGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+		dsytrf(uplo, n, a, n, ipiv, &info);
 
-		for (int i = 0; i < m; ++i)
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
+		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < m && j < n; ++j)
+			if (ipiv[i] > 0)
 			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
+				ipiv[i] -= 1;
 			}
 		}
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			CUNGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			CUNGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
-
 		return info;
 	}
 
-	DLLEXPORT int z_qr_factor(int m, int n, doublecomplex r[], doublecomplex tau[], doublecomplex q[], doublecomplex work[], int len)
+	DLLEXPORT int c_ldlt_factor(int n, complex a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_c_ldlt_factor, 4 * native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
 		int info = 0;
-		ZGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+		chetrf(uplo, n, a, n, ipiv, &info);
 
-		for (int i = 0; i < m; ++i)
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
+		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < m && j < n; ++j)
+			if (ipiv[i] > 0)
 			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
+				ipiv[i] -= 1;
 			}
 		}
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			ZUNGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			ZUNGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
-
 		return info;
 	}
 
-	DLLEXPORT int s_qr_solve(int m, int n, int bn, float r[], float b[], float x[], float work[], int len)
+	DLLEXPORT int z_ldlt_factor(int n, doublecomplex a[], int ipiv[])
 	{
-		int info = 0;
-		float* clone_r = new float[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(float));
+		NativeStatsScope stats(STATS_z_ldlt_factor, 4 * native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
 
-		float* tau = new float[std::max(1, std::min(m,n))];
-		SGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
-
-		if (info != 0)
-		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
-		}
-
-		float* clone_b = new float[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(float));
+		char uplo = 'L';
+		int info = 0;
+		zhetrf(uplo, n, a, n, ipiv, &info);
 
-		char side ='L';
-		char tran = 'T';
-		char upper = 'U';
-		char not = 'N';
-		SORMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		strsm(side, upper, not, not, n, bn, 1.0, clone_r, m, clone_b, m);
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_r;
-		delete[] tau;
-		delete[] clone_b;
 		return info;
 	}
 
-	DLLEXPORT int d_qr_solve(int m, int n, int bn, double r[], double b[], double x[], double work[], int len)
+	DLLEXPORT int s_ldlt_solve_factored(int n, int nrhs, float a[], int ipiv[], float b[])
 	{
-		int info = 0;
-		double* clone_r = new double[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(double));
-
-		double* tau = new double[std::max(1, std::min(m,n))];
-		DGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
+		NativeStatsScope stats(STATS_s_ldlt_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		if (info != 0)
+		for (int i = 0; i < n; ++i)
 		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
+			if (ipiv[i] >= 0)
+			{
+				ipiv[i] += 1;
+			}
 		}
 
-		double* clone_b = new double[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(double));
-
-		char side ='L';
-		char tran = 'T';
-		char upper = 'U';
-		char not = 'N';
+		char uplo = 'L';
+		int info = 0;
+		ssytrs(uplo, n, nrhs, a, n, ipiv, b, n, &info);
 
-		DORMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		dtrsm(side, upper, not, not, n, bn, 1.0, clone_r, m, clone_b, m);
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_b;
-		delete[] tau;
-		delete[] clone_r;
 		return info;
 	}
 
-	DLLEXPORT int c_qr_solve(int m, int n, int bn, complex r[], complex b[], complex x[], complex work[], int len)
+	DLLEXPORT int d_ldlt_solve_factored(int n, int nrhs, double a[], int ipiv[], double b[])
 	{
-		int info = 0;
-		complex* clone_r = new complex[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(complex));
-
-		complex* tau = new complex[std::min(m,n)];
-		CGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
+		NativeStatsScope stats(STATS_d_ldlt_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		if (info != 0)
+		for (int i = 0; i < n; ++i)
 		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
+			if (ipiv[i] >= 0)
+			{
+				ipiv[i] += 1;
+			}
 		}
 
-		char side ='L';
-		char tran = 'C';
-		char upper = 'U';
-		char not = 'N';
-
-		complex* clone_b = new complex[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(complex));
-
-		CUNMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		complex one = {1.0, 0.0};
-		ctrsm(side, upper, not, not, n, bn, &one, clone_r, m, clone_b, m);
+		char uplo = 'L';
+		int info = 0;
+		dsytrs(uplo, n, nrhs, a, n, ipiv, b, n, &info);
 
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_r;
-		delete[] tau;
-		delete[] clone_b;
 		return info;
 	}
 
-	DLLEXPORT int z_qr_solve(int m, int n, int bn, doublecomplex r[], doublecomplex b[], doublecomplex x[], doublecomplex work[], int len)
+	DLLEXPORT int c_ldlt_solve_factored(int n, int nrhs, complex a[], int ipiv[], complex b[])
 	{
-		int info = 0;
-		doublecomplex* clone_r = new doublecomplex[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(doublecomplex));
-
-		doublecomplex* tau = new doublecomplex[std::min(m,n)];
-		ZGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
+		NativeStatsScope stats(STATS_c_ldlt_solve_factored, 4 * native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		if (info != 0)
+		for (int i = 0; i < n; ++i)
 		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
+			if (ipiv[i] >= 0)
+			{
+				ipiv[i] += 1;
+			}
 		}
 
-		char side ='L';
-		char tran = 'C';
-		char upper = 'U';
-		char not = 'N';
-
-		doublecomplex* clone_b = new doublecomplex[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(doublecomplex));
-
-		ZUNMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		doublecomplex one = {1.0, 0.0};
-		ztrsm(side, upper, not, not, n, bn, &one, clone_r, m, clone_b, m);
+		char uplo = 'L';
+		int info = 0;
+		chetrs(uplo, n, nrhs, a, n, ipiv, b, n, &info);
 
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_r;
-		delete[] tau;
-		delete[] clone_b;
 		return info;
 	}
 
-	DLLEXPORT int s_qr_solve_factored(int m, int n, int bn, float r[], float b[], float tau[], float x[], float work[], int len)
+	DLLEXPORT int z_ldlt_solve_factored(int n, int nrhs, doublecomplex a[], int ipiv[], doublecomplex b[])
 	{
-		char side ='L';
-		char tran = 'T';
-		char upper = 'U';
-		char not = 'N';
-		int info = 0;
-
-		float* clone_b = new float[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(float));
+		NativeStatsScope stats(STATS_z_ldlt_solve_factored, 4 * native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		SORMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		strsm(side, upper, not, not, n, bn, 1.0, r, m, clone_b, m);
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] >= 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] += 1;
 			}
 		}
 
-		delete[] clone_b;
-		return info;
-	}
-
-	DLLEXPORT int d_qr_solve_factored(int m, int n, int bn, double r[], double b[], double tau[], double x[], double work[], int len)
-	{
-		char side ='L';
-		char tran = 'T';
-		char upper = 'U';
-		char not = 'N';
+		char uplo = 'L';
 		int info = 0;
+		zhetrs(uplo, n, nrhs, a, n, ipiv, b, n, &info);
 
-		double* clone_b = new double[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(double));
-
-		DORMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		dtrsm(side, upper, not, not, n, bn, 1.0, r, m, clone_b, m);
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_b;
 		return info;
 	}
 
-	DLLEXPORT int c_qr_solve_factored(int m, int n, int bn, complex r[], complex b[], complex tau[], complex x[], complex work[], int len)
+	DLLEXPORT int s_ldlt_solve(int n, int nrhs, float a[], float b[])
+	try
 	{
-		char side ='L';
-		char tran = 'C';
-		char upper = 'U';
-		char not = 'N';
+		NativeStatsScope stats(STATS_s_ldlt_solve, (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		float* clone = scratch.alloc<float>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(float));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
 		int info = 0;
+		ssysv(uplo, n, nrhs, clone, n, ipiv, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		complex* clone_b = new complex[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(complex));
+	DLLEXPORT int d_ldlt_solve(int n, int nrhs, double a[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_ldlt_solve, (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		CUNMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		complex one = {1.0f, 0.0f};
-		ctrsm(side, upper, not, not, n, bn, &one, r, m, clone_b, m);
-		for (int i = 0; i < n; ++i)
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(double));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
+		int info = 0;
+		dsysv(uplo, n, nrhs, clone, n, ipiv, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_ldlt_solve(int n, int nrhs, complex a[], complex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_ldlt_solve, 4 * (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		complex* clone = scratch.alloc<complex>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(complex));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
+		int info = 0;
+		chesv(uplo, n, nrhs, clone, n, ipiv, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_ldlt_solve(int n, int nrhs, doublecomplex a[], doublecomplex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_ldlt_solve, 4 * (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		doublecomplex* clone = scratch.alloc<doublecomplex>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(doublecomplex));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
+		int info = 0;
+		zhesv(uplo, n, nrhs, clone, n, ipiv, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_band_lu_solve(int n, int kl, int ku, int nrhs, float ab[], float b[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_band_lu_solve, native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		float* work = scratch.alloc<float>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(float));
+		for (int j = 0; j < n; ++j)
 		{
-			for (int j = 0; j < bn; ++j)
-			{
-				x[j * n + i] = clone_b[j * m + i];
-			}
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(float));
 		}
 
-		delete[] clone_b;
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		sgbsv(n, kl, ku, nrhs, work, ldwork, ipiv, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int z_qr_solve_factored(int m, int n, int bn, doublecomplex r[], doublecomplex b[], doublecomplex tau[], doublecomplex x[], doublecomplex work[], int len)
+	DLLEXPORT int d_band_lu_solve(int n, int kl, int ku, int nrhs, double ab[], double b[])
+	try
 	{
-		char side ='L';
-		char tran = 'C';
-		char upper = 'U';
-		char not = 'N';
+		NativeStatsScope stats(STATS_d_band_lu_solve, native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		double* work = scratch.alloc<double>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(double));
+		for (int j = 0; j < n; ++j)
+		{
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(double));
+		}
+
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		dgbsv(n, kl, ku, nrhs, work, ldwork, ipiv, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		doublecomplex* clone_b = new doublecomplex[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(doublecomplex));
+	DLLEXPORT int c_band_lu_solve(int n, int kl, int ku, int nrhs, complex ab[], complex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_band_lu_solve, 4 * native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		complex* work = scratch.alloc<complex>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(complex));
+		for (int j = 0; j < n; ++j)
+		{
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(complex));
+		}
 
-		ZUNMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
-		doublecomplex one = {1.0, 0.0};
-		ztrsm(side, upper, not, not, n, bn, &one, r, m, clone_b, m);
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		cgbsv(n, kl, ku, nrhs, work, ldwork, ipiv, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		for (int i = 0; i < n; ++i)
+	DLLEXPORT int z_band_lu_solve(int n, int kl, int ku, int nrhs, doublecomplex ab[], doublecomplex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_band_lu_solve, 4 * native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		doublecomplex* work = scratch.alloc<doublecomplex>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(doublecomplex));
+		for (int j = 0; j < n; ++j)
 		{
-			for (int j = 0; j < bn; ++j)
-			{
-				x[j * n + i] = clone_b[j * m + i];
-			}
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(doublecomplex));
 		}
 
-		delete[] clone_b;
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		zgbsv(n, kl, ku, nrhs, work, ldwork, ipiv, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int s_svd_factor(bool compute_vectors, int m, int n, float a[], float s[], float u[], float v[], float work[], int len)
+	DLLEXPORT int s_band_cholesky_solve(int n, int kd, int nrhs, float ab[], float b[])
+	try
 	{
+		NativeStatsScope stats(STATS_s_band_cholesky_solve, native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		ScratchScope scratch;
+		int ld = kd + 1;
+		float* clone = scratch.alloc<float>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(float));
+		char uplo = 'L';
 		int info = 0;
-		char job = compute_vectors ? 'A' : 'N';
-		SGESVD(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info, 1, 1);
+		spbsv(uplo, n, kd, nrhs, clone, ld, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int d_svd_factor(bool compute_vectors, int m, int n, double a[], double s[], double u[], double v[], double work[], int len)
+	DLLEXPORT int d_band_cholesky_solve(int n, int kd, int nrhs, double ab[], double b[])
+	try
 	{
+		NativeStatsScope stats(STATS_d_band_cholesky_solve, native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		ScratchScope scratch;
+		int ld = kd + 1;
+		double* clone = scratch.alloc<double>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(double));
+		char uplo = 'L';
 		int info = 0;
-		char job = compute_vectors ? 'A' : 'N';
-		DGESVD(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info, 1, 1);
+		dpbsv(uplo, n, kd, nrhs, clone, ld, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int c_svd_factor(bool compute_vectors, int m, int n, complex a[], complex s[], complex u[], complex v[], complex work[], int len)
+	DLLEXPORT int c_band_cholesky_solve(int n, int kd, int nrhs, complex ab[], complex b[])
+	try
 	{
+		NativeStatsScope stats(STATS_c_band_cholesky_solve, 4 * native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		ScratchScope scratch;
+		int ld = kd + 1;
+		complex* clone = scratch.alloc<complex>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(complex));
+		char uplo = 'L';
 		int info = 0;
-		int dim_s = std::min(m,n);
-		float* rwork = new float[5 * dim_s];
-		float* s_local = new float[dim_s];
-		char job = compute_vectors ? 'A' : 'N';
-		CGESVD(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info, 1 ,1);
+		cpbsv(uplo, n, kd, nrhs, clone, ld, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		for(int index = 0; index < dim_s; ++index){
-			complex value = {s_local[index], 0.0f};
-			s[index] = value;
-		}
+	DLLEXPORT int z_band_cholesky_solve(int n, int kd, int nrhs, doublecomplex ab[], doublecomplex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_band_cholesky_solve, 4 * native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
 
-		delete[] rwork;
-		delete[] s_local;
+		ScratchScope scratch;
+		int ld = kd + 1;
+		doublecomplex* clone = scratch.alloc<doublecomplex>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(doublecomplex));
+		char uplo = 'L';
+		int info = 0;
+		zpbsv(uplo, n, kd, nrhs, clone, ld, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int z_svd_factor(bool compute_vectors, int m, int n, doublecomplex a[], doublecomplex s[], doublecomplex u[], doublecomplex v[], doublecomplex work[], int len)
+	DLLEXPORT int s_tridiagonal_solve(int n, int nrhs, float dl[], float d[], float du[], float b[])
+	try
 	{
+		NativeStatsScope stats(STATS_s_tridiagonal_solve, native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(3 * n);
+		float* dlw = dw + n;
+		float* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(float));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(float));
+		std::memcpy(duw, du, (n - 1) * sizeof(float));
 		int info = 0;
-		int dim_s = std::min(m,n);
-		double* rwork = new double[5 * std::min(m, n)];
-		double* s_local = new double[dim_s];
-		char job = compute_vectors ? 'A' : 'N';
-		ZGESVD(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info, 1, 1);
+		sgtsv(n, nrhs, dlw, dw, duw, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		for(int index = 0; index < dim_s; ++index){
-			doublecomplex value = {s_local[index], 0.0f};
-			s[index] = value;
-		}
+	DLLEXPORT int d_tridiagonal_solve(int n, int nrhs, double dl[], double d[], double du[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_tridiagonal_solve, native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(3 * n);
+		double* dlw = dw + n;
+		double* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(double));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(double));
+		std::memcpy(duw, du, (n - 1) * sizeof(double));
+		int info = 0;
+		dgtsv(n, nrhs, dlw, dw, duw, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		delete[] rwork;
-		delete[] s_local;
+	DLLEXPORT int c_tridiagonal_solve(int n, int nrhs, complex dl[], complex d[], complex du[], complex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_tridiagonal_solve, 4 * native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		complex* dw = scratch.alloc<complex>(3 * n);
+		complex* dlw = dw + n;
+		complex* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(complex));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(complex));
+		std::memcpy(duw, du, (n - 1) * sizeof(complex));
+		int info = 0;
+		cgtsv(n, nrhs, dlw, dw, duw, b, n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_tridiagonal_solve(int n, int nrhs, doublecomplex dl[], doublecomplex d[], doublecomplex du[], doublecomplex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_tridiagonal_solve, 4 * native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		doublecomplex* dw = scratch.alloc<doublecomplex>(3 * n);
+		doublecomplex* dlw = dw + n;
+		doublecomplex* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(doublecomplex));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(doublecomplex));
+		std::memcpy(duw, du, (n - 1) * sizeof(doublecomplex));
+		int info = 0;
+		zgtsv(n, nrhs, dlw, dw, duw, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_tridiagonal_solve_batch(int n, int nrhs, int count, float dl[], float d[], float du[], float b[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_tridiagonal_solve_batch, count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(3 * n);
+		float* dlw = dw + n;
+		float* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(float));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(float));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(float));
+			sgtsv(n, nrhs, dlw, dw, duw, b + k * n * nrhs, n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_tridiagonal_solve_batch(int n, int nrhs, int count, double dl[], double d[], double du[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_tridiagonal_solve_batch, count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(3 * n);
+		double* dlw = dw + n;
+		double* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(double));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(double));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(double));
+			dgtsv(n, nrhs, dlw, dw, duw, b + k * n * nrhs, n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_tridiagonal_solve_batch(int n, int nrhs, int count, complex dl[], complex d[], complex du[], complex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_tridiagonal_solve_batch, 4 * count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		complex* dw = scratch.alloc<complex>(3 * n);
+		complex* dlw = dw + n;
+		complex* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(complex));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(complex));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(complex));
+			cgtsv(n, nrhs, dlw, dw, duw, b + k * n * nrhs, n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_tridiagonal_solve_batch(int n, int nrhs, int count, doublecomplex dl[], doublecomplex d[], doublecomplex du[], doublecomplex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_tridiagonal_solve_batch, 4 * count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		doublecomplex* dw = scratch.alloc<doublecomplex>(3 * n);
+		doublecomplex* dlw = dw + n;
+		doublecomplex* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(doublecomplex));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(doublecomplex));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(doublecomplex));
+			zgtsv(n, nrhs, dlw, dw, duw, b + k * n * nrhs, n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_positive_definite_tridiagonal_solve(int n, int nrhs, float d[], float e[], float b[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_positive_definite_tridiagonal_solve, native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors, so factor copies.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(n);
+		std::memcpy(dw, d, n * sizeof(float));
+		float* ew = scratch.alloc<float>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(float));
+		int info = 0;
+		sptsv(n, nrhs, dw, ew, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_positive_definite_tridiagonal_solve(int n, int nrhs, double d[], double e[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_positive_definite_tridiagonal_solve, native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors, so factor copies.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(n);
+		std::memcpy(dw, d, n * sizeof(double));
+		double* ew = scratch.alloc<double>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(double));
+		int info = 0;
+		dptsv(n, nrhs, dw, ew, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_positive_definite_tridiagonal_solve(int n, int nrhs, complex d[], complex e[], complex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_positive_definite_tridiagonal_solve, 4 * native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors; the diagonal of a Hermitian matrix is real.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(n);
+		for (int i = 0; i < n; ++i)
+		{
+			dw[i] = d[i].real;
+		}
+		complex* ew = scratch.alloc<complex>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(complex));
+		int info = 0;
+		cptsv(n, nrhs, dw, ew, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_positive_definite_tridiagonal_solve(int n, int nrhs, doublecomplex d[], doublecomplex e[], doublecomplex b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_positive_definite_tridiagonal_solve, 4 * native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors; the diagonal of a Hermitian matrix is real.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(n);
+		for (int i = 0; i < n; ++i)
+		{
+			dw[i] = d[i].real;
+		}
+		doublecomplex* ew = scratch.alloc<doublecomplex>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(doublecomplex));
+		int info = 0;
+		zptsv(n, nrhs, dw, ew, b, n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_factor(int m, int n, float r[], float tau[], float q[], float work[], int len)
+	{
+		NativeStatsScope stats(STATS_s_qr_factor, native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n)), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		SGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			SORGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			SORGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int d_qr_factor(int m, int n, double r[], double tau[], double q[], double work[], int len)
+	{
+		NativeStatsScope stats(STATS_d_qr_factor, native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n)), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		DGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			DORGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			DORGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int c_qr_factor(int m, int n, complex r[], complex tau[], complex q[], complex work[], int len)
+	{
+		NativeStatsScope stats(STATS_c_qr_factor, 4 * (native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n))), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		CGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			CUNGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			CUNGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int z_qr_factor(int m, int n, doublecomplex r[], doublecomplex tau[], doublecomplex q[], doublecomplex work[], int len)
+	{
+		NativeStatsScope stats(STATS_z_qr_factor, 4 * (native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n))), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		ZGEQRF(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			ZUNGQR(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			ZUNGQR(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int s_qr_solve(int m, int n, int bn, float r[], float b[], float x[], float work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_s_qr_solve, native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		float* clone_r = scratch.alloc<float>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(float));
+
+		float* tau = scratch.alloc<float>(std::max(1, std::min(m,n)));
+		SGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		float* clone_b = scratch.alloc<float>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(float));
+
+		char side ='L';
+		char tran = 'T';
+		char upper = 'U';
+		char not = 'N';
+		SORMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		strsm(side, upper, not, not, n, bn, 1.0, clone_r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_qr_solve(int m, int n, int bn, double r[], double b[], double x[], double work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_d_qr_solve, native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		double* clone_r = scratch.alloc<double>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(double));
+
+		double* tau = scratch.alloc<double>(std::max(1, std::min(m,n)));
+		DGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		double* clone_b = scratch.alloc<double>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(double));
+
+		char side ='L';
+		char tran = 'T';
+		char upper = 'U';
+		char not = 'N';
+
+		DORMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		dtrsm(side, upper, not, not, n, bn, 1.0, clone_r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_qr_solve(int m, int n, int bn, complex r[], complex b[], complex x[], complex work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_c_qr_solve, 4 * (native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		complex* clone_r = scratch.alloc<complex>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(complex));
+
+		complex* tau = scratch.alloc<complex>(std::min(m,n));
+		CGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		char side ='L';
+		char tran = 'C';
+		char upper = 'U';
+		char not = 'N';
+
+		complex* clone_b = scratch.alloc<complex>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(complex));
+
+		CUNMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		complex one = {1.0, 0.0};
+		ctrsm(side, upper, not, not, n, bn, &one, clone_r, m, clone_b, m);
+
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_qr_solve(int m, int n, int bn, doublecomplex r[], doublecomplex b[], doublecomplex x[], doublecomplex work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_z_qr_solve, 4 * (native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		doublecomplex* clone_r = scratch.alloc<doublecomplex>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(doublecomplex));
+
+		doublecomplex* tau = scratch.alloc<doublecomplex>(std::min(m,n));
+		ZGEQRF(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		char side ='L';
+		char tran = 'C';
+		char upper = 'U';
+		char not = 'N';
+
+		doublecomplex* clone_b = scratch.alloc<doublecomplex>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(doublecomplex));
+
+		ZUNMQR(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		doublecomplex one = {1.0, 0.0};
+		ztrsm(side, upper, not, not, n, bn, &one, clone_r, m, clone_b, m);
+
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_solve_factored(int m, int n, int bn, float r[], float b[], float tau[], float x[], float work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_s_qr_solve_factored, native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'T';
+		char upper = 'U';
+		char not = 'N';
+		int info = 0;
+
+		float* clone_b = scratch.alloc<float>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(float));
+
+		SORMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		strsm(side, upper, not, not, n, bn, 1.0, r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_qr_solve_factored(int m, int n, int bn, double r[], double b[], double tau[], double x[], double work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_d_qr_solve_factored, native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'T';
+		char upper = 'U';
+		char not = 'N';
+		int info = 0;
+
+		double* clone_b = scratch.alloc<double>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(double));
+
+		DORMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		dtrsm(side, upper, not, not, n, bn, 1.0, r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_qr_solve_factored(int m, int n, int bn, complex r[], complex b[], complex tau[], complex x[], complex work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_c_qr_solve_factored, 4 * (native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'C';
+		char upper = 'U';
+		char not = 'N';
+		int info = 0;
+
+		complex* clone_b = scratch.alloc<complex>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(complex));
+
+		CUNMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		complex one = {1.0f, 0.0f};
+		ctrsm(side, upper, not, not, n, bn, &one, r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_qr_solve_factored(int m, int n, int bn, doublecomplex r[], doublecomplex b[], doublecomplex tau[], doublecomplex x[], doublecomplex work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_z_qr_solve_factored, 4 * (native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'C';
+		char upper = 'U';
+		char not = 'N';
+		int info = 0;
+
+		doublecomplex* clone_b = scratch.alloc<doublecomplex>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(doublecomplex));
+
+		ZUNMQR(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info, 1, 1);
+		doublecomplex one = {1.0, 0.0};
+		ztrsm(side, upper, not, not, n, bn, &one, r, m, clone_b, m);
+
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_factor_compact(int m, int n, float r[], float tau[])
+	{
+		NativeStatsScope stats(STATS_s_qr_factor_compact, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		int info = 0;
+		sgeqrf(m, n, r, m, tau, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int d_qr_factor_compact(int m, int n, double r[], double tau[])
+	{
+		NativeStatsScope stats(STATS_d_qr_factor_compact, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		int info = 0;
+		dgeqrf(m, n, r, m, tau, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int c_qr_factor_compact(int m, int n, complex r[], complex tau[])
+	{
+		NativeStatsScope stats(STATS_c_qr_factor_compact, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		int info = 0;
+		cgeqrf(m, n, r, m, tau, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int z_qr_factor_compact(int m, int n, doublecomplex r[], doublecomplex tau[])
+	{
+		NativeStatsScope stats(STATS_z_qr_factor_compact, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		int info = 0;
+		zgeqrf(m, n, r, m, tau, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int s_qr_factor_pivoted(int m, int n, float r[], float tau[], int jpvt[], int* rank)
+	{
+		NativeStatsScope stats(STATS_s_qr_factor_pivoted, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		int info = 0;
+		sgeqp3(m, n, r, m, jpvt, tau, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			float tolerance = std::max(m, n) * std::numeric_limits<float>::epsilon() * std::abs(r[0]);
+			while (*rank < k && std::abs(r[*rank * m + *rank]) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int d_qr_factor_pivoted(int m, int n, double r[], double tau[], int jpvt[], int* rank)
+	{
+		NativeStatsScope stats(STATS_d_qr_factor_pivoted, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		int info = 0;
+		dgeqp3(m, n, r, m, jpvt, tau, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			double tolerance = std::max(m, n) * std::numeric_limits<double>::epsilon() * std::abs(r[0]);
+			while (*rank < k && std::abs(r[*rank * m + *rank]) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int c_qr_factor_pivoted(int m, int n, complex r[], complex tau[], int jpvt[], int* rank)
+	{
+		NativeStatsScope stats(STATS_c_qr_factor_pivoted, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		int info = 0;
+		cgeqp3(m, n, r, m, jpvt, tau, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			float tolerance = std::max(m, n) * std::numeric_limits<float>::epsilon() * std::hypot(r[0].real, r[0].imag);
+			while (*rank < k && std::hypot(r[*rank * m + *rank].real, r[*rank * m + *rank].imag) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int z_qr_factor_pivoted(int m, int n, doublecomplex r[], doublecomplex tau[], int jpvt[], int* rank)
+	{
+		NativeStatsScope stats(STATS_z_qr_factor_pivoted, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		int info = 0;
+		zgeqp3(m, n, r, m, jpvt, tau, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			double tolerance = std::max(m, n) * std::numeric_limits<double>::epsilon() * std::hypot(r[0].real, r[0].imag);
+			while (*rank < k && std::hypot(r[*rank * m + *rank].real, r[*rank * m + *rank].imag) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int s_qr_apply_q(bool transpose, int m, int n, int bn, float r[], float tau[], float b[])
+	{
+		NativeStatsScope stats(STATS_s_qr_apply_q, native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		int k = std::min(m, n);
+		int info = 0;
+		sormqr('L', transpose ? 'T' : 'N', m, bn, k, r, m, tau, b, m, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int d_qr_apply_q(bool transpose, int m, int n, int bn, double r[], double tau[], double b[])
+	{
+		NativeStatsScope stats(STATS_d_qr_apply_q, native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		int k = std::min(m, n);
+		int info = 0;
+		dormqr('L', transpose ? 'T' : 'N', m, bn, k, r, m, tau, b, m, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int c_qr_apply_q(bool transpose, int m, int n, int bn, complex r[], complex tau[], complex b[])
+	{
+		NativeStatsScope stats(STATS_c_qr_apply_q, 4 * native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		int k = std::min(m, n);
+		int info = 0;
+		cunmqr('L', transpose ? 'C' : 'N', m, bn, k, r, m, tau, b, m, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int z_qr_apply_q(bool transpose, int m, int n, int bn, doublecomplex r[], doublecomplex tau[], doublecomplex b[])
+	{
+		NativeStatsScope stats(STATS_z_qr_apply_q, 4 * native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		int k = std::min(m, n);
+		int info = 0;
+		zunmqr('L', transpose ? 'C' : 'N', m, bn, k, r, m, tau, b, m, &info);
+
+		return info;
+	}
+
+	DLLEXPORT int s_least_squares(int m, int n, int bn, float a[], float b[], float x[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_least_squares, native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		float* clone_a = scratch.alloc<float>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(float));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		float* clone_b = scratch.alloc<float>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(float));
+		}
+
+		sgels('N', m, n, bn, clone_a, m, clone_b, ldb, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(float));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_least_squares(int m, int n, int bn, double a[], double b[], double x[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_least_squares, native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		double* clone_a = scratch.alloc<double>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(double));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		double* clone_b = scratch.alloc<double>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(double));
+		}
+
+		dgels('N', m, n, bn, clone_a, m, clone_b, ldb, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_least_squares(int m, int n, int bn, complex a[], complex b[], complex x[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_least_squares, 4 * native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		complex* clone_a = scratch.alloc<complex>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(complex));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		complex* clone_b = scratch.alloc<complex>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(complex));
+		}
+
+		cgels('N', m, n, bn, clone_a, m, clone_b, ldb, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(complex));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_least_squares(int m, int n, int bn, doublecomplex a[], doublecomplex b[], doublecomplex x[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_least_squares, 4 * native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		doublecomplex* clone_a = scratch.alloc<doublecomplex>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(doublecomplex));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		doublecomplex* clone_b = scratch.alloc<doublecomplex>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(doublecomplex));
+		}
+
+		zgels('N', m, n, bn, clone_a, m, clone_b, ldb, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(doublecomplex));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_svd_factor(bool compute_vectors, int m, int n, float a[], float s[], float u[], float v[], float work[], int len)
+	{
+		NativeStatsScope stats(STATS_s_svd_factor, native_stats::svd_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		int info = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		SGESVD(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info, 1, 1);
+		return info;
+	}
+
+	DLLEXPORT int d_svd_factor(bool compute_vectors, int m, int n, double a[], double s[], double u[], double v[], double work[], int len)
+	{
+		NativeStatsScope stats(STATS_d_svd_factor, native_stats::svd_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		int info = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		DGESVD(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info, 1, 1);
+		return info;
+	}
+
+	DLLEXPORT int c_svd_factor(bool compute_vectors, int m, int n, complex a[], complex s[], complex u[], complex v[], complex work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_c_svd_factor, 4 * (native_stats::svd_flops(compute_vectors, m, n)), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		int dim_s = std::min(m,n);
+		float* rwork = scratch.alloc<float>(5 * dim_s);
+		float* s_local = scratch.alloc<float>(dim_s);
+		char job = compute_vectors ? 'A' : 'N';
+		CGESVD(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info, 1 ,1);
+
+		for(int index = 0; index < dim_s; ++index){
+			complex value = {s_local[index], 0.0f};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_svd_factor(bool compute_vectors, int m, int n, doublecomplex a[], doublecomplex s[], doublecomplex u[], doublecomplex v[], doublecomplex work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_z_svd_factor, 4 * (native_stats::svd_flops(compute_vectors, m, n)), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		int dim_s = std::min(m,n);
+		double* rwork = scratch.alloc<double>(5 * std::min(m, n));
+		double* s_local = scratch.alloc<double>(dim_s);
+		char job = compute_vectors ? 'A' : 'N';
+		ZGESVD(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info, 1, 1);
+
+		for(int index = 0; index < dim_s; ++index){
+			doublecomplex value = {s_local[index], 0.0f};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, float a[], float s[], float u[], float vt[])
+	{
+		NativeStatsScope stats(STATS_s_svd_thin, native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, std::min(m, n)) : 1;
+		int info = 0;
+		if (divide_and_conquer)
+		{
+			sgesdd(job, m, n, a, m, s, u, ldu, vt, ldvt, &info);
+		}
+		else
+		{
+			sgesvd(job, job, m, n, a, m, s, u, ldu, vt, ldvt, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int d_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, double a[], double s[], double u[], double vt[])
+	{
+		NativeStatsScope stats(STATS_d_svd_thin, native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, std::min(m, n)) : 1;
+		int info = 0;
+		if (divide_and_conquer)
+		{
+			dgesdd(job, m, n, a, m, s, u, ldu, vt, ldvt, &info);
+		}
+		else
+		{
+			dgesvd(job, job, m, n, a, m, s, u, ldu, vt, ldvt, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int c_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, complex a[], complex s[], complex u[], complex vt[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_svd_thin, 4 * native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, k) : 1;
+		int info = 0;
+		float* s_local = scratch.alloc<float>(k);
+		if (divide_and_conquer)
+		{
+			cgesdd(job, m, n, a, m, s_local, u, ldu, vt, ldvt, &info);
+		}
+		else
+		{
+			cgesvd(job, job, m, n, a, m, s_local, u, ldu, vt, ldvt, &info);
+		}
+
+		for (int index = 0; index < k; ++index)
+		{
+			complex value = {s_local[index], 0.0f};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, doublecomplex a[], doublecomplex s[], doublecomplex u[], doublecomplex vt[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_svd_thin, 4 * native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, k) : 1;
+		int info = 0;
+		double* s_local = scratch.alloc<double>(k);
+		if (divide_and_conquer)
+		{
+			zgesdd(job, m, n, a, m, s_local, u, ldu, vt, ldvt, &info);
+		}
+		else
+		{
+			zgesvd(job, job, m, n, a, m, s_local, u, ldu, vt, ldvt, &info);
+		}
+
+		for (int index = 0; index < k; ++index)
+		{
+			doublecomplex value = {s_local[index], 0.0};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_svd_solve(int m, int n, int bn, float a[], float b[], float x[], float rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_s_svd_solve, native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		float* clone_a = scratch.alloc<float>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(float));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		float* clone_b = scratch.alloc<float>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(float));
+		}
+
+		float* s = scratch.alloc<float>(std::max(1, k));
+		sgelsd(m, n, bn, clone_a, m, clone_b, ldb, s, rcond, &rank, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(float));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_svd_solve(int m, int n, int bn, double a[], double b[], double x[], double rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_d_svd_solve, native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		double* clone_a = scratch.alloc<double>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(double));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		double* clone_b = scratch.alloc<double>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(double));
+		}
+
+		double* s = scratch.alloc<double>(std::max(1, k));
+		dgelsd(m, n, bn, clone_a, m, clone_b, ldb, s, rcond, &rank, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_svd_solve(int m, int n, int bn, complex a[], complex b[], complex x[], float rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_c_svd_solve, 4 * native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		complex* clone_a = scratch.alloc<complex>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(complex));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		complex* clone_b = scratch.alloc<complex>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(complex));
+		}
+
+		float* s = scratch.alloc<float>(std::max(1, k));
+		cgelsd(m, n, bn, clone_a, m, clone_b, ldb, s, rcond, &rank, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(complex));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_svd_solve(int m, int n, int bn, doublecomplex a[], doublecomplex b[], doublecomplex x[], double rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_z_svd_solve, 4 * native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		doublecomplex* clone_a = scratch.alloc<doublecomplex>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(doublecomplex));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		doublecomplex* clone_b = scratch.alloc<doublecomplex>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(doublecomplex));
+		}
+
+		double* s = scratch.alloc<double>(std::max(1, k));
+		zgelsd(m, n, bn, clone_a, m, clone_b, ldb, s, rcond, &rank, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(doublecomplex));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_symmetric_eigen(int n, float a[], float w[])
+	{
+		NativeStatsScope stats(STATS_s_symmetric_eigen, native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		ssyevd('V', 'L', n, a, n, w, &info);
+		return info;
+	}
+
+	DLLEXPORT int d_symmetric_eigen(int n, double a[], double w[])
+	{
+		NativeStatsScope stats(STATS_d_symmetric_eigen, native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		dsyevd('V', 'L', n, a, n, w, &info);
+		return info;
+	}
+
+	DLLEXPORT int c_hermitian_eigen(int n, complex a[], float w[])
+	{
+		NativeStatsScope stats(STATS_c_symmetric_eigen, 4 * native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		cheevd('V', 'L', n, a, n, w, &info);
+		return info;
+	}
+
+	DLLEXPORT int z_hermitian_eigen(int n, doublecomplex a[], double w[])
+	{
+		NativeStatsScope stats(STATS_z_symmetric_eigen, 4 * native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		zheevd('V', 'L', n, a, n, w, &info);
+		return info;
+	}
+
+	DLLEXPORT int s_eigen(bool compute_left, bool compute_right, int n, float a[], float wr[], float wi[], float vl[], float vr[])
+	{
+		NativeStatsScope stats(STATS_s_eigen, native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		int info = 0;
+		sgeev(compute_left ? 'V' : 'N', compute_right ? 'V' : 'N', n, a, n, wr, wi, vl, compute_left ? n : 1, vr, compute_right ? n : 1, &info);
+		return info;
+	}
+
+	DLLEXPORT int d_eigen(bool compute_left, bool compute_right, int n, double a[], double wr[], double wi[], double vl[], double vr[])
+	{
+		NativeStatsScope stats(STATS_d_eigen, native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		int info = 0;
+		dgeev(compute_left ? 'V' : 'N', compute_right ? 'V' : 'N', n, a, n, wr, wi, vl, compute_left ? n : 1, vr, compute_right ? n : 1, &info);
+		return info;
+	}
+
+	DLLEXPORT int c_eigen(bool compute_left, bool compute_right, int n, complex a[], complex w[], complex vl[], complex vr[])
+	{
+		NativeStatsScope stats(STATS_c_eigen, 4 * native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		int info = 0;
+		cgeev(compute_left ? 'V' : 'N', compute_right ? 'V' : 'N', n, a, n, w, vl, compute_left ? n : 1, vr, compute_right ? n : 1, &info);
+		return info;
+	}
+
+	DLLEXPORT int z_eigen(bool compute_left, bool compute_right, int n, doublecomplex a[], doublecomplex w[], doublecomplex vl[], doublecomplex vr[])
+	{
+		NativeStatsScope stats(STATS_z_eigen, 4 * native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		int info = 0;
+		zgeev(compute_left ? 'V' : 'N', compute_right ? 'V' : 'N', n, a, n, w, vl, compute_left ? n : 1, vr, compute_right ? n : 1, &info);
+		return info;
+	}
+
+	DLLEXPORT int s_schur(int n, float a[], float wr[], float wi[], float vs[])
+	{
+		NativeStatsScope stats(STATS_s_schur, native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		int sdim = 0;
+		sgees('V', 'N', NULL, n, a, n, &sdim, wr, wi, vs, n, &info);
+		return info;
+	}
+
+	DLLEXPORT int d_schur(int n, double a[], double wr[], double wi[], double vs[])
+	{
+		NativeStatsScope stats(STATS_d_schur, native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		int sdim = 0;
+		dgees('V', 'N', NULL, n, a, n, &sdim, wr, wi, vs, n, &info);
+		return info;
+	}
+
+	DLLEXPORT int c_schur(int n, complex a[], complex w[], complex vs[])
+	{
+		NativeStatsScope stats(STATS_c_schur, 4 * native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		int sdim = 0;
+		cgees('V', 'N', NULL, n, a, n, &sdim, w, vs, n, &info);
+		return info;
+	}
+
+	DLLEXPORT int z_schur(int n, doublecomplex a[], doublecomplex w[], doublecomplex vs[])
+	{
+		NativeStatsScope stats(STATS_z_schur, 4 * native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		int sdim = 0;
+		zgees('V', 'N', NULL, n, a, n, &sdim, w, vs, n, &info);
+		return info;
+	}
+
+	DLLEXPORT int s_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		float a = 0;
+		float query = 0;
+		SGETRI(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int d_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		double a = 0;
+		double query = 0;
+		DGETRI(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int c_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		complex a = {0.0f, 0.0f};
+		complex query = {0.0f, 0.0f};
+		CGETRI(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int z_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		doublecomplex a = {0.0, 0.0};
+		doublecomplex query = {0.0, 0.0};
+		ZGETRI(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int s_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		float a = 0;
+		float tau = 0;
+		float query = 0;
+		SGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		SORGQR(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int d_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		double a = 0;
+		double tau = 0;
+		double query = 0;
+		DGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		DORGQR(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int c_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		complex a = {0.0f, 0.0f};
+		complex tau = {0.0f, 0.0f};
+		complex query = {0.0f, 0.0f};
+		CGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		CUNGQR(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int z_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		doublecomplex a = {0.0, 0.0};
+		doublecomplex tau = {0.0, 0.0};
+		doublecomplex query = {0.0, 0.0};
+		ZGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		ZUNGQR(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int s_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		float a = 0;
+		float tau = 0;
+		float b = 0;
+		float query = 0;
+		SGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		char side ='L';
+		char tran = 'T';
+		SORMQR(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info, 1, 1);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int d_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		double a = 0;
+		double tau = 0;
+		double b = 0;
+		double query = 0;
+		DGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		char side ='L';
+		char tran = 'T';
+		DORMQR(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info, 1, 1);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int c_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		complex a = {0.0f, 0.0f};
+		complex tau = {0.0f, 0.0f};
+		complex b = {0.0f, 0.0f};
+		complex query = {0.0f, 0.0f};
+		CGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		char side ='L';
+		char tran = 'C';
+		CUNMQR(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info, 1, 1);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int z_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		doublecomplex a = {0.0, 0.0};
+		doublecomplex tau = {0.0, 0.0};
+		doublecomplex b = {0.0, 0.0};
+		doublecomplex query = {0.0, 0.0};
+		ZGEQRF(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		char side ='L';
+		char tran = 'C';
+		ZUNMQR(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info, 1, 1);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int s_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		float a = 0;
+		float s = 0;
+		float u = 0;
+		float v = 0;
+		float query = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		SGESVD(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &info, 1, 1);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int d_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		double a = 0;
+		double s = 0;
+		double u = 0;
+		double v = 0;
+		double query = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		DGESVD(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &info, 1, 1);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int c_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		complex a = {0.0f, 0.0f};
+		complex u = {0.0f, 0.0f};
+		complex v = {0.0f, 0.0f};
+		complex query = {0.0f, 0.0f};
+		float s = 0;
+		float rwork = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		CGESVD(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &rwork, &info, 1, 1);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int z_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		doublecomplex a = {0.0, 0.0};
+		doublecomplex u = {0.0, 0.0};
+		doublecomplex v = {0.0, 0.0};
+		doublecomplex query = {0.0, 0.0};
+		double s = 0;
+		double rwork = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		ZGESVD(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &rwork, &info, 1, 1);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int s_lu_factor_ld(int m, float a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_s_lu_factor_ld, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		SGETRF(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int d_lu_factor_ld(int m, double a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_d_lu_factor_ld, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		DGETRF(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int c_lu_factor_ld(int m, complex a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_c_lu_factor_ld, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		CGETRF(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int z_lu_factor_ld(int m, doublecomplex a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_z_lu_factor_ld, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		ZGETRF(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int s_lu_solve_factored_ld(int n, int nrhs, float a[], int a_offset, int lda, int ipiv[], float b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_s_lu_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		SGETRS(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info, 1);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int d_lu_solve_factored_ld(int n, int nrhs, double a[], int a_offset, int lda, int ipiv[], double b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_d_lu_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		DGETRS(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info, 1);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int c_lu_solve_factored_ld(int n, int nrhs, complex a[], int a_offset, int lda, int ipiv[], complex b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_c_lu_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		CGETRS(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info, 1);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int z_lu_solve_factored_ld(int n, int nrhs, doublecomplex a[], int a_offset, int lda, int ipiv[], doublecomplex b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_z_lu_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		ZGETRS(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info, 1);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int s_cholesky_factor_ld(int n, float a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_factor_ld, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		float* block = a + offset;
+		SPOTRF(&uplo, &n, block, &lda, &info, 1);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = 0;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int d_cholesky_factor_ld(int n, double a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_factor_ld, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		double* block = a + offset;
+		DPOTRF(&uplo, &n, block, &lda, &info, 1);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = 0;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int c_cholesky_factor_ld(int n, complex a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_factor_ld, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		complex zero = {0.0f, 0.0f};
+		complex* block = a + offset;
+		CPOTRF(&uplo, &n, block, &lda, &info, 1);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = zero;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int z_cholesky_factor_ld(int n, doublecomplex a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_factor_ld, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		doublecomplex zero = {0.0, 0.0};
+		doublecomplex* block = a + offset;
+		ZPOTRF(&uplo, &n, block, &lda, &info, 1);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = zero;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int s_cholesky_solve_factored_ld(int n, int nrhs, float a[], int a_offset, int lda, float b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		SPOTRS(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info, 1);
+		return info;
+	}
+
+	DLLEXPORT int d_cholesky_solve_factored_ld(int n, int nrhs, double a[], int a_offset, int lda, double b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		DPOTRS(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info, 1);
+		return info;
+	}
+
+	DLLEXPORT int c_cholesky_solve_factored_ld(int n, int nrhs, complex a[], int a_offset, int lda, complex b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		CPOTRS(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info, 1);
+		return info;
+	}
+
+	DLLEXPORT int z_cholesky_solve_factored_ld(int n, int nrhs, doublecomplex a[], int a_offset, int lda, doublecomplex b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		ZPOTRS(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info, 1);
+		return info;
+	}
+
+	// The batched routines run the single-matrix export on every item of a strided batch, spreading the
+	// items over OpenMP threads. They return the one-based index of the first item whose LAPACK call
+	// reported an error, or zero.
+
+	DLLEXPORT int s_lu_factor_batch(int n, float a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_s_lu_factor_batch, batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_lu_factor_batch(int n, double a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_d_lu_factor_batch, batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_lu_factor_batch(int n, complex a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_c_lu_factor_batch, 4 * batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_lu_factor_batch(int n, doublecomplex a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_z_lu_factor_batch, 4 * batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int s_lu_solve_factored_batch(int n, int nrhs, float a[], int a_stride, int ipiv[], float b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_s_lu_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_lu_solve_factored_batch(int n, int nrhs, double a[], int a_stride, int ipiv[], double b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_d_lu_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_lu_solve_factored_batch(int n, int nrhs, complex a[], int a_stride, int ipiv[], complex b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_c_lu_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_lu_solve_factored_batch(int n, int nrhs, doublecomplex a[], int a_stride, int ipiv[], doublecomplex b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_z_lu_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int s_cholesky_factor_batch(int n, float a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_factor_batch, batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_cholesky_factor_batch(int n, double a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_factor_batch, batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_cholesky_factor_batch(int n, complex a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_factor_batch, 4 * batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_cholesky_factor_batch(int n, doublecomplex a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_factor_batch, 4 * batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int s_cholesky_solve_factored_batch(int n, int nrhs, float a[], int a_stride, float b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_cholesky_solve_factored_batch(int n, int nrhs, double a[], int a_stride, double b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_cholesky_solve_factored_batch(int n, int nrhs, complex a[], int a_stride, complex b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_cholesky_solve_factored_batch(int n, int nrhs, doublecomplex a[], int a_stride, doublecomplex b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
 }
\ No newline at end of file
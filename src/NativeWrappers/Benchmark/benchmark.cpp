@@ -0,0 +1,556 @@
+// Micro-benchmark of the native wrapper exports.
+//
+// The wrapper library is loaded at run time, so one executable measures any backend (MKL,
+// OpenBLAS, GotoBLAS2, ACML); exports the library lacks are skipped. Every export is timed one
+// call at a time over a sweep of orders n and the four element types, and the table reports
+// latency percentiles and the rate at the median in GFLOP/s. The vector exports work on n*n
+// elements, so a row touches as much data as the matrix exports of the same n.
+//
+// The flop counts are those of Common/stats.h, with four real flops per complex one.
+//
+// usage: NativeBenchmark [--library path] [--sizes 4,8,...] [--types sdcz] [--exports name,...]
+//                        [--samples count] [--budget seconds] [--nrhs count]
+//                        [--format csv|json] [--output file]
+
+#include "stats.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <dlfcn.h>
+#endif
+
+#ifndef BENCHMARK_DEFAULT_LIBRARY
+	#ifdef _WIN32
+		#define BENCHMARK_DEFAULT_LIBRARY "MathNET.Numerics.MKL.dll"
+	#else
+		#define BENCHMARK_DEFAULT_LIBRARY "./MathNET.Numerics.MKL.dll.so"
+	#endif
+#endif
+
+namespace
+{
+	// Layout-compatible with the complex types of every backend.
+	struct complex8 { float real, imag; };
+	struct complex16 { double real, imag; };
+
+	const int CblasNoTrans = 111;
+
+	template<typename T> struct Element;
+
+	template<> struct Element<float>
+	{
+		static const char prefix = 's';
+		static const int flop_factor = 1;
+		static float make(double real, double) { return (float)real; }
+	};
+
+	template<> struct Element<double>
+	{
+		static const char prefix = 'd';
+		static const int flop_factor = 1;
+		static double make(double real, double) { return real; }
+	};
+
+	template<> struct Element<complex8>
+	{
+		static const char prefix = 'c';
+		static const int flop_factor = 4;
+		static complex8 make(double real, double imag) { complex8 value = { (float)real, (float)imag }; return value; }
+	};
+
+	template<> struct Element<complex16>
+	{
+		static const char prefix = 'z';
+		static const int flop_factor = 4;
+		static complex16 make(double real, double imag) { complex16 value = { real, imag }; return value; }
+	};
+
+	class Library
+	{
+	public:
+		explicit Library(const char* path)
+		{
+#ifdef _WIN32
+			handle = LoadLibraryA(path);
+#else
+			handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+#endif
+		}
+
+		~Library()
+		{
+			if (handle != 0)
+			{
+#ifdef _WIN32
+				FreeLibrary(handle);
+#else
+				dlclose(handle);
+#endif
+			}
+		}
+
+		bool loaded() const
+		{
+			return handle != 0;
+		}
+
+		template<typename F>
+		bool find(const std::string& name, F& function) const
+		{
+#ifdef _WIN32
+			function = reinterpret_cast<F>(GetProcAddress(handle, name.c_str()));
+#else
+			function = reinterpret_cast<F>(dlsym(handle, name.c_str()));
+#endif
+			return function != 0;
+		}
+
+	private:
+		Library(const Library&);
+		Library& operator=(const Library&);
+
+#ifdef _WIN32
+		HMODULE handle;
+#else
+		void* handle;
+#endif
+	};
+
+	struct Options
+	{
+		std::string library;
+		std::vector<int> sizes;
+		std::string types;
+		std::vector<std::string> exports;
+		int samples;
+		double budget;
+		int nrhs;
+		bool json;
+		std::string output;
+	};
+
+	struct Result
+	{
+		std::string export_name;
+		char type;
+		int n;
+		int samples;
+		double min_us;
+		double p50_us;
+		double p90_us;
+		double p99_us;
+		double gflops;
+	};
+
+	// One measurement: prepare restores the inputs outside the timed region, run is timed.
+	struct Case
+	{
+		std::string name;
+		double flops;
+		std::function<void()> prepare;
+		std::function<void()> run;
+	};
+
+	bool selected(const Options& options, const std::string& operation)
+	{
+		return options.exports.empty() || std::find(options.exports.begin(), options.exports.end(), operation) != options.exports.end();
+	}
+
+	double percentile(const std::vector<double>& sorted, double p)
+	{
+		size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+		return sorted[std::min(index, sorted.size() - 1)];
+	}
+
+	Result measure(const Options& options, char type, int n, const Case& c)
+	{
+		typedef std::chrono::steady_clock clock;
+
+		c.prepare();
+		clock::time_point start = clock::now();
+		c.run();
+		double warmup = std::chrono::duration<double>(clock::now() - start).count();
+
+		int samples = options.samples;
+		if (warmup > 0 && warmup * samples > options.budget)
+		{
+			samples = std::max(3, (int)(options.budget / warmup));
+		}
+
+		std::vector<double> times;
+		times.reserve(samples);
+		for (int i = 0; i < samples; ++i)
+		{
+			c.prepare();
+			start = clock::now();
+			c.run();
+			times.push_back(std::chrono::duration<double, std::micro>(clock::now() - start).count());
+		}
+
+		std::sort(times.begin(), times.end());
+
+		Result result;
+		result.export_name = c.name;
+		result.type = type;
+		result.n = n;
+		result.samples = samples;
+		result.min_us = times.front();
+		result.p50_us = percentile(times, 0.5);
+		result.p90_us = percentile(times, 0.9);
+		result.p99_us = percentile(times, 0.99);
+		result.gflops = result.p50_us > 0 ? c.flops / (result.p50_us * 1e3) : 0.0;
+		return result;
+	}
+
+	// Benchmarks every export of one element type that the library has.
+	template<typename T>
+	void run_type(const Library& library, const Options& options, std::vector<Result>& results)
+	{
+		typedef Element<T> E;
+		const std::string prefix(1, E::prefix);
+		const double factor = E::flop_factor;
+
+		void (*axpy)(int, T, const T*, T*) = 0;
+		T (*dot_product)(int, const T*, const T*) = 0;
+		void (*matrix_multiply)(int, int, int, int, int, T, const T*, const T*, T, T*) = 0;
+		int (*lu_factor)(int, T*, int*) = 0;
+		int (*lu_solve)(int, int, T*, T*) = 0;
+		int (*cholesky_factor)(int, T*) = 0;
+		int (*cholesky_solve)(int, int, T*, T*) = 0;
+		int (*qr_factor)(int, int, T*, T*, T*, T*, int) = 0;
+		int (*qr_factor_workspace)(int, int) = 0;
+		int (*qr_solve)(int, int, int, T*, T*, T*, T*, int) = 0;
+		int (*qr_solve_workspace)(int, int, int) = 0;
+		int (*svd_factor)(bool, int, int, T*, T*, T*, T*, T*, int) = 0;
+		int (*svd_workspace)(bool, int, int) = 0;
+
+		const bool has_axpy = library.find(prefix + "_axpy", axpy) && selected(options, "axpy");
+		const bool has_dot = library.find(prefix + "_dot_product", dot_product) && selected(options, "dot_product");
+		const bool has_gemm = library.find(prefix + "_matrix_multiply", matrix_multiply) && selected(options, "matrix_multiply");
+		const bool has_lu_factor = library.find(prefix + "_lu_factor", lu_factor) && selected(options, "lu_factor");
+		const bool has_lu_solve = library.find(prefix + "_lu_solve", lu_solve) && selected(options, "lu_solve");
+		const bool has_cholesky_factor = library.find(prefix + "_cholesky_factor", cholesky_factor) && selected(options, "cholesky_factor");
+		const bool has_cholesky_solve = library.find(prefix + "_cholesky_solve", cholesky_solve) && selected(options, "cholesky_solve");
+		const bool has_qr_factor = library.find(prefix + "_qr_factor", qr_factor) && library.find(prefix + "_qr_factor_workspace", qr_factor_workspace) && selected(options, "qr_factor");
+		const bool has_qr_solve = library.find(prefix + "_qr_solve", qr_solve) && library.find(prefix + "_qr_solve_workspace", qr_solve_workspace) && selected(options, "qr_solve");
+		const bool has_svd = library.find(prefix + "_svd_factor", svd_factor) && library.find(prefix + "_svd_workspace", svd_workspace) && selected(options, "svd_factor");
+
+		std::mt19937 random(42);
+		std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+
+		for (size_t s = 0; s < options.sizes.size(); ++s)
+		{
+			const int n = options.sizes[s];
+			const int nn = n * n;
+			const int nrhs = options.nrhs;
+
+			std::vector<T> a(nn), b(nn), c(nn), work_a(nn);
+			std::vector<T> rhs(n * nrhs), work_rhs(n * nrhs), x(n * nrhs);
+			std::vector<T> spd(nn), q(nn), u(nn), v(nn), tau(n), singular(n);
+			std::vector<int> ipiv(n);
+			for (int i = 0; i < nn; ++i)
+			{
+				a[i] = E::make(uniform(random), uniform(random));
+				b[i] = E::make(uniform(random), uniform(random));
+			}
+
+			for (int i = 0; i < n * nrhs; ++i)
+			{
+				rhs[i] = E::make(uniform(random), uniform(random));
+			}
+
+			// Hermitian and strictly diagonally dominant with a positive diagonal, hence positive definite.
+			for (int j = 0; j < n; ++j)
+			{
+				spd[j * n + j] = E::make(n + 1.0, 0.0);
+				for (int i = j + 1; i < n; ++i)
+				{
+					const double real = uniform(random);
+					const double imag = uniform(random);
+					spd[j * n + i] = E::make(real, imag);
+					spd[i * n + j] = E::make(real, -imag);
+				}
+			}
+
+			// a is dense with random entries, which is nonsingular with probability one; the
+			// exports are timed whatever info they return.
+			T* pa = &a[0];
+			T* pb = &b[0];
+			T* pc = &c[0];
+			T* pwork = &work_a[0];
+			T* prhs = &rhs[0];
+			T* pwork_rhs = &work_rhs[0];
+			T* px = &x[0];
+			T* pspd = &spd[0];
+			T* pq = &q[0];
+			T* pu = &u[0];
+			T* pv = &v[0];
+			T* ptau = &tau[0];
+			T* psingular = &singular[0];
+			int* pipiv = &ipiv[0];
+			const size_t matrix_bytes = nn * sizeof(T);
+			const size_t rhs_bytes = n * nrhs * sizeof(T);
+
+			std::function<void()> restore_matrix = [=]() { std::memcpy(pwork, pa, matrix_bytes); };
+			std::function<void()> restore_spd = [=]() { std::memcpy(pwork, pspd, matrix_bytes); };
+			std::function<void()> restore_rhs = [=]() { std::memcpy(pwork_rhs, prhs, rhs_bytes); };
+			std::function<void()> nothing = []() {};
+
+			std::vector<Case> cases;
+			if (has_axpy)
+			{
+				const T alpha = E::make(1e-3, 0.0);
+				Case item = { prefix + "_axpy", factor * 2.0 * nn, nothing, [=]() { axpy(nn, alpha, pa, pc); } };
+				cases.push_back(item);
+			}
+
+			if (has_dot)
+			{
+				Case item = { prefix + "_dot_product", factor * 2.0 * nn, nothing, [=]() { volatile T result = dot_product(nn, pa, pb); (void)result; } };
+				cases.push_back(item);
+			}
+
+			if (has_gemm)
+			{
+				const T one = E::make(1.0, 0.0);
+				const T zero = E::make(0.0, 0.0);
+				Case item = { prefix + "_matrix_multiply", factor * 2.0 * n * n * (double)n, nothing,
+					[=]() { matrix_multiply(CblasNoTrans, CblasNoTrans, n, n, n, one, pa, pb, zero, pc); } };
+				cases.push_back(item);
+			}
+
+			if (has_lu_factor)
+			{
+				Case item = { prefix + "_lu_factor", factor * native_stats::lu_factor_flops(n), restore_matrix, [=]() { lu_factor(n, pwork, pipiv); } };
+				cases.push_back(item);
+			}
+
+			if (has_lu_solve)
+			{
+				Case item = { prefix + "_lu_solve", factor * (native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), restore_rhs,
+					[=]() { lu_solve(n, nrhs, pa, pwork_rhs); } };
+				cases.push_back(item);
+			}
+
+			if (has_cholesky_factor)
+			{
+				Case item = { prefix + "_cholesky_factor", factor * native_stats::cholesky_factor_flops(n), restore_spd, [=]() { cholesky_factor(n, pwork); } };
+				cases.push_back(item);
+			}
+
+			if (has_cholesky_solve)
+			{
+				Case item = { prefix + "_cholesky_solve", factor * (native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), restore_rhs,
+					[=]() { cholesky_solve(n, nrhs, pspd, pwork_rhs); } };
+				cases.push_back(item);
+			}
+
+			if (has_qr_factor)
+			{
+				const int len = qr_factor_workspace(n, n);
+				std::shared_ptr<std::vector<T> > work(new std::vector<T>(std::max(1, len)));
+				Case item = { prefix + "_qr_factor", factor * (native_stats::qr_factor_flops(n, n) + native_stats::qr_apply_flops(n, n, n)), restore_matrix,
+					[=]() { qr_factor(n, n, pwork, ptau, pq, &(*work)[0], len); } };
+				cases.push_back(item);
+			}
+
+			if (has_qr_solve)
+			{
+				const int len = qr_solve_workspace(n, n, nrhs);
+				std::shared_ptr<std::vector<T> > work(new std::vector<T>(std::max(1, len)));
+				Case item = { prefix + "_qr_solve", factor * (native_stats::qr_factor_flops(n, n) + native_stats::qr_apply_flops(n, nrhs, n) + n * (double)n * nrhs), restore_matrix,
+					[=]() { qr_solve(n, n, nrhs, pwork, prhs, px, &(*work)[0], len); } };
+				cases.push_back(item);
+			}
+
+			if (has_svd)
+			{
+				const int len = svd_workspace(true, n, n);
+				std::shared_ptr<std::vector<T> > work(new std::vector<T>(std::max(1, len)));
+				Case item = { prefix + "_svd_factor", factor * native_stats::svd_flops(true, n, n), restore_matrix,
+					[=]() { svd_factor(true, n, n, pwork, psingular, pu, pv, &(*work)[0], len); } };
+				cases.push_back(item);
+			}
+
+			for (size_t i = 0; i < cases.size(); ++i)
+			{
+				results.push_back(measure(options, E::prefix, n, cases[i]));
+				std::fprintf(stderr, "%s n=%d\n", cases[i].name.c_str(), n);
+			}
+		}
+	}
+
+	std::vector<std::string> split(const std::string& list)
+	{
+		std::vector<std::string> items;
+		size_t start = 0;
+		while (start <= list.size())
+		{
+			size_t end = list.find(',', start);
+			if (end == std::string::npos)
+			{
+				end = list.size();
+			}
+
+			if (end > start)
+			{
+				items.push_back(list.substr(start, end - start));
+			}
+
+			start = end + 1;
+		}
+
+		return items;
+	}
+
+	std::string backend_name(const std::string& path)
+	{
+		size_t slash = path.find_last_of("/\\");
+		return slash == std::string::npos ? path : path.substr(slash + 1);
+	}
+
+	void write_csv(FILE* file, const std::string& backend, const std::vector<Result>& results)
+	{
+		std::fprintf(file, "backend,export,type,n,samples,min_us,p50_us,p90_us,p99_us,gflops\n");
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const Result& r = results[i];
+			std::fprintf(file, "%s,%s,%c,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f\n", backend.c_str(), r.export_name.c_str(), r.type, r.n, r.samples,
+				r.min_us, r.p50_us, r.p90_us, r.p99_us, r.gflops);
+		}
+	}
+
+	void write_json(FILE* file, const std::string& backend, const std::vector<Result>& results)
+	{
+		std::string escaped;
+		for (size_t i = 0; i < backend.size(); ++i)
+		{
+			if (backend[i] == '"' || backend[i] == '\\')
+			{
+				escaped += '\\';
+			}
+
+			escaped += backend[i];
+		}
+
+		std::fprintf(file, "{\n  \"backend\": \"%s\",\n  \"results\": [\n", escaped.c_str());
+		for (size_t i = 0; i < results.size(); ++i)
+		{
+			const Result& r = results[i];
+			std::fprintf(file, "    {\"export\": \"%s\", \"type\": \"%c\", \"n\": %d, \"samples\": %d, \"min_us\": %.3f, \"p50_us\": %.3f, \"p90_us\": %.3f, \"p99_us\": %.3f, \"gflops\": %.3f}%s\n",
+				r.export_name.c_str(), r.type, r.n, r.samples, r.min_us, r.p50_us, r.p90_us, r.p99_us, r.gflops, i + 1 < results.size() ? "," : "");
+		}
+
+		std::fprintf(file, "  ]\n}\n");
+	}
+
+	int usage()
+	{
+		std::fprintf(stderr,
+			"usage: NativeBenchmark [--library path] [--sizes 4,8,...] [--types sdcz] [--exports name,...]\n"
+			"                       [--samples count] [--budget seconds] [--nrhs count]\n"
+			"                       [--format csv|json] [--output file]\n"
+			"exports: axpy dot_product matrix_multiply lu_factor lu_solve cholesky_factor\n"
+			"         cholesky_solve qr_factor qr_solve svd_factor\n");
+		return 2;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	options.library = BENCHMARK_DEFAULT_LIBRARY;
+	options.types = "sdcz";
+	options.samples = 100;
+	options.budget = 1.0;
+	options.nrhs = 1;
+	options.json = false;
+
+	std::string sizes = "2,4,8,16,32,64,128,256,512";
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string option = argv[i];
+		if (i + 1 >= argc)
+		{
+			return usage();
+		}
+
+		const std::string value = argv[++i];
+		if (option == "--library") options.library = value;
+		else if (option == "--sizes") sizes = value;
+		else if (option == "--types") options.types = value;
+		else if (option == "--exports") options.exports = split(value);
+		else if (option == "--samples") options.samples = std::atoi(value.c_str());
+		else if (option == "--budget") options.budget = std::atof(value.c_str());
+		else if (option == "--nrhs") options.nrhs = std::atoi(value.c_str());
+		else if (option == "--format" && (value == "csv" || value == "json")) options.json = value == "json";
+		else if (option == "--output") options.output = value;
+		else return usage();
+	}
+
+	std::vector<std::string> size_list = split(sizes);
+	for (size_t i = 0; i < size_list.size(); ++i)
+	{
+		const int n = std::atoi(size_list[i].c_str());
+		if (n < 1)
+		{
+			return usage();
+		}
+
+		options.sizes.push_back(n);
+	}
+
+	if (options.sizes.empty() || options.samples < 1 || options.nrhs < 1 || options.budget <= 0)
+	{
+		return usage();
+	}
+
+	Library library(options.library.c_str());
+	if (!library.loaded())
+	{
+		std::fprintf(stderr, "cannot load %s\n", options.library.c_str());
+		return 1;
+	}
+
+	std::vector<Result> results;
+	if (options.types.find('s') != std::string::npos) run_type<float>(library, options, results);
+	if (options.types.find('d') != std::string::npos) run_type<double>(library, options, results);
+	if (options.types.find('c') != std::string::npos) run_type<complex8>(library, options, results);
+	if (options.types.find('z') != std::string::npos) run_type<complex16>(library, options, results);
+
+	FILE* file = options.output.empty() ? stdout : std::fopen(options.output.c_str(), "w");
+	if (file == 0)
+	{
+		std::fprintf(stderr, "cannot write %s\n", options.output.c_str());
+		return 1;
+	}
+
+	const std::string backend = backend_name(options.library);
+	if (options.json)
+	{
+		write_json(file, backend, results);
+	}
+	else
+	{
+		write_csv(file, backend, results);
+	}
+
+	if (file != stdout)
+	{
+		std::fclose(file);
+	}
+
+	return 0;
+}
@@ -2,7 +2,12 @@
 	#define VC_EXTRALEAN
 #endif
 #include "windows.h"
+#include "scratch.h"
 	
-BOOL APIENTRY DllMain( HANDLE, DWORD, LPVOID ){
+BOOL APIENTRY DllMain( HANDLE, DWORD reason, LPVOID ){
+	if (reason == DLL_THREAD_DETACH || reason == DLL_PROCESS_DETACH){
+		scratch_release();
+	}
+
 	return TRUE;
 }
@@ -0,0 +1,180 @@
+#include "wrapper_common.h"
+#include "scratch.h"
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+	#include <malloc.h>
+#endif
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+	#define SCRATCH_THREAD_LOCAL __declspec(thread)
+#else
+	#define SCRATCH_THREAD_LOCAL thread_local
+	#define SCRATCH_THREAD_EXIT_GUARD
+#endif
+
+namespace
+{
+	const size_t alignment = 64;
+	const size_t minimum_capacity = 64 * 1024;
+
+	struct Chunk
+	{
+		Chunk* previous;
+		char* data;
+		size_t capacity;
+		size_t used;
+	};
+
+	// Plain data so that it also works with __declspec(thread).
+	struct Arena
+	{
+		Chunk* top;
+		int depth;
+		size_t retired;
+	};
+
+	SCRATCH_THREAD_LOCAL Arena arena;
+
+#ifdef SCRATCH_THREAD_EXIT_GUARD
+	// Hands the arena back when a thread exits. Older compilers rely on DllMain instead.
+	struct ArenaGuard
+	{
+		~ArenaGuard()
+		{
+			scratch_release();
+		}
+	};
+
+	SCRATCH_THREAD_LOCAL ArenaGuard guard;
+#endif
+
+	size_t round_up(size_t bytes)
+	{
+		return (bytes + alignment - 1) & ~(alignment - 1);
+	}
+
+	Chunk* new_chunk(size_t capacity, Chunk* previous)
+	{
+		void* data = 0;
+#ifdef _WIN32
+		data = _aligned_malloc(capacity, alignment);
+#else
+		if (posix_memalign(&data, alignment, capacity) != 0){
+			data = 0;
+		}
+#endif
+		Chunk* chunk = static_cast<Chunk*>(std::malloc(sizeof(Chunk)));
+		if (data == 0 || chunk == 0){
+#ifdef _WIN32
+			_aligned_free(data);
+#else
+			std::free(data);
+#endif
+			std::free(chunk);
+			throw std::bad_alloc();
+		}
+
+		chunk->previous = previous;
+		chunk->data = static_cast<char*>(data);
+		chunk->capacity = capacity;
+		chunk->used = 0;
+		return chunk;
+	}
+
+	void free_chunk(Chunk* chunk)
+	{
+#ifdef _WIN32
+		_aligned_free(chunk->data);
+#else
+		std::free(chunk->data);
+#endif
+		std::free(chunk);
+	}
+}
+
+ScratchScope::ScratchScope()
+{
+#ifdef SCRATCH_THREAD_EXIT_GUARD
+	(void)&guard;
+#endif
+	++arena.depth;
+	mark_chunk = arena.top;
+	mark_used = arena.top != 0 ? arena.top->used : 0;
+}
+
+ScratchScope::~ScratchScope()
+{
+	// Chunks taken while this scope was open are dropped, but their size is remembered.
+	while (arena.top != mark_chunk){
+		Chunk* chunk = arena.top;
+		arena.top = chunk->previous;
+		arena.retired += chunk->capacity;
+		free_chunk(chunk);
+	}
+
+	if (arena.top != 0){
+		arena.top->used = mark_used;
+	}
+
+	// Once the outermost scope closes, fold everything into one chunk big enough for the whole call.
+	if (--arena.depth == 0 && arena.retired > 0){
+		size_t capacity = arena.retired;
+		if (arena.top != 0){
+			capacity += arena.top->capacity;
+			free_chunk(arena.top);
+			arena.top = 0;
+		}
+
+		arena.retired = 0;
+		try{
+			arena.top = new_chunk(capacity, 0);
+		}
+		catch (const std::bad_alloc&){
+			arena.top = 0;
+		}
+	}
+}
+
+void* ScratchScope::allocate(size_t bytes)
+{
+	bytes = round_up(bytes == 0 ? 1 : bytes);
+
+	Chunk* top = arena.top;
+	if (top == 0 || top->used + bytes > top->capacity){
+		size_t capacity = bytes > minimum_capacity ? bytes : minimum_capacity;
+		if (top != 0 && capacity < 2 * top->capacity){
+			capacity = 2 * top->capacity;
+		}
+
+		top = new_chunk(capacity, top);
+		arena.top = top;
+	}
+
+	void* p = top->data + top->used;
+	top->used += bytes;
+	return p;
+}
+
+void scratch_release()
+{
+	if (arena.depth != 0){
+		return;
+	}
+
+	while (arena.top != 0){
+		Chunk* chunk = arena.top;
+		arena.top = chunk->previous;
+		free_chunk(chunk);
+	}
+
+	arena.retired = 0;
+}
+
+extern "C"{
+	DLLEXPORT void native_release_scratch()
+	{
+		scratch_release();
+	}
+}
@@ -0,0 +1,45 @@
+#ifndef SCRATCH_H
+#define SCRATCH_H
+
+#include <climits>
+#include <cstddef>
+#include <new>
+
+// Status returned by an export whose scratch memory could not be grown. The managed
+// providers map it to OutOfMemoryException.
+#define NATIVE_OUT_OF_MEMORY INT_MIN
+
+// Exports that open a ScratchScope are function-try-blocks closed by this handler, so
+// std::bad_alloc never unwinds across the extern "C" boundary.
+#define NATIVE_CATCH_OUT_OF_MEMORY catch (const std::bad_alloc&) { return NATIVE_OUT_OF_MEMORY; }
+
+// Per-thread scratch memory for the wrapper exports. Open a ScratchScope at the top of an
+// export and take its temporary buffers from it; they are handed back when the scope closes,
+// but the memory itself stays with the calling thread and only ever grows, so repeated calls
+// of a similar size never touch the heap. Every buffer is 64-byte aligned.
+class ScratchScope
+{
+public:
+	ScratchScope();
+	~ScratchScope();
+
+	template<typename T>
+	T* alloc(size_t count)
+	{
+		return static_cast<T*>(allocate(count * sizeof(T)));
+	}
+
+private:
+	void* allocate(size_t bytes);
+
+	ScratchScope(const ScratchScope&);
+	ScratchScope& operator=(const ScratchScope&);
+
+	void* mark_chunk;
+	size_t mark_used;
+};
+
+// Frees the scratch memory held by the calling thread. Does nothing while a scope is open.
+void scratch_release();
+
+#endif
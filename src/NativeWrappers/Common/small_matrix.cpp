@@ -0,0 +1,106 @@
+#include "small_matrix.h"
+
+#if SMALL_MATRIX_MAX_ORDER > 8
+	#error SMALL_MATRIX_MAX_ORDER must not exceed 8
+#endif
+
+// Runs KERNEL(N) for the compile-time order N equal to n, or returns false for other orders.
+#define SMALL_MATRIX_SWITCH(n, KERNEL) \
+	if (n > SMALL_MATRIX_MAX_ORDER) \
+	{ \
+		return false; \
+	} \
+	switch (n) \
+	{ \
+		case 2: KERNEL(2); return true; \
+		case 3: KERNEL(3); return true; \
+		case 4: KERNEL(4); return true; \
+		case 5: KERNEL(5); return true; \
+		case 6: KERNEL(6); return true; \
+		case 7: KERNEL(7); return true; \
+		case 8: KERNEL(8); return true; \
+		default: return false; \
+	}
+
+namespace small_matrix
+{
+	template<typename T>
+	bool multiply(bool transA, bool transB, int n, T alpha, const T* a, const T* b, T beta, T* c)
+	{
+		#define KERNEL(N) multiply<N>(transA, transB, alpha, a, b, beta, c)
+		SMALL_MATRIX_SWITCH(n, KERNEL)
+		#undef KERNEL
+	}
+
+	template<typename T>
+	bool lu_factor(int n, T* a, int* ipiv, int& info)
+	{
+		#define KERNEL(N) info = lu_factor<N>(a, ipiv)
+		SMALL_MATRIX_SWITCH(n, KERNEL)
+		#undef KERNEL
+	}
+
+	template<typename T>
+	bool lu_solve_factored(int n, int nrhs, const T* lu, const int* ipiv, T* b)
+	{
+		#define KERNEL(N) lu_solve_factored<N>(nrhs, lu, ipiv, b)
+		SMALL_MATRIX_SWITCH(n, KERNEL)
+		#undef KERNEL
+	}
+
+	template<typename T>
+	bool lu_inverse_factored(int n, T* a, const int* ipiv, int& info)
+	{
+		#define KERNEL(N) info = lu_inverse_factored<N>(a, ipiv)
+		SMALL_MATRIX_SWITCH(n, KERNEL)
+		#undef KERNEL
+	}
+
+	template<typename T>
+	bool inverse(int n, T* a, int& info)
+	{
+		#define KERNEL(N) info = inverse<N>(a)
+		SMALL_MATRIX_SWITCH(n, KERNEL)
+		#undef KERNEL
+	}
+
+	template<typename T>
+	bool cholesky_factor(int n, T* a, int& info)
+	{
+		#define KERNEL(N) info = cholesky_factor<N>(a)
+		SMALL_MATRIX_SWITCH(n, KERNEL)
+		#undef KERNEL
+	}
+
+	template<typename T>
+	bool cholesky_solve_factored(int n, int nrhs, const T* l, T* b)
+	{
+		#define KERNEL(N) cholesky_solve_factored<N>(nrhs, l, b)
+		SMALL_MATRIX_SWITCH(n, KERNEL)
+		#undef KERNEL
+	}
+
+	#define SMALL_MATRIX_INSTANTIATE(T) \
+		template bool multiply<T>(bool, bool, int, T, const T*, const T*, T, T*); \
+		template bool lu_factor<T>(int, T*, int*, int&); \
+		template bool lu_solve_factored<T>(int, int, const T*, const int*, T*); \
+		template bool lu_inverse_factored<T>(int, T*, const int*, int&); \
+		template bool inverse<T>(int, T*, int&); \
+		template bool cholesky_factor<T>(int, T*, int&); \
+		template bool cholesky_solve_factored<T>(int, int, const T*, T*);
+
+	SMALL_MATRIX_INSTANTIATE(float)
+	SMALL_MATRIX_INSTANTIATE(double)
+}
+
+extern "C" {
+	int small_sgemm(int transA, int transB, int n, float alpha, const float a[], const float b[], float beta, float c[])
+	{
+		return small_matrix::multiply(transA != 0, transB != 0, n, alpha, a, b, beta, c) ? 1 : 0;
+	}
+
+	int small_dgemm(int transA, int transB, int n, double alpha, const double a[], const double b[], double beta, double c[])
+	{
+		return small_matrix::multiply(transA != 0, transB != 0, n, alpha, a, b, beta, c) ? 1 : 0;
+	}
+}
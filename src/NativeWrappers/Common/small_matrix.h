@@ -0,0 +1,266 @@
+#ifndef SMALL_MATRIX_H
+#define SMALL_MATRIX_H
+
+// Kernels for real matrices of a fixed, tiny order. The order is a template parameter, so
+// every loop has a constant trip count and the compiler fully unrolls and vectorizes it; at
+// these sizes that beats the call and blocking overhead of the BLAS/LAPACK routines.
+// The exports try the run-time dispatchers first and fall back to the library when the order
+// is outside 2..SMALL_MATRIX_MAX_ORDER. All matrices are square, column-major and packed.
+#ifndef SMALL_MATRIX_MAX_ORDER
+	#define SMALL_MATRIX_MAX_ORDER 8
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// c = alpha*op(a)*op(b) + beta*c for n by n matrices, callable from the C BLAS wrappers.
+// Return nonzero when the product was computed, zero when n is not handled.
+int small_sgemm(int transA, int transB, int n, float alpha, const float a[], const float b[], float beta, float c[]);
+int small_dgemm(int transA, int transB, int n, double alpha, const double a[], const double b[], double beta, double c[]);
+
+#ifdef __cplusplus
+}
+
+#include <cmath>
+
+namespace small_matrix
+{
+	// c = alpha*op(a)*op(b) + beta*c. As in gemm, c is not read when beta is zero.
+	template<int N, typename T>
+	inline void multiply(bool transA, bool transB, T alpha, const T* a, const T* b, T beta, T* c)
+	{
+		T at[N * N];
+		if (transA)
+		{
+			for (int j = 0; j < N; ++j)
+				for (int i = 0; i < N; ++i)
+					at[j * N + i] = a[i * N + j];
+			a = at;
+		}
+
+		T product[N * N] = {};
+		for (int j = 0; j < N; ++j)
+		{
+			for (int l = 0; l < N; ++l)
+			{
+				const T blj = transB ? b[l * N + j] : b[j * N + l];
+				for (int i = 0; i < N; ++i)
+				{
+					product[j * N + i] += a[l * N + i] * blj;
+				}
+			}
+		}
+
+		if (beta == T(0))
+		{
+			for (int i = 0; i < N * N; ++i)
+				c[i] = alpha * product[i];
+		}
+		else
+		{
+			for (int i = 0; i < N * N; ++i)
+				c[i] = alpha * product[i] + beta * c[i];
+		}
+	}
+
+	// In-place LU factorization with partial pivoting, the same algorithm as getf2. The pivot
+	// indices are zero-based, as the exports return them. Returns the getrf info: zero, or the
+	// one-based index of the first exactly zero pivot.
+	template<int N, typename T>
+	inline int lu_factor(T* a, int* ipiv)
+	{
+		int info = 0;
+		for (int j = 0; j < N; ++j)
+		{
+			int p = j;
+			T largest = std::abs(a[j * N + j]);
+			for (int i = j + 1; i < N; ++i)
+			{
+				const T value = std::abs(a[j * N + i]);
+				if (value > largest)
+				{
+					largest = value;
+					p = i;
+				}
+			}
+
+			ipiv[j] = p;
+			if (a[j * N + p] != T(0))
+			{
+				if (p != j)
+				{
+					for (int k = 0; k < N; ++k)
+					{
+						const T swap = a[k * N + j];
+						a[k * N + j] = a[k * N + p];
+						a[k * N + p] = swap;
+					}
+				}
+
+				const T scale = T(1) / a[j * N + j];
+				for (int i = j + 1; i < N; ++i)
+					a[j * N + i] *= scale;
+			}
+			else if (info == 0)
+			{
+				info = j + 1;
+			}
+
+			for (int k = j + 1; k < N; ++k)
+			{
+				const T akj = a[k * N + j];
+				for (int i = j + 1; i < N; ++i)
+					a[k * N + i] -= a[j * N + i] * akj;
+			}
+		}
+
+		return info;
+	}
+
+	// Solves a*x = b in place for nrhs right hand sides, given the factors from lu_factor.
+	template<int N, typename T>
+	inline void lu_solve_factored(int nrhs, const T* lu, const int* ipiv, T* b)
+	{
+		for (int r = 0; r < nrhs; ++r, b += N)
+		{
+			for (int i = 0; i < N; ++i)
+			{
+				const T swap = b[i];
+				b[i] = b[ipiv[i]];
+				b[ipiv[i]] = swap;
+			}
+
+			for (int j = 0; j < N; ++j)
+				for (int i = j + 1; i < N; ++i)
+					b[i] -= lu[j * N + i] * b[j];
+
+			for (int j = N - 1; j >= 0; --j)
+			{
+				b[j] /= lu[j * N + j];
+				for (int i = 0; i < j; ++i)
+					b[i] -= lu[j * N + i] * b[j];
+			}
+		}
+	}
+
+	// Replaces the factors from lu_factor with the inverse of the original matrix. Returns the
+	// getri info: zero, or the one-based index of the first zero diagonal entry of U, in which
+	// case the factors are left untouched.
+	template<int N, typename T>
+	inline int lu_inverse_factored(T* a, const int* ipiv)
+	{
+		for (int i = 0; i < N; ++i)
+		{
+			if (a[i * N + i] == T(0))
+				return i + 1;
+		}
+
+		T inverse[N * N] = {};
+		for (int i = 0; i < N; ++i)
+			inverse[i * N + i] = T(1);
+
+		lu_solve_factored<N>(N, a, ipiv, inverse);
+		for (int i = 0; i < N * N; ++i)
+			a[i] = inverse[i];
+
+		return 0;
+	}
+
+	// Inverts a in place. Returns the info of the failing factorization step, leaving a
+	// partially factored when it is nonzero, just as the getrf/getri pair does.
+	template<int N, typename T>
+	inline int inverse(T* a)
+	{
+		int ipiv[N];
+		const int info = lu_factor<N>(a, ipiv);
+		if (info != 0)
+			return info;
+
+		return lu_inverse_factored<N>(a, ipiv);
+	}
+
+	// In-place Cholesky factorization a = L*L', the same algorithm as potf2 with uplo 'L'.
+	// Only the lower triangle is referenced and the strictly upper triangle is left alone.
+	// Returns the potrf info: zero, or the one-based order of the first leading minor that is
+	// not positive definite.
+	template<int N, typename T>
+	inline int cholesky_factor(T* a)
+	{
+		for (int j = 0; j < N; ++j)
+		{
+			T ajj = a[j * N + j];
+			for (int k = 0; k < j; ++k)
+				ajj -= a[k * N + j] * a[k * N + j];
+
+			if (!(ajj > T(0)))
+			{
+				a[j * N + j] = ajj;
+				return j + 1;
+			}
+
+			ajj = std::sqrt(ajj);
+			a[j * N + j] = ajj;
+			for (int i = j + 1; i < N; ++i)
+			{
+				T aij = a[j * N + i];
+				for (int k = 0; k < j; ++k)
+					aij -= a[k * N + i] * a[k * N + j];
+
+				a[j * N + i] = aij / ajj;
+			}
+		}
+
+		return 0;
+	}
+
+	// Solves a*x = b in place for nrhs right hand sides, given the lower factor from
+	// cholesky_factor.
+	template<int N, typename T>
+	inline void cholesky_solve_factored(int nrhs, const T* l, T* b)
+	{
+		for (int r = 0; r < nrhs; ++r, b += N)
+		{
+			for (int j = 0; j < N; ++j)
+			{
+				b[j] /= l[j * N + j];
+				for (int i = j + 1; i < N; ++i)
+					b[i] -= l[j * N + i] * b[j];
+			}
+
+			for (int j = N - 1; j >= 0; --j)
+			{
+				for (int i = j + 1; i < N; ++i)
+					b[j] -= l[j * N + i] * b[i];
+
+				b[j] /= l[j * N + j];
+			}
+		}
+	}
+
+	// Run-time dispatch: each of these returns false, doing nothing, when n is not handled.
+
+	template<typename T>
+	bool multiply(bool transA, bool transB, int n, T alpha, const T* a, const T* b, T beta, T* c);
+
+	template<typename T>
+	bool lu_factor(int n, T* a, int* ipiv, int& info);
+
+	template<typename T>
+	bool lu_solve_factored(int n, int nrhs, const T* lu, const int* ipiv, T* b);
+
+	template<typename T>
+	bool lu_inverse_factored(int n, T* a, const int* ipiv, int& info);
+
+	template<typename T>
+	bool inverse(int n, T* a, int& info);
+
+	template<typename T>
+	bool cholesky_factor(int n, T* a, int& info);
+
+	template<typename T>
+	bool cholesky_solve_factored(int n, int nrhs, const T* l, T* b);
+}
+#endif
+
+#endif
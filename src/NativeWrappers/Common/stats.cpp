@@ -0,0 +1,140 @@
+#include "wrapper_common.h"
+#include "stats.h"
+
+#ifdef _WIN32
+	#include <windows.h>
+#else
+	#include <time.h>
+#endif
+
+namespace
+{
+	struct Counters
+	{
+		volatile long long calls;
+		volatile long long total_ns;
+		volatile long long max_ns;
+		volatile long long flops;
+		volatile long long bytes;
+	};
+
+	Counters counters[NATIVE_STATS_COUNT];
+
+	#define NATIVE_STATS_NAMES(operation) "s_" #operation, "d_" #operation, "c_" #operation, "z_" #operation,
+	#define NATIVE_STATS_EXPORT_NAME(name) #name,
+
+	const char* const names[NATIVE_STATS_COUNT] = { NATIVE_STATS_OPERATIONS(NATIVE_STATS_NAMES) NATIVE_STATS_EXPORTS(NATIVE_STATS_EXPORT_NAME) };
+
+	#undef NATIVE_STATS_NAMES
+	#undef NATIVE_STATS_EXPORT_NAME
+
+	void atomic_add(volatile long long* target, long long value)
+	{
+#ifdef _WIN32
+		InterlockedExchangeAdd64(target, value);
+#else
+		__sync_fetch_and_add(target, value);
+#endif
+	}
+
+	void atomic_max(volatile long long* target, long long value)
+	{
+		long long current = *target;
+		while (value > current)
+		{
+#ifdef _WIN32
+			long long seen = InterlockedCompareExchange64(target, value, current);
+#else
+			long long seen = __sync_val_compare_and_swap(target, current, value);
+#endif
+			if (seen == current)
+			{
+				break;
+			}
+
+			current = seen;
+		}
+	}
+}
+
+extern "C" {
+	volatile int native_stats_on = 0;
+
+	long long native_stats_now(void)
+	{
+#ifdef _WIN32
+		static LARGE_INTEGER frequency;
+		if (frequency.QuadPart == 0)
+		{
+			QueryPerformanceFrequency(&frequency);
+		}
+
+		LARGE_INTEGER now;
+		QueryPerformanceCounter(&now);
+		return (long long)((double)now.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+		timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+#endif
+	}
+
+	void native_stats_record(int id, long long start, double flops, double bytes)
+	{
+		long long elapsed = native_stats_now() - start;
+		Counters& entry = counters[id];
+		atomic_add(&entry.calls, 1);
+		atomic_add(&entry.total_ns, elapsed);
+		atomic_max(&entry.max_ns, elapsed);
+		atomic_add(&entry.flops, (long long)flops);
+		atomic_add(&entry.bytes, (long long)bytes);
+	}
+
+	DLLEXPORT void native_stats_enable(int enable)
+	{
+		native_stats_on = enable != 0;
+	}
+
+	DLLEXPORT int native_stats_count()
+	{
+		return NATIVE_STATS_COUNT;
+	}
+
+	DLLEXPORT const char* native_stats_name(int id)
+	{
+		return id >= 0 && id < NATIVE_STATS_COUNT ? names[id] : 0;
+	}
+
+	// Copies the counters of the first count exports; each array needs count elements. Returns the
+	// number of exports copied. Calls still running may be partly counted.
+	DLLEXPORT int native_stats_snapshot(long long calls[], long long total_ns[], long long max_ns[], long long flops[], long long bytes[], int count)
+	{
+		if (count > NATIVE_STATS_COUNT)
+		{
+			count = NATIVE_STATS_COUNT;
+		}
+
+		for (int i = 0; i < count; ++i)
+		{
+			calls[i] = counters[i].calls;
+			total_ns[i] = counters[i].total_ns;
+			max_ns[i] = counters[i].max_ns;
+			flops[i] = counters[i].flops;
+			bytes[i] = counters[i].bytes;
+		}
+
+		return count;
+	}
+
+	DLLEXPORT void native_stats_reset()
+	{
+		for (int i = 0; i < NATIVE_STATS_COUNT; ++i)
+		{
+			counters[i].calls = 0;
+			counters[i].total_ns = 0;
+			counters[i].max_ns = 0;
+			counters[i].flops = 0;
+			counters[i].bytes = 0;
+		}
+	}
+}
@@ -0,0 +1,265 @@
+#ifndef STATS_H
+#define STATS_H
+
+// Opt-in call statistics for the wrapper exports: per export, the number of calls, the total and
+// longest wall time, and estimates of the floating point operations and bytes of matrix data
+// touched. Recording is off until native_stats_enable(1); while it is off an instrumented export
+// only tests a flag.
+//
+// The flop estimates are the leading-order counts of the LAPACK drivers as given in LAWN 41,
+// with four real flops per complex one; bytes count each matrix operand read or written once.
+
+// Every instrumented operation; each has an s, d, c and z export. The _batch exports that run
+// the single matrix exports per item are counted under both.
+#define NATIVE_STATS_OPERATIONS(X) \
+	X(matrix_norm) \
+	X(matrix_multiply) \
+	X(matrix_multiply_ld) \
+	X(matrix_multiply_batch) \
+	X(matrix_vector_multiply) \
+	X(rank1_update) \
+	X(symmetric_rank_k_update) \
+	X(triangular_solve) \
+	X(triangular_multiply) \
+	X(lu_factor) \
+	X(lu_factor_ld) \
+	X(lu_factor_batch) \
+	X(lu_inverse) \
+	X(lu_inverse_factored) \
+	X(lu_solve) \
+	X(lu_solve_factored) \
+	X(lu_solve_factored_ld) \
+	X(lu_solve_factored_batch) \
+	X(lu_condition) \
+	X(lu_determinant) \
+	X(cholesky_factor) \
+	X(cholesky_factor_ld) \
+	X(cholesky_factor_batch) \
+	X(cholesky_solve) \
+	X(cholesky_solve_factored) \
+	X(cholesky_solve_factored_ld) \
+	X(cholesky_solve_factored_batch) \
+	X(cholesky_condition) \
+	X(ldlt_factor) \
+	X(ldlt_solve) \
+	X(ldlt_solve_factored) \
+	X(band_lu_solve) \
+	X(band_cholesky_solve) \
+	X(tridiagonal_solve) \
+	X(tridiagonal_solve_batch) \
+	X(positive_definite_tridiagonal_solve) \
+	X(qr_factor) \
+	X(qr_solve) \
+	X(qr_solve_factored) \
+	X(qr_factor_compact) \
+	X(qr_apply_q) \
+	X(qr_factor_pivoted) \
+	X(least_squares) \
+	X(svd_factor) \
+	X(svd_thin) \
+	X(svd_solve) \
+	X(eigen) \
+	X(symmetric_eigen) \
+	X(schur)
+
+// Instrumented exports that only exist for some of the element types.
+#define NATIVE_STATS_EXPORTS(X) \
+	X(s_symmetric_matrix_vector_multiply) \
+	X(d_symmetric_matrix_vector_multiply) \
+	X(c_hermitian_rank_k_update) \
+	X(z_hermitian_rank_k_update) \
+	X(d_lu_solve_mixed) \
+	X(d_cholesky_solve_mixed)
+
+#define NATIVE_STATS_IDS(operation) STATS_s_##operation, STATS_d_##operation, STATS_c_##operation, STATS_z_##operation,
+#define NATIVE_STATS_EXPORT_ID(name) STATS_##name,
+
+enum native_stats_id
+{
+	NATIVE_STATS_OPERATIONS(NATIVE_STATS_IDS)
+	NATIVE_STATS_EXPORTS(NATIVE_STATS_EXPORT_ID)
+	NATIVE_STATS_COUNT
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Nonzero while statistics are recorded.
+extern volatile int native_stats_on;
+
+// A monotonic timestamp in nanoseconds.
+long long native_stats_now(void);
+
+// Adds one call of the export id that started at the given timestamp.
+void native_stats_record(int id, long long start, double flops, double bytes);
+
+#ifdef __cplusplus
+}
+#endif
+
+// For the C exports: NATIVE_STATS_BEGIN must come first among the declarations of the export, and
+// NATIVE_STATS_END before every return.
+#define NATIVE_STATS_BEGIN long long native_stats_start = native_stats_on ? native_stats_now() : 0
+#define NATIVE_STATS_END(id, flops, bytes) if (native_stats_start != 0) native_stats_record(id, native_stats_start, flops, bytes)
+
+#ifdef __cplusplus
+// For the C++ exports: records the call when it goes out of scope.
+class NativeStatsScope
+{
+public:
+	NativeStatsScope(int id, double flops, double bytes)
+		: id(id), flops(flops), bytes(bytes), start(native_stats_on ? native_stats_now() : 0)
+	{
+	}
+
+	~NativeStatsScope()
+	{
+		if (start != 0)
+		{
+			native_stats_record(id, start, flops, bytes);
+		}
+	}
+
+private:
+	NativeStatsScope(const NativeStatsScope&);
+	NativeStatsScope& operator=(const NativeStatsScope&);
+
+	int id;
+	double flops;
+	double bytes;
+	long long start;
+};
+
+namespace native_stats
+{
+	inline double lu_factor_flops(double n)
+	{
+		return 2.0 * n * n * n / 3.0;
+	}
+
+	inline double lu_inverse_factored_flops(double n)
+	{
+		return 4.0 * n * n * n / 3.0;
+	}
+
+	inline double cholesky_factor_flops(double n)
+	{
+		return n * n * n / 3.0;
+	}
+
+	// Bunch-Kaufman pivoting costs only O(n^2) comparisons on top of the Cholesky-like update.
+	inline double ldlt_factor_flops(double n)
+	{
+		return n * n * n / 3.0;
+	}
+
+	// Forward and back substitution with a factored n by n matrix.
+	inline double triangular_solve_flops(double n, double nrhs)
+	{
+		return 2.0 * n * n * nrhs;
+	}
+
+	// gbsv on an n by n matrix with kl subdiagonals and ku superdiagonals: partial pivoting widens U to
+	// kl + ku superdiagonals.
+	inline double band_lu_solve_flops(double n, double kl, double ku, double nrhs)
+	{
+		return 2.0 * n * kl * (kl + ku + 1.0) + 2.0 * n * (2.0 * kl + ku + 1.0) * nrhs;
+	}
+
+	// pbsv on an n by n matrix with kd subdiagonals.
+	inline double band_cholesky_solve_flops(double n, double kd, double nrhs)
+	{
+		return n * kd * (kd + 1.0) + 4.0 * n * (kd + 1.0) * nrhs;
+	}
+
+	// gtsv: elimination with partial pivoting, then a back substitution over three diagonals.
+	inline double tridiagonal_solve_flops(double n, double nrhs)
+	{
+		return 4.0 * n + 7.0 * n * nrhs;
+	}
+
+	// ptsv: the L*D*L' factorization, then forward, diagonal and back substitution.
+	inline double positive_definite_tridiagonal_solve_flops(double n, double nrhs)
+	{
+		return 3.0 * n + 5.0 * n * nrhs;
+	}
+
+	// gecon or pocon: the norm estimator typically needs about five solves with the factors.
+	inline double condition_estimate_flops(double n)
+	{
+		return 5.0 * triangular_solve_flops(n, 1);
+	}
+
+	// A logarithm and a multiplication per pivot.
+	inline double determinant_flops(double n)
+	{
+		return 2.0 * n;
+	}
+
+	// geqrf on an m by n matrix.
+	inline double qr_factor_flops(double m, double n)
+	{
+		double k = m < n ? m : n;
+		double l = m < n ? n : m;
+		return 2.0 * l * k * k - 2.0 * k * k * k / 3.0;
+	}
+
+	// orgqr or ormqr applying k reflectors of length m to n columns.
+	inline double qr_apply_flops(double m, double n, double k)
+	{
+		return 4.0 * m * n * k - 2.0 * (m + n) * k * k + 4.0 * k * k * k / 3.0;
+	}
+
+	// gels on an m by n matrix with nrhs right-hand sides: the QR (or LQ) factorization, applying its
+	// reflectors to the right-hand sides and the triangular solve.
+	inline double least_squares_flops(double m, double n, double nrhs)
+	{
+		double k = m < n ? m : n;
+		double l = m < n ? n : m;
+		return qr_factor_flops(m, n) + qr_apply_flops(l, nrhs, k) + k * k * nrhs;
+	}
+
+	// geev or gees on an n by n matrix: the Hessenberg QR algorithm, with or without the vectors
+	// (Golub and Van Loan, section 7.5.6).
+	inline double eigen_flops(bool compute_vectors, double n)
+	{
+		return (compute_vectors ? 25.0 : 10.0) * n * n * n;
+	}
+
+	// syevd or heevd on an n by n matrix: tridiagonal reduction followed by the symmetric
+	// tridiagonal QR algorithm, with or without the vectors (Golub and Van Loan, section 8.3).
+	inline double symmetric_eigen_flops(bool compute_vectors, double n)
+	{
+		return (compute_vectors ? 9.0 : 4.0 / 3.0) * n * n * n;
+	}
+
+	// gesvd on an m by n matrix.
+	inline double svd_flops(bool compute_vectors, double m, double n)
+	{
+		double k = m < n ? m : n;
+		double l = m < n ? n : m;
+		return compute_vectors ? 4.0 * l * l * k + 8.0 * l * k * k + 9.0 * k * k * k : 4.0 * l * k * k - 4.0 * k * k * k / 3.0;
+	}
+
+	// gesvd or gesdd on an m by n matrix with only the leading min(m, n) singular vectors
+	// (Golub and Van Loan, section 5.4.5, R-SVD).
+	inline double svd_thin_flops(bool compute_vectors, double m, double n)
+	{
+		double k = m < n ? m : n;
+		double l = m < n ? n : m;
+		return compute_vectors ? 6.0 * l * k * k + 20.0 * k * k * k : 4.0 * l * k * k - 4.0 * k * k * k / 3.0;
+	}
+
+	// gelsd on an m by n matrix with nrhs right-hand sides: the bidiagonal reduction, and applying both
+	// sets of reflectors to the right-hand sides.
+	inline double svd_solve_flops(double m, double n, double nrhs)
+	{
+		double k = m < n ? m : n;
+		double l = m < n ? n : m;
+		return 4.0 * l * k * k - 4.0 * k * k * k / 3.0 + 4.0 * (l + k) * k * nrhs;
+	}
+}
+#endif
+
+#endif
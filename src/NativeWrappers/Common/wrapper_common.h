@@ -3,6 +3,8 @@
 
 #ifdef _WINDOWS
 	#define DLLEXPORT __declspec( dllexport )
+#elif defined(__GNUC__)
+	#define DLLEXPORT __attribute__ (( visibility("default") ))
 #else
 	#define DLLEXPORT
 #endif
@@ -4,6 +4,9 @@
 extern "C"{
 	#include "f2c.h"
 	#include "clapack.h"
+
+	/* clapack.h predates dsposv. */
+	int dsposv_(char*, integer*, integer*, doublereal*, integer*, doublereal*, integer*, doublereal*, integer*, doublereal*, real*, integer*, integer*);
 	
 	enum CBLAS_ORDER     {CblasRowMajor=101, CblasColMajor=102};
 	enum CBLAS_TRANSPOSE {CblasNoTrans=111, CblasTrans=112, CblasConjTrans=113, CblasConjNoTrans=114};
@@ -1,5 +1,52 @@
 #include "mkl_cblas.h"
+#include "mkl_version.h"
 #include "wrapper_common.h"
+#include "small_matrix.h"
+#include "stats.h"
+
+/* Copies the strictly lower triangle of the packed n by n matrix c to its upper triangle. */
+static void s_mirror_lower(const int n, float c[]){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[(size_t)i * n + j] = c[(size_t)j * n + i];
+		}
+	}
+}
+
+static void d_mirror_lower(const int n, double c[]){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[(size_t)i * n + j] = c[(size_t)j * n + i];
+		}
+	}
+}
+
+/* The complex versions take the interleaved real and imaginary parts, and conjugate the copies of a Hermitian matrix. */
+static void c_mirror_lower(const int n, float c[], const int conjugate){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[2 * ((size_t)i * n + j)] = c[2 * ((size_t)j * n + i)];
+			c[2 * ((size_t)i * n + j) + 1] = conjugate ? -c[2 * ((size_t)j * n + i) + 1] : c[2 * ((size_t)j * n + i) + 1];
+		}
+	}
+}
+
+static void z_mirror_lower(const int n, double c[], const int conjugate){
+	int i, j;
+
+	for (j = 0; j < n; ++j){
+		for (i = j + 1; i < n; ++i){
+			c[2 * ((size_t)i * n + j)] = c[2 * ((size_t)j * n + i)];
+			c[2 * ((size_t)i * n + j) + 1] = conjugate ? -c[2 * ((size_t)j * n + i) + 1] : c[2 * ((size_t)j * n + i) + 1];
+		}
+	}
+}
 
 DLLEXPORT void s_axpy(const int n, const float alpha, const float x[], float y[]){
 	cblas_saxpy(n, alpha, x, 1, y, 1);
@@ -53,30 +100,407 @@ DLLEXPORT MKL_Complex16 z_dot_product(const int n, const MKL_Complex16 x[], cons
 	return ret;
 }
 
+DLLEXPORT void s_matrix_vector_multiply(const enum CBLAS_TRANSPOSE transA, const int m, const int n, const float alpha, const float a[], const float x[], const float beta, float y[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_sgemv(CblasColMajor, transA, m, n, alpha, a, m, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_s_matrix_vector_multiply, 2.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void d_matrix_vector_multiply(const enum CBLAS_TRANSPOSE transA, const int m, const int n, const double alpha, const double a[], const double x[], const double beta, double y[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_dgemv(CblasColMajor, transA, m, n, alpha, a, m, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_d_matrix_vector_multiply, 2.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void c_matrix_vector_multiply(const enum CBLAS_TRANSPOSE transA, const int m, const int n, const MKL_Complex8 alpha, const MKL_Complex8 a[], const MKL_Complex8 x[], const MKL_Complex8 beta, MKL_Complex8 y[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_cgemv(CblasColMajor, transA, m, n, &alpha, a, m, x, 1, &beta, y, 1);
+
+	NATIVE_STATS_END(STATS_c_matrix_vector_multiply, 8.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void z_matrix_vector_multiply(const enum CBLAS_TRANSPOSE transA, const int m, const int n, const MKL_Complex16 alpha, const MKL_Complex16 a[], const MKL_Complex16 x[], const MKL_Complex16 beta, MKL_Complex16 y[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_zgemv(CblasColMajor, transA, m, n, &alpha, a, m, x, 1, &beta, y, 1);
+
+	NATIVE_STATS_END(STATS_z_matrix_vector_multiply, 8.0 * m * n, ((double)m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void s_rank1_update(const int m, const int n, const float alpha, const float x[], const float y[], float a[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_sger(CblasColMajor, m, n, alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_s_rank1_update, 2.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void d_rank1_update(const int m, const int n, const double alpha, const double x[], const double y[], double a[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_dger(CblasColMajor, m, n, alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_d_rank1_update, 2.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void c_rank1_update(const int m, const int n, const MKL_Complex8 alpha, const MKL_Complex8 x[], const MKL_Complex8 y[], MKL_Complex8 a[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_cgeru(CblasColMajor, m, n, &alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_c_rank1_update, 8.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+DLLEXPORT void z_rank1_update(const int m, const int n, const MKL_Complex16 alpha, const MKL_Complex16 x[], const MKL_Complex16 y[], MKL_Complex16 a[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_zgeru(CblasColMajor, m, n, &alpha, x, 1, y, 1, a, m);
+
+	NATIVE_STATS_END(STATS_z_rank1_update, 8.0 * m * n, (2.0 * m * n + m + n) * sizeof(a[0]));
+}
+
+// Only the lower triangle of a is read.
+DLLEXPORT void s_symmetric_matrix_vector_multiply(const int n, const float alpha, const float a[], const float x[], const float beta, float y[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_ssymv(CblasColMajor, CblasLower, n, alpha, a, n, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_s_symmetric_matrix_vector_multiply, 2.0 * n * n, (0.5 * n * n + 2.0 * n) * sizeof(a[0]));
+}
+
+DLLEXPORT void d_symmetric_matrix_vector_multiply(const int n, const double alpha, const double a[], const double x[], const double beta, double y[]){
+	NATIVE_STATS_BEGIN;
+
+	cblas_dsymv(CblasColMajor, CblasLower, n, alpha, a, n, x, 1, beta, y, 1);
+
+	NATIVE_STATS_END(STATS_d_symmetric_matrix_vector_multiply, 2.0 * n * n, (0.5 * n * n + 2.0 * n) * sizeof(a[0]));
+}
+
 DLLEXPORT void s_matrix_multiply(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const float y[], const float beta, float c[]){
-	int lda = transA == CblasNoTrans ? m : k;
-	int ldb = transB == CblasNoTrans ? k : n;
+	NATIVE_STATS_BEGIN;
+
+	if (m != n || n != k || !small_sgemm(transA != CblasNoTrans, transB != CblasNoTrans, n, alpha, x, y, beta, c)){
+		int lda = transA == CblasNoTrans ? m : k;
+		int ldb = transB == CblasNoTrans ? k : n;
+
+		cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+	}
 
-	cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+	NATIVE_STATS_END(STATS_s_matrix_multiply, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
 }
 
 DLLEXPORT void d_matrix_multiply(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const double y[], const double beta, double c[]){
-	int lda = transA == CblasNoTrans ? m : k;
-	int ldb = transB == CblasNoTrans ? k : n;
+	NATIVE_STATS_BEGIN;
+
+	if (m != n || n != k || !small_dgemm(transA != CblasNoTrans, transB != CblasNoTrans, n, alpha, x, y, beta, c)){
+		int lda = transA == CblasNoTrans ? m : k;
+		int ldb = transB == CblasNoTrans ? k : n;
 
-	cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+		cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, y, ldb, beta, c, m);
+	}
+
+	NATIVE_STATS_END(STATS_d_matrix_multiply, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
 }
 
 DLLEXPORT void c_matrix_multiply(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const MKL_Complex8 alpha, const MKL_Complex8 x[], const MKL_Complex8 y[], const MKL_Complex8 beta, MKL_Complex8 c[]){
+	NATIVE_STATS_BEGIN;
+
 	int lda = transA == CblasNoTrans ? m : k;
 	int ldb = transB == CblasNoTrans ? k : n;
 
 	cblas_cgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x, lda, y, ldb, &beta, c, m);
+
+	NATIVE_STATS_END(STATS_c_matrix_multiply, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
 }
 
 DLLEXPORT void z_matrix_multiply(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const MKL_Complex16 alpha, const MKL_Complex16 x[], const MKL_Complex16 y[], const MKL_Complex16 beta, MKL_Complex16 c[]){
+	NATIVE_STATS_BEGIN;
+
 	int lda = transA == CblasNoTrans ? m : k;
 	int ldb = transB == CblasNoTrans ? k : n;
 
 	cblas_zgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x, lda, y, ldb, &beta, c, m);
+
+	NATIVE_STATS_END(STATS_z_matrix_multiply, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void s_matrix_multiply_ld(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const int x_offset, const int ldx, const float y[], const int y_offset, const int ldy, const float beta, float c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + x_offset, ldx, y + y_offset, ldy, beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_s_matrix_multiply_ld, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void d_matrix_multiply_ld(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const int x_offset, const int ldx, const double y[], const int y_offset, const int ldy, const double beta, double c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + x_offset, ldx, y + y_offset, ldy, beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_d_matrix_multiply_ld, 2.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void c_matrix_multiply_ld(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const MKL_Complex8 alpha, const MKL_Complex8 x[], const int x_offset, const int ldx, const MKL_Complex8 y[], const int y_offset, const int ldy, const MKL_Complex8 beta, MKL_Complex8 c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	cblas_cgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x + x_offset, ldx, y + y_offset, ldy, &beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_c_matrix_multiply_ld, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void z_matrix_multiply_ld(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const MKL_Complex16 alpha, const MKL_Complex16 x[], const int x_offset, const int ldx, const MKL_Complex16 y[], const int y_offset, const int ldy, const MKL_Complex16 beta, MKL_Complex16 c[], const int c_offset, const int ldc){
+	NATIVE_STATS_BEGIN;
+
+	cblas_zgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x + x_offset, ldx, y + y_offset, ldy, &beta, c + c_offset, ldc);
+
+	NATIVE_STATS_END(STATS_z_matrix_multiply_ld, 8.0 * m * n * k, ((double)m * k + (double)k * n + 2.0 * m * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void s_symmetric_rank_k_update(const enum CBLAS_TRANSPOSE trans, const int n, const int k, const float alpha, const float a[], const float beta, float c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_ssyrk(CblasColMajor, CblasLower, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		s_mirror_lower(n, c);
+	}
+
+	NATIVE_STATS_END(STATS_s_symmetric_rank_k_update, 1.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void d_symmetric_rank_k_update(const enum CBLAS_TRANSPOSE trans, const int n, const int k, const double alpha, const double a[], const double beta, double c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_dsyrk(CblasColMajor, CblasLower, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		d_mirror_lower(n, c);
+	}
+
+	NATIVE_STATS_END(STATS_d_symmetric_rank_k_update, 1.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void c_symmetric_rank_k_update(const enum CBLAS_TRANSPOSE trans, const int n, const int k, const MKL_Complex8 alpha, const MKL_Complex8 a[], const MKL_Complex8 beta, MKL_Complex8 c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_csyrk(CblasColMajor, CblasLower, trans, n, k, &alpha, a, lda, &beta, c, n);
+
+	if (mirror){
+		c_mirror_lower(n, (float*)c, 0);
+	}
+
+	NATIVE_STATS_END(STATS_c_symmetric_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void z_symmetric_rank_k_update(const enum CBLAS_TRANSPOSE trans, const int n, const int k, const MKL_Complex16 alpha, const MKL_Complex16 a[], const MKL_Complex16 beta, MKL_Complex16 c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_zsyrk(CblasColMajor, CblasLower, trans, n, k, &alpha, a, lda, &beta, c, n);
+
+	if (mirror){
+		z_mirror_lower(n, (double*)c, 0);
+	}
+
+	NATIVE_STATS_END(STATS_z_symmetric_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void c_hermitian_rank_k_update(const enum CBLAS_TRANSPOSE trans, const int n, const int k, const float alpha, const MKL_Complex8 a[], const float beta, MKL_Complex8 c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_cherk(CblasColMajor, CblasLower, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		c_mirror_lower(n, (float*)c, 1);
+	}
+
+	NATIVE_STATS_END(STATS_c_hermitian_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void z_hermitian_rank_k_update(const enum CBLAS_TRANSPOSE trans, const int n, const int k, const double alpha, const MKL_Complex16 a[], const double beta, MKL_Complex16 c[], const int mirror){
+	NATIVE_STATS_BEGIN;
+
+	int lda = trans == CblasNoTrans ? n : k;
+
+	cblas_zherk(CblasColMajor, CblasLower, trans, n, k, alpha, a, lda, beta, c, n);
+
+	if (mirror){
+		z_mirror_lower(n, (double*)c, 1);
+	}
+
+	NATIVE_STATS_END(STATS_z_hermitian_rank_k_update, 4.0 * n * (n + 1.0) * k, ((double)n * k + (double)n * n) * sizeof(c[0]));
+}
+
+DLLEXPORT void s_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const float alpha, const float a[], float b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_strsm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_s_triangular_solve, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void d_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const double alpha, const double a[], double b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_dtrsm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_d_triangular_solve, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void c_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const MKL_Complex8 alpha, const MKL_Complex8 a[], MKL_Complex8 b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_ctrsm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_c_triangular_solve, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void z_triangular_solve(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const MKL_Complex16 alpha, const MKL_Complex16 a[], MKL_Complex16 b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_ztrsm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_z_triangular_solve, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void s_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const float alpha, const float a[], float b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_strmm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_s_triangular_multiply, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void d_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const double alpha, const double a[], double b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_dtrmm(CblasColMajor, side, uplo, trans, diag, m, n, alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_d_triangular_multiply, 1.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void c_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const MKL_Complex8 alpha, const MKL_Complex8 a[], MKL_Complex8 b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_ctrmm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_c_triangular_multiply, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void z_triangular_multiply(const enum CBLAS_SIDE side, const enum CBLAS_UPLO uplo, const enum CBLAS_TRANSPOSE trans, const enum CBLAS_DIAG diag, const int m, const int n, const MKL_Complex16 alpha, const MKL_Complex16 a[], MKL_Complex16 b[]){
+	NATIVE_STATS_BEGIN;
+
+	int lda = side == CblasLeft ? m : n;
+
+	cblas_ztrmm(CblasColMajor, side, uplo, trans, diag, m, n, &alpha, a, lda, b, m);
+
+	NATIVE_STATS_END(STATS_z_triangular_multiply, 4.0 * lda * lda * (side == CblasLeft ? n : m), (0.5 * lda * lda + 2.0 * m * n) * sizeof(b[0]));
+}
+
+DLLEXPORT void s_matrix_multiply_batch(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const float alpha, const float x[], const int x_stride, const float y[], const int y_stride, const float beta, float c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+#if INTEL_MKL_VERSION >= 20200000
+	cblas_sgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, x_stride, y, ldb, y_stride, beta, c, m, c_stride, batch);
+#else
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		cblas_sgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, beta, c + (size_t)i * c_stride, m);
+	}
+#endif
+
+	NATIVE_STATS_END(STATS_s_matrix_multiply_batch, 2.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
+}
+
+DLLEXPORT void d_matrix_multiply_batch(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const double alpha, const double x[], const int x_stride, const double y[], const int y_stride, const double beta, double c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+#if INTEL_MKL_VERSION >= 20200000
+	cblas_dgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, alpha, x, lda, x_stride, y, ldb, y_stride, beta, c, m, c_stride, batch);
+#else
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		cblas_dgemm(CblasColMajor, transA, transB, m, n, k, alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, beta, c + (size_t)i * c_stride, m);
+	}
+#endif
+
+	NATIVE_STATS_END(STATS_d_matrix_multiply_batch, 2.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
+}
+
+DLLEXPORT void c_matrix_multiply_batch(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const MKL_Complex8 alpha, const MKL_Complex8 x[], const int x_stride, const MKL_Complex8 y[], const int y_stride, const MKL_Complex8 beta, MKL_Complex8 c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+#if INTEL_MKL_VERSION >= 20200000
+	cblas_cgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, &alpha, x, lda, x_stride, y, ldb, y_stride, &beta, c, m, c_stride, batch);
+#else
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		cblas_cgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, &beta, c + (size_t)i * c_stride, m);
+	}
+#endif
+
+	NATIVE_STATS_END(STATS_c_matrix_multiply_batch, 8.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
+}
+
+DLLEXPORT void z_matrix_multiply_batch(const enum CBLAS_TRANSPOSE transA, const enum CBLAS_TRANSPOSE transB, const int m, const int n, const int k, const MKL_Complex16 alpha, const MKL_Complex16 x[], const int x_stride, const MKL_Complex16 y[], const int y_stride, const MKL_Complex16 beta, MKL_Complex16 c[], const int c_stride, const int batch){
+	NATIVE_STATS_BEGIN;
+
+	int lda = transA == CblasNoTrans ? m : k;
+	int ldb = transB == CblasNoTrans ? k : n;
+
+#if INTEL_MKL_VERSION >= 20200000
+	cblas_zgemm_batch_strided(CblasColMajor, transA, transB, m, n, k, &alpha, x, lda, x_stride, y, ldb, y_stride, &beta, c, m, c_stride, batch);
+#else
+	int i;
+
+	#pragma omp parallel for
+	for (i = 0; i < batch; ++i){
+		cblas_zgemm(CblasColMajor, transA, transB, m, n, k, &alpha, x + (size_t)i * x_stride, lda, y + (size_t)i * y_stride, ldb, &beta, c + (size_t)i * c_stride, m);
+	}
+#endif
+
+	NATIVE_STATS_END(STATS_z_matrix_multiply_batch, 8.0 * m * n * k * batch, ((double)m * k + (double)k * n + 2.0 * m * n) * batch * sizeof(c[0]));
 }
@@ -1,32 +1,51 @@
 ﻿#include "mkl_lapack.h"
 #include "mkl_cblas.h"
 #include "wrapper_common.h"
+#include "scratch.h"
+#include "small_matrix.h"
+#include "stats.h"
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 extern "C"{
 	DLLEXPORT float s_matrix_norm(char norm, int m, int n, float a[], float work[])
 	{
+		NativeStatsScope stats(STATS_s_matrix_norm, 2.0 * m * n, m * (double)n * sizeof(a[0]));
+
 		return slange_(&norm, &m, &n, a, &m, work);
 	}
 
 	DLLEXPORT double d_matrix_norm(char norm, int m, int n, double a[], double work[])
 	{
+		NativeStatsScope stats(STATS_d_matrix_norm, 2.0 * m * n, m * (double)n * sizeof(a[0]));
+
 		return dlange_(&norm, &m, &n, a, &m, work);
 	}
 
 	DLLEXPORT float c_matrix_norm(char norm, int m, int n, MKL_Complex8 a[], float work[])
 	{
+		NativeStatsScope stats(STATS_c_matrix_norm, 8.0 * m * n, m * (double)n * sizeof(a[0]));
+
 		return clange_(&norm, &m, &n, a, &m, work);
 	}
 
 	DLLEXPORT double z_matrix_norm(char norm, int m, int n, MKL_Complex16 a[], double work[])
 	{
+		NativeStatsScope stats(STATS_z_matrix_norm, 8.0 * m * n, m * (double)n * sizeof(a[0]));
+
 		return zlange_(&norm, &m, &n, a, &m, work);
 	}
 
 	DLLEXPORT int s_lu_factor(int m, float a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_s_lu_factor, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_factor(m, a, ipiv, info)){
+			return info;
+		}
+
 		sgetrf_(&m,&m,a,&m,ipiv,&info);
 		for(int i = 0; i < m; ++i ){
 			ipiv[i] -= 1;
@@ -36,7 +55,13 @@ extern "C"{
 
 	DLLEXPORT int d_lu_factor(int m, double a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_d_lu_factor, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_factor(m, a, ipiv, info)){
+			return info;
+		}
+
 		dgetrf_(&m,&m,a,&m,ipiv,&info);
 		for(int i = 0; i < m; ++i ){
 			ipiv[i] -= 1;
@@ -46,6 +71,8 @@ extern "C"{
 
 	DLLEXPORT int c_lu_factor(int m, MKL_Complex8 a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_c_lu_factor, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
 		cgetrf_(&m,&m,a,&m,ipiv,&info);
 		for(int i = 0; i < m; ++i ){
@@ -56,6 +83,8 @@ extern "C"{
 
 	DLLEXPORT int z_lu_factor(int m, MKL_Complex16 a[], int ipiv[])
 	{
+		NativeStatsScope stats(STATS_z_lu_factor, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
 		int info = 0;
 		zgetrf_(&m,&m,a,&m,ipiv,&info);
 		for(int i = 0; i < m; ++i ){
@@ -65,76 +94,102 @@ extern "C"{
 	}
 
 	DLLEXPORT int s_lu_inverse(int n, float a[], float work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_s_lu_inverse, native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::inverse(n, a, info)){
+			return info;
+		}
+
 		sgetrf_(&n,&n,a,&n,ipiv,&info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		sgetri_(&n,a,&n,ipiv,work,&lwork,&info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int d_lu_inverse(int n, double a[], double work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_d_lu_inverse, native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::inverse(n, a, info)){
+			return info;
+		}
+
 		dgetrf_(&n,&n,a,&n,ipiv,&info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		dgetri_(&n,a,&n,ipiv,work,&lwork,&info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int c_lu_inverse(int n, MKL_Complex8 a[], MKL_Complex8 work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_c_lu_inverse, 4 * (native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		cgetrf_(&n,&n,a,&n,ipiv,&info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		cgetri_(&n,a,&n,ipiv,work,&lwork,&info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int z_lu_inverse(int n, MKL_Complex16 a[], MKL_Complex16 work[], int lwork)
+	try
 	{
-		int* ipiv = new int[n];
+		NativeStatsScope stats(STATS_z_lu_inverse, 4 * (native_stats::lu_factor_flops(n) + native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		zgetrf_(&n,&n,a,&n,ipiv,&info);
 
 		if (info != 0){
-			delete[] ipiv;
 			return info;
 		}
 
 		zgetri_(&n,a,&n,ipiv,work,&lwork,&info);
-		delete[] ipiv;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int s_lu_inverse_factored(int n, float a[], int ipiv[], float work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_s_lu_inverse_factored, native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		if (small_matrix::lu_inverse_factored(n, a, ipiv, info)){
+			return info;
+		}
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
 		}
-		int info = 0;
 		sgetri_(&n,a,&n,ipiv,work,&lwork,&info);
 
 		for(i = 0; i < n; ++i ){
@@ -145,12 +200,18 @@ extern "C"{
 
 	DLLEXPORT int d_lu_inverse_factored(int n, double a[], int ipiv[], double work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_d_lu_inverse_factored, native_stats::lu_inverse_factored_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		int info = 0;
+		if (small_matrix::lu_inverse_factored(n, a, ipiv, info)){
+			return info;
+		}
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
 		}
 
-		int info = 0;
 		dgetri_(&n,a,&n,ipiv,work,&lwork,&info);
 
 		for(i = 0; i < n; ++i ){
@@ -161,6 +222,8 @@ extern "C"{
 
 	DLLEXPORT int c_lu_inverse_factored(int n, MKL_Complex8 a[], int ipiv[], MKL_Complex8 work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_c_lu_inverse_factored, 4 * (native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -177,6 +240,8 @@ extern "C"{
 
 	DLLEXPORT int z_lu_inverse_factored(int n, MKL_Complex16 a[], int ipiv[], MKL_Complex16 work[], int lwork)
 	{
+		NativeStatsScope stats(STATS_z_lu_inverse_factored, 4 * (native_stats::lu_inverse_factored_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		int i;
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -193,7 +258,13 @@ extern "C"{
 
 	DLLEXPORT int s_lu_solve_factored(int n, int nrhs, float a[], int ipiv[], float b[])
 	{
+		NativeStatsScope stats(STATS_s_lu_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_solve_factored(n, nrhs, a, ipiv, b)){
+			return info;
+		}
+
 		int i;    
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -209,7 +280,13 @@ extern "C"{
 
 	DLLEXPORT int  d_lu_solve_factored(int n, int nrhs, double a[], int ipiv[], double b[])
 	{
+		NativeStatsScope stats(STATS_d_lu_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
+		if (small_matrix::lu_solve_factored(n, nrhs, a, ipiv, b)){
+			return info;
+		}
+
 		int i;    
 		for(i = 0; i < n; ++i ){
 			ipiv[i] += 1;
@@ -225,6 +302,8 @@ extern "C"{
 
 	DLLEXPORT int c_lu_solve_factored(int n, int nrhs, MKL_Complex8 a[], int ipiv[], MKL_Complex8 b[])
 	{
+		NativeStatsScope stats(STATS_c_lu_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
 		int i;    
 		for(i = 0; i < n; ++i ){
@@ -241,6 +320,8 @@ extern "C"{
 
 	DLLEXPORT int z_lu_solve_factored(int n, int nrhs, MKL_Complex16 a[], int ipiv[], MKL_Complex16 b[])
 	{
+		NativeStatsScope stats(STATS_z_lu_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		int info = 0;
 		int i;    
 		for(i = 0; i < n; ++i ){
@@ -255,98 +336,334 @@ extern "C"{
 		return info;
 	}
 
+	DLLEXPORT int s_lu_condition(char norm, int n, float a[], float anorm, float* rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_s_lu_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		float* work = scratch.alloc<float>(4 * n);
+		int* iwork = scratch.alloc<int>(n);
+		sgecon_(&norm, &n, a, &n, &anorm, rcond, work, iwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_lu_condition(char norm, int n, double a[], double anorm, double* rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_d_lu_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		double* work = scratch.alloc<double>(4 * n);
+		int* iwork = scratch.alloc<int>(n);
+		dgecon_(&norm, &n, a, &n, &anorm, rcond, work, iwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_lu_condition(char norm, int n, MKL_Complex8 a[], float anorm, float* rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_c_lu_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(2 * n);
+		float* rwork = scratch.alloc<float>(2 * n);
+		cgecon_(&norm, &n, a, &n, &anorm, rcond, work, rwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_lu_condition(char norm, int n, MKL_Complex16 a[], double anorm, double* rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_z_lu_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(2 * n);
+		double* rwork = scratch.alloc<double>(2 * n);
+		zgecon_(&norm, &n, a, &n, &anorm, rcond, work, rwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_lu_determinant(int n, float a[], int ipiv[], float* log_abs, float* sign)
+	{
+		NativeStatsScope stats(STATS_s_lu_determinant, native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would.
+		*log_abs = 0;
+		*sign = 1;
+		for (int i = 0; i < n; ++i)
+		{
+			float u = a[i * n + i];
+			if (u == 0)
+			{
+				*log_abs = -std::numeric_limits<float>::infinity();
+				*sign = 0;
+				return i + 1;
+			}
+
+			if ((u < 0) != (ipiv[i] != i))
+			{
+				*sign = -*sign;
+			}
+
+			*log_abs += std::log(std::abs(u));
+		}
+
+		return 0;
+	}
+
+	DLLEXPORT int d_lu_determinant(int n, double a[], int ipiv[], double* log_abs, double* sign)
+	{
+		NativeStatsScope stats(STATS_d_lu_determinant, native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would.
+		*log_abs = 0;
+		*sign = 1;
+		for (int i = 0; i < n; ++i)
+		{
+			double u = a[i * n + i];
+			if (u == 0)
+			{
+				*log_abs = -std::numeric_limits<double>::infinity();
+				*sign = 0;
+				return i + 1;
+			}
+
+			if ((u < 0) != (ipiv[i] != i))
+			{
+				*sign = -*sign;
+			}
+
+			*log_abs += std::log(std::abs(u));
+		}
+
+		return 0;
+	}
+
+	DLLEXPORT int c_lu_determinant(int n, MKL_Complex8 a[], int ipiv[], float* log_abs, MKL_Complex8* sign)
+	{
+		NativeStatsScope stats(STATS_c_lu_determinant, 4 * native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would;
+		// the sign is the product of the pivots' phases.
+		*log_abs = 0;
+		sign->real = 1;
+		sign->imag = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			MKL_Complex8 u = a[i * n + i];
+			float magnitude = std::hypot(u.real, u.imag);
+			if (magnitude == 0)
+			{
+				*log_abs = -std::numeric_limits<float>::infinity();
+				sign->real = 0;
+				sign->imag = 0;
+				return i + 1;
+			}
+
+			float phase_re = u.real / magnitude;
+			float phase_im = u.imag / magnitude;
+			if (ipiv[i] != i)
+			{
+				phase_re = -phase_re;
+				phase_im = -phase_im;
+			}
+
+			float sign_re = sign->real * phase_re - sign->imag * phase_im;
+			sign->imag = sign->real * phase_im + sign->imag * phase_re;
+			sign->real = sign_re;
+			*log_abs += std::log(magnitude);
+		}
+
+		return 0;
+	}
+
+	DLLEXPORT int z_lu_determinant(int n, MKL_Complex16 a[], int ipiv[], double* log_abs, MKL_Complex16* sign)
+	{
+		NativeStatsScope stats(STATS_z_lu_determinant, 4 * native_stats::determinant_flops(n), (double)n * sizeof(a[0]));
+
+		// Summing the logarithms of the pivots cannot overflow or underflow where their product would;
+		// the sign is the product of the pivots' phases.
+		*log_abs = 0;
+		sign->real = 1;
+		sign->imag = 0;
+		for (int i = 0; i < n; ++i)
+		{
+			MKL_Complex16 u = a[i * n + i];
+			double magnitude = std::hypot(u.real, u.imag);
+			if (magnitude == 0)
+			{
+				*log_abs = -std::numeric_limits<double>::infinity();
+				sign->real = 0;
+				sign->imag = 0;
+				return i + 1;
+			}
+
+			double phase_re = u.real / magnitude;
+			double phase_im = u.imag / magnitude;
+			if (ipiv[i] != i)
+			{
+				phase_re = -phase_re;
+				phase_im = -phase_im;
+			}
+
+			double sign_re = sign->real * phase_re - sign->imag * phase_im;
+			sign->imag = sign->real * phase_im + sign->imag * phase_re;
+			sign->real = sign_re;
+			*log_abs += std::log(magnitude);
+		}
+
+		return 0;
+	}
+
 	DLLEXPORT int s_lu_solve(int n, int nrhs, float a[], float b[])
+	try
 	{
-		float* clone = new float[n*n];
+		NativeStatsScope stats(STATS_s_lu_solve, native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		float* clone = scratch.alloc<float>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(float));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::lu_factor(n, clone, ipiv, info)){
+			if (info == 0){
+				small_matrix::lu_solve_factored(n, nrhs, clone, ipiv, b);
+			}
+			return info;
+		}
+
 		sgetrf_(&n, &n, clone, &n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		sgetrs_(&trans, &n, &nrhs, clone, &n, ipiv, b, &n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int d_lu_solve(int n, int nrhs, double a[], double b[])
+	try
 	{
-		double* clone = new double[n*n];
+		NativeStatsScope stats(STATS_d_lu_solve, native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(double));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		if (small_matrix::lu_factor(n, clone, ipiv, info)){
+			if (info == 0){
+				small_matrix::lu_solve_factored(n, nrhs, clone, ipiv, b);
+			}
+			return info;
+		}
+
 		dgetrf_(&n, &n, clone, &n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		dgetrs_(&trans, &n, &nrhs, clone, &n, ipiv, b, &n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int c_lu_solve(int n, int nrhs, MKL_Complex8 a[], MKL_Complex8 b[])
+	try
 	{
-		MKL_Complex8* clone = new MKL_Complex8[n*n];
+		NativeStatsScope stats(STATS_c_lu_solve, 4 * (native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		MKL_Complex8* clone = scratch.alloc<MKL_Complex8>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(MKL_Complex8));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		cgetrf_(&n, &n, clone, &n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		cgetrs_(&trans, &n, &nrhs, clone, &n, ipiv, b, &n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int z_lu_solve(int n, int nrhs, MKL_Complex16 a[],  MKL_Complex16 b[])
+	try
 	{
-		MKL_Complex16* clone = new MKL_Complex16[n*n];
+		NativeStatsScope stats(STATS_z_lu_solve, 4 * (native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		MKL_Complex16* clone = scratch.alloc<MKL_Complex16>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(MKL_Complex16));
 
-		int* ipiv = new int[n];
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
 		zgetrf_(&n, &n, clone, &n, ipiv, &info);
 
 		if (info != 0){
-			delete[] ipiv;
-			delete[] clone;
 			return info;
 		}
 
 		char trans ='N';
 		zgetrs_(&trans, &n, &nrhs, clone, &n, ipiv, b, &n, &info);
-		delete[] ipiv;
-		delete[] clone;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	// Solves in single precision and refines the solution with double precision residuals. iterations
+	// receives the number of refinement steps, or a negative value when the solve fell back to
+	// double precision (see dsgesv).
+	DLLEXPORT int d_lu_solve_mixed(int n, int nrhs, double a[], double b[], int* iterations)
+	try
+	{
+		NativeStatsScope stats(STATS_d_lu_solve_mixed, native_stats::lu_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
+		std::memcpy(clone, a, n*n*sizeof(double));
+		double* x = scratch.alloc<double>(n*nrhs);
+		double* work = scratch.alloc<double>(n*nrhs);
+		float* swork = scratch.alloc<float>(n*(n+nrhs));
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		dsgesv_(&n, &nrhs, clone, &n, ipiv, b, &n, x, &n, work, swork, iterations, &info);
+
+		if (info == 0){
+			std::memcpy(b, x, n*nrhs*sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int s_cholesky_factor(int n, float a[]){
+		NativeStatsScope stats(STATS_s_cholesky_factor, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
-		spotrf_(&uplo, &n, a, &n, &info);
+		if (!small_matrix::cholesky_factor(n, a, info)){
+			spotrf_(&uplo, &n, a, &n, &info);
+		}
 		for (int i = 0; i < n; ++i)
 		{
 			int index = i * n;
@@ -359,9 +676,13 @@ extern "C"{
 	}
 
 	DLLEXPORT int d_cholesky_factor(int n, double* a){
+		NativeStatsScope stats(STATS_d_cholesky_factor, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
-		dpotrf_(&uplo, &n, a, &n, &info);
+		if (!small_matrix::cholesky_factor(n, a, info)){
+			dpotrf_(&uplo, &n, a, &n, &info);
+		}
 		for (int i = 0; i < n; ++i)
 		{
 			int index = i * n;
@@ -374,6 +695,8 @@ extern "C"{
 	}
 
 	DLLEXPORT int c_cholesky_factor(int n, MKL_Complex8 a[]){
+		NativeStatsScope stats(STATS_c_cholesky_factor, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		MKL_Complex8 zero = {0.0f, 0.0f};
@@ -390,6 +713,8 @@ extern "C"{
 	}
 
 	DLLEXPORT int z_cholesky_factor(int n, MKL_Complex16 a[]){
+		NativeStatsScope stats(STATS_z_cholesky_factor, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		MKL_Complex16 zero = {0.0, 0.0};
@@ -406,91 +731,159 @@ extern "C"{
 	}
 
 	DLLEXPORT int s_cholesky_solve(int n, int nrhs, float a[], float b[])
+	try
 	{
-		float* clone = new float[n*n];
+		NativeStatsScope stats(STATS_s_cholesky_solve, native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		float* clone = scratch.alloc<float>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(float));
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_factor(n, clone, info)){
+			if (info == 0){
+				small_matrix::cholesky_solve_factored(n, nrhs, clone, b);
+			}
+			return info;
+		}
+
 		spotrf_(&uplo, &n, clone, &n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		spotrs_(&uplo, &n, &nrhs, clone, &n, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int d_cholesky_solve(int n, int nrhs, double a[], double b[])
+	try
 	{
-		double* clone = new double[n*n];
+		NativeStatsScope stats(STATS_d_cholesky_solve, native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(double));
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_factor(n, clone, info)){
+			if (info == 0){
+				small_matrix::cholesky_solve_factored(n, nrhs, clone, b);
+			}
+			return info;
+		}
+
 		dpotrf_(&uplo, &n, clone, &n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		dpotrs_(&uplo, &n, &nrhs, clone, &n, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int c_cholesky_solve(int n, int nrhs, MKL_Complex8 a[], MKL_Complex8 b[])
+	try
 	{
-		MKL_Complex8* clone = new MKL_Complex8[n*n];
+		NativeStatsScope stats(STATS_c_cholesky_solve, 4 * (native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		MKL_Complex8* clone = scratch.alloc<MKL_Complex8>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(MKL_Complex8));
 		char uplo = 'L';
 		int info = 0;
 		cpotrf_(&uplo, &n, clone, &n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		cpotrs_(&uplo, &n, &nrhs, clone, &n, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int z_cholesky_solve(int n, int nrhs, MKL_Complex16 a[], MKL_Complex16 b[])
+	try
 	{
-		MKL_Complex16* clone = new MKL_Complex16[n*n];
+		NativeStatsScope stats(STATS_z_cholesky_solve, 4 * (native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		MKL_Complex16* clone = scratch.alloc<MKL_Complex16>(n*n);
 		std::memcpy(clone, a, n*n*sizeof(MKL_Complex16));
 		char uplo = 'L';
 		int info = 0;
 		zpotrf_(&uplo, &n, clone, &n, &info);
 
 		if (info != 0){
-			delete[] clone;
 			return info;
 		}
 
 		zpotrs_(&uplo, &n, &nrhs, clone, &n, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	// The Cholesky counterpart of d_lu_solve_mixed (see dsposv).
+	DLLEXPORT int d_cholesky_solve_mixed(int n, int nrhs, double a[], double b[], int* iterations)
+	try
+	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_mixed, native_stats::cholesky_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n*n);
+		std::memcpy(clone, a, n*n*sizeof(double));
+		double* x = scratch.alloc<double>(n*nrhs);
+		double* work = scratch.alloc<double>(n*nrhs);
+		float* swork = scratch.alloc<float>(n*(n+nrhs));
+		char uplo = 'L';
+		int info = 0;
+		dsposv_(&uplo, &n, &nrhs, clone, &n, b, &n, x, &n, work, swork, iterations, &info);
+
+		if (info == 0){
+			std::memcpy(b, x, n*nrhs*sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
 	DLLEXPORT int s_cholesky_solve_factored(int n, int nrhs, float a[], float b[])
 	{
+		NativeStatsScope stats(STATS_s_cholesky_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_solve_factored(n, nrhs, a, b)){
+			return info;
+		}
+
 		spotrs_(&uplo, &n, &nrhs, a, &n, b, &n, &info);
 		return info;
 	}
 
 	DLLEXPORT int d_cholesky_solve_factored(int n, int nrhs, double a[], double b[])
 	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
+		if (small_matrix::cholesky_solve_factored(n, nrhs, a, b)){
+			return info;
+		}
+
 		dpotrs_(&uplo, &n, &nrhs, a, &n, b, &n, &info);
 		return info;
 	}
 
 	DLLEXPORT int c_cholesky_solve_factored(int n, int nrhs, MKL_Complex8 a[], MKL_Complex8 b[])
 	{
+		NativeStatsScope stats(STATS_c_cholesky_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		cpotrs_(&uplo, &n, &nrhs, a, &n, b, &n, &info);
@@ -499,429 +892,3375 @@ extern "C"{
 
 	DLLEXPORT int z_cholesky_solve_factored(int n, int nrhs, MKL_Complex16 a[], MKL_Complex16 b[])
 	{
+		NativeStatsScope stats(STATS_z_cholesky_solve_factored, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
 		char uplo = 'L';
 		int info = 0;
 		zpotrs_(&uplo, &n, &nrhs, a, &n, b, &n, &info);
 		return info;
 	}
 
-	DLLEXPORT int s_qr_factor(int m, int n, float r[], float tau[], float q[], float work[], int len)
+	DLLEXPORT int s_cholesky_condition(int n, float a[], float anorm, float* rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_s_cholesky_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char uplo = 'L';
+		int info = 0;
+		float* work = scratch.alloc<float>(3 * n);
+		int* iwork = scratch.alloc<int>(n);
+		spocon_(&uplo, &n, a, &n, &anorm, rcond, work, iwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_cholesky_condition(int n, double a[], double anorm, double* rcond)
+	try
 	{
+		NativeStatsScope stats(STATS_d_cholesky_condition, native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char uplo = 'L';
 		int info = 0;
-		sgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+		double* work = scratch.alloc<double>(3 * n);
+		int* iwork = scratch.alloc<int>(n);
+		dpocon_(&uplo, &n, a, &n, &anorm, rcond, work, iwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		for (int i = 0; i < m; ++i)
-		{
-			for (int j = 0; j < m && j < n; ++j)
-			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
-			}
-		}
+	DLLEXPORT int c_cholesky_condition(int n, MKL_Complex8 a[], float anorm, float* rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_c_cholesky_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			sorgqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			sorgqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
+		ScratchScope scratch;
+		char uplo = 'L';
+		int info = 0;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(2 * n);
+		float* rwork = scratch.alloc<float>(n);
+		cpocon_(&uplo, &n, a, &n, &anorm, rcond, work, rwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_cholesky_condition(int n, MKL_Complex16 a[], double anorm, double* rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_z_cholesky_condition, 4 * native_stats::condition_estimate_flops(n), (double)n * n * sizeof(a[0]));
 
+		ScratchScope scratch;
+		char uplo = 'L';
+		int info = 0;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(2 * n);
+		double* rwork = scratch.alloc<double>(n);
+		zpocon_(&uplo, &n, a, &n, &anorm, rcond, work, rwork, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int d_qr_factor(int m, int n, double r[], double tau[], double q[], double work[], int len)
+	DLLEXPORT int s_ldlt_factor(int n, float a[], int ipiv[])
+	try
 	{
+		NativeStatsScope stats(STATS_s_ldlt_factor, native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char uplo = 'L';
 		int info = 0;
-		dgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		ssytrf_(&uplo, &n, a, &n, ipiv, &work_query, &lwork, &info);
 
-		for (int i = 0; i < m; ++i)
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		ssytrf_(&uplo, &n, a, &n, ipiv, work, &lwork, &info);
+
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
+		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < m && j < n; ++j)
+			if (ipiv[i] > 0)
 			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
+				ipiv[i] -= 1;
 			}
 		}
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			dorgqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			dorgqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
-
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int c_qr_factor(int m, int n, MKL_Complex8 r[], MKL_Complex8 tau[], MKL_Complex8 q[], MKL_Complex8 work[], int len)
+	DLLEXPORT int d_ldlt_factor(int n, double a[], int ipiv[])
+	try
 	{
+		NativeStatsScope stats(STATS_d_ldlt_factor, native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char uplo = 'L';
 		int info = 0;
-		cgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dsytrf_(&uplo, &n, a, &n, ipiv, &work_query, &lwork, &info);
 
-		for (int i = 0; i < m; ++i)
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dsytrf_(&uplo, &n, a, &n, ipiv, work, &lwork, &info);
+
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
+		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < m && j < n; ++j)
+			if (ipiv[i] > 0)
 			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
+				ipiv[i] -= 1;
 			}
 		}
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			cungqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			cungqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
-
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int z_qr_factor(int m, int n, MKL_Complex16 r[], MKL_Complex16 tau[], MKL_Complex16 q[], MKL_Complex16 work[], int len)
+	DLLEXPORT int c_ldlt_factor(int n, MKL_Complex8 a[], int ipiv[])
+	try
 	{
+		NativeStatsScope stats(STATS_c_ldlt_factor, 4 * native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char uplo = 'L';
 		int info = 0;
-		zgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		chetrf_(&uplo, &n, a, &n, ipiv, &work_query, &lwork, &info);
 
-		for (int i = 0; i < m; ++i)
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		chetrf_(&uplo, &n, a, &n, ipiv, work, &lwork, &info);
+
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
+		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < m && j < n; ++j)
+			if (ipiv[i] > 0)
 			{
-				if (i > j)
-				{
-					q[j * m + i] = r[j * m + i];
-				}
+				ipiv[i] -= 1;
 			}
 		}
 
-		//compute the q elements explicitly
-		if (m <= n)
-		{
-			zungqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
-		}
-		else
-		{
-			zungqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
-		}
-
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int s_qr_solve(int m, int n, int bn, float r[], float b[], float x[], float work[], int len)
+	DLLEXPORT int z_ldlt_factor(int n, MKL_Complex16 a[], int ipiv[])
+	try
 	{
-		int info = 0;
-		float* clone_r = new float[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(float));
-
-		float* tau = new float[std::max(1, std::min(m,n))];
-		sgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+		NativeStatsScope stats(STATS_z_ldlt_factor, 4 * native_stats::ldlt_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
 
-		if (info != 0)
-		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
-		}
+		ScratchScope scratch;
+		char uplo = 'L';
+		int info = 0;
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zhetrf_(&uplo, &n, a, &n, ipiv, &work_query, &lwork, &info);
 
-		float* clone_b = new float[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(float));
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zhetrf_(&uplo, &n, a, &n, ipiv, work, &lwork, &info);
 
-		char side ='L';
-		char tran = 'T';
-		sormqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
-		cblas_strsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, clone_r, m, clone_b, m);
+		// A 1 by 1 pivot k interchanges rows k and ipiv[k]; both entries of a 2 by 2 pivot hold the ones'
+		// complement of the row interchanged with its second row, which LAPACK's negative pivots already are.
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_r;
-		delete[] tau;
-		delete[] clone_b;
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int d_qr_solve(int m, int n, int bn, double r[], double b[], double x[], double work[], int len)
+	DLLEXPORT int s_ldlt_solve_factored(int n, int nrhs, float a[], int ipiv[], float b[])
 	{
-		int info = 0;
-		double* clone_r = new double[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(double));
-
-		double* tau = new double[std::max(1, std::min(m,n))];
-		dgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+		NativeStatsScope stats(STATS_s_ldlt_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		if (info != 0)
+		for (int i = 0; i < n; ++i)
 		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
+			if (ipiv[i] >= 0)
+			{
+				ipiv[i] += 1;
+			}
 		}
 
-		double* clone_b = new double[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(double));
-
-		char side ='L';
-		char tran = 'T';
+		char uplo = 'L';
+		int info = 0;
+		ssytrs_(&uplo, &n, &nrhs, a, &n, ipiv, b, &n, &info);
 
-		dormqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
-		cblas_dtrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, clone_r, m, clone_b, m);
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_b;
-		delete[] tau;
-		delete[] clone_r;
 		return info;
 	}
 
-	DLLEXPORT int c_qr_solve(int m, int n, int bn, MKL_Complex8 r[], MKL_Complex8 b[], MKL_Complex8 x[], MKL_Complex8 work[], int len)
+	DLLEXPORT int d_ldlt_solve_factored(int n, int nrhs, double a[], int ipiv[], double b[])
 	{
-		int info = 0;
-		MKL_Complex8* clone_r = new MKL_Complex8[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(MKL_Complex8));
-
-		MKL_Complex8* tau = new MKL_Complex8[std::min(m,n)];
-		cgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+		NativeStatsScope stats(STATS_d_ldlt_solve_factored, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		if (info != 0)
+		for (int i = 0; i < n; ++i)
 		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
+			if (ipiv[i] >= 0)
+			{
+				ipiv[i] += 1;
+			}
 		}
 
-		char side ='L';
-		char tran = 'C';
-
-		MKL_Complex8* clone_b = new MKL_Complex8[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex8));
-
-		cunmqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
-		MKL_Complex8 one = {1.0, 0.0};
-		cblas_ctrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, clone_r, m, clone_b, m);
+		char uplo = 'L';
+		int info = 0;
+		dsytrs_(&uplo, &n, &nrhs, a, &n, ipiv, b, &n, &info);
 
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_r;
-		delete[] tau;
-		delete[] clone_b;
 		return info;
 	}
 
-	DLLEXPORT int z_qr_solve(int m, int n, int bn, MKL_Complex16 r[], MKL_Complex16 b[], MKL_Complex16 x[], MKL_Complex16 work[], int len)
+	DLLEXPORT int c_ldlt_solve_factored(int n, int nrhs, MKL_Complex8 a[], int ipiv[], MKL_Complex8 b[])
 	{
-		int info = 0;
-		MKL_Complex16* clone_r = new MKL_Complex16[m*n];
-		std::memcpy(clone_r, r, m*n*sizeof(MKL_Complex16));
-
-		MKL_Complex16* tau = new MKL_Complex16[std::min(m,n)];
-		zgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+		NativeStatsScope stats(STATS_c_ldlt_solve_factored, 4 * native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		if (info != 0)
+		for (int i = 0; i < n; ++i)
 		{
-			delete[] clone_r;
-			delete[] tau;
-			return info;
+			if (ipiv[i] >= 0)
+			{
+				ipiv[i] += 1;
+			}
 		}
 
-		char side ='L';
-		char tran = 'C';
-
-		MKL_Complex16* clone_b = new MKL_Complex16[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex16));
-
-		zunmqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
-		MKL_Complex16 one = {1.0, 0.0};
-		cblas_ztrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, clone_r, m, clone_b, m);
+		char uplo = 'L';
+		int info = 0;
+		chetrs_(&uplo, &n, &nrhs, a, &n, ipiv, b, &n, &info);
 
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_r;
-		delete[] tau;
-		delete[] clone_b;
 		return info;
 	}
 
-	DLLEXPORT int s_qr_solve_factored(int m, int n, int bn, float r[], float b[], float tau[], float x[], float work[], int len)
+	DLLEXPORT int z_ldlt_solve_factored(int n, int nrhs, MKL_Complex16 a[], int ipiv[], MKL_Complex16 b[])
 	{
-		char side ='L';
-		char tran = 'T';
-		int info = 0;
+		NativeStatsScope stats(STATS_z_ldlt_solve_factored, 4 * native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
 
-		float* clone_b = new float[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(float));
+		for (int i = 0; i < n; ++i)
+		{
+			if (ipiv[i] >= 0)
+			{
+				ipiv[i] += 1;
+			}
+		}
+
+		char uplo = 'L';
+		int info = 0;
+		zhetrs_(&uplo, &n, &nrhs, a, &n, ipiv, b, &n, &info);
 
-		sormqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
-		cblas_strsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, r, m, clone_b, m);
 		for (int i = 0; i < n; ++i)
 		{
-			for (int j = 0; j < bn; ++j)
+			if (ipiv[i] > 0)
 			{
-				x[j * n + i] = clone_b[j * m + i];
+				ipiv[i] -= 1;
 			}
 		}
 
-		delete[] clone_b;
 		return info;
 	}
 
-	DLLEXPORT int d_qr_solve_factored(int m, int n, int bn, double r[], double b[], double tau[], double x[], double work[], int len)
+	DLLEXPORT int s_ldlt_solve(int n, int nrhs, float a[], float b[])
+	try
 	{
-		char side ='L';
-		char tran = 'T';
+		NativeStatsScope stats(STATS_s_ldlt_solve, (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		float* clone = scratch.alloc<float>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(float));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
 		int info = 0;
 
-		double* clone_b = new double[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(double));
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		ssysv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, &work_query, &lwork, &info);
 
-		dormqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
-		cblas_dtrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, r, m, clone_b, m);
-		for (int i = 0; i < n; ++i)
-		{
-			for (int j = 0; j < bn; ++j)
-			{
-				x[j * n + i] = clone_b[j * m + i];
-			}
-		}
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		ssysv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, work, &lwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_ldlt_solve(int n, int nrhs, double a[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_ldlt_solve, (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		double* clone = scratch.alloc<double>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(double));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dsysv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, &work_query, &lwork, &info);
 
-		delete[] clone_b;
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dsysv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, work, &lwork, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int c_qr_solve_factored(int m, int n, int bn, MKL_Complex8 r[], MKL_Complex8 b[], MKL_Complex8 tau[], MKL_Complex8 x[], MKL_Complex8 work[], int len)
+	DLLEXPORT int c_ldlt_solve(int n, int nrhs, MKL_Complex8 a[], MKL_Complex8 b[])
+	try
 	{
-		char side ='L';
-		char tran = 'C';
+		NativeStatsScope stats(STATS_c_ldlt_solve, 4 * (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		MKL_Complex8* clone = scratch.alloc<MKL_Complex8>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(MKL_Complex8));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
 		int info = 0;
 
-		MKL_Complex8* clone_b = new MKL_Complex8[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex8));
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		chesv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, &work_query, &lwork, &info);
 
-		cunmqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
-		MKL_Complex8 one = {1.0f, 0.0f};
-		cblas_ctrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, r, m, clone_b, m);
-		for (int i = 0; i < n; ++i)
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		chesv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, work, &lwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_ldlt_solve(int n, int nrhs, MKL_Complex16 a[], MKL_Complex16 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_ldlt_solve, 4 * (native_stats::ldlt_factor_flops(n) + native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		MKL_Complex16* clone = scratch.alloc<MKL_Complex16>(n * n);
+		std::memcpy(clone, a, n * n * sizeof(MKL_Complex16));
+		int* ipiv = scratch.alloc<int>(n);
+		char uplo = 'L';
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zhesv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, &work_query, &lwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zhesv_(&uplo, &n, &nrhs, clone, &n, ipiv, b, &n, work, &lwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_band_lu_solve(int n, int kl, int ku, int nrhs, float ab[], float b[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_band_lu_solve, native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		float* work = scratch.alloc<float>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(float));
+		for (int j = 0; j < n; ++j)
 		{
-			for (int j = 0; j < bn; ++j)
-			{
-				x[j * n + i] = clone_b[j * m + i];
-			}
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(float));
 		}
 
-		delete[] clone_b;
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		sgbsv_(&n, &kl, &ku, &nrhs, work, &ldwork, ipiv, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int z_qr_solve_factored(int m, int n, int bn, MKL_Complex16 r[], MKL_Complex16 b[], MKL_Complex16 tau[], MKL_Complex16 x[], MKL_Complex16 work[], int len)
+	DLLEXPORT int d_band_lu_solve(int n, int kl, int ku, int nrhs, double ab[], double b[])
+	try
 	{
-		char side ='L';
-		char tran = 'C';
+		NativeStatsScope stats(STATS_d_band_lu_solve, native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		double* work = scratch.alloc<double>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(double));
+		for (int j = 0; j < n; ++j)
+		{
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(double));
+		}
+
+		int* ipiv = scratch.alloc<int>(n);
 		int info = 0;
+		dgbsv_(&n, &kl, &ku, &nrhs, work, &ldwork, ipiv, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		MKL_Complex16* clone_b = new MKL_Complex16[m*bn];
-		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex16));
+	DLLEXPORT int c_band_lu_solve(int n, int kl, int ku, int nrhs, MKL_Complex8 ab[], MKL_Complex8 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_band_lu_solve, 4 * native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(MKL_Complex8));
+		for (int j = 0; j < n; ++j)
+		{
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(MKL_Complex8));
+		}
 
-		zunmqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
-		MKL_Complex16 one = {1.0, 0.0};
-		cblas_ztrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, r, m, clone_b, m);
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		cgbsv_(&n, &kl, &ku, &nrhs, work, &ldwork, ipiv, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		for (int i = 0; i < n; ++i)
+	DLLEXPORT int z_band_lu_solve(int n, int kl, int ku, int nrhs, MKL_Complex16 ab[], MKL_Complex16 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_band_lu_solve, 4 * native_stats::band_lu_solve_flops(n, kl, ku, nrhs), ((kl + ku + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		// gbsv needs kl extra rows above the band for the fill-in of the row interchanges.
+		ScratchScope scratch;
+		int ld = kl + ku + 1;
+		int ldwork = 2 * kl + ku + 1;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(ldwork * n);
+		std::memset(work, 0, ldwork * n * sizeof(MKL_Complex16));
+		for (int j = 0; j < n; ++j)
 		{
-			for (int j = 0; j < bn; ++j)
-			{
-				x[j * n + i] = clone_b[j * m + i];
-			}
+			std::memcpy(work + j * ldwork + kl, ab + j * ld, ld * sizeof(MKL_Complex16));
 		}
 
-		delete[] clone_b;
+		int* ipiv = scratch.alloc<int>(n);
+		int info = 0;
+		zgbsv_(&n, &kl, &ku, &nrhs, work, &ldwork, ipiv, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int s_svd_factor(bool compute_vectors, int m, int n, float a[], float s[], float u[], float v[], float work[], int len)
+	DLLEXPORT int s_band_cholesky_solve(int n, int kd, int nrhs, float ab[], float b[])
+	try
 	{
+		NativeStatsScope stats(STATS_s_band_cholesky_solve, native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		ScratchScope scratch;
+		int ld = kd + 1;
+		float* clone = scratch.alloc<float>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(float));
+		char uplo = 'L';
 		int info = 0;
-		char job = compute_vectors ? 'A' : 'N';
-		sgesvd_(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info);
+		spbsv_(&uplo, &n, &kd, &nrhs, clone, &ld, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int d_svd_factor(bool compute_vectors, int m, int n, double a[], double s[], double u[], double v[], double work[], int len)
+	DLLEXPORT int d_band_cholesky_solve(int n, int kd, int nrhs, double ab[], double b[])
+	try
 	{
+		NativeStatsScope stats(STATS_d_band_cholesky_solve, native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		ScratchScope scratch;
+		int ld = kd + 1;
+		double* clone = scratch.alloc<double>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(double));
+		char uplo = 'L';
 		int info = 0;
-		char job = compute_vectors ? 'A' : 'N';
-		dgesvd_(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info);
+		dpbsv_(&uplo, &n, &kd, &nrhs, clone, &ld, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int c_svd_factor(bool compute_vectors, int m, int n, MKL_Complex8 a[], MKL_Complex8 s[], MKL_Complex8 u[], MKL_Complex8 v[], MKL_Complex8 work[], int len)
+	DLLEXPORT int c_band_cholesky_solve(int n, int kd, int nrhs, MKL_Complex8 ab[], MKL_Complex8 b[])
+	try
 	{
+		NativeStatsScope stats(STATS_c_band_cholesky_solve, 4 * native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
+
+		ScratchScope scratch;
+		int ld = kd + 1;
+		MKL_Complex8* clone = scratch.alloc<MKL_Complex8>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(MKL_Complex8));
+		char uplo = 'L';
 		int info = 0;
-		int dim_s = std::min(m,n);
-		float* rwork = new float[5 * dim_s];
-		float* s_local = new float[dim_s];
-		char job = compute_vectors ? 'A' : 'N';
-		cgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info);
+		cpbsv_(&uplo, &n, &kd, &nrhs, clone, &ld, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		for(int index = 0; index < dim_s; ++index){
-			MKL_Complex8 value = {s_local[index], 0.0f};
-			s[index] = value;
-		}
+	DLLEXPORT int z_band_cholesky_solve(int n, int kd, int nrhs, MKL_Complex16 ab[], MKL_Complex16 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_band_cholesky_solve, 4 * native_stats::band_cholesky_solve_flops(n, kd, nrhs), ((kd + 1.0) * n + 2.0 * n * nrhs) * sizeof(ab[0]));
 
-		delete[] rwork;
-		delete[] s_local;
+		ScratchScope scratch;
+		int ld = kd + 1;
+		MKL_Complex16* clone = scratch.alloc<MKL_Complex16>(ld * n);
+		std::memcpy(clone, ab, ld * n * sizeof(MKL_Complex16));
+		char uplo = 'L';
+		int info = 0;
+		zpbsv_(&uplo, &n, &kd, &nrhs, clone, &ld, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-	DLLEXPORT int z_svd_factor(bool compute_vectors, int m, int n, MKL_Complex16 a[], MKL_Complex16 s[], MKL_Complex16 u[], MKL_Complex16 v[], MKL_Complex16 work[], int len)
+	DLLEXPORT int s_tridiagonal_solve(int n, int nrhs, float dl[], float d[], float du[], float b[])
+	try
 	{
+		NativeStatsScope stats(STATS_s_tridiagonal_solve, native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(3 * n);
+		float* dlw = dw + n;
+		float* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(float));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(float));
+		std::memcpy(duw, du, (n - 1) * sizeof(float));
 		int info = 0;
-		int dim_s = std::min(m,n);
-		double* rwork = new double[5 * std::min(m, n)];
-		double* s_local = new double[dim_s];
-		char job = compute_vectors ? 'A' : 'N';
-		zgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info);
+		sgtsv_(&n, &nrhs, dlw, dw, duw, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		for(int index = 0; index < dim_s; ++index){
-			MKL_Complex16 value = {s_local[index], 0.0f};
-			s[index] = value;
-		}
+	DLLEXPORT int d_tridiagonal_solve(int n, int nrhs, double dl[], double d[], double du[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_tridiagonal_solve, native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(3 * n);
+		double* dlw = dw + n;
+		double* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(double));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(double));
+		std::memcpy(duw, du, (n - 1) * sizeof(double));
+		int info = 0;
+		dgtsv_(&n, &nrhs, dlw, dw, duw, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
 
-		delete[] rwork;
-		delete[] s_local;
+	DLLEXPORT int c_tridiagonal_solve(int n, int nrhs, MKL_Complex8 dl[], MKL_Complex8 d[], MKL_Complex8 du[], MKL_Complex8 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_tridiagonal_solve, 4 * native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		MKL_Complex8* dw = scratch.alloc<MKL_Complex8>(3 * n);
+		MKL_Complex8* dlw = dw + n;
+		MKL_Complex8* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(MKL_Complex8));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(MKL_Complex8));
+		std::memcpy(duw, du, (n - 1) * sizeof(MKL_Complex8));
+		int info = 0;
+		cgtsv_(&n, &nrhs, dlw, dw, duw, b, &n, &info);
 		return info;
 	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_tridiagonal_solve(int n, int nrhs, MKL_Complex16 dl[], MKL_Complex16 d[], MKL_Complex16 du[], MKL_Complex16 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_tridiagonal_solve, 4 * native_stats::tridiagonal_solve_flops(n, nrhs), (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// gtsv overwrites the diagonals with its factors, so factor copies.
+		ScratchScope scratch;
+		MKL_Complex16* dw = scratch.alloc<MKL_Complex16>(3 * n);
+		MKL_Complex16* dlw = dw + n;
+		MKL_Complex16* duw = dlw + n;
+		std::memcpy(dw, d, n * sizeof(MKL_Complex16));
+		std::memcpy(dlw, dl, (n - 1) * sizeof(MKL_Complex16));
+		std::memcpy(duw, du, (n - 1) * sizeof(MKL_Complex16));
+		int info = 0;
+		zgtsv_(&n, &nrhs, dlw, dw, duw, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_tridiagonal_solve_batch(int n, int nrhs, int count, float dl[], float d[], float du[], float b[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_tridiagonal_solve_batch, count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(3 * n);
+		float* dlw = dw + n;
+		float* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(float));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(float));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(float));
+			sgtsv_(&n, &nrhs, dlw, dw, duw, b + k * n * nrhs, &n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_tridiagonal_solve_batch(int n, int nrhs, int count, double dl[], double d[], double du[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_tridiagonal_solve_batch, count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(3 * n);
+		double* dlw = dw + n;
+		double* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(double));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(double));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(double));
+			dgtsv_(&n, &nrhs, dlw, dw, duw, b + k * n * nrhs, &n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_tridiagonal_solve_batch(int n, int nrhs, int count, MKL_Complex8 dl[], MKL_Complex8 d[], MKL_Complex8 du[], MKL_Complex8 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_tridiagonal_solve_batch, 4 * count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		MKL_Complex8* dw = scratch.alloc<MKL_Complex8>(3 * n);
+		MKL_Complex8* dlw = dw + n;
+		MKL_Complex8* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(MKL_Complex8));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(MKL_Complex8));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(MKL_Complex8));
+			cgtsv_(&n, &nrhs, dlw, dw, duw, b + k * n * nrhs, &n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_tridiagonal_solve_batch(int n, int nrhs, int count, MKL_Complex16 dl[], MKL_Complex16 d[], MKL_Complex16 du[], MKL_Complex16 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_tridiagonal_solve_batch, 4 * count * native_stats::tridiagonal_solve_flops(n, nrhs), count * (3.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// One P/Invoke call for the whole batch; gtsv still runs serially, once per system. System k starts at
+		// d + k*n, dl and du + k*(n-1) and b + k*n*nrhs.
+		ScratchScope scratch;
+		MKL_Complex16* dw = scratch.alloc<MKL_Complex16>(3 * n);
+		MKL_Complex16* dlw = dw + n;
+		MKL_Complex16* duw = dlw + n;
+		int info = 0;
+		int singular = 0;
+		for (int k = 0; k < count; ++k)
+		{
+			std::memcpy(dw, d + k * n, n * sizeof(MKL_Complex16));
+			std::memcpy(dlw, dl + k * (n - 1), (n - 1) * sizeof(MKL_Complex16));
+			std::memcpy(duw, du + k * (n - 1), (n - 1) * sizeof(MKL_Complex16));
+			zgtsv_(&n, &nrhs, dlw, dw, duw, b + k * n * nrhs, &n, &info);
+			if (info < 0)
+			{
+				return info;
+			}
+
+			if (info > 0 && singular == 0)
+			{
+				singular = k + 1;
+			}
+		}
+
+		// A singular system does not stop the rest of the batch; report one more than the index of the first.
+		return singular;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_positive_definite_tridiagonal_solve(int n, int nrhs, float d[], float e[], float b[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_positive_definite_tridiagonal_solve, native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors, so factor copies.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(n);
+		std::memcpy(dw, d, n * sizeof(float));
+		float* ew = scratch.alloc<float>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(float));
+		int info = 0;
+		sptsv_(&n, &nrhs, dw, ew, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_positive_definite_tridiagonal_solve(int n, int nrhs, double d[], double e[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_positive_definite_tridiagonal_solve, native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors, so factor copies.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(n);
+		std::memcpy(dw, d, n * sizeof(double));
+		double* ew = scratch.alloc<double>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(double));
+		int info = 0;
+		dptsv_(&n, &nrhs, dw, ew, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_positive_definite_tridiagonal_solve(int n, int nrhs, MKL_Complex8 d[], MKL_Complex8 e[], MKL_Complex8 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_positive_definite_tridiagonal_solve, 4 * native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors; the diagonal of a Hermitian matrix is real.
+		ScratchScope scratch;
+		float* dw = scratch.alloc<float>(n);
+		for (int i = 0; i < n; ++i)
+		{
+			dw[i] = d[i].real;
+		}
+		MKL_Complex8* ew = scratch.alloc<MKL_Complex8>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(MKL_Complex8));
+		int info = 0;
+		cptsv_(&n, &nrhs, dw, ew, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_positive_definite_tridiagonal_solve(int n, int nrhs, MKL_Complex16 d[], MKL_Complex16 e[], MKL_Complex16 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_positive_definite_tridiagonal_solve, 4 * native_stats::positive_definite_tridiagonal_solve_flops(n, nrhs), (2.0 * n + 2.0 * n * nrhs) * sizeof(d[0]));
+
+		// ptsv overwrites d and e with the L*D*L' factors; the diagonal of a Hermitian matrix is real.
+		ScratchScope scratch;
+		double* dw = scratch.alloc<double>(n);
+		for (int i = 0; i < n; ++i)
+		{
+			dw[i] = d[i].real;
+		}
+		MKL_Complex16* ew = scratch.alloc<MKL_Complex16>(n);
+		std::memcpy(ew, e, (n - 1) * sizeof(MKL_Complex16));
+		int info = 0;
+		zptsv_(&n, &nrhs, dw, ew, b, &n, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_factor(int m, int n, float r[], float tau[], float q[], float work[], int len)
+	{
+		NativeStatsScope stats(STATS_s_qr_factor, native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n)), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		sgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			sorgqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			sorgqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int d_qr_factor(int m, int n, double r[], double tau[], double q[], double work[], int len)
+	{
+		NativeStatsScope stats(STATS_d_qr_factor, native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n)), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		dgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			dorgqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			dorgqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int c_qr_factor(int m, int n, MKL_Complex8 r[], MKL_Complex8 tau[], MKL_Complex8 q[], MKL_Complex8 work[], int len)
+	{
+		NativeStatsScope stats(STATS_c_qr_factor, 4 * (native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n))), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		cgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			cungqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			cungqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int z_qr_factor(int m, int n, MKL_Complex16 r[], MKL_Complex16 tau[], MKL_Complex16 q[], MKL_Complex16 work[], int len)
+	{
+		NativeStatsScope stats(STATS_z_qr_factor, 4 * (native_stats::qr_factor_flops(m, n) + (m <= n ? native_stats::qr_apply_flops(m, m, m) : native_stats::qr_apply_flops(m, n, n))), (2.0 * m * n + (double)m * m) * sizeof(r[0]));
+
+		int info = 0;
+		zgeqrf_(&m, &n, r, &m, tau, work, &len, &info);
+
+		for (int i = 0; i < m; ++i)
+		{
+			for (int j = 0; j < m && j < n; ++j)
+			{
+				if (i > j)
+				{
+					q[j * m + i] = r[j * m + i];
+				}
+			}
+		}
+
+		//compute the q elements explicitly
+		if (m <= n)
+		{
+			zungqr_(&m, &m, &m, q, &m, tau, work, &len, &info);
+		}
+		else
+		{
+			zungqr_(&m, &n, &n, q, &m, tau, work, &len, &info);
+		}
+
+		return info;
+	}
+
+	DLLEXPORT int s_qr_solve(int m, int n, int bn, float r[], float b[], float x[], float work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_s_qr_solve, native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		float* clone_r = scratch.alloc<float>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(float));
+
+		float* tau = scratch.alloc<float>(std::max(1, std::min(m,n)));
+		sgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		float* clone_b = scratch.alloc<float>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(float));
+
+		char side ='L';
+		char tran = 'T';
+		sormqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
+		cblas_strsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, clone_r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_qr_solve(int m, int n, int bn, double r[], double b[], double x[], double work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_d_qr_solve, native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		double* clone_r = scratch.alloc<double>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(double));
+
+		double* tau = scratch.alloc<double>(std::max(1, std::min(m,n)));
+		dgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		double* clone_b = scratch.alloc<double>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(double));
+
+		char side ='L';
+		char tran = 'T';
+
+		dormqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
+		cblas_dtrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, clone_r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_qr_solve(int m, int n, int bn, MKL_Complex8 r[], MKL_Complex8 b[], MKL_Complex8 x[], MKL_Complex8 work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_c_qr_solve, 4 * (native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		MKL_Complex8* clone_r = scratch.alloc<MKL_Complex8>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(MKL_Complex8));
+
+		MKL_Complex8* tau = scratch.alloc<MKL_Complex8>(std::min(m,n));
+		cgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		char side ='L';
+		char tran = 'C';
+
+		MKL_Complex8* clone_b = scratch.alloc<MKL_Complex8>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex8));
+
+		cunmqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
+		MKL_Complex8 one = {1.0, 0.0};
+		cblas_ctrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, clone_r, m, clone_b, m);
+
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_qr_solve(int m, int n, int bn, MKL_Complex16 r[], MKL_Complex16 b[], MKL_Complex16 x[], MKL_Complex16 work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_z_qr_solve, 4 * (native_stats::qr_factor_flops(m, n) + native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), (2.0 * m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		MKL_Complex16* clone_r = scratch.alloc<MKL_Complex16>(m*n);
+		std::memcpy(clone_r, r, m*n*sizeof(MKL_Complex16));
+
+		MKL_Complex16* tau = scratch.alloc<MKL_Complex16>(std::min(m,n));
+		zgeqrf_(&m, &n, clone_r, &m, tau, work, &len, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		char side ='L';
+		char tran = 'C';
+
+		MKL_Complex16* clone_b = scratch.alloc<MKL_Complex16>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex16));
+
+		zunmqr_(&side, &tran, &m, &bn, &n, clone_r, &m, tau, clone_b, &m, work, &len, &info);
+		MKL_Complex16 one = {1.0, 0.0};
+		cblas_ztrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, clone_r, m, clone_b, m);
+
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_solve_factored(int m, int n, int bn, float r[], float b[], float tau[], float x[], float work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_s_qr_solve_factored, native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'T';
+		int info = 0;
+
+		float* clone_b = scratch.alloc<float>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(float));
+
+		sormqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
+		cblas_strsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_qr_solve_factored(int m, int n, int bn, double r[], double b[], double tau[], double x[], double work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_d_qr_solve_factored, native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn, ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'T';
+		int info = 0;
+
+		double* clone_b = scratch.alloc<double>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(double));
+
+		dormqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
+		cblas_dtrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, 1.0, r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_qr_solve_factored(int m, int n, int bn, MKL_Complex8 r[], MKL_Complex8 b[], MKL_Complex8 tau[], MKL_Complex8 x[], MKL_Complex8 work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_c_qr_solve_factored, 4 * (native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'C';
+		int info = 0;
+
+		MKL_Complex8* clone_b = scratch.alloc<MKL_Complex8>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex8));
+
+		cunmqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
+		MKL_Complex8 one = {1.0f, 0.0f};
+		cblas_ctrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, r, m, clone_b, m);
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_qr_solve_factored(int m, int n, int bn, MKL_Complex16 r[], MKL_Complex16 b[], MKL_Complex16 tau[], MKL_Complex16 x[], MKL_Complex16 work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_z_qr_solve_factored, 4 * (native_stats::qr_apply_flops(m, bn, n) + n * (double)n * bn), ((double)m * n + (double)m * bn + (double)n * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side ='L';
+		char tran = 'C';
+		int info = 0;
+
+		MKL_Complex16* clone_b = scratch.alloc<MKL_Complex16>(m*bn);
+		std::memcpy(clone_b, b, m*bn*sizeof(MKL_Complex16));
+
+		zunmqr_(&side, &tran, &m, &bn, &n, r, &m, tau, clone_b, &m, work, &len, &info);
+		MKL_Complex16 one = {1.0, 0.0};
+		cblas_ztrsm(CblasColMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, n, bn, &one, r, m, clone_b, m);
+
+		for (int i = 0; i < n; ++i)
+		{
+			for (int j = 0; j < bn; ++j)
+			{
+				x[j * n + i] = clone_b[j * m + i];
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_factor_compact(int m, int n, float r[], float tau[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_qr_factor_compact, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		sgeqrf_(&m, &n, r, &m, tau, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		sgeqrf_(&m, &n, r, &m, tau, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_qr_factor_compact(int m, int n, double r[], double tau[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_qr_factor_compact, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dgeqrf_(&m, &n, r, &m, tau, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dgeqrf_(&m, &n, r, &m, tau, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_qr_factor_compact(int m, int n, MKL_Complex8 r[], MKL_Complex8 tau[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_qr_factor_compact, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		cgeqrf_(&m, &n, r, &m, tau, &work_query, &lwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		cgeqrf_(&m, &n, r, &m, tau, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_qr_factor_compact(int m, int n, MKL_Complex16 r[], MKL_Complex16 tau[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_qr_factor_compact, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zgeqrf_(&m, &n, r, &m, tau, &work_query, &lwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zgeqrf_(&m, &n, r, &m, tau, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_factor_pivoted(int m, int n, float r[], float tau[], int jpvt[], int* rank)
+	try
+	{
+		NativeStatsScope stats(STATS_s_qr_factor_pivoted, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		sgeqp3_(&m, &n, r, &m, jpvt, tau, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		sgeqp3_(&m, &n, r, &m, jpvt, tau, work, &lwork, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			float tolerance = std::max(m, n) * std::numeric_limits<float>::epsilon() * std::abs(r[0]);
+			while (*rank < k && std::abs(r[*rank * m + *rank]) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_qr_factor_pivoted(int m, int n, double r[], double tau[], int jpvt[], int* rank)
+	try
+	{
+		NativeStatsScope stats(STATS_d_qr_factor_pivoted, native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dgeqp3_(&m, &n, r, &m, jpvt, tau, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dgeqp3_(&m, &n, r, &m, jpvt, tau, work, &lwork, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			double tolerance = std::max(m, n) * std::numeric_limits<double>::epsilon() * std::abs(r[0]);
+			while (*rank < k && std::abs(r[*rank * m + *rank]) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_qr_factor_pivoted(int m, int n, MKL_Complex8 r[], MKL_Complex8 tau[], int jpvt[], int* rank)
+	try
+	{
+		NativeStatsScope stats(STATS_c_qr_factor_pivoted, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		float* rwork = scratch.alloc<float>(2 * n);
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		cgeqp3_(&m, &n, r, &m, jpvt, tau, &work_query, &lwork, rwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		cgeqp3_(&m, &n, r, &m, jpvt, tau, work, &lwork, rwork, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			float tolerance = std::max(m, n) * std::numeric_limits<float>::epsilon() * std::hypot(r[0].real, r[0].imag);
+			while (*rank < k && std::hypot(r[*rank * m + *rank].real, r[*rank * m + *rank].imag) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_qr_factor_pivoted(int m, int n, MKL_Complex16 r[], MKL_Complex16 tau[], int jpvt[], int* rank)
+	try
+	{
+		NativeStatsScope stats(STATS_z_qr_factor_pivoted, 4 * native_stats::qr_factor_flops(m, n), 2.0 * m * n * sizeof(r[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		double* rwork = scratch.alloc<double>(2 * n);
+
+		// All columns are free to move.
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] = 0;
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zgeqp3_(&m, &n, r, &m, jpvt, tau, &work_query, &lwork, rwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zgeqp3_(&m, &n, r, &m, jpvt, tau, work, &lwork, rwork, &info);
+
+		for (int j = 0; j < n; ++j)
+		{
+			jpvt[j] -= 1;
+		}
+
+		// The diagonal of R is non-increasing in magnitude, so the numerical rank is the number of
+		// leading entries above max(m, n) times the machine epsilon times the largest one.
+		*rank = 0;
+		int k = std::min(m, n);
+		if (k > 0)
+		{
+			double tolerance = std::max(m, n) * std::numeric_limits<double>::epsilon() * std::hypot(r[0].real, r[0].imag);
+			while (*rank < k && std::hypot(r[*rank * m + *rank].real, r[*rank * m + *rank].imag) > tolerance)
+			{
+				++*rank;
+			}
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_qr_apply_q(bool transpose, int m, int n, int bn, float r[], float tau[], float b[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_qr_apply_q, native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side = 'L';
+		char tran = transpose ? 'T' : 'N';
+		int k = std::min(m, n);
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		sormqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		sormqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_qr_apply_q(bool transpose, int m, int n, int bn, double r[], double tau[], double b[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_qr_apply_q, native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side = 'L';
+		char tran = transpose ? 'T' : 'N';
+		int k = std::min(m, n);
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dormqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dormqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_qr_apply_q(bool transpose, int m, int n, int bn, MKL_Complex8 r[], MKL_Complex8 tau[], MKL_Complex8 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_qr_apply_q, 4 * native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side = 'L';
+		char tran = transpose ? 'C' : 'N';
+		int k = std::min(m, n);
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		cunmqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, &work_query, &lwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		cunmqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_qr_apply_q(bool transpose, int m, int n, int bn, MKL_Complex16 r[], MKL_Complex16 tau[], MKL_Complex16 b[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_qr_apply_q, 4 * native_stats::qr_apply_flops(m, bn, std::min(m, n)), ((double)m * n + 2.0 * m * bn) * sizeof(r[0]));
+
+		ScratchScope scratch;
+		char side = 'L';
+		char tran = transpose ? 'C' : 'N';
+		int k = std::min(m, n);
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zunmqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, &work_query, &lwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zunmqr_(&side, &tran, &m, &bn, &k, r, &m, tau, b, &m, work, &lwork, &info);
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_least_squares(int m, int n, int bn, float a[], float b[], float x[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_least_squares, native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		char trans = 'N';
+		float* clone_a = scratch.alloc<float>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(float));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		float* clone_b = scratch.alloc<float>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(float));
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		sgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		sgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, work, &lwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(float));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_least_squares(int m, int n, int bn, double a[], double b[], double x[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_least_squares, native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		char trans = 'N';
+		double* clone_a = scratch.alloc<double>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(double));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		double* clone_b = scratch.alloc<double>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(double));
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, work, &lwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_least_squares(int m, int n, int bn, MKL_Complex8 a[], MKL_Complex8 b[], MKL_Complex8 x[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_least_squares, 4 * native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		char trans = 'N';
+		MKL_Complex8* clone_a = scratch.alloc<MKL_Complex8>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(MKL_Complex8));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		MKL_Complex8* clone_b = scratch.alloc<MKL_Complex8>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(MKL_Complex8));
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		cgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, &work_query, &lwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		cgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, work, &lwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(MKL_Complex8));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_least_squares(int m, int n, int bn, MKL_Complex16 a[], MKL_Complex16 b[], MKL_Complex16 x[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_least_squares, 4 * native_stats::least_squares_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int ldb = std::max(1, std::max(m, n));
+		int info = 0;
+		char trans = 'N';
+		MKL_Complex16* clone_a = scratch.alloc<MKL_Complex16>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(MKL_Complex16));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		MKL_Complex16* clone_b = scratch.alloc<MKL_Complex16>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(MKL_Complex16));
+		}
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, &work_query, &lwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zgels_(&trans, &m, &n, &bn, clone_a, &m, clone_b, &ldb, work, &lwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(MKL_Complex16));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_svd_factor(bool compute_vectors, int m, int n, float a[], float s[], float u[], float v[], float work[], int len)
+	{
+		NativeStatsScope stats(STATS_s_svd_factor, native_stats::svd_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		int info = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		sgesvd_(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info);
+		return info;
+	}
+
+	DLLEXPORT int d_svd_factor(bool compute_vectors, int m, int n, double a[], double s[], double u[], double v[], double work[], int len)
+	{
+		NativeStatsScope stats(STATS_d_svd_factor, native_stats::svd_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		int info = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		dgesvd_(&job, &job, &m, &n, a, &m, s, u, &m, v, &n, work, &len, &info);
+		return info;
+	}
+
+	DLLEXPORT int c_svd_factor(bool compute_vectors, int m, int n, MKL_Complex8 a[], MKL_Complex8 s[], MKL_Complex8 u[], MKL_Complex8 v[], MKL_Complex8 work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_c_svd_factor, 4 * (native_stats::svd_flops(compute_vectors, m, n)), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		int dim_s = std::min(m,n);
+		float* rwork = scratch.alloc<float>(5 * dim_s);
+		float* s_local = scratch.alloc<float>(dim_s);
+		char job = compute_vectors ? 'A' : 'N';
+		cgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info);
+
+		for(int index = 0; index < dim_s; ++index){
+			MKL_Complex8 value = {s_local[index], 0.0f};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_svd_factor(bool compute_vectors, int m, int n, MKL_Complex16 a[], MKL_Complex16 s[], MKL_Complex16 u[], MKL_Complex16 v[], MKL_Complex16 work[], int len)
+	try
+	{
+		NativeStatsScope stats(STATS_z_svd_factor, 4 * (native_stats::svd_flops(compute_vectors, m, n)), (2.0 * m * n + (compute_vectors ? (double)m * m + (double)n * n : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int info = 0;
+		int dim_s = std::min(m,n);
+		double* rwork = scratch.alloc<double>(5 * std::min(m, n));
+		double* s_local = scratch.alloc<double>(dim_s);
+		char job = compute_vectors ? 'A' : 'N';
+		zgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &m, v, &n, work, &len, rwork, &info);
+
+		for(int index = 0; index < dim_s; ++index){
+			MKL_Complex16 value = {s_local[index], 0.0f};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, float a[], float s[], float u[], float vt[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_svd_thin, native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, k) : 1;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		if (divide_and_conquer)
+		{
+			int* iwork = scratch.alloc<int>(8 * k);
+			sgesdd_(&job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, &work_query, &lwork, iwork, &info);
+
+			lwork = (int)work_query;
+			float* work = scratch.alloc<float>(lwork);
+			sgesdd_(&job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, work, &lwork, iwork, &info);
+		}
+		else
+		{
+			sgesvd_(&job, &job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, &work_query, &lwork, &info);
+
+			lwork = (int)work_query;
+			float* work = scratch.alloc<float>(lwork);
+			sgesvd_(&job, &job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, work, &lwork, &info);
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, double a[], double s[], double u[], double vt[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_svd_thin, native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, k) : 1;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		if (divide_and_conquer)
+		{
+			int* iwork = scratch.alloc<int>(8 * k);
+			dgesdd_(&job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, &work_query, &lwork, iwork, &info);
+
+			lwork = (int)work_query;
+			double* work = scratch.alloc<double>(lwork);
+			dgesdd_(&job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, work, &lwork, iwork, &info);
+		}
+		else
+		{
+			dgesvd_(&job, &job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, &work_query, &lwork, &info);
+
+			lwork = (int)work_query;
+			double* work = scratch.alloc<double>(lwork);
+			dgesvd_(&job, &job, &m, &n, a, &m, s, u, &ldu, vt, &ldvt, work, &lwork, &info);
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, MKL_Complex8 a[], MKL_Complex8 s[], MKL_Complex8 u[], MKL_Complex8 vt[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_svd_thin, 4 * native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, k) : 1;
+		int info = 0;
+		float* s_local = scratch.alloc<float>(k);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		if (divide_and_conquer)
+		{
+			int lrwork = compute_vectors ? std::max(5 * k * k + 7 * k, 2 * std::max(m, n) * k + 2 * k * k + k) : 7 * k;
+			float* rwork = scratch.alloc<float>(std::max(1, lrwork));
+			int* iwork = scratch.alloc<int>(8 * k);
+			cgesdd_(&job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, &work_query, &lwork, rwork, iwork, &info);
+
+			lwork = (int)work_query.real;
+			MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+			cgesdd_(&job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, work, &lwork, rwork, iwork, &info);
+		}
+		else
+		{
+			float* rwork = scratch.alloc<float>(std::max(1, 5 * k));
+			cgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, &work_query, &lwork, rwork, &info);
+
+			lwork = (int)work_query.real;
+			MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+			cgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, work, &lwork, rwork, &info);
+		}
+
+		for (int index = 0; index < k; ++index)
+		{
+			MKL_Complex8 value = {s_local[index], 0.0f};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_svd_thin(bool divide_and_conquer, bool compute_vectors, int m, int n, MKL_Complex16 a[], MKL_Complex16 s[], MKL_Complex16 u[], MKL_Complex16 vt[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_svd_thin, 4 * native_stats::svd_thin_flops(compute_vectors, m, n), (2.0 * m * n + (compute_vectors ? (double)std::min(m, n) * (m + n) : 0.0)) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		char job = compute_vectors ? 'S' : 'N';
+		int ldu = compute_vectors ? m : 1;
+		int ldvt = compute_vectors ? std::max(1, k) : 1;
+		int info = 0;
+		double* s_local = scratch.alloc<double>(k);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		if (divide_and_conquer)
+		{
+			int lrwork = compute_vectors ? std::max(5 * k * k + 7 * k, 2 * std::max(m, n) * k + 2 * k * k + k) : 7 * k;
+			double* rwork = scratch.alloc<double>(std::max(1, lrwork));
+			int* iwork = scratch.alloc<int>(8 * k);
+			zgesdd_(&job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, &work_query, &lwork, rwork, iwork, &info);
+
+			lwork = (int)work_query.real;
+			MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+			zgesdd_(&job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, work, &lwork, rwork, iwork, &info);
+		}
+		else
+		{
+			double* rwork = scratch.alloc<double>(std::max(1, 5 * k));
+			zgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, &work_query, &lwork, rwork, &info);
+
+			lwork = (int)work_query.real;
+			MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+			zgesvd_(&job, &job, &m, &n, a, &m, s_local, u, &ldu, vt, &ldvt, work, &lwork, rwork, &info);
+		}
+
+		for (int index = 0; index < k; ++index)
+		{
+			MKL_Complex16 value = {s_local[index], 0.0};
+			s[index] = value;
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_svd_solve(int m, int n, int bn, float a[], float b[], float x[], float rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_s_svd_solve, native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		float* clone_a = scratch.alloc<float>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(float));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		float* clone_b = scratch.alloc<float>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(float));
+		}
+
+		float* s = scratch.alloc<float>(std::max(1, k));
+
+		// Query the workspace size first. Only LAPACK 3.2 and later report the integer workspace size,
+		// so it is also bounded from the documented formula with SMLSIZ = 25.
+		int lwork = -1;
+		float work_query;
+		int iwork_query = 1;
+		sgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, &work_query, &lwork, &iwork_query, &info);
+
+		int nlvl = std::max(0, (int)(std::log(std::max(1, k) / 26.0) / std::log(2.0)) + 1);
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		int* iwork = scratch.alloc<int>(std::max(iwork_query, std::max(1, 3 * k * nlvl + 11 * k)));
+		sgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, work, &lwork, iwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(float));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_svd_solve(int m, int n, int bn, double a[], double b[], double x[], double rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_d_svd_solve, native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		double* clone_a = scratch.alloc<double>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(double));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		double* clone_b = scratch.alloc<double>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(double));
+		}
+
+		double* s = scratch.alloc<double>(std::max(1, k));
+
+		// Query the workspace size first. Only LAPACK 3.2 and later report the integer workspace size,
+		// so it is also bounded from the documented formula with SMLSIZ = 25.
+		int lwork = -1;
+		double work_query;
+		int iwork_query = 1;
+		dgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, &work_query, &lwork, &iwork_query, &info);
+
+		int nlvl = std::max(0, (int)(std::log(std::max(1, k) / 26.0) / std::log(2.0)) + 1);
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		int* iwork = scratch.alloc<int>(std::max(iwork_query, std::max(1, 3 * k * nlvl + 11 * k)));
+		dgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, work, &lwork, iwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(double));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_svd_solve(int m, int n, int bn, MKL_Complex8 a[], MKL_Complex8 b[], MKL_Complex8 x[], float rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_c_svd_solve, 4 * native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		MKL_Complex8* clone_a = scratch.alloc<MKL_Complex8>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(MKL_Complex8));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		MKL_Complex8* clone_b = scratch.alloc<MKL_Complex8>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(MKL_Complex8));
+		}
+
+		float* s = scratch.alloc<float>(std::max(1, k));
+
+		// Query the workspace size first. Only LAPACK 3.2 and later report the real and integer workspace
+		// sizes, so they are also bounded from the documented formulas with SMLSIZ = 25.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		float rwork_query = 1;
+		int iwork_query = 1;
+		cgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, &work_query, &lwork, &rwork_query, &iwork_query, &info);
+
+		int nlvl = std::max(0, (int)(std::log(std::max(1, k) / 26.0) / std::log(2.0)) + 1);
+		int lrwork = 10 * k + 2 * k * 25 + 8 * k * nlvl + 3 * 25 * bn + std::max(26 * 26, std::max(m, n) * (1 + bn) + 2 * bn);
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		float* rwork = scratch.alloc<float>(std::max((int)rwork_query, lrwork));
+		int* iwork = scratch.alloc<int>(std::max(iwork_query, std::max(1, 3 * k * nlvl + 11 * k)));
+		cgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, work, &lwork, rwork, iwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(MKL_Complex8));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_svd_solve(int m, int n, int bn, MKL_Complex16 a[], MKL_Complex16 b[], MKL_Complex16 x[], double rcond)
+	try
+	{
+		NativeStatsScope stats(STATS_z_svd_solve, 4 * native_stats::svd_solve_flops(m, n, bn), (2.0 * m * n + 2.0 * std::max(m, n) * bn + (double)n * bn) * sizeof(a[0]));
+
+		ScratchScope scratch;
+		int k = std::min(m, n);
+		int ldb = std::max(1, std::max(m, n));
+		int rank = 0;
+		int info = 0;
+		MKL_Complex16* clone_a = scratch.alloc<MKL_Complex16>(m * n);
+		std::memcpy(clone_a, a, m * n * sizeof(MKL_Complex16));
+
+		// B holds m rows on entry and the n rows of X on exit.
+		MKL_Complex16* clone_b = scratch.alloc<MKL_Complex16>(ldb * bn);
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(clone_b + j * ldb, b + j * m, m * sizeof(MKL_Complex16));
+		}
+
+		double* s = scratch.alloc<double>(std::max(1, k));
+
+		// Query the workspace size first. Only LAPACK 3.2 and later report the real and integer workspace
+		// sizes, so they are also bounded from the documented formulas with SMLSIZ = 25.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		double rwork_query = 1;
+		int iwork_query = 1;
+		zgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, &work_query, &lwork, &rwork_query, &iwork_query, &info);
+
+		int nlvl = std::max(0, (int)(std::log(std::max(1, k) / 26.0) / std::log(2.0)) + 1);
+		int lrwork = 10 * k + 2 * k * 25 + 8 * k * nlvl + 3 * 25 * bn + std::max(26 * 26, std::max(m, n) * (1 + bn) + 2 * bn);
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		double* rwork = scratch.alloc<double>(std::max((int)rwork_query, lrwork));
+		int* iwork = scratch.alloc<int>(std::max(iwork_query, std::max(1, 3 * k * nlvl + 11 * k)));
+		zgelsd_(&m, &n, &bn, clone_a, &m, clone_b, &ldb, s, &rcond, &rank, work, &lwork, rwork, iwork, &info);
+
+		if (info != 0)
+		{
+			return info;
+		}
+
+		for (int j = 0; j < bn; ++j)
+		{
+			std::memcpy(x + j * n, clone_b + j * ldb, n * sizeof(MKL_Complex16));
+		}
+
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_symmetric_eigen(int n, float a[], float w[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_symmetric_eigen, native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobz = 'V';
+		char uplo = 'L';
+		int info = 0;
+
+		// Query the workspace sizes first.
+		int lwork = -1;
+		int liwork = -1;
+		float work_query;
+		int iwork_query;
+		ssyevd_(&jobz, &uplo, &n, a, &n, w, &work_query, &lwork, &iwork_query, &liwork, &info);
+
+		lwork = (int)work_query;
+		liwork = iwork_query;
+		float* work = scratch.alloc<float>(lwork);
+		int* iwork = scratch.alloc<int>(liwork);
+		ssyevd_(&jobz, &uplo, &n, a, &n, w, work, &lwork, iwork, &liwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_symmetric_eigen(int n, double a[], double w[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_symmetric_eigen, native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobz = 'V';
+		char uplo = 'L';
+		int info = 0;
+
+		// Query the workspace sizes first.
+		int lwork = -1;
+		int liwork = -1;
+		double work_query;
+		int iwork_query;
+		dsyevd_(&jobz, &uplo, &n, a, &n, w, &work_query, &lwork, &iwork_query, &liwork, &info);
+
+		lwork = (int)work_query;
+		liwork = iwork_query;
+		double* work = scratch.alloc<double>(lwork);
+		int* iwork = scratch.alloc<int>(liwork);
+		dsyevd_(&jobz, &uplo, &n, a, &n, w, work, &lwork, iwork, &liwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_hermitian_eigen(int n, MKL_Complex8 a[], float w[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_symmetric_eigen, 4 * native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobz = 'V';
+		char uplo = 'L';
+		int info = 0;
+
+		// Query the workspace sizes first.
+		int lwork = -1;
+		int lrwork = -1;
+		int liwork = -1;
+		MKL_Complex8 work_query;
+		float rwork_query;
+		int iwork_query;
+		cheevd_(&jobz, &uplo, &n, a, &n, w, &work_query, &lwork, &rwork_query, &lrwork, &iwork_query, &liwork, &info);
+
+		lwork = (int)work_query.real;
+		lrwork = (int)rwork_query;
+		liwork = iwork_query;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		float* rwork = scratch.alloc<float>(lrwork);
+		int* iwork = scratch.alloc<int>(liwork);
+		cheevd_(&jobz, &uplo, &n, a, &n, w, work, &lwork, rwork, &lrwork, iwork, &liwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_hermitian_eigen(int n, MKL_Complex16 a[], double w[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_symmetric_eigen, 4 * native_stats::symmetric_eigen_flops(true, n), 2.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobz = 'V';
+		char uplo = 'L';
+		int info = 0;
+
+		// Query the workspace sizes first.
+		int lwork = -1;
+		int lrwork = -1;
+		int liwork = -1;
+		MKL_Complex16 work_query;
+		double rwork_query;
+		int iwork_query;
+		zheevd_(&jobz, &uplo, &n, a, &n, w, &work_query, &lwork, &rwork_query, &lrwork, &iwork_query, &liwork, &info);
+
+		lwork = (int)work_query.real;
+		lrwork = (int)rwork_query;
+		liwork = iwork_query;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		double* rwork = scratch.alloc<double>(lrwork);
+		int* iwork = scratch.alloc<int>(liwork);
+		zheevd_(&jobz, &uplo, &n, a, &n, w, work, &lwork, rwork, &lrwork, iwork, &liwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_eigen(bool compute_left, bool compute_right, int n, float a[], float wr[], float wi[], float vl[], float vr[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_eigen, native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvl = compute_left ? 'V' : 'N';
+		char jobvr = compute_right ? 'V' : 'N';
+		int ldvl = compute_left ? n : 1;
+		int ldvr = compute_right ? n : 1;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		sgeev_(&jobvl, &jobvr, &n, a, &n, wr, wi, vl, &ldvl, vr, &ldvr, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		sgeev_(&jobvl, &jobvr, &n, a, &n, wr, wi, vl, &ldvl, vr, &ldvr, work, &lwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_eigen(bool compute_left, bool compute_right, int n, double a[], double wr[], double wi[], double vl[], double vr[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_eigen, native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvl = compute_left ? 'V' : 'N';
+		char jobvr = compute_right ? 'V' : 'N';
+		int ldvl = compute_left ? n : 1;
+		int ldvr = compute_right ? n : 1;
+		int info = 0;
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dgeev_(&jobvl, &jobvr, &n, a, &n, wr, wi, vl, &ldvl, vr, &ldvr, &work_query, &lwork, &info);
+
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dgeev_(&jobvl, &jobvr, &n, a, &n, wr, wi, vl, &ldvl, vr, &ldvr, work, &lwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_eigen(bool compute_left, bool compute_right, int n, MKL_Complex8 a[], MKL_Complex8 w[], MKL_Complex8 vl[], MKL_Complex8 vr[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_eigen, 4 * native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvl = compute_left ? 'V' : 'N';
+		char jobvr = compute_right ? 'V' : 'N';
+		int ldvl = compute_left ? n : 1;
+		int ldvr = compute_right ? n : 1;
+		int info = 0;
+		float* rwork = scratch.alloc<float>(2 * n);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		cgeev_(&jobvl, &jobvr, &n, a, &n, w, vl, &ldvl, vr, &ldvr, &work_query, &lwork, rwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		cgeev_(&jobvl, &jobvr, &n, a, &n, w, vl, &ldvl, vr, &ldvr, work, &lwork, rwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_eigen(bool compute_left, bool compute_right, int n, MKL_Complex16 a[], MKL_Complex16 w[], MKL_Complex16 vl[], MKL_Complex16 vr[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_eigen, 4 * native_stats::eigen_flops(compute_left || compute_right, n), (2.0 + (compute_left ? 1.0 : 0.0) + (compute_right ? 1.0 : 0.0)) * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvl = compute_left ? 'V' : 'N';
+		char jobvr = compute_right ? 'V' : 'N';
+		int ldvl = compute_left ? n : 1;
+		int ldvr = compute_right ? n : 1;
+		int info = 0;
+		double* rwork = scratch.alloc<double>(2 * n);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zgeev_(&jobvl, &jobvr, &n, a, &n, w, vl, &ldvl, vr, &ldvr, &work_query, &lwork, rwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zgeev_(&jobvl, &jobvr, &n, a, &n, w, vl, &ldvl, vr, &ldvr, work, &lwork, rwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_schur(int n, float a[], float wr[], float wi[], float vs[])
+	try
+	{
+		NativeStatsScope stats(STATS_s_schur, native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvs = 'V';
+		char sort = 'N';
+		int sdim = 0;
+		int info = 0;
+		int* bwork = scratch.alloc<int>(n);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		float work_query;
+		sgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, wr, wi, vs, &n, &work_query, &lwork, bwork, &info);
+
+		lwork = (int)work_query;
+		float* work = scratch.alloc<float>(lwork);
+		sgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, wr, wi, vs, &n, work, &lwork, bwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int d_schur(int n, double a[], double wr[], double wi[], double vs[])
+	try
+	{
+		NativeStatsScope stats(STATS_d_schur, native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvs = 'V';
+		char sort = 'N';
+		int sdim = 0;
+		int info = 0;
+		int* bwork = scratch.alloc<int>(n);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		double work_query;
+		dgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, wr, wi, vs, &n, &work_query, &lwork, bwork, &info);
+
+		lwork = (int)work_query;
+		double* work = scratch.alloc<double>(lwork);
+		dgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, wr, wi, vs, &n, work, &lwork, bwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int c_schur(int n, MKL_Complex8 a[], MKL_Complex8 w[], MKL_Complex8 vs[])
+	try
+	{
+		NativeStatsScope stats(STATS_c_schur, 4 * native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvs = 'V';
+		char sort = 'N';
+		int sdim = 0;
+		int info = 0;
+		float* rwork = scratch.alloc<float>(n);
+		int* bwork = scratch.alloc<int>(n);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex8 work_query;
+		cgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, w, vs, &n, &work_query, &lwork, rwork, bwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex8* work = scratch.alloc<MKL_Complex8>(lwork);
+		cgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, w, vs, &n, work, &lwork, rwork, bwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int z_schur(int n, MKL_Complex16 a[], MKL_Complex16 w[], MKL_Complex16 vs[])
+	try
+	{
+		NativeStatsScope stats(STATS_z_schur, 4 * native_stats::eigen_flops(true, n), 3.0 * n * n * sizeof(a[0]));
+
+		ScratchScope scratch;
+		char jobvs = 'V';
+		char sort = 'N';
+		int sdim = 0;
+		int info = 0;
+		double* rwork = scratch.alloc<double>(n);
+		int* bwork = scratch.alloc<int>(n);
+
+		// Query the workspace size first.
+		int lwork = -1;
+		MKL_Complex16 work_query;
+		zgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, w, vs, &n, &work_query, &lwork, rwork, bwork, &info);
+
+		lwork = (int)work_query.real;
+		MKL_Complex16* work = scratch.alloc<MKL_Complex16>(lwork);
+		zgees_(&jobvs, &sort, NULL, &n, a, &n, &sdim, w, vs, &n, work, &lwork, rwork, bwork, &info);
+		return info;
+	}
+	NATIVE_CATCH_OUT_OF_MEMORY
+
+	DLLEXPORT int s_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		float a = 0;
+		float query = 0;
+		sgetri_(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int d_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		double a = 0;
+		double query = 0;
+		dgetri_(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int c_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		MKL_Complex8 a = {0.0f, 0.0f};
+		MKL_Complex8 query = {0.0f, 0.0f};
+		cgetri_(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int z_lu_inverse_workspace(int n)
+	{
+		int lda = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		int ipiv = 0;
+		MKL_Complex16 a = {0.0, 0.0};
+		MKL_Complex16 query = {0.0, 0.0};
+		zgetri_(&n, &a, &lda, &ipiv, &query, &lwork, &info);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int s_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		float a = 0;
+		float tau = 0;
+		float query = 0;
+		sgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		sorgqr_(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int d_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		double a = 0;
+		double tau = 0;
+		double query = 0;
+		dgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		dorgqr_(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int c_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		MKL_Complex8 a = {0.0f, 0.0f};
+		MKL_Complex8 tau = {0.0f, 0.0f};
+		MKL_Complex8 query = {0.0f, 0.0f};
+		cgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		cungqr_(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int z_qr_factor_workspace(int m, int n)
+	{
+		int lda = std::max(1, m);
+		int k = std::min(m, n);
+		int lwork = -1;
+		int info = 0;
+		MKL_Complex16 a = {0.0, 0.0};
+		MKL_Complex16 tau = {0.0, 0.0};
+		MKL_Complex16 query = {0.0, 0.0};
+		zgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		zungqr_(&m, &k, &k, &a, &lda, &tau, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int s_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		float a = 0;
+		float tau = 0;
+		float b = 0;
+		float query = 0;
+		sgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		char side ='L';
+		char tran = 'T';
+		sormqr_(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int d_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		double a = 0;
+		double tau = 0;
+		double b = 0;
+		double query = 0;
+		dgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query;
+		char side ='L';
+		char tran = 'T';
+		dormqr_(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query) : -1;
+	}
+
+	DLLEXPORT int c_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		MKL_Complex8 a = {0.0f, 0.0f};
+		MKL_Complex8 tau = {0.0f, 0.0f};
+		MKL_Complex8 b = {0.0f, 0.0f};
+		MKL_Complex8 query = {0.0f, 0.0f};
+		cgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		char side ='L';
+		char tran = 'C';
+		cunmqr_(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int z_qr_solve_workspace(int m, int n, int bn)
+	{
+		int lda = std::max(1, m);
+		int lwork = -1;
+		int info = 0;
+		MKL_Complex16 a = {0.0, 0.0};
+		MKL_Complex16 tau = {0.0, 0.0};
+		MKL_Complex16 b = {0.0, 0.0};
+		MKL_Complex16 query = {0.0, 0.0};
+		zgeqrf_(&m, &n, &a, &lda, &tau, &query, &lwork, &info);
+		if (info != 0){
+			return -1;
+		}
+
+		int size = (int)query.real;
+		char side ='L';
+		char tran = 'C';
+		zunmqr_(&side, &tran, &m, &bn, &n, &a, &lda, &tau, &b, &lda, &query, &lwork, &info);
+		return info == 0 ? std::max(size, (int)query.real) : -1;
+	}
+
+	DLLEXPORT int s_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		float a = 0;
+		float s = 0;
+		float u = 0;
+		float v = 0;
+		float query = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		sgesvd_(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &info);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int d_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		double a = 0;
+		double s = 0;
+		double u = 0;
+		double v = 0;
+		double query = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		dgesvd_(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &info);
+		return info == 0 ? (int)query : -1;
+	}
+
+	DLLEXPORT int c_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		MKL_Complex8 a = {0.0f, 0.0f};
+		MKL_Complex8 u = {0.0f, 0.0f};
+		MKL_Complex8 v = {0.0f, 0.0f};
+		MKL_Complex8 query = {0.0f, 0.0f};
+		float s = 0;
+		float rwork = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		cgesvd_(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &rwork, &info);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int z_svd_workspace(bool compute_vectors, int m, int n)
+	{
+		int lda = std::max(1, m);
+		int ldvt = std::max(1, n);
+		int lwork = -1;
+		int info = 0;
+		MKL_Complex16 a = {0.0, 0.0};
+		MKL_Complex16 u = {0.0, 0.0};
+		MKL_Complex16 v = {0.0, 0.0};
+		MKL_Complex16 query = {0.0, 0.0};
+		double s = 0;
+		double rwork = 0;
+		char job = compute_vectors ? 'A' : 'N';
+		zgesvd_(&job, &job, &m, &n, &a, &lda, &s, &u, &lda, &v, &ldvt, &query, &lwork, &rwork, &info);
+		return info == 0 ? (int)query.real : -1;
+	}
+
+	DLLEXPORT int s_lu_factor_ld(int m, float a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_s_lu_factor_ld, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		sgetrf_(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int d_lu_factor_ld(int m, double a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_d_lu_factor_ld, native_stats::lu_factor_flops(m), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		dgetrf_(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int c_lu_factor_ld(int m, MKL_Complex8 a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_c_lu_factor_ld, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		cgetrf_(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int z_lu_factor_ld(int m, MKL_Complex16 a[], int offset, int lda, int ipiv[])
+	{
+		NativeStatsScope stats(STATS_z_lu_factor_ld, 4 * (native_stats::lu_factor_flops(m)), 2.0 * m * m * sizeof(a[0]));
+
+		int info = 0;
+		zgetrf_(&m,&m,a + offset,&lda,ipiv,&info);
+		for(int i = 0; i < m; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int s_lu_solve_factored_ld(int n, int nrhs, float a[], int a_offset, int lda, int ipiv[], float b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_s_lu_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		sgetrs_(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int d_lu_solve_factored_ld(int n, int nrhs, double a[], int a_offset, int lda, int ipiv[], double b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_d_lu_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		dgetrs_(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int c_lu_solve_factored_ld(int n, int nrhs, MKL_Complex8 a[], int a_offset, int lda, int ipiv[], MKL_Complex8 b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_c_lu_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		cgetrs_(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int z_lu_solve_factored_ld(int n, int nrhs, MKL_Complex16 a[], int a_offset, int lda, int ipiv[], MKL_Complex16 b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_z_lu_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int info = 0;
+		int i;
+		for(i = 0; i < n; ++i ){
+			ipiv[i] += 1;
+		}
+
+		char trans ='N';
+		zgetrs_(&trans, &n, &nrhs, a + a_offset, &lda, ipiv, b + b_offset, &ldb, &info);
+		for(i = 0; i < n; ++i ){
+			ipiv[i] -= 1;
+		}
+		return info;
+	}
+
+	DLLEXPORT int s_cholesky_factor_ld(int n, float a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_factor_ld, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		float* block = a + offset;
+		spotrf_(&uplo, &n, block, &lda, &info);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = 0;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int d_cholesky_factor_ld(int n, double a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_factor_ld, native_stats::cholesky_factor_flops(n), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		double* block = a + offset;
+		dpotrf_(&uplo, &n, block, &lda, &info);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = 0;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int c_cholesky_factor_ld(int n, MKL_Complex8 a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_factor_ld, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		MKL_Complex8 zero = {0.0f, 0.0f};
+		MKL_Complex8* block = a + offset;
+		cpotrf_(&uplo, &n, block, &lda, &info);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = zero;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int z_cholesky_factor_ld(int n, MKL_Complex16 a[], int offset, int lda)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_factor_ld, 4 * (native_stats::cholesky_factor_flops(n)), 2.0 * n * n * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		MKL_Complex16 zero = {0.0, 0.0};
+		MKL_Complex16* block = a + offset;
+		zpotrf_(&uplo, &n, block, &lda, &info);
+		for (int i = 0; i < n; ++i)
+		{
+			int index = i * lda;
+			for (int j = 0; j < i; ++j)
+			{
+				block[index + j] = zero;
+			}
+		}
+		return info;
+	}
+
+	DLLEXPORT int s_cholesky_solve_factored_ld(int n, int nrhs, float a[], int a_offset, int lda, float b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		spotrs_(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info);
+		return info;
+	}
+
+	DLLEXPORT int d_cholesky_solve_factored_ld(int n, int nrhs, double a[], int a_offset, int lda, double b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_factored_ld, native_stats::triangular_solve_flops(n, nrhs), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		dpotrs_(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info);
+		return info;
+	}
+
+	DLLEXPORT int c_cholesky_solve_factored_ld(int n, int nrhs, MKL_Complex8 a[], int a_offset, int lda, MKL_Complex8 b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		cpotrs_(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info);
+		return info;
+	}
+
+	DLLEXPORT int z_cholesky_solve_factored_ld(int n, int nrhs, MKL_Complex16 a[], int a_offset, int lda, MKL_Complex16 b[], int b_offset, int ldb)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_solve_factored_ld, 4 * (native_stats::triangular_solve_flops(n, nrhs)), (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		char uplo = 'L';
+		int info = 0;
+		zpotrs_(&uplo, &n, &nrhs, a + a_offset, &lda, b + b_offset, &ldb, &info);
+		return info;
+	}
+
+	// The batched routines run the single-matrix export on every item of a strided batch, spreading the
+	// items over OpenMP threads. They return the one-based index of the first item whose LAPACK call
+	// reported an error, or zero.
+
+	DLLEXPORT int s_lu_factor_batch(int n, float a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_s_lu_factor_batch, batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_lu_factor_batch(int n, double a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_d_lu_factor_batch, batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_lu_factor_batch(int n, MKL_Complex8 a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_c_lu_factor_batch, 4 * batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_lu_factor_batch(int n, MKL_Complex16 a[], int a_stride, int ipiv[], int batch)
+	{
+		NativeStatsScope stats(STATS_z_lu_factor_batch, 4 * batch * native_stats::lu_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_lu_factor(n, a + (size_t)i * a_stride, ipiv + (size_t)i * n) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int s_lu_solve_factored_batch(int n, int nrhs, float a[], int a_stride, int ipiv[], float b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_s_lu_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_lu_solve_factored_batch(int n, int nrhs, double a[], int a_stride, int ipiv[], double b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_d_lu_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_lu_solve_factored_batch(int n, int nrhs, MKL_Complex8 a[], int a_stride, int ipiv[], MKL_Complex8 b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_c_lu_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_lu_solve_factored_batch(int n, int nrhs, MKL_Complex16 a[], int a_stride, int ipiv[], MKL_Complex16 b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_z_lu_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_lu_solve_factored(n, nrhs, a + (size_t)i * a_stride, ipiv + (size_t)i * n, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int s_cholesky_factor_batch(int n, float a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_factor_batch, batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_cholesky_factor_batch(int n, double a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_factor_batch, batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_cholesky_factor_batch(int n, MKL_Complex8 a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_factor_batch, 4 * batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_cholesky_factor_batch(int n, MKL_Complex16 a[], int a_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_factor_batch, 4 * batch * native_stats::cholesky_factor_flops(n), batch * 2.0 * n * n * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_cholesky_factor(n, a + (size_t)i * a_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int s_cholesky_solve_factored_batch(int n, int nrhs, float a[], int a_stride, float b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_s_cholesky_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (s_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int d_cholesky_solve_factored_batch(int n, int nrhs, double a[], int a_stride, double b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_d_cholesky_solve_factored_batch, batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (d_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int c_cholesky_solve_factored_batch(int n, int nrhs, MKL_Complex8 a[], int a_stride, MKL_Complex8 b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_c_cholesky_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (c_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
+
+	DLLEXPORT int z_cholesky_solve_factored_batch(int n, int nrhs, MKL_Complex16 a[], int a_stride, MKL_Complex16 b[], int b_stride, int batch)
+	{
+		NativeStatsScope stats(STATS_z_cholesky_solve_factored_batch, 4 * batch * native_stats::triangular_solve_flops(n, nrhs), batch * (n * (double)n + 2.0 * n * nrhs) * sizeof(a[0]));
+
+		int failed = 0;
+
+		#pragma omp parallel for
+		for (int i = 0; i < batch; ++i)
+		{
+			if (z_cholesky_solve_factored(n, nrhs, a + (size_t)i * a_stride, b + (size_t)i * b_stride) != 0)
+			{
+				#pragma omp critical
+				if (failed == 0 || i < failed - 1)
+				{
+					failed = i + 1;
+				}
+			}
+		}
+
+		return failed;
+	}
 }
\ No newline at end of file
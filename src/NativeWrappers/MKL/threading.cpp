@@ -0,0 +1,53 @@
+﻿#include "mkl_service.h"
+#include "wrapper_common.h"
+
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+	#define THREADING_THREAD_LOCAL __declspec(thread)
+#else
+	#define THREADING_THREAD_LOCAL thread_local
+#endif
+
+namespace
+{
+	// The budget last set by native_set_thread_local_threads on this thread; zero follows
+	// the global one.
+	THREADING_THREAD_LOCAL int local_threads = 0;
+}
+
+extern "C" {
+	DLLEXPORT int native_get_max_threads()
+	{
+		return mkl_get_max_threads();
+	}
+
+	DLLEXPORT void native_set_max_threads(int n)
+	{
+		if (n < 1){
+			n = 1;
+		}
+
+		mkl_set_num_threads(n);
+	}
+
+	DLLEXPORT int native_set_thread_local_threads(int n)
+	{
+		if (n < 0){
+			n = 0;
+		}
+
+		mkl_set_num_threads_local(n);
+
+#ifdef _OPENMP
+		// The batched exports run their own OpenMP loops; hold them to the same budget.
+		omp_set_num_threads(n > 0 ? n : native_get_max_threads());
+#endif
+
+		int previous = local_threads;
+		local_threads = n;
+		return previous;
+	}
+}
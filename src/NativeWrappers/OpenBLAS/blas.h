@@ -0,0 +1,9 @@
+#ifndef BLAS_H
+#define BLAS_H
+
+#include "cblas.h"
+
+typedef struct { float real; float imag; } Complex8;
+typedef struct { double real; double imag; } Complex16;
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef LAPACK_H
+#define LAPACK_H
+
+#include "blas.h"
+
+extern "C"{
+	float slange_(char*, int*, int*, float*, int*, float*);
+	double dlange_(char*, int*, int*, double*, int*, double*);
+	float clange_(char*, int*, int*, Complex8*, int*, float*);
+	double zlange_(char*, int*, int*, Complex16*, int*, double*);
+
+	void sgetrf_(int*, int*, float*, int*, int*, int*);
+	void dgetrf_(int*, int*, double*, int*, int*, int*);
+	void cgetrf_(int*, int*, Complex8*, int*, int*, int*);
+	void zgetrf_(int*, int*, Complex16*, int*, int*, int*);
+
+	void sgetri_(int*, float*, int*, int*, float*, int*, int*);
+	void dgetri_(int*, double*, int*, int*, double*, int*, int*);
+	void cgetri_(int*, Complex8*, int*, int*, Complex8*, int*, int*);
+	void zgetri_(int*, Complex16*, int*, int*, Complex16*, int*, int*);
+
+	void sgetrs_(char*, int*, int*, float*, int*, int*, float*, int*, int*);
+	void dgetrs_(char*, int*, int*, double*, int*, int*, double*, int*, int*);
+	void cgetrs_(char*, int*, int*, Complex8*, int*, int*, Complex8*, int*, int*);
+	void zgetrs_(char*, int*, int*, Complex16*, int*, int*, Complex16*, int*, int*);
+	void sgecon_(char*, int*, float*, int*, float*, float*, float*, int*, int*);
+	void dgecon_(char*, int*, double*, int*, double*, double*, double*, int*, int*);
+	void cgecon_(char*, int*, Complex8*, int*, float*, float*, Complex8*, float*, int*);
+	void zgecon_(char*, int*, Complex16*, int*, double*, double*, Complex16*, double*, int*);
+
+	void spotrf_(char*, int*, float*, int*, int*);
+	void dpotrf_(char*, int*, double*, int*, int*);
+	void cpotrf_(char*, int*, Complex8*, int*, int*);
+	void zpotrf_(char*, int*, Complex16*, int*, int*);
+
+	void spotrs_(char*, int*, int*, float*, int*, float*, int*, int*);
+	void dpotrs_(char*, int*, int*, double*, int*, double*, int*, int*);
+	void cpotrs_(char*, int*, int*, Complex8*, int*, Complex8*, int*, int*);
+	void zpotrs_(char*, int*, int*, Complex16*, int*, Complex16*, int*, int*);
+	void spocon_(char*, int*, float*, int*, float*, float*, float*, int*, int*);
+	void dpocon_(char*, int*, double*, int*, double*, double*, double*, int*, int*);
+	void cpocon_(char*, int*, Complex8*, int*, float*, float*, Complex8*, float*, int*);
+	void zpocon_(char*, int*, Complex16*, int*, double*, double*, Complex16*, double*, int*);
+
+	void ssytrf_(char*, int*, float*, int*, int*, float*, int*, int*);
+	void dsytrf_(char*, int*, double*, int*, int*, double*, int*, int*);
+	void chetrf_(char*, int*, Complex8*, int*, int*, Complex8*, int*, int*);
+	void zhetrf_(char*, int*, Complex16*, int*, int*, Complex16*, int*, int*);
+
+	void ssytrs_(char*, int*, int*, float*, int*, int*, float*, int*, int*);
+	void dsytrs_(char*, int*, int*, double*, int*, int*, double*, int*, int*);
+	void chetrs_(char*, int*, int*, Complex8*, int*, int*, Complex8*, int*, int*);
+	void zhetrs_(char*, int*, int*, Complex16*, int*, int*, Complex16*, int*, int*);
+
+	void ssysv_(char*, int*, int*, float*, int*, int*, float*, int*, float*, int*, int*);
+	void dsysv_(char*, int*, int*, double*, int*, int*, double*, int*, double*, int*, int*);
+	void chesv_(char*, int*, int*, Complex8*, int*, int*, Complex8*, int*, Complex8*, int*, int*);
+	void zhesv_(char*, int*, int*, Complex16*, int*, int*, Complex16*, int*, Complex16*, int*, int*);
+
+	void sgbsv_(int*, int*, int*, int*, float*, int*, int*, float*, int*, int*);
+	void dgbsv_(int*, int*, int*, int*, double*, int*, int*, double*, int*, int*);
+	void cgbsv_(int*, int*, int*, int*, Complex8*, int*, int*, Complex8*, int*, int*);
+	void zgbsv_(int*, int*, int*, int*, Complex16*, int*, int*, Complex16*, int*, int*);
+
+	void spbsv_(char*, int*, int*, int*, float*, int*, float*, int*, int*);
+	void dpbsv_(char*, int*, int*, int*, double*, int*, double*, int*, int*);
+	void cpbsv_(char*, int*, int*, int*, Complex8*, int*, Complex8*, int*, int*);
+	void zpbsv_(char*, int*, int*, int*, Complex16*, int*, Complex16*, int*, int*);
+
+	void sgtsv_(int*, int*, float*, float*, float*, float*, int*, int*);
+	void dgtsv_(int*, int*, double*, double*, double*, double*, int*, int*);
+	void cgtsv_(int*, int*, Complex8*, Complex8*, Complex8*, Complex8*, int*, int*);
+	void zgtsv_(int*, int*, Complex16*, Complex16*, Complex16*, Complex16*, int*, int*);
+
+	void sptsv_(int*, int*, float*, float*, float*, int*, int*);
+	void dptsv_(int*, int*, double*, double*, double*, int*, int*);
+	void cptsv_(int*, int*, float*, Complex8*, Complex8*, int*, int*);
+	void zptsv_(int*, int*, double*, Complex16*, Complex16*, int*, int*);
+
+	void dsgesv_(int*, int*, double*, int*, int*, double*, int*, double*, int*, double*, float*, int*, int*);
+	void dsposv_(char*, int*, int*, double*, int*, double*, int*, double*, int*, double*, float*, int*, int*);
+
+	void sgeqrf_(int*, int*, float*, int*, float*, float*, int*, int*);
+	void dgeqrf_(int*, int*, double*, int*, double*, double*, int*, int*);
+	void cgeqrf_(int*, int*, Complex8*, int*, Complex8*, Complex8*, int*, int*);
+	void zgeqrf_(int*, int*, Complex16*, int*, Complex16*, Complex16*, int*, int*);
+
+	void sgeqp3_(int*, int*, float*, int*, int*, float*, float*, int*, int*);
+	void dgeqp3_(int*, int*, double*, int*, int*, double*, double*, int*, int*);
+	void cgeqp3_(int*, int*, Complex8*, int*, int*, Complex8*, Complex8*, int*, float*, int*);
+	void zgeqp3_(int*, int*, Complex16*, int*, int*, Complex16*, Complex16*, int*, double*, int*);
+
+	void sorgqr_(int*, int*, int*, float*, int*, float*, float*, int*, int*);
+	void dorgqr_(int*, int*, int*, double*, int*, double*, double*, int*, int*);
+	void cungqr_(int*, int*, int*, Complex8*, int*, Complex8*, Complex8*, int*, int*);
+	void zungqr_(int*, int*, int*, Complex16*, int*, Complex16*, Complex16*, int*, int*);
+
+	void sormqr_(char*, char*, int*, int*, int*, float*, int*, float*, float*, int*, float*, int*, int*);
+	void dormqr_(char*, char*, int*, int*, int*, double*, int*, double*, double*, int*, double*, int*, int*);
+	void cunmqr_(char*, char*, int*, int*, int*, Complex8*, int*, Complex8*, Complex8*, int*, Complex8*, int*, int*);
+	void zunmqr_(char*, char*, int*, int*, int*, Complex16*, int*, Complex16*, Complex16*, int*, Complex16*, int*, int*);
+
+	void sgesvd_(char*, char*, int*, int*, float*, int*, float*, float*, int*, float*, int*, float*, int*, int*);
+	void dgesvd_(char*, char*, int*, int*, double*, int*, double*, double*, int*, double*, int*, double*, int*, int*);
+	void cgesvd_(char*, char*, int*, int*, Complex8*, int*, float*, Complex8*, int*, Complex8*, int*, Complex8*, int*, float*, int*);
+	void zgesvd_(char*, char*, int*, int*, Complex16*, int*, double*, Complex16*, int*, Complex16*, int*, Complex16*, int*, double*, int*);
+	void sgesdd_(char*, int*, int*, float*, int*, float*, float*, int*, float*, int*, float*, int*, int*, int*);
+	void dgesdd_(char*, int*, int*, double*, int*, double*, double*, int*, double*, int*, double*, int*, int*, int*);
+	void cgesdd_(char*, int*, int*, Complex8*, int*, float*, Complex8*, int*, Complex8*, int*, Complex8*, int*, float*, int*, int*);
+	void zgesdd_(char*, int*, int*, Complex16*, int*, double*, Complex16*, int*, Complex16*, int*, Complex16*, int*, double*, int*, int*);
+	void sgels_(char*, int*, int*, int*, float*, int*, float*, int*, float*, int*, int*);
+	void dgels_(char*, int*, int*, int*, double*, int*, double*, int*, double*, int*, int*);
+	void cgels_(char*, int*, int*, int*, Complex8*, int*, Complex8*, int*, Complex8*, int*, int*);
+	void zgels_(char*, int*, int*, int*, Complex16*, int*, Complex16*, int*, Complex16*, int*, int*);
+	void sgelsd_(int*, int*, int*, float*, int*, float*, int*, float*, float*, int*, float*, int*, int*, int*);
+	void dgelsd_(int*, int*, int*, double*, int*, double*, int*, double*, double*, int*, double*, int*, int*, int*);
+	void cgelsd_(int*, int*, int*, Complex8*, int*, Complex8*, int*, float*, float*, int*, Complex8*, int*, float*, int*, int*);
+	void zgelsd_(int*, int*, int*, Complex16*, int*, Complex16*, int*, double*, double*, int*, Complex16*, int*, double*, int*, int*);
+
+	void ssyevd_(char*, char*, int*, float*, int*, float*, float*, int*, int*, int*, int*);
+	void dsyevd_(char*, char*, int*, double*, int*, double*, double*, int*, int*, int*, int*);
+	void cheevd_(char*, char*, int*, Complex8*, int*, float*, Complex8*, int*, float*, int*, int*, int*, int*);
+	void zheevd_(char*, char*, int*, Complex16*, int*, double*, Complex16*, int*, double*, int*, int*, int*, int*);
+
+	void sgeev_(char*, char*, int*, float*, int*, float*, float*, float*, int*, float*, int*, float*, int*, int*);
+	void dgeev_(char*, char*, int*, double*, int*, double*, double*, double*, int*, double*, int*, double*, int*, int*);
+	void cgeev_(char*, char*, int*, Complex8*, int*, Complex8*, Complex8*, int*, Complex8*, int*, Complex8*, int*, float*, int*);
+	void zgeev_(char*, char*, int*, Complex16*, int*, Complex16*, Complex16*, int*, Complex16*, int*, Complex16*, int*, double*, int*);
+
+	void sgees_(char*, char*, int (*)(float*, float*), int*, float*, int*, int*, float*, float*, float*, int*, float*, int*, int*, int*);
+	void dgees_(char*, char*, int (*)(double*, double*), int*, double*, int*, int*, double*, double*, double*, int*, double*, int*, int*, int*);
+	void cgees_(char*, char*, int (*)(Complex8*), int*, Complex8*, int*, int*, Complex8*, Complex8*, int*, Complex8*, int*, float*, int*, int*);
+	void zgees_(char*, char*, int (*)(Complex16*), int*, Complex16*, int*, int*, Complex16*, Complex16*, int*, Complex16*, int*, double*, int*, int*);
+}
+
+#endif
@@ -0,0 +1,65 @@
+﻿#include "blas.h"
+#include "wrapper_common.h"
+
+#ifdef _OPENMP
+	#include <omp.h>
+#endif
+
+#if defined(_MSC_VER) && _MSC_VER < 1900
+	#define THREADING_THREAD_LOCAL __declspec(thread)
+#else
+	#define THREADING_THREAD_LOCAL thread_local
+#endif
+
+namespace
+{
+	// The budget last set by native_set_thread_local_threads on this thread; zero follows
+	// the global one.
+	THREADING_THREAD_LOCAL int local_threads = 0;
+}
+
+// Older OpenBLAS releases lack the per-thread setting, so it is looked up weakly where the
+// toolchain allows it.
+#if defined(__GNUC__)
+extern "C" int openblas_set_num_threads_local(int num_threads) __attribute__((weak));
+#else
+static int (* const openblas_set_num_threads_local)(int) = 0;
+#endif
+
+extern "C" {
+	DLLEXPORT int native_get_max_threads()
+	{
+		return openblas_get_num_threads();
+	}
+
+	DLLEXPORT void native_set_max_threads(int n)
+	{
+		if (n < 1){
+			n = 1;
+		}
+
+		openblas_set_num_threads(n);
+	}
+
+	DLLEXPORT int native_set_thread_local_threads(int n)
+	{
+		if (n < 0){
+			n = 0;
+		}
+
+		// An OpenMP build of OpenBLAS takes its team size from the calling thread, which the
+		// OpenMP call below sets. Other builds only have a per-thread setting from 0.3.27 on.
+		if (openblas_get_parallel() != OPENBLAS_OPENMP && openblas_set_num_threads_local){
+			openblas_set_num_threads_local(n > 0 ? n : openblas_get_num_threads());
+		}
+
+#ifdef _OPENMP
+		// The batched exports run their own OpenMP loops; hold them to the same budget.
+		omp_set_num_threads(n > 0 ? n : native_get_max_threads());
+#endif
+
+		int previous = local_threads;
+		local_threads = n;
+		return previous;
+	}
+}
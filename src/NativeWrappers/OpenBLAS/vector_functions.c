@@ -0,0 +1,116 @@
+#include "blas.h"
+#include "wrapper_common.h"
+
+DLLEXPORT void s_vector_add( const int n, const float x[], const float y[], float result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] + y[i];
+	}
+}
+
+DLLEXPORT void s_vector_subtract( const int n, const float x[], const float y[], float result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] - y[i];
+	}
+}
+
+DLLEXPORT void s_vector_multiply( const int n, const float x[], const float y[], float result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] * y[i];
+	}
+}
+
+DLLEXPORT void s_vector_divide( const int n, const float x[], const float y[], float result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] / y[i];
+	}
+}
+
+DLLEXPORT void d_vector_add( const int n, const double x[], const double y[], double result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] + y[i];
+	}
+}
+
+DLLEXPORT void d_vector_subtract( const int n, const double x[], const double y[], double result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] - y[i];
+	}
+}
+
+DLLEXPORT void d_vector_multiply( const int n, const double x[], const double y[], double result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] * y[i];
+	}
+}
+
+DLLEXPORT void d_vector_divide( const int n, const double x[], const double y[], double result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i] = x[i] / y[i];
+	}
+}
+
+DLLEXPORT void c_vector_add( const int n, const Complex8 x[], const Complex8 y[], Complex8 result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i].real = x[i].real + y[i].real;
+		result[i].imag = x[i].imag + y[i].imag;
+	}
+}
+
+DLLEXPORT void c_vector_subtract( const int n, const Complex8 x[], const Complex8 y[], Complex8 result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i].real = x[i].real - y[i].real;
+		result[i].imag = x[i].imag - y[i].imag;
+	}
+}
+
+DLLEXPORT void c_vector_multiply( const int n, const Complex8 x[], const Complex8 y[], Complex8 result[] ){
+	for( int i = 0; i < n; ++i ){
+		float real = x[i].real * y[i].real - x[i].imag * y[i].imag;
+		float imag = x[i].real * y[i].imag + x[i].imag * y[i].real;
+		result[i].real = real;
+		result[i].imag = imag;
+	}
+}
+
+DLLEXPORT void c_vector_divide( const int n, const Complex8 x[], const Complex8 y[], Complex8 result[] ){
+	for( int i = 0; i < n; ++i ){
+		float denominator = y[i].real * y[i].real + y[i].imag * y[i].imag;
+		float real = (x[i].real * y[i].real + x[i].imag * y[i].imag) / denominator;
+		float imag = (x[i].imag * y[i].real - x[i].real * y[i].imag) / denominator;
+		result[i].real = real;
+		result[i].imag = imag;
+	}
+}
+
+DLLEXPORT void z_vector_add( const int n, const Complex16 x[], const Complex16 y[], Complex16 result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i].real = x[i].real + y[i].real;
+		result[i].imag = x[i].imag + y[i].imag;
+	}
+}
+
+DLLEXPORT void z_vector_subtract( const int n, const Complex16 x[], const Complex16 y[], Complex16 result[] ){
+	for( int i = 0; i < n; ++i ){
+		result[i].real = x[i].real - y[i].real;
+		result[i].imag = x[i].imag - y[i].imag;
+	}
+}
+
+DLLEXPORT void z_vector_multiply( const int n, const Complex16 x[], const Complex16 y[], Complex16 result[] ){
+	for( int i = 0; i < n; ++i ){
+		double real = x[i].real * y[i].real - x[i].imag * y[i].imag;
+		double imag = x[i].real * y[i].imag + x[i].imag * y[i].real;
+		result[i].real = real;
+		result[i].imag = imag;
+	}
+}
+
+DLLEXPORT void z_vector_divide( const int n, const Complex16 x[], const Complex16 y[], Complex16 result[] ){
+	for( int i = 0; i < n; ++i ){
+		double denominator = y[i].real * y[i].real + y[i].imag * y[i].imag;
+		double real = (x[i].real * y[i].real + x[i].imag * y[i].imag) / denominator;
+		double imag = (x[i].imag * y[i].real - x[i].real * y[i].imag) / denominator;
+		result[i].real = real;
+		result[i].imag = imag;
+	}
+}
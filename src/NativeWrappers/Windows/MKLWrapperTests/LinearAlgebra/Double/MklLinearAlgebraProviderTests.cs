@@ -32,6 +32,9 @@ using MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Double;
 
 namespace MathNet.Numerics.MklWrapperTests.LinearAlgebra.Double
 {
+    using System.IO;
+    using Algorithms.LinearAlgebra;
+    using Algorithms.LinearAlgebra.Mkl;
     using NUnit.Framework;
 
     /// <summary>
@@ -47,5 +50,146 @@ namespace MathNet.Numerics.MklWrapperTests.LinearAlgebra.Double
          {
              Control.LinearAlgebraProvider = new Algorithms.LinearAlgebra.Mkl.MklLinearAlgebraProvider();
          }
+
+        /// <summary>
+        /// Records call statistics of the native exports only while enabled.
+        /// </summary>
+        [Test]
+        public void CanRecordStatistics()
+        {
+            var provider = (MklLinearAlgebraProvider)Control.LinearAlgebraProvider;
+            var x = new[] { 1.0, 2.0, 3.0, 4.0 };
+            var result = new double[4];
+
+            provider.ResetStatistics();
+            provider.EnableStatistics(true);
+            try
+            {
+                provider.MatrixMultiply(x, 2, 2, x, 2, 2, result);
+                provider.MatrixMultiply(x, 2, 2, x, 2, 2, result);
+            }
+            finally
+            {
+                provider.EnableStatistics(false);
+            }
+
+            provider.MatrixMultiply(x, 2, 2, x, 2, 2, result);
+
+            var statistics = provider.GetStatistics();
+            var multiply = statistics["d_matrix_multiply"];
+            Assert.AreEqual(2, multiply.CallCount);
+            Assert.AreEqual(2 * 16, multiply.Flops);
+            Assert.AreEqual(2 * 16 * sizeof(double), multiply.Bytes);
+            Assert.IsTrue(multiply.MaximumTime <= multiply.TotalTime);
+            Assert.AreEqual(0, statistics["d_lu_factor"].CallCount);
+
+            provider.ResetStatistics();
+            Assert.AreEqual(0, provider.GetStatistics()["d_matrix_multiply"].CallCount);
+        }
+
+        /// <summary>
+        /// Runs calls below the native crossover size in managed code, with the same result.
+        /// </summary>
+        [Test]
+        public void CanRouteCallsByCrossoverProfile()
+        {
+            var provider = (MklLinearAlgebraProvider)Control.LinearAlgebraProvider;
+            var x = new[] { 1.0, 2.0, 3.0, 4.0 };
+            var native = new double[4];
+            var managed = new double[4];
+            provider.MatrixMultiply(x, 2, 2, x, 2, 2, native);
+
+            var profile = new CrossoverProfile();
+            profile.SetNativeSize(CrossoverOperation.MatrixMultiply, typeof(double), 3);
+            profile.SetParallelSize(CrossoverOperation.MatrixMultiply, typeof(double), 3);
+
+            provider.ResetStatistics();
+            provider.EnableStatistics(true);
+            provider.CrossoverProfile = profile;
+            try
+            {
+                provider.MatrixMultiply(x, 2, 2, x, 2, 2, managed);
+                provider.LUFactor(new[] { 4.0, 1.0, 2.0, 3.0 }, 2, new int[2]);
+            }
+            finally
+            {
+                provider.CrossoverProfile = null;
+                provider.EnableStatistics(false);
+            }
+
+            CollectionAssert.AreEqual(native, managed);
+            var statistics = provider.GetStatistics();
+            Assert.AreEqual(0, statistics["d_matrix_multiply"].CallCount);
+            Assert.AreEqual(1, statistics["d_lu_factor"].CallCount);
+        }
+
+        /// <summary>
+        /// Writes and reads back a crossover profile.
+        /// </summary>
+        [Test]
+        public void CanSaveAndLoadCrossoverProfile()
+        {
+            var profile = new CrossoverProfile();
+            profile.SetNativeSize(CrossoverOperation.AddArrays, typeof(float), 4096);
+            profile.SetParallelSize(CrossoverOperation.AddArrays, typeof(float), 65536);
+            profile.SetNativeSize(CrossoverOperation.SvdSolve, typeof(System.Numerics.Complex), int.MaxValue);
+
+            var writer = new StringWriter();
+            profile.Save(writer);
+            var loaded = CrossoverProfile.Load(new StringReader(writer.ToString()));
+
+            Assert.AreEqual(4096, loaded.GetNativeSize(CrossoverOperation.AddArrays, typeof(float)));
+            Assert.AreEqual(65536, loaded.GetParallelSize(CrossoverOperation.AddArrays, typeof(float)));
+            Assert.AreEqual(int.MaxValue, loaded.GetNativeSize(CrossoverOperation.SvdSolve, typeof(System.Numerics.Complex)));
+            Assert.AreEqual(0, loaded.GetNativeSize(CrossoverOperation.AddArrays, typeof(double)));
+            Assert.Throws<System.FormatException>(() => CrossoverProfile.Load(new StringReader("AddArrays Double ten 0")));
+        }
+
+        /// <summary>
+        /// Solves in mixed precision to the accuracy of the double precision solve, and falls back to it
+        /// for an ill-conditioned matrix.
+        /// </summary>
+        [Test]
+        public void CanSolveInMixedPrecision()
+        {
+            var provider = (MklLinearAlgebraProvider)Control.LinearAlgebraProvider;
+            var a = new[] { 4.0, 1.0, 0.5, 1.0, 3.0, 0.25, 0.5, 0.25, 2.0 };
+            var b = new[] { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 };
+
+            var expected = (double[])b.Clone();
+            var mixed = (double[])b.Clone();
+            provider.LUSolve(2, a, 3, expected);
+            Assert.IsTrue(provider.LUSolveMixed(2, a, 3, mixed) >= 0);
+            for (var i = 0; i < b.Length; i++)
+            {
+                Assert.AreEqual(expected[i], mixed[i], 1e-14);
+            }
+
+            expected = (double[])b.Clone();
+            mixed = (double[])b.Clone();
+            provider.CholeskySolve(a, 3, expected, 2);
+            Assert.IsTrue(provider.CholeskySolveMixed(a, 3, mixed, 2) >= 0);
+            for (var i = 0; i < b.Length; i++)
+            {
+                Assert.AreEqual(expected[i], mixed[i], 1e-14);
+            }
+
+            const int Order = 10;
+            var hilbert = new double[Order * Order];
+            for (var i = 0; i < Order; i++)
+            {
+                for (var j = 0; j < Order; j++)
+                {
+                    hilbert[(j * Order) + i] = 1.0 / (i + j + 1);
+                }
+            }
+
+            expected = new double[Order];
+            expected[0] = 1.0;
+            mixed = (double[])expected.Clone();
+            provider.LUSolve(1, hilbert, Order, expected);
+            Assert.IsTrue(provider.LUSolveMixed(1, hilbert, Order, mixed) < 0);
+            CollectionAssert.AreEqual(expected, mixed);
+        }
     }
 }
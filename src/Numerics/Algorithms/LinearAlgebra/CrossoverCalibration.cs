@@ -0,0 +1,335 @@
+﻿// <copyright file="CrossoverCalibration.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+//
+// Copyright (c) 2009-2010 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+namespace MathNet.Numerics.Algorithms.LinearAlgebra
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Diagnostics;
+
+    /// <summary>
+    /// Measures the crossover sizes of a <see cref="CrossoverProfile"/>.
+    /// </summary>
+    internal static class CrossoverCalibration
+    {
+        /// <summary>
+        /// Routes every call to managed code on one thread.
+        /// </summary>
+        private static readonly CrossoverProfile ManagedSerial = CrossoverProfile.Uniform(int.MaxValue, int.MaxValue);
+
+        /// <summary>
+        /// Routes every call to managed code with all threads.
+        /// </summary>
+        private static readonly CrossoverProfile ManagedParallel = CrossoverProfile.Uniform(int.MaxValue, 0);
+
+        /// <summary>
+        /// Routes every call to the native library on one thread.
+        /// </summary>
+        private static readonly CrossoverProfile NativeSerial = CrossoverProfile.Uniform(0, int.MaxValue);
+
+        /// <summary>
+        /// Routes every call to the native library with all threads.
+        /// </summary>
+        private static readonly CrossoverProfile NativeParallel = CrossoverProfile.Uniform(0, 0);
+
+        /// <summary>
+        /// Measures every operation for one element type and stores the crossover sizes in <paramref name="profile"/>.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="provider">The native provider to measure.</param>
+        /// <param name="profile">The profile to store the sizes in.</param>
+        /// <param name="maximumLength">The largest array length to measure.</param>
+        /// <param name="maximumOrder">The largest matrix order to measure.</param>
+        /// <param name="timePerMeasurement">How long to repeat the calls of one measurement.</param>
+        /// <param name="create">Creates an element from its real and imaginary parts.</param>
+        public static void Measure<T>(ManagedLinearAlgebraProvider provider, CrossoverProfile profile, int maximumLength, int maximumOrder, TimeSpan timePerMeasurement, Func<double, double, T> create)
+            where T : struct
+        {
+            var lengths = Sizes(16, maximumLength, 4);
+            var orders = Sizes(4, maximumOrder, 2);
+            for (var operation = CrossoverOperation.AddVectorToScaledVector; operation <= CrossoverOperation.EigenDecomposition; operation++)
+            {
+                var sizes = operation < CrossoverOperation.MatrixMultiply ? lengths : orders;
+                var nativeWins = new bool[sizes.Length];
+                var parallelWins = new bool[sizes.Length];
+                for (var i = 0; i < sizes.Length; i++)
+                {
+                    var call = CreateCall((ILinearAlgebraProvider<T>)provider, operation, sizes[i], create);
+                    var managedSerial = Time(provider, ManagedSerial, call, timePerMeasurement);
+                    var managedParallel = Time(provider, ManagedParallel, call, timePerMeasurement);
+                    var nativeSerial = Time(provider, NativeSerial, call, timePerMeasurement);
+                    var nativeParallel = Time(provider, NativeParallel, call, timePerMeasurement);
+
+                    nativeWins[i] = Math.Min(nativeSerial, nativeParallel) < Math.Min(managedSerial, managedParallel);
+                    parallelWins[i] = nativeWins[i] ? nativeParallel < nativeSerial : managedParallel < managedSerial;
+                }
+
+                profile.SetNativeSize(operation, typeof(T), Crossover(sizes, nativeWins));
+                profile.SetParallelSize(operation, typeof(T), Crossover(sizes, parallelWins));
+            }
+        }
+
+        /// <summary>
+        /// The sizes to measure: powers of <paramref name="factor"/> times <paramref name="first"/>, and <paramref name="last"/>.
+        /// </summary>
+        /// <param name="first">The smallest size.</param>
+        /// <param name="last">The largest size.</param>
+        /// <param name="factor">The ratio of consecutive sizes.</param>
+        /// <returns>The sizes in increasing order.</returns>
+        private static int[] Sizes(int first, int last, int factor)
+        {
+            var sizes = new List<int>();
+            for (long size = Math.Min(first, last); size < last; size *= factor)
+            {
+                sizes.Add((int)size);
+            }
+
+            sizes.Add(last);
+            return sizes.ToArray();
+        }
+
+        /// <summary>
+        /// The smallest measured size from which on the faster path won at every larger measured size.
+        /// </summary>
+        /// <param name="sizes">The measured sizes in increasing order.</param>
+        /// <param name="wins">Whether the faster path won at each size.</param>
+        /// <returns>The crossover size: zero if it always won, <see cref="int.MaxValue"/> if it lost at the largest size.</returns>
+        private static int Crossover(int[] sizes, bool[] wins)
+        {
+            var i = sizes.Length;
+            while (i > 0 && wins[i - 1])
+            {
+                i--;
+            }
+
+            if (i == sizes.Length)
+            {
+                return int.MaxValue;
+            }
+
+            return i == 0 ? 0 : sizes[i];
+        }
+
+        /// <summary>
+        /// The mean time of a call routed by <paramref name="route"/>, the best of three rounds.
+        /// </summary>
+        /// <param name="provider">The provider the call goes to.</param>
+        /// <param name="route">The profile to route the call by.</param>
+        /// <param name="call">The call.</param>
+        /// <param name="timePerMeasurement">How long to repeat the call in all.</param>
+        /// <returns>The time of one call in seconds.</returns>
+        private static double Time(ManagedLinearAlgebraProvider provider, CrossoverProfile route, Action call, TimeSpan timePerMeasurement)
+        {
+            provider.CrossoverProfile = route;
+            call();
+
+            var best = double.MaxValue;
+            var round = TimeSpan.FromTicks(timePerMeasurement.Ticks / 3);
+            for (var r = 0; r < 3; r++)
+            {
+                var calls = 0;
+                var watch = Stopwatch.StartNew();
+                do
+                {
+                    call();
+                    calls++;
+                }
+                while (watch.Elapsed < round);
+
+                best = Math.Min(best, watch.Elapsed.TotalSeconds / calls);
+            }
+
+            return best;
+        }
+
+        /// <summary>
+        /// Creates a call of an operation at a given size on random data. Inputs the operation overwrites are
+        /// restored by every call.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="provider">The provider to call.</param>
+        /// <param name="operation">The operation.</param>
+        /// <param name="size">The array length or matrix order.</param>
+        /// <param name="create">Creates an element from its real and imaginary parts.</param>
+        /// <returns>The call.</returns>
+        private static Action CreateCall<T>(ILinearAlgebraProvider<T> provider, CrossoverOperation operation, int size, Func<double, double, T> create)
+            where T : struct
+        {
+            var random = new System.Random(size);
+            var n = size;
+            var one = create(1.0, 0.0);
+            var zero = create(0.0, 0.0);
+            var alpha = create(0.5, 0.25);
+
+            if (operation < CrossoverOperation.MatrixMultiply)
+            {
+                var x = new T[n];
+                var y = new T[n];
+                var result = new T[n];
+                for (var i = 0; i < n; i++)
+                {
+                    x[i] = create(random.NextDouble() + 0.5, random.NextDouble());
+                    y[i] = create(random.NextDouble() + 0.5, random.NextDouble());
+                }
+
+                switch (operation)
+                {
+                    case CrossoverOperation.AddVectorToScaledVector:
+                        return () => provider.AddVectorToScaledVector(y, alpha, x, result);
+                    case CrossoverOperation.ScaleArray:
+                        return () => provider.ScaleArray(alpha, x, result);
+                    case CrossoverOperation.DotProduct:
+                        return () => provider.DotProduct(x, y);
+                    case CrossoverOperation.AddArrays:
+                        return () => provider.AddArrays(x, y, result);
+                    case CrossoverOperation.SubtractArrays:
+                        return () => provider.SubtractArrays(x, y, result);
+                    case CrossoverOperation.PointWiseMultiplyArrays:
+                        return () => provider.PointWiseMultiplyArrays(x, y, result);
+                    case CrossoverOperation.TridiagonalSolve:
+                        // Diagonally dominant, so nonsingular.
+                        var diagonal = new T[n];
+                        var subdiagonal = new T[n - 1];
+                        var superdiagonal = new T[n - 1];
+                        for (var i = 0; i < n; i++)
+                        {
+                            diagonal[i] = create(4.0, 0.0);
+                        }
+
+                        Array.Copy(x, subdiagonal, n - 1);
+                        Array.Copy(y, superdiagonal, n - 1);
+                        return () =>
+                        {
+                            Array.Copy(y, result, n);
+                            provider.TridiagonalSolve(subdiagonal, diagonal, superdiagonal, result, 1);
+                        };
+                    default:
+                        return () => provider.PointWiseDivideArrays(x, y, result);
+                }
+            }
+
+            // a is diagonally dominant, so nonsingular; spd is Hermitian and diagonally dominant with a
+            // positive diagonal, so positive definite.
+            var a = new T[n * n];
+            var spd = new T[n * n];
+            for (var j = 0; j < n; j++)
+            {
+                for (var i = 0; i < n; i++)
+                {
+                    a[(j * n) + i] = create(i == j ? n : random.NextDouble(), random.NextDouble());
+                }
+
+                spd[(j * n) + j] = create(n + 1.0, 0.0);
+                for (var i = j + 1; i < n; i++)
+                {
+                    var real = random.NextDouble();
+                    var imaginary = random.NextDouble();
+                    spd[(j * n) + i] = create(real, imaginary);
+                    spd[(i * n) + j] = create(real, -imaginary);
+                }
+            }
+
+            var b = new T[n];
+            for (var i = 0; i < n; i++)
+            {
+                b[i] = create(random.NextDouble(), random.NextDouble());
+            }
+
+            var work = new T[n * n];
+            var rhs = new T[n];
+            var solution = new T[n];
+            var product = new T[n * n];
+            var q = new T[n * n];
+            var tau = new T[n];
+            var ipiv = new int[n];
+
+            switch (operation)
+            {
+                case CrossoverOperation.MatrixMultiply:
+                    return () => provider.MatrixMultiplyWithUpdate(Transpose.DontTranspose, Transpose.DontTranspose, one, a, n, n, spd, n, n, zero, product);
+                case CrossoverOperation.LUFactor:
+                    return () =>
+                    {
+                        Array.Copy(a, work, a.Length);
+                        provider.LUFactor(work, n, ipiv);
+                    };
+                case CrossoverOperation.LUInverse:
+                    return () =>
+                    {
+                        Array.Copy(a, work, a.Length);
+                        provider.LUInverse(work, n);
+                    };
+                case CrossoverOperation.LUSolve:
+                    return () =>
+                    {
+                        Array.Copy(b, rhs, b.Length);
+                        provider.LUSolve(1, a, n, rhs);
+                    };
+                case CrossoverOperation.CholeskyFactor:
+                    return () =>
+                    {
+                        Array.Copy(spd, work, spd.Length);
+                        provider.CholeskyFactor(work, n);
+                    };
+                case CrossoverOperation.CholeskySolve:
+                    return () =>
+                    {
+                        Array.Copy(b, rhs, b.Length);
+                        provider.CholeskySolve(spd, n, rhs, 1);
+                    };
+                case CrossoverOperation.QRFactor:
+                    return () =>
+                    {
+                        Array.Copy(a, work, a.Length);
+                        provider.QRFactor(work, n, n, q, tau);
+                    };
+                case CrossoverOperation.QRSolve:
+                    return () => provider.QRSolve(a, n, n, b, 1, solution);
+                case CrossoverOperation.SingularValueDecomposition:
+                    var s = new T[n];
+                    var vt = new T[n * n];
+                    return () =>
+                    {
+                        Array.Copy(a, work, a.Length);
+                        provider.SingularValueDecomposition(true, work, n, n, s, q, vt);
+                    };
+                case CrossoverOperation.SvdSolve:
+                    return () => provider.SvdSolve(a, n, n, b, 1, solution);
+                default:
+                    var eigenvalues = new T[n];
+                    return () =>
+                    {
+                        Array.Copy(spd, work, spd.Length);
+                        provider.EigenDecomposition(work, n, eigenvalues);
+                    };
+            }
+        }
+    }
+}
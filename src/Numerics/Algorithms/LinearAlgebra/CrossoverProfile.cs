@@ -0,0 +1,531 @@
+﻿// <copyright file="CrossoverProfile.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+//
+// Copyright (c) 2009-2010 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+namespace MathNet.Numerics.Algorithms.LinearAlgebra
+{
+    using System;
+    using System.Globalization;
+    using System.IO;
+    using System.Numerics;
+    using Properties;
+    using Threading;
+
+    /// <summary>
+    /// The provider operations a <see cref="CrossoverProfile"/> holds crossover sizes for. The size of a call
+    /// is the array length for the array operations, the largest of m, n and k for a matrix multiplication,
+    /// and the larger of the number of rows and columns otherwise.
+    /// </summary>
+    public enum CrossoverOperation
+    {
+        /// <summary>
+        /// Adding a scaled vector, <c>result = y + alpha*x</c>.
+        /// </summary>
+        AddVectorToScaledVector,
+
+        /// <summary>
+        /// Scaling an array.
+        /// </summary>
+        ScaleArray,
+
+        /// <summary>
+        /// The dot product of two arrays.
+        /// </summary>
+        DotProduct,
+
+        /// <summary>
+        /// Point wise addition of two arrays.
+        /// </summary>
+        AddArrays,
+
+        /// <summary>
+        /// Point wise subtraction of two arrays.
+        /// </summary>
+        SubtractArrays,
+
+        /// <summary>
+        /// Point wise multiplication of two arrays.
+        /// </summary>
+        PointWiseMultiplyArrays,
+
+        /// <summary>
+        /// Point wise division of two arrays.
+        /// </summary>
+        PointWiseDivideArrays,
+
+        /// <summary>
+        /// Tridiagonal solves, single or batched; the size is the length of the right hand side array.
+        /// </summary>
+        TridiagonalSolve,
+
+        /// <summary>
+        /// Matrix multiplication, with or without update.
+        /// </summary>
+        MatrixMultiply,
+
+        /// <summary>
+        /// LU factorization.
+        /// </summary>
+        LUFactor,
+
+        /// <summary>
+        /// Inversion through an LU factorization, factored or not.
+        /// </summary>
+        LUInverse,
+
+        /// <summary>
+        /// Solving through an LU factorization, factored or not.
+        /// </summary>
+        LUSolve,
+
+        /// <summary>
+        /// Cholesky factorization.
+        /// </summary>
+        CholeskyFactor,
+
+        /// <summary>
+        /// Solving through a Cholesky factorization, factored or not.
+        /// </summary>
+        CholeskySolve,
+
+        /// <summary>
+        /// QR factorization.
+        /// </summary>
+        QRFactor,
+
+        /// <summary>
+        /// Solving through a QR factorization, factored or not.
+        /// </summary>
+        QRSolve,
+
+        /// <summary>
+        /// Singular value decomposition.
+        /// </summary>
+        SingularValueDecomposition,
+
+        /// <summary>
+        /// Solving through a singular value decomposition.
+        /// </summary>
+        SvdSolve,
+
+        /// <summary>
+        /// Eigenvalue decomposition of a symmetric, Hermitian or general matrix, and the Schur decomposition.
+        /// </summary>
+        EigenDecomposition
+    }
+
+    /// <summary>
+    /// Crossover sizes by which a native linear algebra provider routes each call: to its managed code or to
+    /// the native library, and to one thread or many. Small calls are dominated by the cost of the call and of
+    /// starting threads, so below a crossover the simpler path is faster.
+    /// </summary>
+    /// <remarks>
+    /// The sizes depend on the machine, the native library and the thread count, so they are best measured
+    /// with <see cref="Calibrate(ManagedLinearAlgebraProvider)"/> on the host and stored with <see cref="Save(TextWriter)"/>.
+    /// A new profile has all sizes zero: every call runs natively with all threads.
+    /// </remarks>
+    public sealed class CrossoverProfile
+    {
+        /// <summary>
+        /// The number of operations.
+        /// </summary>
+        private const int OperationCount = (int)CrossoverOperation.EigenDecomposition + 1;
+
+        /// <summary>
+        /// The element types, in the order of the second index of the size tables.
+        /// </summary>
+        private static readonly Type[] ElementTypes = { typeof(double), typeof(float), typeof(Complex), typeof(Complex32) };
+
+        /// <summary>
+        /// The smallest size run natively, by operation and element type.
+        /// </summary>
+        private readonly int[,] _nativeSizes = new int[OperationCount, 4];
+
+        /// <summary>
+        /// The smallest size run with more than one thread, by operation and element type.
+        /// </summary>
+        private readonly int[,] _parallelSizes = new int[OperationCount, 4];
+
+        /// <summary>
+        /// Gets the smallest size at which an operation runs in the native library rather than in managed code.
+        /// </summary>
+        /// <param name="operation">The operation.</param>
+        /// <param name="elementType">The element type: <see cref="double"/>, <see cref="float"/>, <see cref="Complex"/> or <see cref="Complex32"/>.</param>
+        /// <returns>The crossover size; <see cref="int.MaxValue"/> if the operation always runs in managed code.</returns>
+        public int GetNativeSize(CrossoverOperation operation, Type elementType)
+        {
+            return _nativeSizes[OperationIndex(operation), ElementIndex(elementType)];
+        }
+
+        /// <summary>
+        /// Sets the smallest size at which an operation runs in the native library rather than in managed code.
+        /// </summary>
+        /// <param name="operation">The operation.</param>
+        /// <param name="elementType">The element type: <see cref="double"/>, <see cref="float"/>, <see cref="Complex"/> or <see cref="Complex32"/>.</param>
+        /// <param name="size">The crossover size; zero to always, <see cref="int.MaxValue"/> to never run natively.</param>
+        public void SetNativeSize(CrossoverOperation operation, Type elementType, int size)
+        {
+            if (size < 0)
+            {
+                throw new ArgumentOutOfRangeException("size");
+            }
+
+            _nativeSizes[OperationIndex(operation), ElementIndex(elementType)] = size;
+        }
+
+        /// <summary>
+        /// Gets the smallest size at which an operation runs with more than one thread.
+        /// </summary>
+        /// <param name="operation">The operation.</param>
+        /// <param name="elementType">The element type: <see cref="double"/>, <see cref="float"/>, <see cref="Complex"/> or <see cref="Complex32"/>.</param>
+        /// <returns>The crossover size; <see cref="int.MaxValue"/> if the operation always runs on the calling thread.</returns>
+        public int GetParallelSize(CrossoverOperation operation, Type elementType)
+        {
+            return _parallelSizes[OperationIndex(operation), ElementIndex(elementType)];
+        }
+
+        /// <summary>
+        /// Sets the smallest size at which an operation runs with more than one thread.
+        /// </summary>
+        /// <param name="operation">The operation.</param>
+        /// <param name="elementType">The element type: <see cref="double"/>, <see cref="float"/>, <see cref="Complex"/> or <see cref="Complex32"/>.</param>
+        /// <param name="size">The crossover size; zero to always, <see cref="int.MaxValue"/> to never use more than one thread.</param>
+        public void SetParallelSize(CrossoverOperation operation, Type elementType, int size)
+        {
+            if (size < 0)
+            {
+                throw new ArgumentOutOfRangeException("size");
+            }
+
+            _parallelSizes[OperationIndex(operation), ElementIndex(elementType)] = size;
+        }
+
+        /// <summary>
+        /// Measures the crossover sizes of every operation and element type on this machine, with the
+        /// current <see cref="Control.NumberOfParallelWorkerThreads"/>. This takes some seconds.
+        /// </summary>
+        /// <param name="provider">The native provider to measure.</param>
+        /// <returns>The measured profile.</returns>
+        public static CrossoverProfile Calibrate(ManagedLinearAlgebraProvider provider)
+        {
+            return Calibrate(provider, 1 << 20, 256, TimeSpan.FromMilliseconds(10));
+        }
+
+        /// <summary>
+        /// Measures the crossover sizes of every operation and element type on this machine, with the
+        /// current <see cref="Control.NumberOfParallelWorkerThreads"/>.
+        /// </summary>
+        /// <param name="provider">The native provider to measure.</param>
+        /// <param name="maximumLength">The largest array length to measure the array operations at.</param>
+        /// <param name="maximumOrder">The largest matrix order to measure the matrix operations at.</param>
+        /// <param name="timePerMeasurement">How long to repeat the calls of one measurement.</param>
+        /// <returns>The measured profile. A crossover beyond the largest size measured is <see cref="int.MaxValue"/>.</returns>
+        public static CrossoverProfile Calibrate(ManagedLinearAlgebraProvider provider, int maximumLength, int maximumOrder, TimeSpan timePerMeasurement)
+        {
+            if (provider == null)
+            {
+                throw new ArgumentNullException("provider");
+            }
+
+            if (maximumLength < 1)
+            {
+                throw new ArgumentOutOfRangeException("maximumLength");
+            }
+
+            if (maximumOrder < 1)
+            {
+                throw new ArgumentOutOfRangeException("maximumOrder");
+            }
+
+            var profile = new CrossoverProfile();
+            var previous = provider.CrossoverProfile;
+            try
+            {
+                CrossoverCalibration.Measure<double>(provider, profile, maximumLength, maximumOrder, timePerMeasurement, (real, imaginary) => real);
+                CrossoverCalibration.Measure<float>(provider, profile, maximumLength, maximumOrder, timePerMeasurement, (real, imaginary) => (float)real);
+                CrossoverCalibration.Measure<Complex>(provider, profile, maximumLength, maximumOrder, timePerMeasurement, (real, imaginary) => new Complex(real, imaginary));
+                CrossoverCalibration.Measure<Complex32>(provider, profile, maximumLength, maximumOrder, timePerMeasurement, (real, imaginary) => new Complex32((float)real, (float)imaginary));
+            }
+            finally
+            {
+                provider.CrossoverProfile = previous;
+            }
+
+            return profile;
+        }
+
+        /// <summary>
+        /// Creates a profile with the same sizes for every operation and element type.
+        /// </summary>
+        /// <param name="nativeSize">The smallest size to run natively.</param>
+        /// <param name="parallelSize">The smallest size to run with more than one thread.</param>
+        /// <returns>The profile.</returns>
+        internal static CrossoverProfile Uniform(int nativeSize, int parallelSize)
+        {
+            var profile = new CrossoverProfile();
+            for (var i = 0; i < OperationCount; i++)
+            {
+                for (var j = 0; j < ElementTypes.Length; j++)
+                {
+                    profile._nativeSizes[i, j] = nativeSize;
+                    profile._parallelSizes[i, j] = parallelSize;
+                }
+            }
+
+            return profile;
+        }
+
+        /// <summary>
+        /// Writes the profile as text, one line per operation and element type.
+        /// </summary>
+        /// <param name="writer">The writer to write to.</param>
+        public void Save(TextWriter writer)
+        {
+            if (writer == null)
+            {
+                throw new ArgumentNullException("writer");
+            }
+
+            writer.WriteLine("# operation element-type native-size parallel-size");
+            for (var i = 0; i < OperationCount; i++)
+            {
+                for (var j = 0; j < ElementTypes.Length; j++)
+                {
+                    writer.WriteLine(string.Format(CultureInfo.InvariantCulture, "{0} {1} {2} {3}", (CrossoverOperation)i, ElementTypes[j].Name, _nativeSizes[i, j], _parallelSizes[i, j]));
+                }
+            }
+        }
+
+        /// <summary>
+        /// Reads a profile written by <see cref="Save(TextWriter)"/>. Operations and element types
+        /// missing from the text keep sizes of zero.
+        /// </summary>
+        /// <param name="reader">The reader to read from.</param>
+        /// <returns>The profile.</returns>
+        /// <exception cref="FormatException">A line is not valid.</exception>
+        public static CrossoverProfile Load(TextReader reader)
+        {
+            if (reader == null)
+            {
+                throw new ArgumentNullException("reader");
+            }
+
+            var profile = new CrossoverProfile();
+            var number = 0;
+            string line;
+            while ((line = reader.ReadLine()) != null)
+            {
+                number++;
+                line = line.Trim();
+                if (line.Length == 0 || line[0] == '#')
+                {
+                    continue;
+                }
+
+                var fields = line.Split(new[] { ' ', '\t' }, StringSplitOptions.RemoveEmptyEntries);
+                var element = fields.Length == 4 ? Array.FindIndex(ElementTypes, type => type.Name == fields[1]) : -1;
+                int operation, nativeSize, parallelSize;
+                if (element < 0
+                    || !TryParseOperation(fields[0], out operation)
+                    || !int.TryParse(fields[2], NumberStyles.None, CultureInfo.InvariantCulture, out nativeSize)
+                    || !int.TryParse(fields[3], NumberStyles.None, CultureInfo.InvariantCulture, out parallelSize))
+                {
+                    throw new FormatException(string.Format(Resources.InvalidCrossoverProfileLine, number));
+                }
+
+                profile._nativeSizes[operation, element] = nativeSize;
+                profile._parallelSizes[operation, element] = parallelSize;
+            }
+
+            return profile;
+        }
+
+        /// <summary>
+        /// Writes the profile to a file, replacing it.
+        /// </summary>
+        /// <param name="path">The path of the file.</param>
+        public void Save(string path)
+        {
+            using (var writer = new StreamWriter(path))
+            {
+                Save(writer);
+            }
+        }
+
+        /// <summary>
+        /// Reads a profile from a file written by <see cref="Save(string)"/>.
+        /// </summary>
+        /// <param name="path">The path of the file.</param>
+        /// <returns>The profile.</returns>
+        /// <exception cref="FormatException">A line of the file is not valid.</exception>
+        public static CrossoverProfile Load(string path)
+        {
+            using (var reader = new StreamReader(path))
+            {
+                return Load(reader);
+            }
+        }
+
+        /// <summary>
+        /// Starts a call of <paramref name="provider"/>, routed by this profile.
+        /// </summary>
+        /// <param name="provider">The provider making the call.</param>
+        /// <param name="operation">The operation.</param>
+        /// <param name="elementType">The element type.</param>
+        /// <param name="size">The size of the call.</param>
+        /// <returns>The call, to dispose when it is done.</returns>
+        internal ProviderCall BeginCall(ManagedLinearAlgebraProvider provider, CrossoverOperation operation, Type elementType, int size)
+        {
+            var i = (int)operation;
+            var j = ElementIndex(elementType);
+            return new ProviderCall(provider, size < _nativeSizes[i, j], size < _parallelSizes[i, j]);
+        }
+
+        /// <summary>
+        /// Checks an operation.
+        /// </summary>
+        /// <param name="operation">The operation.</param>
+        /// <returns>The index of the operation.</returns>
+        private static int OperationIndex(CrossoverOperation operation)
+        {
+            if (operation < 0 || (int)operation >= OperationCount)
+            {
+                throw new ArgumentOutOfRangeException("operation");
+            }
+
+            return (int)operation;
+        }
+
+        /// <summary>
+        /// Finds the index of an element type.
+        /// </summary>
+        /// <param name="elementType">The element type.</param>
+        /// <returns>The index of the element type.</returns>
+        private static int ElementIndex(Type elementType)
+        {
+            var index = Array.IndexOf(ElementTypes, elementType);
+            if (index < 0)
+            {
+                throw new ArgumentException(string.Format(Resources.NotSupportedType, elementType), "elementType");
+            }
+
+            return index;
+        }
+
+        /// <summary>
+        /// Parses the name of an operation.
+        /// </summary>
+        /// <param name="name">The name.</param>
+        /// <param name="operation">The index of the operation.</param>
+        /// <returns><c>true</c> if the name is the name of an operation.</returns>
+        private static bool TryParseOperation(string name, out int operation)
+        {
+            for (operation = 0; operation < OperationCount; operation++)
+            {
+                if (((CrossoverOperation)operation).ToString() == name)
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+    }
+
+    /// <summary>
+    /// A call of a native provider routed by a <see cref="CrossoverProfile"/>. While a call that is to run on
+    /// one thread is open, the native library and <see cref="CommonParallel"/> loops use only the calling thread.
+    /// </summary>
+    internal struct ProviderCall : IDisposable
+    {
+        /// <summary>
+        /// The provider, when the call runs on one thread.
+        /// </summary>
+        private readonly ManagedLinearAlgebraProvider _serialProvider;
+
+        /// <summary>
+        /// The state the provider returned on entering the one-thread region.
+        /// </summary>
+        private readonly int _state;
+
+        /// <summary>
+        /// The previous <see cref="CommonParallel.Serial"/> setting.
+        /// </summary>
+        private readonly bool _wasSerial;
+
+        /// <summary>
+        /// Whether the call is to run in managed code.
+        /// </summary>
+        private readonly bool _managed;
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="ProviderCall"/> struct.
+        /// </summary>
+        /// <param name="provider">The provider making the call.</param>
+        /// <param name="managed">Whether the call is to run in managed code.</param>
+        /// <param name="serial">Whether the call is to run on the calling thread only.</param>
+        public ProviderCall(ManagedLinearAlgebraProvider provider, bool managed, bool serial)
+        {
+            _managed = managed;
+            _serialProvider = null;
+            _state = 0;
+            _wasSerial = false;
+            if (serial)
+            {
+                _serialProvider = provider;
+                _wasSerial = CommonParallel.Serial;
+                CommonParallel.Serial = true;
+                _state = provider.EnterParallelRegion();
+            }
+        }
+
+        /// <summary>
+        /// Gets a value indicating whether the call is to run in managed code.
+        /// </summary>
+        public bool Managed
+        {
+            get
+            {
+                return _managed;
+            }
+        }
+
+        /// <summary>
+        /// Ends the call.
+        /// </summary>
+        public void Dispose()
+        {
+            if (_serialProvider != null)
+            {
+                _serialProvider.ExitParallelRegion(_state);
+                CommonParallel.Serial = _wasSerial;
+            }
+        }
+    }
+}
@@ -93,5 +93,201 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// The requested <see cref="Norm"/> of the matrix.
         /// </returns>
         Complex MatrixNorm(Norm norm, int rows, int columns, Complex[] matrix, double[] work);
+
+        /// <summary>
+        /// Multiplies a symmetric matrix with a vector and updates another vector with the result. <c>y = alpha*a*x + beta*y</c>
+        /// </summary>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="a">The symmetric matrix A. Only its lower triangle is read.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="x">The x vector.</param>
+        /// <param name="beta">The value to scale the <paramref name="y"/> vector.</param>
+        /// <param name="y">The y vector.</param>
+        /// <remarks>This is equivalent to the SYMV BLAS routine.</remarks>
+        void SymmetricMatrixVectorMultiply(float alpha, float[] a, int order, float[] x, float beta, float[] y);
+
+        /// <summary>
+        /// Multiplies a symmetric matrix with a vector and updates another vector with the result. <c>y = alpha*a*x + beta*y</c>
+        /// </summary>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="a">The symmetric matrix A. Only its lower triangle is read.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="x">The x vector.</param>
+        /// <param name="beta">The value to scale the <paramref name="y"/> vector.</param>
+        /// <param name="y">The y vector.</param>
+        /// <remarks>This is equivalent to the SYMV BLAS routine.</remarks>
+        void SymmetricMatrixVectorMultiply(double alpha, double[] a, int order, double[] x, double beta, double[] y);
+
+        /// <summary>
+        /// Adds the scaled product of a matrix with its own conjugate transpose to a Hermitian matrix. <c>c = alpha*op(a)*op(a)^H + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix. Any value other than
+        /// <see cref="Transpose.DontTranspose"/> computes <c>a^H*a</c>.</param>
+        /// <param name="alpha">The value to scale the product.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="beta">The value to scale the <paramref name="c"/> matrix.</param>
+        /// <param name="c">The square c matrix, of order the number of rows of op(a). Only its lower triangle is updated.</param>
+        /// <param name="mirror">If <c>true</c>, the conjugate of the lower triangle is copied to the upper triangle afterwards
+        /// so that <paramref name="c"/> holds the full Hermitian matrix.</param>
+        /// <remarks>This is equivalent to the HERK BLAS routine.</remarks>
+        void HermitianRankKUpdate(Transpose transposeA, float alpha, Complex32[] a, int rowsA, int columnsA, float beta, Complex32[] c, bool mirror);
+
+        /// <summary>
+        /// Adds the scaled product of a matrix with its own conjugate transpose to a Hermitian matrix. <c>c = alpha*op(a)*op(a)^H + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix. Any value other than
+        /// <see cref="Transpose.DontTranspose"/> computes <c>a^H*a</c>.</param>
+        /// <param name="alpha">The value to scale the product.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="beta">The value to scale the <paramref name="c"/> matrix.</param>
+        /// <param name="c">The square c matrix, of order the number of rows of op(a). Only its lower triangle is updated.</param>
+        /// <param name="mirror">If <c>true</c>, the conjugate of the lower triangle is copied to the upper triangle afterwards
+        /// so that <paramref name="c"/> holds the full Hermitian matrix.</param>
+        /// <remarks>This is equivalent to the HERK BLAS routine.</remarks>
+        void HermitianRankKUpdate(Transpose transposeA, double alpha, Complex[] a, int rowsA, int columnsA, double beta, Complex[] c, bool mirror);
+
+        /// <summary>
+        /// Computes the eigenvalues and, optionally, the left and right eigenvectors of a general matrix.
+        /// </summary>
+        /// <param name="computeLeft">Whether to compute the left eigenvectors.</param>
+        /// <param name="computeRight">Whether to compute the right eigenvectors.</param>
+        /// <param name="a">On entry, the square matrix A. On exit, A is overwritten.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="realEigenvalues">On exit, the real parts of the eigenvalues.</param>
+        /// <param name="imaginaryEigenvalues">On exit, the imaginary parts of the eigenvalues. Complex conjugate pairs
+        /// are stored next to each other, the one with the positive imaginary part first.</param>
+        /// <param name="leftVectors">If <paramref name="computeLeft"/> is <c>true</c>, on exit the left eigenvectors u(j),
+        /// <c>u(j)^H*A = lambda(j)*u(j)^H</c>, one per column and of unit length. For a complex pair j, j+1, columns j and j+1
+        /// hold the real and imaginary parts of u(j), and u(j+1) is its conjugate. Otherwise not referenced.</param>
+        /// <param name="rightVectors">If <paramref name="computeRight"/> is <c>true</c>, on exit the right eigenvectors v(j),
+        /// <c>A*v(j) = lambda(j)*v(j)</c>, stored like the left ones. Otherwise not referenced.</param>
+        /// <remarks>This is equivalent to the GEEV LAPACK routine.</remarks>
+        void EigenDecomposition(bool computeLeft, bool computeRight, float[] a, int order, float[] realEigenvalues, float[] imaginaryEigenvalues, float[] leftVectors, float[] rightVectors);
+
+        /// <summary>
+        /// Computes the eigenvalues and, optionally, the left and right eigenvectors of a general matrix.
+        /// </summary>
+        /// <param name="computeLeft">Whether to compute the left eigenvectors.</param>
+        /// <param name="computeRight">Whether to compute the right eigenvectors.</param>
+        /// <param name="a">On entry, the square matrix A. On exit, A is overwritten.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="realEigenvalues">On exit, the real parts of the eigenvalues.</param>
+        /// <param name="imaginaryEigenvalues">On exit, the imaginary parts of the eigenvalues. Complex conjugate pairs
+        /// are stored next to each other, the one with the positive imaginary part first.</param>
+        /// <param name="leftVectors">If <paramref name="computeLeft"/> is <c>true</c>, on exit the left eigenvectors u(j),
+        /// <c>u(j)^H*A = lambda(j)*u(j)^H</c>, one per column and of unit length. For a complex pair j, j+1, columns j and j+1
+        /// hold the real and imaginary parts of u(j), and u(j+1) is its conjugate. Otherwise not referenced.</param>
+        /// <param name="rightVectors">If <paramref name="computeRight"/> is <c>true</c>, on exit the right eigenvectors v(j),
+        /// <c>A*v(j) = lambda(j)*v(j)</c>, stored like the left ones. Otherwise not referenced.</param>
+        /// <remarks>This is equivalent to the GEEV LAPACK routine.</remarks>
+        void EigenDecomposition(bool computeLeft, bool computeRight, double[] a, int order, double[] realEigenvalues, double[] imaginaryEigenvalues, double[] leftVectors, double[] rightVectors);
+
+        /// <summary>
+        /// Computes the real Schur decomposition of a general matrix, <c>A = Z*T*Z'</c> with Z orthogonal and
+        /// T upper quasi-triangular.
+        /// </summary>
+        /// <param name="a">On entry, the square matrix A. On exit, T; its 2 by 2 diagonal blocks hold the
+        /// complex conjugate pairs of eigenvalues.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="realEigenvalues">On exit, the real parts of the eigenvalues, in the order they appear on the diagonal of T.</param>
+        /// <param name="imaginaryEigenvalues">On exit, the imaginary parts of the eigenvalues.</param>
+        /// <param name="schurVectors">On exit, the orthogonal matrix Z of Schur vectors.</param>
+        /// <remarks>This is equivalent to the GEES LAPACK routine without eigenvalue ordering.</remarks>
+        void SchurDecomposition(float[] a, int order, float[] realEigenvalues, float[] imaginaryEigenvalues, float[] schurVectors);
+
+        /// <summary>
+        /// Computes the real Schur decomposition of a general matrix, <c>A = Z*T*Z'</c> with Z orthogonal and
+        /// T upper quasi-triangular.
+        /// </summary>
+        /// <param name="a">On entry, the square matrix A. On exit, T; its 2 by 2 diagonal blocks hold the
+        /// complex conjugate pairs of eigenvalues.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="realEigenvalues">On exit, the real parts of the eigenvalues, in the order they appear on the diagonal of T.</param>
+        /// <param name="imaginaryEigenvalues">On exit, the imaginary parts of the eigenvalues.</param>
+        /// <param name="schurVectors">On exit, the orthogonal matrix Z of Schur vectors.</param>
+        /// <remarks>This is equivalent to the GEES LAPACK routine without eigenvalue ordering.</remarks>
+        void SchurDecomposition(double[] a, int order, double[] realEigenvalues, double[] imaginaryEigenvalues, double[] schurVectors);
+
+        /// <summary>
+        /// Computes the eigenvalues and, optionally, the left and right eigenvectors of a general matrix.
+        /// </summary>
+        /// <param name="computeLeft">Whether to compute the left eigenvectors.</param>
+        /// <param name="computeRight">Whether to compute the right eigenvectors.</param>
+        /// <param name="a">On entry, the square matrix A. On exit, A is overwritten.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues.</param>
+        /// <param name="leftVectors">If <paramref name="computeLeft"/> is <c>true</c>, on exit the left eigenvectors u(j),
+        /// <c>u(j)^H*A = lambda(j)*u(j)^H</c>, one per column and of unit length. Otherwise not referenced.</param>
+        /// <param name="rightVectors">If <paramref name="computeRight"/> is <c>true</c>, on exit the right eigenvectors v(j),
+        /// <c>A*v(j) = lambda(j)*v(j)</c>, one per column and of unit length. Otherwise not referenced.</param>
+        /// <remarks>This is equivalent to the GEEV LAPACK routine.</remarks>
+        void EigenDecomposition(bool computeLeft, bool computeRight, Complex32[] a, int order, Complex32[] eigenvalues, Complex32[] leftVectors, Complex32[] rightVectors);
+
+        /// <summary>
+        /// Computes the eigenvalues and, optionally, the left and right eigenvectors of a general matrix.
+        /// </summary>
+        /// <param name="computeLeft">Whether to compute the left eigenvectors.</param>
+        /// <param name="computeRight">Whether to compute the right eigenvectors.</param>
+        /// <param name="a">On entry, the square matrix A. On exit, A is overwritten.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues.</param>
+        /// <param name="leftVectors">If <paramref name="computeLeft"/> is <c>true</c>, on exit the left eigenvectors u(j),
+        /// <c>u(j)^H*A = lambda(j)*u(j)^H</c>, one per column and of unit length. Otherwise not referenced.</param>
+        /// <param name="rightVectors">If <paramref name="computeRight"/> is <c>true</c>, on exit the right eigenvectors v(j),
+        /// <c>A*v(j) = lambda(j)*v(j)</c>, one per column and of unit length. Otherwise not referenced.</param>
+        /// <remarks>This is equivalent to the GEEV LAPACK routine.</remarks>
+        void EigenDecomposition(bool computeLeft, bool computeRight, Complex[] a, int order, Complex[] eigenvalues, Complex[] leftVectors, Complex[] rightVectors);
+
+        /// <summary>
+        /// Computes the Schur decomposition of a general matrix, <c>A = Z*T*Z^H</c> with Z unitary and
+        /// T upper triangular.
+        /// </summary>
+        /// <param name="a">On entry, the square matrix A. On exit, T.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues, which are the diagonal of T.</param>
+        /// <param name="schurVectors">On exit, the unitary matrix Z of Schur vectors.</param>
+        /// <remarks>This is equivalent to the GEES LAPACK routine without eigenvalue ordering.</remarks>
+        void SchurDecomposition(Complex32[] a, int order, Complex32[] eigenvalues, Complex32[] schurVectors);
+
+        /// <summary>
+        /// Computes the Schur decomposition of a general matrix, <c>A = Z*T*Z^H</c> with Z unitary and
+        /// T upper triangular.
+        /// </summary>
+        /// <param name="a">On entry, the square matrix A. On exit, T.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues, which are the diagonal of T.</param>
+        /// <param name="schurVectors">On exit, the unitary matrix Z of Schur vectors.</param>
+        /// <remarks>This is equivalent to the GEES LAPACK routine without eigenvalue ordering.</remarks>
+        void SchurDecomposition(Complex[] a, int order, Complex[] eigenvalues, Complex[] schurVectors);
+
+        /// <summary>
+        /// Solves A*X=B for X using an LU factorization computed in single precision, refined
+        /// iteratively with residuals computed in double precision.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="a">The square matrix A.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <returns>The number of refinement iterations, or a negative value if the solve fell back to
+        /// double precision.</returns>
+        /// <remarks>This is equivalent to the DSGESV LAPACK routine.</remarks>
+        int LUSolveMixed(int columnsOfB, double[] a, int order, double[] b);
+
+        /// <summary>
+        /// Solves A*X=B for X using a Cholesky factorization computed in single precision, refined
+        /// iteratively with residuals computed in double precision.
+        /// </summary>
+        /// <param name="a">The square, positive definite matrix A.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <returns>The number of refinement iterations, or a negative value if the solve fell back to
+        /// double precision.</returns>
+        /// <remarks>This is equivalent to the DSPOSV LAPACK routine.</remarks>
+        int CholeskySolveMixed(double[] a, int orderA, double[] b, int columnsB);
     }
 }
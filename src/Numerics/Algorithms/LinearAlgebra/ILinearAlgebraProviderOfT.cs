@@ -51,6 +51,54 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         ConjugateTranspose = 113
     }
 
+    /// <summary>
+    /// Which side of the other operand a triangular matrix is applied from.
+    /// </summary>
+    public enum Side
+    {
+        /// <summary>
+        /// The triangular matrix is on the left: <c>op(a)*b</c>.
+        /// </summary>
+        Left = 141,
+
+        /// <summary>
+        /// The triangular matrix is on the right: <c>b*op(a)</c>.
+        /// </summary>
+        Right = 142
+    }
+
+    /// <summary>
+    /// Which triangle of a matrix holds its values.
+    /// </summary>
+    public enum Triangle
+    {
+        /// <summary>
+        /// The upper triangle, including the diagonal.
+        /// </summary>
+        Upper = 121,
+
+        /// <summary>
+        /// The lower triangle, including the diagonal.
+        /// </summary>
+        Lower = 122
+    }
+
+    /// <summary>
+    /// Whether a triangular matrix has an implicit unit diagonal.
+    /// </summary>
+    public enum DiagonalType
+    {
+        /// <summary>
+        /// The diagonal is read from the matrix.
+        /// </summary>
+        NonUnit = 131,
+
+        /// <summary>
+        /// The diagonal is assumed to be all ones and is not read.
+        /// </summary>
+        Unit = 132
+    }
+
     /// <summary>
     /// Types of matrix norms.
     /// </summary>
@@ -77,6 +125,33 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         LargestAbsoluteValue = (byte)'m'
     }
 
+    /// <summary>
+    /// Which parts of a singular value decomposition to compute, and how.
+    /// </summary>
+    public enum SvdMode
+    {
+        /// <summary>
+        /// Only the singular values; U and VT are neither computed nor referenced.
+        /// </summary>
+        ValuesOnly,
+
+        /// <summary>
+        /// The full M by M matrix U and N by N matrix VT.
+        /// </summary>
+        Full,
+
+        /// <summary>
+        /// The economy (thin) factors: the leading Min(M, N) columns of U and rows of VT.
+        /// </summary>
+        Economy,
+
+        /// <summary>
+        /// The economy factors, computed with the divide and conquer algorithm. This is usually
+        /// the fastest way to get singular vectors of a large matrix, at the cost of more workspace.
+        /// </summary>
+        DivideAndConquer
+    }
+
     /// <summary>
     /// Interface to linear algebra algorithms that work off 1-D arrays.
     /// </summary>
@@ -211,6 +286,122 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <param name="c">The c matrix.</param>
         void MatrixMultiplyWithUpdate(Transpose transposeA, Transpose transposeB, T alpha, T[] a, int rowsA, int columnsA, T[] b, int rowsB, int columnsB, T beta, T[] c);
 
+        /// <summary>
+        /// Multiplies two matrices and updates another with the result, where each matrix is a block
+        /// of a larger column-major array. <c>c = alpha*op(a)*op(b) + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="transposeB">How to transpose the <paramref name="b"/> matrix.</param>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="m">The number of rows of op(a) and of c.</param>
+        /// <param name="n">The number of columns of op(b) and of c.</param>
+        /// <param name="k">The number of columns of op(a) and the number of rows of op(b).</param>
+        /// <param name="a">The array holding the a matrix.</param>
+        /// <param name="offsetA">The index of the first element of the a matrix in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of the a matrix.</param>
+        /// <param name="b">The array holding the b matrix.</param>
+        /// <param name="offsetB">The index of the first element of the b matrix in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of the b matrix.</param>
+        /// <param name="beta">The value to scale the c matrix.</param>
+        /// <param name="c">The array holding the c matrix.</param>
+        /// <param name="offsetC">The index of the first element of the c matrix in <paramref name="c"/>.</param>
+        /// <param name="leadingDimensionC">The distance between the starts of two consecutive columns of the c matrix.</param>
+        /// <remarks>This is equivalent to the GEMM BLAS routine.</remarks>
+        void MatrixMultiplyWithUpdate(Transpose transposeA, Transpose transposeB, T alpha, int m, int n, int k, T[] a, int offsetA, int leadingDimensionA, T[] b, int offsetB, int leadingDimensionB, T beta, T[] c, int offsetC, int leadingDimensionC);
+
+        /// <summary>
+        /// Multiplies a batch of equally sized matrices and updates the results. <c>c[i] = alpha*op(a[i])*op(b[i]) + beta*c[i]</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the a matrices.</param>
+        /// <param name="transposeB">How to transpose the b matrices.</param>
+        /// <param name="alpha">The value to scale the a matrices.</param>
+        /// <param name="m">The number of rows of each op(a) and c.</param>
+        /// <param name="n">The number of columns of each op(b) and c.</param>
+        /// <param name="k">The number of columns of each op(a) and the number of rows of each op(b).</param>
+        /// <param name="a">The a matrices, stored one after another in column-major order.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive a matrices. Use zero to share one matrix across the batch.</param>
+        /// <param name="b">The b matrices, stored one after another in column-major order.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive b matrices. Use zero to share one matrix across the batch.</param>
+        /// <param name="beta">The value to scale the c matrices.</param>
+        /// <param name="c">The c matrices, stored one after another in column-major order.</param>
+        /// <param name="strideC">The distance between the starts of two consecutive c matrices; at least <paramref name="m"/>*<paramref name="n"/>.</param>
+        /// <param name="batchCount">The number of products to compute.</param>
+        /// <remarks>Meant for many small products, where calling <c>MatrixMultiplyWithUpdate</c> once per matrix
+        /// costs more than the arithmetic itself.</remarks>
+        void MatrixMultiplyBatch(Transpose transposeA, Transpose transposeB, T alpha, int m, int n, int k, T[] a, int strideA, T[] b, int strideB, T beta, T[] c, int strideC, int batchCount);
+
+        /// <summary>
+        /// Multiplies a matrix with a vector and updates another vector with the result. <c>y = alpha*op(a)*x + beta*y</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="x">The x vector, of length the number of columns of op(a).</param>
+        /// <param name="beta">The value to scale the <paramref name="y"/> vector.</param>
+        /// <param name="y">The y vector, of length the number of rows of op(a).</param>
+        /// <remarks>This is equivalent to the GEMV BLAS routine.</remarks>
+        void MatrixVectorMultiply(Transpose transposeA, T alpha, T[] a, int rowsA, int columnsA, T[] x, T beta, T[] y);
+
+        /// <summary>
+        /// Adds the scaled outer product of two vectors to a matrix. <c>a = a + alpha*x*y'</c>
+        /// </summary>
+        /// <param name="alpha">The value to scale the outer product.</param>
+        /// <param name="x">The x vector, of length the number of rows of <paramref name="a"/>.</param>
+        /// <param name="y">The y vector, of length the number of columns of <paramref name="a"/>. It is not conjugated.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <remarks>This is equivalent to the GER BLAS routine, or GERU for complex numbers.</remarks>
+        void RankOneUpdate(T alpha, T[] x, T[] y, T[] a);
+
+        /// <summary>
+        /// Adds the scaled product of a matrix with its own transpose to a symmetric matrix. <c>c = alpha*op(a)*op(a)' + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix. Any value other than
+        /// <see cref="Transpose.DontTranspose"/> computes <c>a'*a</c>; the transpose is never conjugated.</param>
+        /// <param name="alpha">The value to scale the product.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="beta">The value to scale the <paramref name="c"/> matrix.</param>
+        /// <param name="c">The square c matrix, of order the number of rows of op(a). Only its lower triangle is updated.</param>
+        /// <param name="mirror">If <c>true</c>, the lower triangle is copied to the upper triangle afterwards so that
+        /// <paramref name="c"/> holds the full symmetric matrix.</param>
+        /// <remarks>This is equivalent to the SYRK BLAS routine, and needs half the work of a general multiplication.</remarks>
+        void SymmetricRankKUpdate(Transpose transposeA, T alpha, T[] a, int rowsA, int columnsA, T beta, T[] c, bool mirror);
+
+        /// <summary>
+        /// Solves a triangular system with many right hand sides in place. <c>op(a)*x = alpha*b</c> or <c>x*op(a) = alpha*b</c>
+        /// </summary>
+        /// <param name="side">Whether the triangular matrix is on the left or the right of x.</param>
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read; the other one is ignored.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="alpha">The value to scale <paramref name="b"/> with.</param>
+        /// <param name="a">The square triangular matrix, of order <paramref name="rowsB"/> on the left or
+        /// <paramref name="columnsB"/> on the right.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="rowsB">The number of rows in the <paramref name="b"/> matrix.</param>
+        /// <param name="columnsB">The number of columns in the <paramref name="b"/> matrix.</param>
+        /// <remarks>This is equivalent to the TRSM BLAS routine.</remarks>
+        void TriangularSolve(Side side, Triangle triangle, Transpose transposeA, DiagonalType diagonal, T alpha, T[] a, T[] b, int rowsB, int columnsB);
+
+        /// <summary>
+        /// Multiplies a matrix with a triangular matrix in place. <c>b = alpha*op(a)*b</c> or <c>b = alpha*b*op(a)</c>
+        /// </summary>
+        /// <param name="side">Whether the triangular matrix is on the left or the right of b.</param>
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read; the other one is ignored.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="alpha">The value to scale the product with.</param>
+        /// <param name="a">The square triangular matrix, of order <paramref name="rowsB"/> on the left or
+        /// <paramref name="columnsB"/> on the right.</param>
+        /// <param name="b">On entry the B matrix; on exit the product.</param>
+        /// <param name="rowsB">The number of rows in the <paramref name="b"/> matrix.</param>
+        /// <param name="columnsB">The number of columns in the <paramref name="b"/> matrix.</param>
+        /// <remarks>This is equivalent to the TRMM BLAS routine.</remarks>
+        void TriangularMultiply(Side side, Triangle triangle, Transpose transposeA, DiagonalType diagonal, T alpha, T[] a, T[] b, int rowsB, int columnsB);
+
         /// <summary>
         /// Computes the LUP factorization of A. P*A = L*U.
         /// </summary>
@@ -222,6 +413,30 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <remarks>This is equivalent to the GETRF LAPACK routine.</remarks>
         void LUFactor(T[] data, int order, int[] ipiv);
 
+        /// <summary>
+        /// Computes the LUP factorization of a square block of a larger column-major array. P*A = L*U.
+        /// </summary>
+        /// <param name="data">The array holding the matrix. The block is overwritten with the LU factorization on exit,
+        /// in the same layout as <see cref="LUFactor(T[],int,int[])"/>.</param>
+        /// <param name="offset">The index of the first element of the block in <paramref name="data"/>.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns of the block.</param>
+        /// <param name="order">The order of the square block.</param>
+        /// <param name="ipiv">On exit, it contains the pivot indices. The size of the array must be <paramref name="order"/>.</param>
+        /// <remarks>This is equivalent to the GETRF LAPACK routine.</remarks>
+        void LUFactor(T[] data, int offset, int leadingDimension, int order, int[] ipiv);
+
+        /// <summary>
+        /// Computes the LUP factorizations of a batch of equally sized square matrices. P*A = L*U.
+        /// </summary>
+        /// <param name="data">The matrices, stored one after another in column-major order. On exit each one is
+        /// overwritten with its LU factorization.</param>
+        /// <param name="order">The order of each square matrix.</param>
+        /// <param name="stride">The distance between the starts of two consecutive matrices; at least <paramref name="order"/>*<paramref name="order"/>.</param>
+        /// <param name="ipiv">On exit, the pivot indices of the matrices, <paramref name="order"/> entries per matrix.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        /// <remarks>This is equivalent to the GETRF LAPACK routine applied to every matrix of the batch.</remarks>
+        void LUFactorBatch(T[] data, int order, int stride, int[] ipiv, int batchCount);
+
         /// <summary>
         /// Computes the inverse of matrix using LU factorization.
         /// </summary>
@@ -283,6 +498,61 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <remarks>This is equivalent to the GETRS LAPACK routine.</remarks>
         void LUSolveFactored(int columnsOfB, T[] a, int order, int[] ipiv, T[] b);
 
+        /// <summary>
+        /// Solves A*X=B for X using a previously factored A, where A and B are blocks of larger column-major arrays.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="a">The array holding the factored A matrix.</param>
+        /// <param name="offsetA">The index of the first element of A in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of A.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">The pivot indices of A.</param>
+        /// <param name="b">The array holding the B matrix. On exit the B block is overwritten with the solution X.</param>
+        /// <param name="offsetB">The index of the first element of B in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of B.</param>
+        /// <remarks>This is equivalent to the GETRS LAPACK routine.</remarks>
+        void LUSolveFactored(int columnsOfB, T[] a, int offsetA, int leadingDimensionA, int order, int[] ipiv, T[] b, int offsetB, int leadingDimensionB);
+
+        /// <summary>
+        /// Solves A*X=B for X for a batch of previously LU factored systems of the same size.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of each B.</param>
+        /// <param name="a">The factored A matrices, stored one after another in column-major order.</param>
+        /// <param name="order">The order of each square matrix A.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive A matrices.</param>
+        /// <param name="ipiv">The pivot indices of the A matrices, <paramref name="order"/> entries per matrix.</param>
+        /// <param name="b">The B matrices, stored one after another in column-major order. On exit each one is overwritten
+        /// with its solution X.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive B matrices.</param>
+        /// <param name="batchCount">The number of systems.</param>
+        /// <remarks>This is equivalent to the GETRS LAPACK routine applied to every system of the batch.</remarks>
+        void LUSolveFactoredBatch(int columnsOfB, T[] a, int order, int strideA, int[] ipiv, T[] b, int strideB, int batchCount);
+
+        /// <summary>
+        /// Estimates the reciprocal condition number of A from its LU factorization.
+        /// </summary>
+        /// <param name="norm">The norm to measure the condition in: <see cref="Norm.OneNorm"/> or <see cref="Norm.InfinityNorm"/>.</param>
+        /// <param name="factors">The LU factors of A, as computed by <see cref="LUFactor(T[],int,int[])"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="matrixNorm">The <paramref name="norm"/> of A before it was factored.</param>
+        /// <returns>An estimate of 1/(norm(A)*norm(inverse(A))); zero if A is singular.</returns>
+        /// <remarks>This is equivalent to the GECON LAPACK routine. The norm of the inverse is estimated from
+        /// a few solves with the factors, so this costs O(n^2) where forming the inverse costs O(n^3).</remarks>
+        T LUCondition(Norm norm, T[] factors, int order, T matrixNorm);
+
+        /// <summary>
+        /// Computes the logarithm of the absolute value of the determinant of A, and its sign, from its LU factorization.
+        /// </summary>
+        /// <param name="factors">The LU factors of A, as computed by <see cref="LUFactor(T[],int,int[])"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">The pivot indices of A.</param>
+        /// <param name="sign">On exit, the sign of the determinant: a value of magnitude one (or +/-1 for real
+        /// matrices), or zero if A is singular.</param>
+        /// <returns>The natural logarithm of the absolute value of the determinant; negative infinity if A is singular.</returns>
+        /// <remarks>The determinant is <c>sign*exp(result)</c>. Unlike the product of the pivots, the sum of
+        /// their logarithms does not overflow or underflow for large matrices.</remarks>
+        T LUDeterminant(T[] factors, int order, int[] ipiv, out T sign);
+
         /// <summary>
         /// Computes the Cholesky factorization of A.
         /// </summary>
@@ -292,6 +562,28 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <remarks>This is equivalent to the POTRF LAPACK routine.</remarks>
         void CholeskyFactor(T[] a, int order);
 
+        /// <summary>
+        /// Computes the Cholesky factorization of a square block of a larger column-major array.
+        /// </summary>
+        /// <param name="a">The array holding the matrix. On exit the block is overwritten with the lower triangular
+        /// Cholesky factor and its strictly upper triangle is set to zero.</param>
+        /// <param name="offset">The index of the first element of the block in <paramref name="a"/>.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns of the block.</param>
+        /// <param name="order">The order of the square block.</param>
+        /// <remarks>This is equivalent to the POTRF LAPACK routine.</remarks>
+        void CholeskyFactor(T[] a, int offset, int leadingDimension, int order);
+
+        /// <summary>
+        /// Computes the Cholesky factorizations of a batch of equally sized symmetric positive definite matrices.
+        /// </summary>
+        /// <param name="a">The matrices, stored one after another in column-major order. On exit each one is
+        /// overwritten with its lower triangular Cholesky factor.</param>
+        /// <param name="order">The order of each square matrix.</param>
+        /// <param name="stride">The distance between the starts of two consecutive matrices; at least <paramref name="order"/>*<paramref name="order"/>.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        /// <remarks>This is equivalent to the POTRF LAPACK routine applied to every matrix of the batch.</remarks>
+        void CholeskyFactorBatch(T[] a, int order, int stride, int batchCount);
+
         /// <summary>
         /// Solves A*X=B for X using Cholesky factorization.
         /// </summary>
@@ -312,6 +604,154 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <remarks>This is equivalent to the POTRS LAPACK routine.</remarks>
         void CholeskySolveFactored(T[] a, int orderA, T[] b, int columnsB);
 
+        /// <summary>
+        /// Solves A*X=B for X using a previously Cholesky factored A, where A and B are blocks of larger column-major arrays.
+        /// </summary>
+        /// <param name="a">The array holding the Cholesky factor of A.</param>
+        /// <param name="offsetA">The index of the first element of A in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of A.</param>
+        /// <param name="orderA">The order of the square matrix A.</param>
+        /// <param name="b">The array holding the B matrix. On exit the B block is overwritten with the solution X.</param>
+        /// <param name="offsetB">The index of the first element of B in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of B.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <remarks>This is equivalent to the POTRS LAPACK routine.</remarks>
+        void CholeskySolveFactored(T[] a, int offsetA, int leadingDimensionA, int orderA, T[] b, int offsetB, int leadingDimensionB, int columnsB);
+
+        /// <summary>
+        /// Solves A*X=B for X for a batch of previously Cholesky factored systems of the same size.
+        /// </summary>
+        /// <param name="a">The Cholesky factors, stored one after another in column-major order.</param>
+        /// <param name="orderA">The order of each square matrix A.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive factors.</param>
+        /// <param name="b">The B matrices, stored one after another in column-major order. On exit each one is overwritten
+        /// with its solution X.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive B matrices.</param>
+        /// <param name="columnsB">The number of columns of each B.</param>
+        /// <param name="batchCount">The number of systems.</param>
+        /// <remarks>This is equivalent to the POTRS LAPACK routine applied to every system of the batch.</remarks>
+        void CholeskySolveFactoredBatch(T[] a, int orderA, int strideA, T[] b, int strideB, int columnsB, int batchCount);
+
+        /// <summary>
+        /// Estimates the reciprocal condition number of A from its Cholesky factorization.
+        /// </summary>
+        /// <param name="factors">The Cholesky factor of A, as computed by <see cref="CholeskyFactor(T[],int)"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="matrixNorm">The one norm of A before it was factored.</param>
+        /// <returns>An estimate of 1/(norm(A)*norm(inverse(A))) in the one norm, which for a Hermitian matrix
+        /// equals the infinity norm.</returns>
+        /// <remarks>This is equivalent to the POCON LAPACK routine.</remarks>
+        T CholeskyCondition(T[] factors, int order, T matrixNorm);
+
+        /// <summary>
+        /// Computes the Bunch-Kaufman LDL' factorization of a symmetric (Hermitian for complex types), possibly
+        /// indefinite matrix A, so that P*A*P' = L*D*L' with D block diagonal with 1 by 1 and 2 by 2 blocks.
+        /// </summary>
+        /// <param name="a">On entry, the matrix A; only its lower triangle is referenced. On exit, the lower
+        /// triangle holds the unit lower triangular factor L below the block diagonal matrix D.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">On exit, the pivot indices. A non-negative <c>ipiv[k]</c> means D has a 1 by 1 block at k
+        /// and rows k and <c>ipiv[k]</c> were interchanged. If <c>ipiv[k] = ipiv[k+1]</c> is negative, D has a 2 by 2
+        /// block at k and rows k+1 and <c>~ipiv[k]</c> were interchanged.</param>
+        /// <remarks>This is equivalent to the SYTRF or HETRF LAPACK routine. It needs half the work and memory
+        /// traffic of an LU factorization and, unlike Cholesky, accepts indefinite matrices such as saddle point
+        /// systems.</remarks>
+        void LDLTFactor(T[] a, int order, int[] ipiv);
+
+        /// <summary>
+        /// Solves A*X=B for X using the Bunch-Kaufman LDL' factorization of a symmetric (Hermitian for complex types),
+        /// possibly indefinite A.
+        /// </summary>
+        /// <param name="a">The matrix A; only its lower triangle is referenced. It is left unchanged.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the SYSV or HESV LAPACK routine.</remarks>
+        void LDLTSolve(T[] a, int orderA, T[] b, int columnsB);
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously computed Bunch-Kaufman LDL' factorization of A.
+        /// </summary>
+        /// <param name="a">The factored A, as computed by <see cref="LDLTFactor"/>.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="ipiv">The pivot indices of the factorization.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the SYTRS or HETRS LAPACK routine.</remarks>
+        void LDLTSolveFactored(T[] a, int orderA, int[] ipiv, T[] b, int columnsB);
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a square band matrix, using an LU factorization with partial pivoting.
+        /// </summary>
+        /// <param name="ab">The band matrix A in LAPACK band storage: A(i,j) is at <c>ab[j*(kl+ku+1) + ku + i - j]</c>
+        /// for <c>max(0, j-ku) &lt;= i &lt;= min(order-1, j+kl)</c>. It is left unchanged.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="lowerBandwidth">The number of subdiagonals, kl.</param>
+        /// <param name="upperBandwidth">The number of superdiagonals, ku.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the GBSV LAPACK routine. It takes O(order*kl*(kl+ku)) time and
+        /// O(order*(2*kl+ku)) memory.</remarks>
+        void BandLUSolve(T[] ab, int order, int lowerBandwidth, int upperBandwidth, T[] b, int columnsB);
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a symmetric (Hermitian for complex types) positive definite band matrix,
+        /// using a Cholesky factorization.
+        /// </summary>
+        /// <param name="ab">The lower triangle of the band matrix A in LAPACK band storage: A(i,j) is at
+        /// <c>ab[j*(kd+1) + i - j]</c> for <c>j &lt;= i &lt;= min(order-1, j+kd)</c>. It is left unchanged.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="bandwidth">The number of subdiagonals, kd.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the PBSV LAPACK routine. It takes O(order*kd*kd) time and
+        /// O(order*kd) memory.</remarks>
+        void BandCholeskySolve(T[] ab, int order, int bandwidth, T[] b, int columnsB);
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a tridiagonal matrix, using Gaussian elimination with partial pivoting.
+        /// </summary>
+        /// <param name="subdiagonal">The order-1 subdiagonal elements, A(i+1,i). It is left unchanged.</param>
+        /// <param name="diagonal">The order diagonal elements, A(i,i). It is left unchanged.</param>
+        /// <param name="superdiagonal">The order-1 superdiagonal elements, A(i,i+1). It is left unchanged.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the GTSV LAPACK routine. It takes O(order*columnsB) time.</remarks>
+        void TridiagonalSolve(T[] subdiagonal, T[] diagonal, T[] superdiagonal, T[] b, int columnsB);
+
+        /// <summary>
+        /// Solves A_k*X_k=B_k for X_k for a batch of tridiagonal matrices A_k of the same order, using Gaussian
+        /// elimination with partial pivoting.
+        /// </summary>
+        /// <param name="subdiagonal">The subdiagonals of the systems one after the other: system k starts at
+        /// <c>k*(order-1)</c>. It is left unchanged.</param>
+        /// <param name="diagonal">The diagonals of the systems one after the other: system k starts at
+        /// <c>k*order</c>. It is left unchanged.</param>
+        /// <param name="superdiagonal">The superdiagonals of the systems one after the other: system k starts at
+        /// <c>k*(order-1)</c>. It is left unchanged.</param>
+        /// <param name="b">On entry the B matrices one after the other, B_k starting at <c>k*order*columnsB</c>;
+        /// on exit the X matrices.</param>
+        /// <param name="order">The order of each system.</param>
+        /// <param name="columnsB">The number of columns in each B matrix.</param>
+        /// <param name="count">The number of systems.</param>
+        /// <remarks>This is equivalent to calling the GTSV LAPACK routine on each system, but crosses into the
+        /// native provider only once for the whole batch. A singular system does not stop the others from being
+        /// solved; its B matrix is left in an unspecified state and an <see cref="System.ArgumentException"/>
+        /// naming the first singular system is thrown once the batch is done.</remarks>
+        void TridiagonalSolveBatch(T[] subdiagonal, T[] diagonal, T[] superdiagonal, T[] b, int order, int columnsB, int count);
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a symmetric (Hermitian for complex types) positive definite tridiagonal
+        /// matrix, using an L*D*L' factorization.
+        /// </summary>
+        /// <param name="diagonal">The order diagonal elements, A(i,i). For complex types the imaginary parts are
+        /// ignored. It is left unchanged.</param>
+        /// <param name="subdiagonal">The order-1 subdiagonal elements, A(i+1,i). It is left unchanged.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the PTSV LAPACK routine. It takes O(order*columnsB) time.</remarks>
+        void PositiveDefiniteTridiagonalSolve(T[] diagonal, T[] subdiagonal, T[] b, int columnsB);
+
         /// <summary>
         /// Computes the QR factorization of A.
         /// </summary>
@@ -343,6 +783,49 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
         void QRFactor(T[] r, int rowsR, int columnsR, T[] q, T[] tau, T[] work);
 
+        /// <summary>
+        /// Computes the QR factorization of A without forming Q.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit, the upper triangle
+        /// holds the R matrix and the part below the diagonal the Householder vectors that make up Q.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains the scalar factors of the Householder
+        /// reflectors.</param>
+        /// <remarks>This is equivalent to the GEQRF LAPACK routine. Q is applied with
+        /// <see cref="QRApplyQ"/>, and formed by applying it to the identity.</remarks>
+        void QRFactor(T[] r, int rowsR, int columnsR, T[] tau);
+
+        /// <summary>
+        /// Computes the column-pivoted QR factorization A*P = Q*R without forming Q, and the numerical rank of A.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit, the upper triangle
+        /// holds the R matrix and the part below the diagonal the Householder vectors that make up Q.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains the scalar factors of the Householder
+        /// reflectors.</param>
+        /// <param name="pivots">An N vector. On exit, column j of A*P is column <c>pivots[j]</c> of A.</param>
+        /// <returns>The numerical rank: the number of leading diagonal entries of R larger than
+        /// max(m,n) times the machine epsilon times the magnitude of the first.</returns>
+        /// <remarks>This is equivalent to the GEQP3 LAPACK routine. The diagonal of R is non-increasing
+        /// in magnitude, and Q is applied with <see cref="QRApplyQ"/> as for an unpivoted factorization.</remarks>
+        int QRFactorPivoted(T[] r, int rowsR, int columnsR, T[] tau, int[] pivots);
+
+        /// <summary>
+        /// Multiplies a matrix by the Q of a QR factorization kept as Householder reflectors. <c>b = op(Q)*b</c>
+        /// </summary>
+        /// <param name="transposeQ">Whether to apply Q or its adjoint. Transpose and ConjugateTranspose both
+        /// apply the adjoint, which is the transpose for real matrices.</param>
+        /// <param name="r">The factored matrix returned by <see cref="QRFactor(T[],int,int,T[])"/>.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">The scalar factors of the Householder reflectors.</param>
+        /// <param name="b">On entry the M by <paramref name="columnsB"/> B matrix; on exit the product.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <remarks>This is equivalent to the ORMQR and UNMQR LAPACK routines.</remarks>
+        void QRApplyQ(Transpose transposeQ, T[] r, int rowsR, int columnsR, T[] tau, T[] b, int columnsB);
+
         /// <summary>
         /// Solves A*X=B for X using QR factorization of A.
         /// </summary>
@@ -437,6 +920,22 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
         void SingularValueDecomposition(bool computeVectors, T[] a, int rowsA, int columnsA, T[] s, T[] u, T[] vt, T[] work);
 
+        /// <summary>
+        /// Computes the singular value decomposition of A, or just the parts of it that <paramref name="mode"/> asks for.
+        /// </summary>
+        /// <param name="mode">Which factors to compute, and how.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in descending order.</param>
+        /// <param name="u">On exit, the left singular vectors: M by M for <see cref="SvdMode.Full"/>, M by Min(M, N)
+        /// for <see cref="SvdMode.Economy"/> and <see cref="SvdMode.DivideAndConquer"/>. Not referenced for
+        /// <see cref="SvdMode.ValuesOnly"/>.</param>
+        /// <param name="vt">On exit, the transposed right singular vectors: N by N for <see cref="SvdMode.Full"/>,
+        /// Min(M, N) by N for the economy modes. Not referenced for <see cref="SvdMode.ValuesOnly"/>.</param>
+        /// <remarks>This is equivalent to the GESVD LAPACK routine, or GESDD for <see cref="SvdMode.DivideAndConquer"/>.</remarks>
+        void SingularValueDecomposition(SvdMode mode, T[] a, int rowsA, int columnsA, T[] s, T[] u, T[] vt);
+
         /// <summary>
         /// Solves A*X=B for X using the singular value decomposition of A.
         /// </summary>
@@ -459,6 +958,18 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         /// <param name="b">The B matrix</param>
         /// <param name="columnsB">The number of columns of B.</param>
         /// <param name="x">On exit, the solution matrix.</param>
+        /// <remarks>U and VT may be either the full or the economy factors.</remarks>
         void SvdSolveFactored(int rowsA, int columnsA, T[] s, T[] u, T[] vt, T[] b, int columnsB, T[] x);
+
+        /// <summary>
+        /// Computes the eigenvalues and eigenvectors of a symmetric (or Hermitian) matrix.
+        /// </summary>
+        /// <param name="a">On entry, the symmetric or Hermitian matrix; only its lower triangle is read. On exit,
+        /// the orthonormal eigenvectors, one per column.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues in ascending order. They are real, so for complex
+        /// matrices their imaginary parts are zero.</param>
+        /// <remarks>This is equivalent to the SYEVD and HEEVD LAPACK routines.</remarks>
+        void EigenDecomposition(T[] a, int order, T[] eigenvalues);
     }
 }
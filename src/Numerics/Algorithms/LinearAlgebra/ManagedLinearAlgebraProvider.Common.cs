@@ -0,0 +1,899 @@
+﻿// <copyright file="ManagedLinearAlgebraProvider.Common.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+// Copyright (c) 2009-2010 Math.NET
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+namespace MathNet.Numerics.Algorithms.LinearAlgebra
+{
+    using System;
+    using Properties;
+
+    /// <summary>
+    /// The managed linear algebra provider.
+    /// </summary>
+    public partial class ManagedLinearAlgebraProvider
+    {
+        /// <summary>
+        /// Called when <see cref="Control.NumberOfParallelWorkerThreads"/> changes while this is the
+        /// <see cref="Control.LinearAlgebraProvider"/>. The managed provider already reads that setting.
+        /// </summary>
+        /// <param name="numberOfThreads">The number of worker threads.</param>
+        internal virtual void ApplyNumberOfParallelWorkerThreads(int numberOfThreads)
+        {
+        }
+
+        /// <summary>
+        /// Called on a worker thread before it runs bodies of a <see cref="Threading.CommonParallel"/> loop,
+        /// so that providers with their own threads can avoid oversubscribing the machine.
+        /// </summary>
+        /// <returns>A state to pass to <see cref="ExitParallelRegion"/>.</returns>
+        internal virtual int EnterParallelRegion()
+        {
+            return 0;
+        }
+
+        /// <summary>
+        /// Called on a worker thread after it has run bodies of a <see cref="Threading.CommonParallel"/> loop.
+        /// </summary>
+        /// <param name="state">The value returned by <see cref="EnterParallelRegion"/>.</param>
+        internal virtual void ExitParallelRegion(int state)
+        {
+        }
+
+#if !SILVERLIGHT
+        /// <summary>
+        /// Gets or sets the crossover sizes by which a native provider routes each call between its managed code and
+        /// the native library, and between one thread and many; <c>null</c>, the default, runs every call natively
+        /// with all threads. The managed provider itself ignores the profile.
+        /// </summary>
+        /// <seealso cref="Algorithms.LinearAlgebra.CrossoverProfile.Calibrate(ManagedLinearAlgebraProvider)"/>
+        public CrossoverProfile CrossoverProfile { get; set; }
+
+        /// <summary>
+        /// Starts a call of a native provider, routed by <see cref="CrossoverProfile"/>. Dispose the call when it is done.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="operation">The operation.</param>
+        /// <param name="size">The size of the call, as defined for <see cref="CrossoverOperation"/>.</param>
+        /// <returns>The call.</returns>
+        internal ProviderCall BeginCall<T>(CrossoverOperation operation, int size)
+        {
+            var profile = CrossoverProfile;
+            return profile == null ? new ProviderCall() : profile.BeginCall(this, operation, typeof(T), size);
+        }
+
+        /// <summary>
+        /// Starts a call of a native provider on an array, routed by <see cref="CrossoverProfile"/>. Dispose the call when it is done.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="operation">The operation.</param>
+        /// <param name="array">The array whose length is the size of the call; may be <c>null</c>.</param>
+        /// <returns>The call.</returns>
+        internal ProviderCall BeginCall<T>(CrossoverOperation operation, T[] array)
+        {
+            return BeginCall<T>(operation, array == null ? 0 : array.Length);
+        }
+#endif
+
+        /// <summary>
+        /// Checks that a <paramref name="rows"/> by <paramref name="columns"/> column-major block, starting at
+        /// <paramref name="offset"/> with columns <paramref name="leadingDimension"/> elements apart, lies inside <paramref name="array"/>.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="array">The array holding the block.</param>
+        /// <param name="offset">The index of the first element of the block.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns.</param>
+        /// <param name="rows">The number of rows of the block.</param>
+        /// <param name="columns">The number of columns of the block.</param>
+        /// <param name="parameterName">The name of the parameter to report.</param>
+        internal static void CheckBlock<T>(T[] array, int offset, int leadingDimension, int rows, int columns, string parameterName)
+        {
+            if (array == null)
+            {
+                throw new ArgumentNullException(parameterName);
+            }
+
+            if (rows < 0 || columns < 0 || offset < 0 || leadingDimension < Math.Max(1, rows))
+            {
+                throw new ArgumentOutOfRangeException(parameterName);
+            }
+
+            if (rows > 0 && columns > 0)
+            {
+                var end = offset + ((columns - 1) * leadingDimension) + rows;
+                if (end > array.Length)
+                {
+                    throw new ArgumentException(string.Format(Resources.ArrayTooSmall, end), parameterName);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Checks that <paramref name="batchCount"/> items of <paramref name="size"/> elements each, starting
+        /// <paramref name="stride"/> elements apart, lie inside <paramref name="array"/>.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="array">The array holding the batch.</param>
+        /// <param name="stride">The distance between the starts of two consecutive items.</param>
+        /// <param name="size">The number of elements of one item.</param>
+        /// <param name="batchCount">The number of items.</param>
+        /// <param name="parameterName">The name of the parameter to report.</param>
+        internal static void CheckBatch<T>(T[] array, int stride, int size, int batchCount, string parameterName)
+        {
+            if (array == null)
+            {
+                throw new ArgumentNullException(parameterName);
+            }
+
+            if (stride < 0)
+            {
+                throw new ArgumentOutOfRangeException(parameterName);
+            }
+
+            if (batchCount > 0 && size > 0)
+            {
+                var end = ((long)(batchCount - 1) * stride) + size;
+                if (end > array.Length)
+                {
+                    throw new ArgumentException(string.Format(Resources.ArrayTooSmall, end), parameterName);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Checks that <paramref name="array"/> holds <paramref name="batchCount"/> column-major <paramref name="rows"/> by
+        /// <paramref name="columns"/> matrices that start <paramref name="stride"/> elements apart and do not overlap.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="array">The array holding the batch.</param>
+        /// <param name="rows">The number of rows of each matrix.</param>
+        /// <param name="columns">The number of columns of each matrix.</param>
+        /// <param name="stride">The distance between the starts of two consecutive matrices.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        /// <param name="parameterName">The name of the parameter to report.</param>
+        internal static void CheckBlockBatch<T>(T[] array, int rows, int columns, int stride, int batchCount, string parameterName)
+        {
+            if (rows < 0 || columns < 0)
+            {
+                throw new ArgumentOutOfRangeException(parameterName);
+            }
+
+            if (batchCount < 0)
+            {
+                throw new ArgumentOutOfRangeException("batchCount");
+            }
+
+            if (stride < rows * columns)
+            {
+                throw new ArgumentOutOfRangeException(parameterName);
+            }
+
+            CheckBatch(array, stride, rows * columns, batchCount, parameterName);
+        }
+
+        /// <summary>
+        /// Checks that <paramref name="ipiv"/> can hold <paramref name="order"/> pivot indices for each of
+        /// <paramref name="batchCount"/> matrices.
+        /// </summary>
+        /// <param name="ipiv">The pivot indices.</param>
+        /// <param name="order">The order of each matrix.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        internal static void CheckPivotBatch(int[] ipiv, int order, int batchCount)
+        {
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (ipiv.Length < order * batchCount)
+            {
+                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, order * batchCount), "ipiv");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a batched matrix multiplication.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="m">The number of rows of each op(a) and c.</param>
+        /// <param name="n">The number of columns of each op(b) and c.</param>
+        /// <param name="k">The number of columns of each op(a) and the number of rows of each op(b).</param>
+        /// <param name="a">The a matrices.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive a matrices.</param>
+        /// <param name="b">The b matrices.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive b matrices.</param>
+        /// <param name="c">The c matrices.</param>
+        /// <param name="strideC">The distance between the starts of two consecutive c matrices.</param>
+        /// <param name="batchCount">The number of products.</param>
+        internal static void CheckMatrixMultiplyBatch<T>(int m, int n, int k, T[] a, int strideA, T[] b, int strideB, T[] c, int strideC, int batchCount)
+        {
+            if (m < 0)
+            {
+                throw new ArgumentOutOfRangeException("m");
+            }
+
+            if (n < 0)
+            {
+                throw new ArgumentOutOfRangeException("n");
+            }
+
+            if (k < 0)
+            {
+                throw new ArgumentOutOfRangeException("k");
+            }
+
+            if (batchCount < 0)
+            {
+                throw new ArgumentOutOfRangeException("batchCount");
+            }
+
+            // The results must not overlap, or the products would race each other.
+            if (strideC < m * n)
+            {
+                throw new ArgumentOutOfRangeException("strideC");
+            }
+
+            CheckBatch(a, strideA, m * k, batchCount, "a");
+            CheckBatch(b, strideB, k * n, batchCount, "b");
+            CheckBatch(c, strideC, m * n, batchCount, "c");
+        }
+
+        /// <summary>
+        /// Checks the arguments of a matrix-vector multiplication, <c>y = alpha*op(a)*x + beta*y</c>.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows of the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns of the <paramref name="a"/> matrix.</param>
+        /// <param name="x">The x vector.</param>
+        /// <param name="y">The y vector.</param>
+        internal static void CheckMatrixVectorMultiply<T>(Transpose transposeA, T[] a, int rowsA, int columnsA, T[] x, T[] y)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (x == null)
+            {
+                throw new ArgumentNullException("x");
+            }
+
+            if (y == null)
+            {
+                throw new ArgumentNullException("y");
+            }
+
+            if (rowsA < 0 || columnsA < 0 || a.Length != rowsA * columnsA)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "a");
+            }
+
+            var transposed = transposeA != Transpose.DontTranspose;
+            if (x.Length != (transposed ? rowsA : columnsA))
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "x");
+            }
+
+            if (y.Length != (transposed ? columnsA : rowsA))
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "y");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a rank one update, <c>a = a + alpha*x*y'</c>.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="x">The x vector, of length the number of rows of <paramref name="a"/>.</param>
+        /// <param name="y">The y vector, of length the number of columns of <paramref name="a"/>.</param>
+        /// <param name="a">The a matrix.</param>
+        internal static void CheckRankOneUpdate<T>(T[] x, T[] y, T[] a)
+        {
+            if (x == null)
+            {
+                throw new ArgumentNullException("x");
+            }
+
+            if (y == null)
+            {
+                throw new ArgumentNullException("y");
+            }
+
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (a.Length != x.Length * y.Length)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "a");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a rank-k update, <c>c = alpha*op(a)*op(a)' + beta*c</c>.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="c">The square c matrix, of order the number of rows of op(a).</param>
+        internal static void CheckRankKUpdate<T>(Transpose transposeA, T[] a, int rowsA, int columnsA, T[] c)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (c == null)
+            {
+                throw new ArgumentNullException("c");
+            }
+
+            if (a.Length != rowsA * columnsA)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "a");
+            }
+
+            var order = transposeA == Transpose.DontTranspose ? rowsA : columnsA;
+            if (c.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "c");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a triangular solve or multiplication.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="side">Whether the triangular matrix is on the left or the right of b.</param>
+        /// <param name="a">The square triangular matrix.</param>
+        /// <param name="b">The b matrix.</param>
+        /// <param name="rowsB">The number of rows in the <paramref name="b"/> matrix.</param>
+        /// <param name="columnsB">The number of columns in the <paramref name="b"/> matrix.</param>
+        internal static void CheckTriangular<T>(Side side, T[] a, T[] b, int rowsB, int columnsB)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            if (b.Length != rowsB * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "b");
+            }
+
+            var order = side == Side.Left ? rowsB : columnsB;
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "a");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a condition number estimate from the factors of a square matrix.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="norm">The norm to measure the condition in.</param>
+        /// <param name="factors">The factored matrix.</param>
+        /// <param name="order">The number of rows and columns in the matrix.</param>
+        internal static void CheckCondition<T>(Norm norm, T[] factors, int order)
+        {
+            if (factors == null)
+            {
+                throw new ArgumentNullException("factors");
+            }
+
+            if (factors.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "factors");
+            }
+
+            if (norm != Norm.OneNorm && norm != Norm.InfinityNorm)
+            {
+                throw new ArgumentOutOfRangeException("norm");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a determinant computed from an LU factorization.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="factors">The LU factors.</param>
+        /// <param name="order">The number of rows and columns in the matrix.</param>
+        /// <param name="ipiv">The pivot indices.</param>
+        internal static void CheckLUDeterminant<T>(T[] factors, int order, int[] ipiv)
+        {
+            CheckCondition(Norm.OneNorm, factors, order);
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (ipiv.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of an LDL' factorization.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="a">The matrix or its factors.</param>
+        /// <param name="order">The number of rows and columns in the matrix.</param>
+        /// <param name="ipiv">The pivot indices.</param>
+        internal static void CheckLDLTFactor<T>(T[] a, int order, int[] ipiv)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (ipiv.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a solve with an LDL' factorization.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="a">The matrix or its factors.</param>
+        /// <param name="orderA">The number of rows and columns in the matrix.</param>
+        /// <param name="b">The right hand side, which is overwritten with the solution.</param>
+        /// <param name="columnsB">The number of columns of the right hand side.</param>
+        internal static void CheckLDLTSolve<T>(T[] a, int orderA, T[] b, int columnsB)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (a.Length != orderA * orderA)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (b.Length != orderA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a band matrix solve.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="ab">The band matrix in LAPACK band storage.</param>
+        /// <param name="order">The order of the matrix.</param>
+        /// <param name="lowerBandwidth">The number of subdiagonals.</param>
+        /// <param name="upperBandwidth">The number of superdiagonals.</param>
+        /// <param name="b">The right hand side, which is overwritten with the solution.</param>
+        /// <param name="columnsB">The number of columns of the right hand side.</param>
+        internal static void CheckBandSolve<T>(T[] ab, int order, int lowerBandwidth, int upperBandwidth, T[] b, int columnsB)
+        {
+            if (ab == null)
+            {
+                throw new ArgumentNullException("ab");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (lowerBandwidth < 0)
+            {
+                throw new ArgumentOutOfRangeException("lowerBandwidth");
+            }
+
+            if (upperBandwidth < 0)
+            {
+                throw new ArgumentOutOfRangeException("upperBandwidth");
+            }
+
+            if (ab.Length != (lowerBandwidth + upperBandwidth + 1) * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ab");
+            }
+
+            if (b.Length != order * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(ab, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a batch of tridiagonal solves; a single solve is a batch of one.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="subdiagonal">The subdiagonals of the systems.</param>
+        /// <param name="diagonal">The diagonals of the systems.</param>
+        /// <param name="superdiagonal">The superdiagonals of the systems.</param>
+        /// <param name="b">The right hand sides, which are overwritten with the solutions.</param>
+        /// <param name="order">The order of each system.</param>
+        /// <param name="columnsB">The number of columns of each right hand side.</param>
+        /// <param name="count">The number of systems.</param>
+        internal static void CheckTridiagonalSolve<T>(T[] subdiagonal, T[] diagonal, T[] superdiagonal, T[] b, int order, int columnsB, int count)
+        {
+            if (subdiagonal == null)
+            {
+                throw new ArgumentNullException("subdiagonal");
+            }
+
+            if (diagonal == null)
+            {
+                throw new ArgumentNullException("diagonal");
+            }
+
+            if (superdiagonal == null)
+            {
+                throw new ArgumentNullException("superdiagonal");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (order < 0)
+            {
+                throw new ArgumentOutOfRangeException("order");
+            }
+
+            if (columnsB < 0)
+            {
+                throw new ArgumentOutOfRangeException("columnsB");
+            }
+
+            if (count < 0)
+            {
+                throw new ArgumentOutOfRangeException("count");
+            }
+
+            var offDiagonal = Math.Max(order - 1, 0) * count;
+            if (diagonal.Length != order * count)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "diagonal");
+            }
+
+            if (subdiagonal.Length != offDiagonal)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "subdiagonal");
+            }
+
+            if (superdiagonal.Length != offDiagonal)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "superdiagonal");
+            }
+
+            if (b.Length != order * columnsB * count)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(subdiagonal, b) || ReferenceEquals(diagonal, b) || ReferenceEquals(superdiagonal, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a symmetric or Hermitian eigenvalue decomposition.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <typeparam name="TValue">The element type of the eigenvalues.</typeparam>
+        /// <param name="a">The square matrix.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">The array for the eigenvalues.</param>
+        internal static void CheckEigenDecomposition<T, TValue>(T[] a, int order, TValue[] eigenvalues)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (eigenvalues == null)
+            {
+                throw new ArgumentNullException("eigenvalues");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "a");
+            }
+
+            if (eigenvalues.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "eigenvalues");
+            }
+        }
+
+        /// <summary>
+        /// Checks an array that receives one value per eigenvalue.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="eigenvalues">The array.</param>
+        /// <param name="order">The number of rows and columns of the decomposed matrix.</param>
+        /// <param name="parameterName">The name of the parameter that passed the array.</param>
+        internal static void CheckEigenvalues<T>(T[] eigenvalues, int order, string parameterName)
+        {
+            if (eigenvalues == null)
+            {
+                throw new ArgumentNullException(parameterName);
+            }
+
+            if (eigenvalues.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, parameterName);
+            }
+        }
+
+        /// <summary>
+        /// Checks an array that receives eigenvectors or Schur vectors.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="compute">Whether the vectors are computed; if not, the array is not checked.</param>
+        /// <param name="vectors">The array.</param>
+        /// <param name="order">The number of rows and columns of the decomposed matrix.</param>
+        /// <param name="parameterName">The name of the parameter that passed the array.</param>
+        internal static void CheckEigenvectors<T>(bool compute, T[] vectors, int order, string parameterName)
+        {
+            if (!compute)
+            {
+                return;
+            }
+
+            if (vectors == null)
+            {
+                throw new ArgumentNullException(parameterName);
+            }
+
+            if (vectors.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, parameterName);
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a QR factorization kept as Householder reflectors.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="r">The M by N matrix to factor.</param>
+        /// <param name="rowsR">The number of rows in R.</param>
+        /// <param name="columnsR">The number of columns in R.</param>
+        /// <param name="tau">The array of the scalar factors of the reflectors.</param>
+        internal static void CheckQRFactor<T>(T[] r, int rowsR, int columnsR, T[] tau)
+        {
+            if (r == null)
+            {
+                throw new ArgumentNullException("r");
+            }
+
+            if (tau == null)
+            {
+                throw new ArgumentNullException("tau");
+            }
+
+            if (r.Length != rowsR * columnsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
+            }
+
+            if (tau.Length < Math.Min(rowsR, columnsR))
+            {
+                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a column-pivoted QR factorization kept as Householder reflectors.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="r">The M by N matrix to factor.</param>
+        /// <param name="rowsR">The number of rows in R.</param>
+        /// <param name="columnsR">The number of columns in R.</param>
+        /// <param name="tau">The array of the scalar factors of the reflectors.</param>
+        /// <param name="pivots">The array of the column permutation.</param>
+        internal static void CheckQRFactorPivoted<T>(T[] r, int rowsR, int columnsR, T[] tau, int[] pivots)
+        {
+            CheckQRFactor(r, rowsR, columnsR, tau);
+
+            if (pivots == null)
+            {
+                throw new ArgumentNullException("pivots");
+            }
+
+            if (pivots.Length != columnsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "columnsR"), "pivots");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of applying the Q of a QR factorization kept as Householder reflectors.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="r">The factored M by N matrix.</param>
+        /// <param name="rowsR">The number of rows in R.</param>
+        /// <param name="columnsR">The number of columns in R.</param>
+        /// <param name="tau">The scalar factors of the reflectors.</param>
+        /// <param name="b">The M by <paramref name="columnsB"/> matrix Q is applied to.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        internal static void CheckQRApplyQ<T>(T[] r, int rowsR, int columnsR, T[] tau, T[] b, int columnsB)
+        {
+            CheckQRFactor(r, rowsR, columnsR, tau);
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (b.Length != rowsR * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+        }
+
+        /// <summary>
+        /// Checks the arguments of a singular value decomposition in the given mode.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="mode">Which factors are computed.</param>
+        /// <param name="a">The M by N matrix to decompose.</param>
+        /// <param name="rowsA">The number of rows in A.</param>
+        /// <param name="columnsA">The number of columns in A.</param>
+        /// <param name="s">The array that receives the singular values.</param>
+        /// <param name="u">The array that receives U, or <c>null</c> for <see cref="SvdMode.ValuesOnly"/>.</param>
+        /// <param name="vt">The array that receives VT, or <c>null</c> for <see cref="SvdMode.ValuesOnly"/>.</param>
+        internal static void CheckSingularValueDecomposition<T>(SvdMode mode, T[] a, int rowsA, int columnsA, T[] s, T[] u, T[] vt)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (s == null)
+            {
+                throw new ArgumentNullException("s");
+            }
+
+            if (a.Length != rowsA * columnsA)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "a");
+            }
+
+            var k = Math.Min(rowsA, columnsA);
+            if (s.Length != k)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+            }
+
+            if (mode == SvdMode.ValuesOnly)
+            {
+                return;
+            }
+
+            if (u == null)
+            {
+                throw new ArgumentNullException("u");
+            }
+
+            if (vt == null)
+            {
+                throw new ArgumentNullException("vt");
+            }
+
+            var full = mode == SvdMode.Full;
+            if (u.Length != rowsA * (full ? rowsA : k))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+            }
+
+            if (vt.Length != columnsA * (full ? columnsA : k))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+            }
+        }
+
+        /// <summary>
+        /// Copies a column-major block of a larger array into a new, densely packed array.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="source">The array holding the block.</param>
+        /// <param name="offset">The index of the first element of the block.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns.</param>
+        /// <param name="rows">The number of rows of the block.</param>
+        /// <param name="columns">The number of columns of the block.</param>
+        /// <returns>The block as a <paramref name="rows"/> by <paramref name="columns"/> column-major array.</returns>
+        internal static T[] ExtractBlock<T>(T[] source, int offset, int leadingDimension, int rows, int columns)
+        {
+            var block = new T[rows * columns];
+            for (var j = 0; j < columns; j++)
+            {
+                Array.Copy(source, offset + (j * leadingDimension), block, j * rows, rows);
+            }
+
+            return block;
+        }
+
+        /// <summary>
+        /// Copies a densely packed column-major array back into a block of a larger array.
+        /// </summary>
+        /// <typeparam name="T">The element type.</typeparam>
+        /// <param name="block">The <paramref name="rows"/> by <paramref name="columns"/> column-major array to copy.</param>
+        /// <param name="target">The array holding the block.</param>
+        /// <param name="offset">The index of the first element of the block.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns.</param>
+        /// <param name="rows">The number of rows of the block.</param>
+        /// <param name="columns">The number of columns of the block.</param>
+        internal static void StoreBlock<T>(T[] block, T[] target, int offset, int leadingDimension, int rows, int columns)
+        {
+            for (var j = 0; j < columns; j++)
+            {
+                Array.Copy(block, j * rows, target, offset + (j * leadingDimension), rows);
+            }
+        }
+    }
+}
@@ -329,7 +329,7 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
                     break;
                 case Norm.FrobeniusNorm:
                     var aat = new Complex32[rows * rows];
-                    MatrixMultiplyWithUpdate(Transpose.DontTranspose, Transpose.Transpose, 1.0f, matrix, rows, columns, matrix, rows, columns, 0.0f, aat);
+                    MatrixMultiplyWithUpdate(Transpose.DontTranspose, Transpose.ConjugateTranspose, 1.0f, matrix, rows, columns, matrix, rows, columns, 0.0f, aat);
 
                     for (var i = 0; i < rows; i++)
                     {
@@ -583,458 +583,2957 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         }
 
         /// <summary>
-        /// Cache-Oblivious Matrix Multiplication
+        /// Multiplies two matrices and updates another with the result, where each matrix is a block
+        /// of a larger column-major array. <c>c = alpha*op(a)*op(b) + beta*c</c>
         /// </summary>
-        /// <param name="transposeA">if set to <c>true</c> transpose matrix A.</param>
-        /// <param name="transposeB">if set to <c>true</c> transpose matrix B.</param>
-        /// <param name="alpha">The value to scale the matrix A with.</param>
-        /// <param name="matrixA">The matrix A.</param>
-        /// <param name="shiftArow">Row-shift of the left matrix</param>
-        /// <param name="shiftAcol">Column-shift of the left matrix</param>
-        /// <param name="matrixB">The matrix B.</param>
-        /// <param name="shiftBrow">Row-shift of the right matrix</param>
-        /// <param name="shiftBcol">Column-shift of the right matrix</param>
-        /// <param name="result">The matrix C.</param>
-        /// <param name="shiftCrow">Row-shift of the result matrix</param>
-        /// <param name="shiftCcol">Column-shift of the result matrix</param>
-        /// <param name="m">The number of rows of matrix op(A) and of the matrix C.</param>
-        /// <param name="n">The number of columns of matrix op(B) and of the matrix C.</param>
-        /// <param name="k">The number of columns of matrix op(A) and the rows of the matrix op(B).</param>
-        /// <param name="constM">The constant number of rows of matrix op(A) and of the matrix C.</param>
-        /// <param name="constN">The constant number of columns of matrix op(B) and of the matrix C.</param>
-        /// <param name="constK">The constant number of columns of matrix op(A) and the rows of the matrix op(B).</param>
-        /// <param name="first">Indicates if this is the first recursion.</param>
-        private static void CacheObliviousMatrixMultiply(Transpose transposeA, Transpose transposeB, Complex32 alpha, Complex32[] matrixA, int shiftArow, int shiftAcol, Complex32[] matrixB, int shiftBrow, int shiftBcol, Complex32[] result, int shiftCrow, int shiftCcol, int m, int n, int k, int constM, int constN, int constK, bool first)
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="transposeB">How to transpose the <paramref name="b"/> matrix.</param>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="m">The number of rows of op(a) and of c.</param>
+        /// <param name="n">The number of columns of op(b) and of c.</param>
+        /// <param name="k">The number of columns of op(a) and the number of rows of op(b).</param>
+        /// <param name="a">The array holding the a matrix.</param>
+        /// <param name="offsetA">The index of the first element of the a matrix in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of the a matrix.</param>
+        /// <param name="b">The array holding the b matrix.</param>
+        /// <param name="offsetB">The index of the first element of the b matrix in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of the b matrix.</param>
+        /// <param name="beta">The value to scale the c matrix.</param>
+        /// <param name="c">The array holding the c matrix.</param>
+        /// <param name="offsetC">The index of the first element of the c matrix in <paramref name="c"/>.</param>
+        /// <param name="leadingDimensionC">The distance between the starts of two consecutive columns of the c matrix.</param>
+        /// <remarks>This is equivalent to the GEMM BLAS routine.</remarks>
+        public virtual void MatrixMultiplyWithUpdate(Transpose transposeA, Transpose transposeB, Complex32 alpha, int m, int n, int k, Complex32[] a, int offsetA, int leadingDimensionA, Complex32[] b, int offsetB, int leadingDimensionB, Complex32 beta, Complex32[] c, int offsetC, int leadingDimensionC)
         {
-            if (m + n + k <= Control.ParallelizeOrder)
+            var rowsA = transposeA == Transpose.DontTranspose ? m : k;
+            var columnsA = transposeA == Transpose.DontTranspose ? k : m;
+            var rowsB = transposeB == Transpose.DontTranspose ? k : n;
+            var columnsB = transposeB == Transpose.DontTranspose ? n : k;
+
+            CheckBlock(a, offsetA, leadingDimensionA, rowsA, columnsA, "a");
+            CheckBlock(b, offsetB, leadingDimensionB, rowsB, columnsB, "b");
+            CheckBlock(c, offsetC, leadingDimensionC, m, n, "c");
+
+            if (m == 0 || n == 0)
             {
-                if ((int)transposeA > 111 && (int)transposeB > 111)
+                return;
+            }
+
+            var blockC = ExtractBlock(c, offsetC, leadingDimensionC, m, n);
+            MatrixMultiplyWithUpdate(transposeA, transposeB, alpha, ExtractBlock(a, offsetA, leadingDimensionA, rowsA, columnsA), rowsA, columnsA, ExtractBlock(b, offsetB, leadingDimensionB, rowsB, columnsB), rowsB, columnsB, beta, blockC);
+            StoreBlock(blockC, c, offsetC, leadingDimensionC, m, n);
+        }
+
+        /// <summary>
+        /// Multiplies a batch of equally sized matrices and updates the results. <c>c[i] = alpha*op(a[i])*op(b[i]) + beta*c[i]</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the a matrices.</param>
+        /// <param name="transposeB">How to transpose the b matrices.</param>
+        /// <param name="alpha">The value to scale the a matrices.</param>
+        /// <param name="m">The number of rows of each op(a) and c.</param>
+        /// <param name="n">The number of columns of each op(b) and c.</param>
+        /// <param name="k">The number of columns of each op(a) and the number of rows of each op(b).</param>
+        /// <param name="a">The a matrices, stored one after another in column-major order.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive a matrices. Use zero to share one matrix across the batch.</param>
+        /// <param name="b">The b matrices, stored one after another in column-major order.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive b matrices. Use zero to share one matrix across the batch.</param>
+        /// <param name="beta">The value to scale the c matrices.</param>
+        /// <param name="c">The c matrices, stored one after another in column-major order.</param>
+        /// <param name="strideC">The distance between the starts of two consecutive c matrices; at least <paramref name="m"/>*<paramref name="n"/>.</param>
+        /// <param name="batchCount">The number of products to compute.</param>
+        /// <remarks>The products are computed in parallel, one block multiplication per matrix.</remarks>
+        public virtual void MatrixMultiplyBatch(Transpose transposeA, Transpose transposeB, Complex32 alpha, int m, int n, int k, Complex32[] a, int strideA, Complex32[] b, int strideB, Complex32 beta, Complex32[] c, int strideC, int batchCount)
+        {
+            CheckMatrixMultiplyBatch(m, n, k, a, strideA, b, strideB, c, strideC, batchCount);
+
+            if (batchCount == 0 || m == 0 || n == 0)
+            {
+                return;
+            }
+
+            var leadingDimensionA = Math.Max(1, transposeA == Transpose.DontTranspose ? m : k);
+            var leadingDimensionB = Math.Max(1, transposeB == Transpose.DontTranspose ? k : n);
+
+            CommonParallel.For(0, batchCount, index => MatrixMultiplyWithUpdate(transposeA, transposeB, alpha, m, n, k, a, index * strideA, leadingDimensionA, b, index * strideB, leadingDimensionB, beta, c, index * strideC, m));
+        }
+
+        /// <summary>
+        /// Multiplies a matrix with a vector and updates another vector with the result. <c>y = alpha*op(a)*x + beta*y</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="x">The x vector, of length the number of columns of op(a).</param>
+        /// <param name="beta">The value to scale the <paramref name="y"/> vector.</param>
+        /// <param name="y">The y vector, of length the number of rows of op(a).</param>
+        /// <remarks>This is equivalent to the GEMV BLAS routine.</remarks>
+        public virtual void MatrixVectorMultiply(Transpose transposeA, Complex32 alpha, Complex32[] a, int rowsA, int columnsA, Complex32[] x, Complex32 beta, Complex32[] y)
+        {
+            CheckMatrixVectorMultiply(transposeA, a, rowsA, columnsA, x, y);
+
+            if (ReferenceEquals(x, y))
+            {
+                x = (Complex32[])x.Clone();
+            }
+
+            if (transposeA == Transpose.DontTranspose)
+            {
+                ScaleVector(beta, y);
+
+                // Walk a column by column, in storage order, adding each scaled column to y.
+                for (var j = 0; j < columnsA; j++)
                 {
-                    if ((int)transposeA > 112 && (int)transposeB > 112)
+                    var scaled = alpha * x[j];
+                    if (scaled == Complex32.Zero)
                     {
-                        for (var m1 = 0; m1 < m; m1++)
-                        {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
-                            {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol].Conjugate() *
-                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos].Conjugate();
-                                }
-
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
-                            }
-                        }
+                        continue;
                     }
-                    else if ((int)transposeA > 112)
-                    {
-                        for (var m1 = 0; m1 < m; m1++)
-                        {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
-                            {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol].Conjugate() *
-                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos];
-                                }
 
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
-                            }
-                        }
+                    var offset = j * rowsA;
+                    for (var i = 0; i < rowsA; i++)
+                    {
+                        y[i] += scaled * a[offset + i];
                     }
-                    else if ((int)transposeB > 112)
+                }
+            }
+            else
+            {
+                // Each element of y is the dot product of a column of a with x.
+                CommonParallel.For(
+                    0,
+                    columnsA,
+                    j =>
                     {
-                        for (var m1 = 0; m1 < m; m1++)
+                        var offset = j * rowsA;
+                        var sum = Complex32.Zero;
+                        if (transposeA == Transpose.ConjugateTranspose)
                         {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
+                            for (var i = 0; i < rowsA; i++)
                             {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol] *
-                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos].Conjugate();
-                                }
-
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                                sum += a[offset + i].Conjugate() * x[i];
                             }
                         }
-                    }
-                    else
-                    {
-                        for (var m1 = 0; m1 < m; m1++)
+                        else
                         {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
+                            for (var i = 0; i < rowsA; i++)
                             {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol] *
-                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos];
-                                }
-
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                                sum += a[offset + i] * x[i];
                             }
                         }
+
+                        y[j] = beta == Complex32.Zero ? alpha * sum : (alpha * sum) + (beta * y[j]);
+                    });
+            }
+        }
+
+        /// <summary>
+        /// Adds the scaled outer product of two vectors to a matrix. <c>a = a + alpha*x*y'</c>
+        /// </summary>
+        /// <param name="alpha">The value to scale the outer product.</param>
+        /// <param name="x">The x vector, of length the number of rows of <paramref name="a"/>.</param>
+        /// <param name="y">The y vector, of length the number of columns of <paramref name="a"/>. It is not conjugated.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <remarks>This is equivalent to the GERU BLAS routine.</remarks>
+        public virtual void RankOneUpdate(Complex32 alpha, Complex32[] x, Complex32[] y, Complex32[] a)
+        {
+            CheckRankOneUpdate(x, y, a);
+
+            var rows = x.Length;
+            CommonParallel.For(
+                0,
+                y.Length,
+                j =>
+                {
+                    var scaled = alpha * y[j];
+                    var offset = j * rows;
+                    for (var i = 0; i < rows; i++)
+                    {
+                        a[offset + i] += scaled * x[i];
                     }
-                }
-                else if ((int)transposeA > 111)
+                });
+        }
+
+        /// <summary>
+        /// Adds the scaled product of a matrix with its own transpose to a symmetric matrix. <c>c = alpha*op(a)*op(a)' + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix. Any value other than
+        /// <see cref="Transpose.DontTranspose"/> computes <c>a'*a</c>; the transpose is never conjugated.</param>
+        /// <param name="alpha">The value to scale the product.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="beta">The value to scale the <paramref name="c"/> matrix.</param>
+        /// <param name="c">The square c matrix, of order the number of rows of op(a). Only its lower triangle is updated.</param>
+        /// <param name="mirror">If <c>true</c>, the lower triangle is copied to the upper triangle afterwards so that
+        /// <paramref name="c"/> holds the full symmetric matrix.</param>
+        /// <remarks>This is equivalent to the SYRK BLAS routine.</remarks>
+        public virtual void SymmetricRankKUpdate(Transpose transposeA, Complex32 alpha, Complex32[] a, int rowsA, int columnsA, Complex32 beta, Complex32[] c, bool mirror)
+        {
+            CheckRankKUpdate(transposeA, a, rowsA, columnsA, c);
+
+            if (ReferenceEquals(a, c))
+            {
+                a = (Complex32[])a.Clone();
+            }
+
+            var transposed = transposeA != Transpose.DontTranspose;
+            var order = transposed ? columnsA : rowsA;
+            var k = transposed ? rowsA : columnsA;
+
+            // Each task owns the lower part of one column of c, so the upper triangle is never touched.
+            CommonParallel.For(
+                0,
+                order,
+                j =>
                 {
-                    if ((int)transposeA > 112)
+                    var offset = j * order;
+                    for (var i = j; i < order; i++)
                     {
-                        for (var m1 = 0; m1 < m; m1++)
+                        c[offset + i] = beta == Complex32.Zero ? Complex32.Zero : beta * c[offset + i];
+                    }
+
+                    if (transposed)
+                    {
+                        // c[i,j] is the dot product of columns i and j of a.
+                        for (var i = j; i < order; i++)
                         {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
+                            var sum = Complex32.Zero;
+                            for (var l = 0; l < k; l++)
                             {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol].Conjugate() *
-                                           matrixB[(matBcolPos * constK) + k1 + shiftBrow];
-                                }
-
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                                sum += a[(i * k) + l] * a[(j * k) + l];
                             }
+
+                            c[offset + i] += alpha * sum;
                         }
                     }
                     else
                     {
-                        for (var m1 = 0; m1 < m; m1++)
+                        // Walk a column by column, adding the scaled lower part of each column to c.
+                        for (var l = 0; l < k; l++)
                         {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
+                            var column = l * order;
+                            var scaled = alpha * a[column + j];
+                            if (scaled == Complex32.Zero)
                             {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol] *
-                                           matrixB[(matBcolPos * constK) + k1 + shiftBrow];
-                                }
+                                continue;
+                            }
 
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            for (var i = j; i < order; i++)
+                            {
+                                c[offset + i] += scaled * a[column + i];
                             }
                         }
                     }
-                }
-                else if ((int)transposeB > 111)
+                });
+
+            if (mirror)
+            {
+                MirrorLowerTriangle(c, order, false);
+            }
+        }
+
+        /// <summary>
+        /// Adds the scaled product of a matrix with its own conjugate transpose to a Hermitian matrix. <c>c = alpha*op(a)*op(a)^H + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix. Any value other than
+        /// <see cref="Transpose.DontTranspose"/> computes <c>a^H*a</c>.</param>
+        /// <param name="alpha">The value to scale the product.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="beta">The value to scale the <paramref name="c"/> matrix.</param>
+        /// <param name="c">The square c matrix, of order the number of rows of op(a). Only its lower triangle is updated.</param>
+        /// <param name="mirror">If <c>true</c>, the conjugate of the lower triangle is copied to the upper triangle afterwards
+        /// so that <paramref name="c"/> holds the full Hermitian matrix.</param>
+        /// <remarks>This is equivalent to the HERK BLAS routine.</remarks>
+        public virtual void HermitianRankKUpdate(Transpose transposeA, float alpha, Complex32[] a, int rowsA, int columnsA, float beta, Complex32[] c, bool mirror)
+        {
+            CheckRankKUpdate(transposeA, a, rowsA, columnsA, c);
+
+            if (ReferenceEquals(a, c))
+            {
+                a = (Complex32[])a.Clone();
+            }
+
+            var transposed = transposeA != Transpose.DontTranspose;
+            var order = transposed ? columnsA : rowsA;
+            var k = transposed ? rowsA : columnsA;
+
+            // Each task owns the lower part of one column of c, so the upper triangle is never touched.
+            CommonParallel.For(
+                0,
+                order,
+                j =>
                 {
-                    if ((int)transposeB > 112)
+                    var offset = j * order;
+                    for (var i = j; i < order; i++)
                     {
-                        for (var m1 = 0; m1 < m; m1++)
+                        c[offset + i] = beta == 0 ? Complex32.Zero : beta * c[offset + i];
+                    }
+
+                    if (transposed)
+                    {
+                        // c[i,j] is the dot product of columns i and j of a.
+                        for (var i = j; i < order; i++)
                         {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
+                            var sum = Complex32.Zero;
+                            for (var l = 0; l < k; l++)
                             {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[((k1 + shiftAcol) * constM) + matArowPos] *
-                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos].Conjugate();
-                                }
-
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                                sum += a[(i * k) + l].Conjugate() * a[(j * k) + l];
                             }
+
+                            c[offset + i] += alpha * sum;
                         }
                     }
                     else
                     {
-                        for (var m1 = 0; m1 < m; m1++)
+                        // Walk a column by column, adding the scaled lower part of each column to c.
+                        for (var l = 0; l < k; l++)
                         {
-                            var matArowPos = m1 + shiftArow;
-                            var matCrowPos = m1 + shiftCrow;
-                            for (var n1 = 0; n1 < n; ++n1)
+                            var column = l * order;
+                            var scaled = alpha * a[column + j].Conjugate();
+                            if (scaled == Complex32.Zero)
                             {
-                                var matBcolPos = n1 + shiftBcol;
-                                var sum = Complex32.Zero;
-                                for (var k1 = 0; k1 < k; ++k1)
-                                {
-                                    sum += matrixA[((k1 + shiftAcol) * constM) + matArowPos] *
-                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos];
-                                }
-
-                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                                continue;
                             }
-                        }
-                    }
-                }
-                else
-                {
-                    for (var m1 = 0; m1 < m; m1++)
-                    {
-                        var matArowPos = m1 + shiftArow;
-                        var matCrowPos = m1 + shiftCrow;
-                        for (var n1 = 0; n1 < n; ++n1)
-                        {
-                            var matBcolPos = n1 + shiftBcol;
-                            var sum = Complex32.Zero;
-                            for (var k1 = 0; k1 < k; ++k1)
+
+                            for (var i = j; i < order; i++)
                             {
-                                sum += matrixA[((k1 + shiftAcol) * constM) + matArowPos] *
-                                       matrixB[(matBcolPos * constK) + k1 + shiftBrow];
+                                c[offset + i] += scaled * a[column + i];
                             }
-
-                            result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
                         }
                     }
-                }
-            }
-            else
-            {
-                // divide and conquer
-                int m2 = m / 2, n2 = n / 2, k2 = k / 2;
-
-                if (first)
-                {
-                    CommonParallel.Invoke(
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k2, constM, constN, constK, false),
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k2, constM, constN, constK, false),
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k - k2, constM, constN, constK, false),
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k - k2, constM, constN, constK, false));
-
-                    CommonParallel.Invoke(
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k2, constM, constN, constK, false),
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k2, constM, constN, constK, false),
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k - k2, constM, constN, constK, false),
-                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k - k2, constM, constN, constK, false));
-                }
-                else
-                {
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k2, constM, constN, constK, false);
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k2, constM, constN, constK, false);
 
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k - k2, constM, constN, constK, false);
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k - k2, constM, constN, constK, false);
-
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k2, constM, constN, constK, false);
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k2, constM, constN, constK, false);
+                    c[offset + j] = new Complex32(c[offset + j].Real, 0);
+                });
 
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k - k2, constM, constN, constK, false);
-                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k - k2, constM, constN, constK, false);
-                }
+            if (mirror)
+            {
+                MirrorLowerTriangle(c, order, true);
             }
         }
 
         /// <summary>
-        /// Computes the LUP factorization of A. P*A = L*U.
+        /// Copies the strictly lower triangle of a square matrix to its upper triangle.
         /// </summary>
-        /// <param name="data">An <paramref name="order"/> by <paramref name="order"/> matrix. The matrix is overwritten with the
-        /// the LU factorization on exit. The lower triangular factor L is stored in under the diagonal of <paramref name="data"/> (the diagonal is always 1.0
-        /// for the L factor). The upper triangular factor U is stored on and above the diagonal of <paramref name="data"/>.</param>
-        /// <param name="order">The order of the square matrix <paramref name="data"/>.</param>
-        /// <param name="ipiv">On exit, it contains the pivot indices. The size of the array must be <paramref name="order"/>.</param>
-        /// <remarks>This is equivalent to the GETRF LAPACK routine.</remarks>
-        public virtual void LUFactor(Complex32[] data, int order, int[] ipiv)
+        /// <param name="c">The square matrix.</param>
+        /// <param name="order">The number of rows and columns in <paramref name="c"/>.</param>
+        /// <param name="conjugate">If <c>true</c>, the copies are conjugated, as for a Hermitian matrix.</param>
+        private static void MirrorLowerTriangle(Complex32[] c, int order, bool conjugate)
         {
-            if (data == null)
+            for (var j = 0; j < order; j++)
             {
-                throw new ArgumentNullException("data");
+                for (var i = j + 1; i < order; i++)
+                {
+                    c[(i * order) + j] = conjugate ? c[(j * order) + i].Conjugate() : c[(j * order) + i];
+                }
             }
+        }
 
-            if (ipiv == null)
-            {
-                throw new ArgumentNullException("ipiv");
-            }
+        /// <summary>
+        /// Solves a triangular system with many right hand sides in place. <c>op(a)*x = alpha*b</c> or <c>x*op(a) = alpha*b</c>
+        /// </summary>
+        /// <param name="side">Whether the triangular matrix is on the left or the right of x.</param>
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read; the other one is ignored.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="alpha">The value to scale <paramref name="b"/> with.</param>
+        /// <param name="a">The square triangular matrix, of order <paramref name="rowsB"/> on the left or
+        /// <paramref name="columnsB"/> on the right.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="rowsB">The number of rows in the <paramref name="b"/> matrix.</param>
+        /// <param name="columnsB">The number of columns in the <paramref name="b"/> matrix.</param>
+        /// <remarks>This is equivalent to the TRSM BLAS routine.</remarks>
+        public virtual void TriangularSolve(Side side, Triangle triangle, Transpose transposeA, DiagonalType diagonal, Complex32 alpha, Complex32[] a, Complex32[] b, int rowsB, int columnsB)
+        {
+            CheckTriangular(side, a, b, rowsB, columnsB);
 
-            if (data.Length != order * order)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "data");
-            }
+            bool lower;
+            var order = side == Side.Left ? rowsB : columnsB;
+            var t = ExpandTriangle(triangle, transposeA, diagonal, a, order, out lower);
 
-            if (ipiv.Length != order)
+            if (side == Side.Left)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
-            }
+                // Every column of b is an independent system, solved by forward or back substitution.
+                CommonParallel.For(
+                    0,
+                    columnsB,
+                    j =>
+                    {
+                        var offset = j * rowsB;
+                        for (var step = 0; step < order; step++)
+                        {
+                            var i = lower ? step : order - 1 - step;
+                            var sum = alpha * b[offset + i];
+                            var start = lower ? 0 : i + 1;
+                            var end = lower ? i : order;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum -= t[(k * order) + i] * b[offset + k];
+                            }
 
-            // Initialize the pivot matrix to the identity permutation.
-            for (var i = 0; i < order; i++)
-            {
-                ipiv[i] = i;
+                            b[offset + i] = sum / t[(i * order) + i];
+                        }
+                    });
             }
-
-            var vecLUcolj = new Complex32[order];
-
-            // Outer loop.
-            for (var j = 0; j < order; j++)
+            else
             {
-                var indexj = j * order;
-                var indexjj = indexj + j;
+                // Every row of b is an independent system; an upper op(a) is solved from its first column on.
+                CommonParallel.For(
+                    0,
+                    rowsB,
+                    i =>
+                    {
+                        for (var step = 0; step < order; step++)
+                        {
+                            var j = lower ? order - 1 - step : step;
+                            var sum = alpha * b[(j * rowsB) + i];
+                            var start = lower ? j + 1 : 0;
+                            var end = lower ? order : j;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum -= b[(k * rowsB) + i] * t[(j * order) + k];
+                            }
 
-                // Make a copy of the j-th column to localize references.
-                for (var i = 0; i < order; i++)
-                {
-                    vecLUcolj[i] = data[indexj + i];
-                }
+                            b[(j * rowsB) + i] = sum / t[(j * order) + j];
+                        }
+                    });
+            }
+        }
 
-                // Apply previous transformations.
-                for (var i = 0; i < order; i++)
-                {
-                    // Most of the time is spent in the following dot product.
-                    var kmax = Math.Min(i, j);
-                    var s = Complex32.Zero;
-                    for (var k = 0; k < kmax; k++)
-                    {
-                        s += data[(k * order) + i] * vecLUcolj[k];
-                    }
+        /// <summary>
+        /// Multiplies a matrix with a triangular matrix in place. <c>b = alpha*op(a)*b</c> or <c>b = alpha*b*op(a)</c>
+        /// </summary>
+        /// <param name="side">Whether the triangular matrix is on the left or the right of b.</param>
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read; the other one is ignored.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="alpha">The value to scale the product with.</param>
+        /// <param name="a">The square triangular matrix, of order <paramref name="rowsB"/> on the left or
+        /// <paramref name="columnsB"/> on the right.</param>
+        /// <param name="b">On entry the B matrix; on exit the product.</param>
+        /// <param name="rowsB">The number of rows in the <paramref name="b"/> matrix.</param>
+        /// <param name="columnsB">The number of columns in the <paramref name="b"/> matrix.</param>
+        /// <remarks>This is equivalent to the TRMM BLAS routine.</remarks>
+        public virtual void TriangularMultiply(Side side, Triangle triangle, Transpose transposeA, DiagonalType diagonal, Complex32 alpha, Complex32[] a, Complex32[] b, int rowsB, int columnsB)
+        {
+            CheckTriangular(side, a, b, rowsB, columnsB);
 
-                    data[indexj + i] = vecLUcolj[i] -= s;
-                }
+            bool lower;
+            var order = side == Side.Left ? rowsB : columnsB;
+            var t = ExpandTriangle(triangle, transposeA, diagonal, a, order, out lower);
 
-                // Find pivot and exchange if necessary.
-                var p = j;
-                for (var i = j + 1; i < order; i++)
-                {
-                    if (vecLUcolj[i].Magnitude > vecLUcolj[p].Magnitude)
+            // Each element is overwritten only after every element it depends on has been read,
+            // so a lower op(a) is applied from the last row (or first column) on.
+            if (side == Side.Left)
+            {
+                CommonParallel.For(
+                    0,
+                    columnsB,
+                    j =>
                     {
-                        p = i;
-                    }
-                }
+                        var offset = j * rowsB;
+                        for (var step = 0; step < order; step++)
+                        {
+                            var i = lower ? order - 1 - step : step;
+                            var sum = Complex32.Zero;
+                            var start = lower ? 0 : i;
+                            var end = lower ? i + 1 : order;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum += t[(k * order) + i] * b[offset + k];
+                            }
 
-                if (p != j)
-                {
-                    for (var k = 0; k < order; k++)
+                            b[offset + i] = alpha * sum;
+                        }
+                    });
+            }
+            else
+            {
+                CommonParallel.For(
+                    0,
+                    rowsB,
+                    i =>
                     {
-                        var indexk = k * order;
-                        var indexkp = indexk + p;
-                        var indexkj = indexk + j;
-                        var temp = data[indexkp];
-                        data[indexkp] = data[indexkj];
-                        data[indexkj] = temp;
-                    }
-
-                    ipiv[j] = p;
-                }
+                        for (var step = 0; step < order; step++)
+                        {
+                            var j = lower ? step : order - 1 - step;
+                            var sum = Complex32.Zero;
+                            var start = lower ? j : 0;
+                            var end = lower ? order : j + 1;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum += b[(k * rowsB) + i] * t[(j * order) + k];
+                            }
 
-                // Compute multipliers.
-                if (j < order & data[indexjj] != 0.0f)
-                {
-                    for (var i = j + 1; i < order; i++)
-                    {
-                        data[indexj + i] /= data[indexjj];
-                    }
-                }
+                            b[(j * rowsB) + i] = alpha * sum;
+                        }
+                    });
             }
         }
 
         /// <summary>
-        /// Computes the inverse of matrix using LU factorization.
+        /// Copies op(a) into a new square matrix, with zeros outside its triangle and ones on an implicit unit diagonal.
         /// </summary>
-        /// <param name="a">The N by N matrix to invert. Contains the inverse On exit.</param>
-        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
-        /// <remarks>This is equivalent to the GETRF and GETRI LAPACK routines.</remarks>
-        public virtual void LUInverse(Complex32[] a, int order)
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="a">The square triangular matrix.</param>
+        /// <param name="order">The number of rows and columns in <paramref name="a"/>.</param>
+        /// <param name="lower">On exit, whether op(a) is lower triangular.</param>
+        /// <returns>The matrix op(a).</returns>
+        private static Complex32[] ExpandTriangle(Triangle triangle, Transpose transposeA, DiagonalType diagonal, Complex32[] a, int order, out bool lower)
         {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
+            var transposed = transposeA != Transpose.DontTranspose;
+            lower = (triangle == Triangle.Lower) != transposed;
 
-            if (a.Length != order * order)
+            var t = new Complex32[order * order];
+            for (var k = 0; k < order; k++)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+                var start = lower ? k : 0;
+                var end = lower ? order : k + 1;
+                for (var i = start; i < end; i++)
+                {
+                    var value = transposed ? a[(i * order) + k] : a[(k * order) + i];
+                    t[(k * order) + i] = transposeA == Transpose.ConjugateTranspose ? value.Conjugate() : value;
+                }
+
+                if (diagonal == DiagonalType.Unit)
+                {
+                    t[(k * order) + k] = Complex32.One;
+                }
             }
 
-            var ipiv = new int[order];
-            LUFactor(a, order, ipiv);
-            LUInverseFactored(a, order, ipiv);
+            return t;
         }
 
         /// <summary>
-        /// Computes the inverse of a previously factored matrix.
+        /// Scales a vector in place, setting it to zero rather than multiplying when <paramref name="beta"/> is zero.
         /// </summary>
-        /// <param name="a">The LU factored N by N matrix.  Contains the inverse On exit.</param>
-        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
-        /// <param name="ipiv">The pivot indices of <paramref name="a"/>.</param>
-        /// <remarks>This is equivalent to the GETRI LAPACK routine.</remarks>
-        public virtual void LUInverseFactored(Complex32[] a, int order, int[] ipiv)
+        /// <param name="beta">The value to scale <paramref name="y"/> by.</param>
+        /// <param name="y">The vector to scale.</param>
+        private static void ScaleVector(Complex32 beta, Complex32[] y)
         {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
-
-            if (ipiv == null)
+            if (beta == Complex32.Zero)
             {
-                throw new ArgumentNullException("ipiv");
-            }
-
-            if (a.Length != order * order)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
-            }
-
-            if (ipiv.Length != order)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+                Array.Clear(y, 0, y.Length);
             }
-
-            var inverse = new Complex32[a.Length];
-            for (var i = 0; i < order; i++)
+            else if (beta != Complex32.One)
             {
-                inverse[i + (order * i)] = Complex32.One;
+                for (var i = 0; i < y.Length; i++)
+                {
+                    y[i] *= beta;
+                }
             }
-
-            LUSolveFactored(order, a, order, ipiv, inverse);
-            CommonParallel.For(0, a.Length, index => a[index] = inverse[index]);
         }
 
         /// <summary>
-        /// Computes the inverse of matrix using LU factorization.
+        /// Cache-Oblivious Matrix Multiplication
         /// </summary>
-        /// <param name="a">The N by N matrix to invert. Contains the inverse On exit.</param>
-        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
-        /// <param name="work">The work array. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>This is equivalent to the GETRF and GETRI LAPACK routines.</remarks>
-        public virtual void LUInverse(Complex32[] a, int order, Complex32[] work)
-        {
-            LUInverse(a, order);
-        }
+        /// <param name="transposeA">if set to <c>true</c> transpose matrix A.</param>
+        /// <param name="transposeB">if set to <c>true</c> transpose matrix B.</param>
+        /// <param name="alpha">The value to scale the matrix A with.</param>
+        /// <param name="matrixA">The matrix A.</param>
+        /// <param name="shiftArow">Row-shift of the left matrix</param>
+        /// <param name="shiftAcol">Column-shift of the left matrix</param>
+        /// <param name="matrixB">The matrix B.</param>
+        /// <param name="shiftBrow">Row-shift of the right matrix</param>
+        /// <param name="shiftBcol">Column-shift of the right matrix</param>
+        /// <param name="result">The matrix C.</param>
+        /// <param name="shiftCrow">Row-shift of the result matrix</param>
+        /// <param name="shiftCcol">Column-shift of the result matrix</param>
+        /// <param name="m">The number of rows of matrix op(A) and of the matrix C.</param>
+        /// <param name="n">The number of columns of matrix op(B) and of the matrix C.</param>
+        /// <param name="k">The number of columns of matrix op(A) and the rows of the matrix op(B).</param>
+        /// <param name="constM">The constant number of rows of matrix op(A) and of the matrix C.</param>
+        /// <param name="constN">The constant number of columns of matrix op(B) and of the matrix C.</param>
+        /// <param name="constK">The constant number of columns of matrix op(A) and the rows of the matrix op(B).</param>
+        /// <param name="first">Indicates if this is the first recursion.</param>
+        private static void CacheObliviousMatrixMultiply(Transpose transposeA, Transpose transposeB, Complex32 alpha, Complex32[] matrixA, int shiftArow, int shiftAcol, Complex32[] matrixB, int shiftBrow, int shiftBcol, Complex32[] result, int shiftCrow, int shiftCcol, int m, int n, int k, int constM, int constN, int constK, bool first)
+        {
+            if (m + n + k <= Control.ParallelizeOrder)
+            {
+                if ((int)transposeA > 111 && (int)transposeB > 111)
+                {
+                    if ((int)transposeA > 112 && (int)transposeB > 112)
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol].Conjugate() *
+                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos].Conjugate();
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                    else if ((int)transposeA > 112)
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol].Conjugate() *
+                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos];
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                    else if ((int)transposeB > 112)
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol] *
+                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos].Conjugate();
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol] *
+                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos];
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                }
+                else if ((int)transposeA > 111)
+                {
+                    if ((int)transposeA > 112)
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol].Conjugate() *
+                                           matrixB[(matBcolPos * constK) + k1 + shiftBrow];
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[(matArowPos * constK) + k1 + shiftAcol] *
+                                           matrixB[(matBcolPos * constK) + k1 + shiftBrow];
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                }
+                else if ((int)transposeB > 111)
+                {
+                    if ((int)transposeB > 112)
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[((k1 + shiftAcol) * constM) + matArowPos] *
+                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos].Conjugate();
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (var m1 = 0; m1 < m; m1++)
+                        {
+                            var matArowPos = m1 + shiftArow;
+                            var matCrowPos = m1 + shiftCrow;
+                            for (var n1 = 0; n1 < n; ++n1)
+                            {
+                                var matBcolPos = n1 + shiftBcol;
+                                var sum = Complex32.Zero;
+                                for (var k1 = 0; k1 < k; ++k1)
+                                {
+                                    sum += matrixA[((k1 + shiftAcol) * constM) + matArowPos] *
+                                           matrixB[((k1 + shiftBrow) * constN) + matBcolPos];
+                                }
+
+                                result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    for (var m1 = 0; m1 < m; m1++)
+                    {
+                        var matArowPos = m1 + shiftArow;
+                        var matCrowPos = m1 + shiftCrow;
+                        for (var n1 = 0; n1 < n; ++n1)
+                        {
+                            var matBcolPos = n1 + shiftBcol;
+                            var sum = Complex32.Zero;
+                            for (var k1 = 0; k1 < k; ++k1)
+                            {
+                                sum += matrixA[((k1 + shiftAcol) * constM) + matArowPos] *
+                                       matrixB[(matBcolPos * constK) + k1 + shiftBrow];
+                            }
+
+                            result[((n1 + shiftCcol) * constM) + matCrowPos] += alpha * sum;
+                        }
+                    }
+                }
+            }
+            else
+            {
+                // divide and conquer
+                int m2 = m / 2, n2 = n / 2, k2 = k / 2;
+
+                if (first)
+                {
+                    CommonParallel.Invoke(
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k2, constM, constN, constK, false),
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k2, constM, constN, constK, false),
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k - k2, constM, constN, constK, false),
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k - k2, constM, constN, constK, false));
+
+                    CommonParallel.Invoke(
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k2, constM, constN, constK, false),
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k2, constM, constN, constK, false),
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k - k2, constM, constN, constK, false),
+                        () => CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k - k2, constM, constN, constK, false));
+                }
+                else
+                {
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k2, constM, constN, constK, false);
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k2, constM, constN, constK, false);
+
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow, shiftCcol, m2, n2, k - k2, constM, constN, constK, false);
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow, shiftCcol + n2, m2, n - n2, k - k2, constM, constN, constK, false);
+
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k2, constM, constN, constK, false);
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol, matrixB, shiftBrow, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k2, constM, constN, constK, false);
+
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol, result, shiftCrow + m2, shiftCcol, m - m2, n2, k - k2, constM, constN, constK, false);
+                    CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, matrixA, shiftArow + m2, shiftAcol + k2, matrixB, shiftBrow + k2, shiftBcol + n2, result, shiftCrow + m2, shiftCcol + n2, m - m2, n - n2, k - k2, constM, constN, constK, false);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Computes the LUP factorization of A. P*A = L*U.
+        /// </summary>
+        /// <param name="data">An <paramref name="order"/> by <paramref name="order"/> matrix. The matrix is overwritten with the
+        /// the LU factorization on exit. The lower triangular factor L is stored in under the diagonal of <paramref name="data"/> (the diagonal is always 1.0
+        /// for the L factor). The upper triangular factor U is stored on and above the diagonal of <paramref name="data"/>.</param>
+        /// <param name="order">The order of the square matrix <paramref name="data"/>.</param>
+        /// <param name="ipiv">On exit, it contains the pivot indices. The size of the array must be <paramref name="order"/>.</param>
+        /// <remarks>This is equivalent to the GETRF LAPACK routine.</remarks>
+        public virtual void LUFactor(Complex32[] data, int order, int[] ipiv)
+        {
+            if (data == null)
+            {
+                throw new ArgumentNullException("data");
+            }
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (data.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "data");
+            }
+
+            if (ipiv.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+            }
+
+            // Initialize the pivot matrix to the identity permutation.
+            for (var i = 0; i < order; i++)
+            {
+                ipiv[i] = i;
+            }
+
+            var vecLUcolj = new Complex32[order];
+
+            // Outer loop.
+            for (var j = 0; j < order; j++)
+            {
+                var indexj = j * order;
+                var indexjj = indexj + j;
+
+                // Make a copy of the j-th column to localize references.
+                for (var i = 0; i < order; i++)
+                {
+                    vecLUcolj[i] = data[indexj + i];
+                }
+
+                // Apply previous transformations.
+                for (var i = 0; i < order; i++)
+                {
+                    // Most of the time is spent in the following dot product.
+                    var kmax = Math.Min(i, j);
+                    var s = Complex32.Zero;
+                    for (var k = 0; k < kmax; k++)
+                    {
+                        s += data[(k * order) + i] * vecLUcolj[k];
+                    }
+
+                    data[indexj + i] = vecLUcolj[i] -= s;
+                }
+
+                // Find pivot and exchange if necessary.
+                var p = j;
+                for (var i = j + 1; i < order; i++)
+                {
+                    if (vecLUcolj[i].Magnitude > vecLUcolj[p].Magnitude)
+                    {
+                        p = i;
+                    }
+                }
+
+                if (p != j)
+                {
+                    for (var k = 0; k < order; k++)
+                    {
+                        var indexk = k * order;
+                        var indexkp = indexk + p;
+                        var indexkj = indexk + j;
+                        var temp = data[indexkp];
+                        data[indexkp] = data[indexkj];
+                        data[indexkj] = temp;
+                    }
+
+                    ipiv[j] = p;
+                }
+
+                // Compute multipliers.
+                if (j < order & data[indexjj] != 0.0f)
+                {
+                    for (var i = j + 1; i < order; i++)
+                    {
+                        data[indexj + i] /= data[indexjj];
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Computes the LUP factorization of a square block of a larger column-major array. P*A = L*U.
+        /// </summary>
+        /// <param name="data">The array holding the matrix. The block is overwritten with the LU factorization on exit,
+        /// in the same layout as <see cref="LUFactor(Complex32[],int,int[])"/>.</param>
+        /// <param name="offset">The index of the first element of the block in <paramref name="data"/>.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns of the block.</param>
+        /// <param name="order">The order of the square block.</param>
+        /// <param name="ipiv">On exit, it contains the pivot indices. The size of the array must be <paramref name="order"/>.</param>
+        /// <remarks>This is equivalent to the GETRF LAPACK routine.</remarks>
+        public virtual void LUFactor(Complex32[] data, int offset, int leadingDimension, int order, int[] ipiv)
+        {
+            CheckBlock(data, offset, leadingDimension, order, order, "data");
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (ipiv.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+            }
+
+            var block = ExtractBlock(data, offset, leadingDimension, order, order);
+            LUFactor(block, order, ipiv);
+            StoreBlock(block, data, offset, leadingDimension, order, order);
+        }
+
+        /// <summary>
+        /// Computes the LUP factorizations of a batch of equally sized square matrices. P*A = L*U.
+        /// </summary>
+        /// <param name="data">The matrices, stored one after another in column-major order. On exit each one is
+        /// overwritten with its LU factorization.</param>
+        /// <param name="order">The order of each square matrix.</param>
+        /// <param name="stride">The distance between the starts of two consecutive matrices; at least <paramref name="order"/>*<paramref name="order"/>.</param>
+        /// <param name="ipiv">On exit, the pivot indices of the matrices, <paramref name="order"/> entries per matrix.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        /// <remarks>This is equivalent to the GETRF LAPACK routine applied to every matrix of the batch.</remarks>
+        public virtual void LUFactorBatch(Complex32[] data, int order, int stride, int[] ipiv, int batchCount)
+        {
+            CheckBlockBatch(data, order, order, stride, batchCount, "data");
+            CheckPivotBatch(ipiv, order, batchCount);
+
+            if (order == 0 || batchCount == 0)
+            {
+                return;
+            }
+
+            CommonParallel.For(
+                0,
+                batchCount,
+                index =>
+                {
+                    var pivots = new int[order];
+                    LUFactor(data, index * stride, order, order, pivots);
+                    Array.Copy(pivots, 0, ipiv, index * order, order);
+                });
+        }
+
+        /// <summary>
+        /// Computes the inverse of matrix using LU factorization.
+        /// </summary>
+        /// <param name="a">The N by N matrix to invert. Contains the inverse On exit.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <remarks>This is equivalent to the GETRF and GETRI LAPACK routines.</remarks>
+        public virtual void LUInverse(Complex32[] a, int order)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            var ipiv = new int[order];
+            LUFactor(a, order, ipiv);
+            LUInverseFactored(a, order, ipiv);
+        }
+
+        /// <summary>
+        /// Computes the inverse of a previously factored matrix.
+        /// </summary>
+        /// <param name="a">The LU factored N by N matrix.  Contains the inverse On exit.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <param name="ipiv">The pivot indices of <paramref name="a"/>.</param>
+        /// <remarks>This is equivalent to the GETRI LAPACK routine.</remarks>
+        public virtual void LUInverseFactored(Complex32[] a, int order, int[] ipiv)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (ipiv.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+            }
+
+            var inverse = new Complex32[a.Length];
+            for (var i = 0; i < order; i++)
+            {
+                inverse[i + (order * i)] = Complex32.One;
+            }
+
+            LUSolveFactored(order, a, order, ipiv, inverse);
+            CommonParallel.For(0, a.Length, index => a[index] = inverse[index]);
+        }
+
+        /// <summary>
+        /// Computes the inverse of matrix using LU factorization.
+        /// </summary>
+        /// <param name="a">The N by N matrix to invert. Contains the inverse On exit.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <param name="work">The work array. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>This is equivalent to the GETRF and GETRI LAPACK routines.</remarks>
+        public virtual void LUInverse(Complex32[] a, int order, Complex32[] work)
+        {
+            LUInverse(a, order);
+        }
+
+        /// <summary>
+        /// Computes the inverse of a previously factored matrix.
+        /// </summary>
+        /// <param name="a">The LU factored N by N matrix.  Contains the inverse On exit.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <param name="ipiv">The pivot indices of <paramref name="a"/>.</param>
+        /// <param name="work">The work array. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>This is equivalent to the GETRI LAPACK routine.</remarks>
+        public virtual void LUInverseFactored(Complex32[] a, int order, int[] ipiv, Complex32[] work)
+        {
+            LUInverseFactored(a, order, ipiv);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using LU factorization.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="a">The square matrix A.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <remarks>This is equivalent to the GETRF and GETRS LAPACK routines.</remarks>
+        public virtual void LUSolve(int columnsOfB, Complex32[] a, int order, Complex32[] b)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (b.Length != order * columnsOfB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            var ipiv = new int[order];
+            var clone = new Complex32[a.Length];
+            Array.Copy(a, 0, clone, 0, a.Length);
+            LUFactor(clone, order, ipiv);
+            LUSolveFactored(columnsOfB, clone, order, ipiv, b);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously factored A matrix.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="a">The factored A matrix.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <param name="ipiv">The pivot indices of <paramref name="a"/>.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <remarks>This is equivalent to the GETRS LAPACK routine.</remarks>
+        public virtual void LUSolveFactored(int columnsOfB, Complex32[] a, int order, int[] ipiv, Complex32[] b)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (ipiv.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+            }
+
+            if (b.Length != order * columnsOfB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            // Compute the column vector  P*B
+            for (var i = 0; i < ipiv.Length; i++)
+            {
+                if (ipiv[i] == i)
+                {
+                    continue;
+                }
+
+                var p = ipiv[i];
+                for (var j = 0; j < columnsOfB; j++)
+                {
+                    var indexk = j * order;
+                    var indexkp = indexk + p;
+                    var indexkj = indexk + i;
+                    var temp = b[indexkp];
+                    b[indexkp] = b[indexkj];
+                    b[indexkj] = temp;
+                }
+            }
+
+            // Solve L*Y = P*B
+            for (var k = 0; k < order; k++)
+            {
+                var korder = k * order;
+                for (var i = k + 1; i < order; i++)
+                {
+                    for (var j = 0; j < columnsOfB; j++)
+                    {
+                        var index = j * order;
+                        b[i + index] -= b[k + index] * a[i + korder];
+                    }
+                }
+            }
+
+            // Solve U*X = Y;
+            for (var k = order - 1; k >= 0; k--)
+            {
+                var korder = k + (k * order);
+                for (var j = 0; j < columnsOfB; j++)
+                {
+                    b[k + (j * order)] /= a[korder];
+                }
+
+                korder = k * order;
+                for (var i = 0; i < k; i++)
+                {
+                    for (var j = 0; j < columnsOfB; j++)
+                    {
+                        var index = j * order;
+                        b[i + index] -= b[k + index] * a[i + korder];
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously factored A, where A and B are blocks of larger column-major arrays.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="a">The array holding the factored A matrix.</param>
+        /// <param name="offsetA">The index of the first element of A in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of A.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">The pivot indices of A.</param>
+        /// <param name="b">The array holding the B matrix. On exit the B block is overwritten with the solution X.</param>
+        /// <param name="offsetB">The index of the first element of B in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of B.</param>
+        /// <remarks>This is equivalent to the GETRS LAPACK routine.</remarks>
+        public virtual void LUSolveFactored(int columnsOfB, Complex32[] a, int offsetA, int leadingDimensionA, int order, int[] ipiv, Complex32[] b, int offsetB, int leadingDimensionB)
+        {
+            CheckBlock(a, offsetA, leadingDimensionA, order, order, "a");
+            CheckBlock(b, offsetB, leadingDimensionB, order, columnsOfB, "b");
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            var blockB = ExtractBlock(b, offsetB, leadingDimensionB, order, columnsOfB);
+            LUSolveFactored(columnsOfB, ExtractBlock(a, offsetA, leadingDimensionA, order, order), order, ipiv, blockB);
+            StoreBlock(blockB, b, offsetB, leadingDimensionB, order, columnsOfB);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X for a batch of previously LU factored systems of the same size.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of each B.</param>
+        /// <param name="a">The factored A matrices, stored one after another in column-major order.</param>
+        /// <param name="order">The order of each square matrix A.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive A matrices.</param>
+        /// <param name="ipiv">The pivot indices of the A matrices, <paramref name="order"/> entries per matrix.</param>
+        /// <param name="b">The B matrices, stored one after another in column-major order. On exit each one is overwritten
+        /// with its solution X.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive B matrices.</param>
+        /// <param name="batchCount">The number of systems.</param>
+        /// <remarks>This is equivalent to the GETRS LAPACK routine applied to every system of the batch.</remarks>
+        public virtual void LUSolveFactoredBatch(int columnsOfB, Complex32[] a, int order, int strideA, int[] ipiv, Complex32[] b, int strideB, int batchCount)
+        {
+            CheckBlockBatch(a, order, order, strideA, batchCount, "a");
+            CheckBlockBatch(b, order, columnsOfB, strideB, batchCount, "b");
+            CheckPivotBatch(ipiv, order, batchCount);
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            if (order == 0 || columnsOfB == 0 || batchCount == 0)
+            {
+                return;
+            }
+
+            CommonParallel.For(
+                0,
+                batchCount,
+                index =>
+                {
+                    var pivots = new int[order];
+                    Array.Copy(ipiv, index * order, pivots, 0, order);
+                    LUSolveFactored(columnsOfB, a, index * strideA, order, order, pivots, b, index * strideB, order);
+                });
+        }
+
+        /// <summary>
+        /// Estimates the reciprocal condition number of A from its LU factorization.
+        /// </summary>
+        /// <param name="norm">The norm to measure the condition in: <see cref="Norm.OneNorm"/> or <see cref="Norm.InfinityNorm"/>.</param>
+        /// <param name="factors">The LU factors of A, as computed by <see cref="LUFactor(Complex32[],int,int[])"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="matrixNorm">The <paramref name="norm"/> of A before it was factored.</param>
+        /// <returns>An estimate of 1/(norm(A)*norm(inverse(A))); zero if A is singular.</returns>
+        /// <remarks>This is equivalent to the GECON LAPACK routine. The norm of the inverse is estimated from
+        /// a few solves with the factors, so this costs O(n^2) where forming the inverse costs O(n^3).</remarks>
+        public virtual Complex32 LUCondition(Norm norm, Complex32[] factors, int order, Complex32 matrixNorm)
+        {
+            CheckCondition(norm, factors, order);
+
+            if (order == 0)
+            {
+                return Complex32.One;
+            }
+
+            for (var i = 0; i < order; i++)
+            {
+                if (factors[(i * order) + i] == Complex32.Zero)
+                {
+                    return Complex32.Zero;
+                }
+            }
+
+            // The row interchanges do not change either norm of the inverse, so only L and U are solved with.
+            Action<Complex32[]> solve = x =>
+            {
+                TriangularSolve(Side.Left, Triangle.Lower, Transpose.DontTranspose, DiagonalType.Unit, Complex32.One, factors, x, order, 1);
+                TriangularSolve(Side.Left, Triangle.Upper, Transpose.DontTranspose, DiagonalType.NonUnit, Complex32.One, factors, x, order, 1);
+            };
+            Action<Complex32[]> solveAdjoint = x =>
+            {
+                TriangularSolve(Side.Left, Triangle.Upper, Transpose.ConjugateTranspose, DiagonalType.NonUnit, Complex32.One, factors, x, order, 1);
+                TriangularSolve(Side.Left, Triangle.Lower, Transpose.ConjugateTranspose, DiagonalType.Unit, Complex32.One, factors, x, order, 1);
+            };
+
+            // The infinity norm of the inverse is the one norm of its adjoint.
+            var inverseNorm = norm == Norm.OneNorm
+                ? EstimateInverseOneNorm(order, solve, solveAdjoint)
+                : EstimateInverseOneNorm(order, solveAdjoint, solve);
+
+            return matrixNorm.Magnitude == 0.0f ? Complex32.Zero : new Complex32((1.0f / inverseNorm) / matrixNorm.Magnitude, 0.0f);
+        }
+
+        /// <summary>
+        /// Computes the logarithm of the absolute value of the determinant of A, and its sign, from its LU factorization.
+        /// </summary>
+        /// <param name="factors">The LU factors of A, as computed by <see cref="LUFactor(Complex32[],int,int[])"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">The pivot indices of A.</param>
+        /// <param name="sign">On exit, the sign of the determinant: a value of magnitude one, or zero if A is singular.</param>
+        /// <returns>The natural logarithm of the absolute value of the determinant; negative infinity if A is singular.</returns>
+        /// <remarks>The determinant is <c>sign*exp(result)</c>. Unlike the product of the pivots, the sum of
+        /// their logarithms does not overflow or underflow for large matrices.</remarks>
+        public virtual Complex32 LUDeterminant(Complex32[] factors, int order, int[] ipiv, out Complex32 sign)
+        {
+            CheckLUDeterminant(factors, order, ipiv);
+
+            var logAbs = 0.0f;
+            sign = Complex32.One;
+            for (var i = 0; i < order; i++)
+            {
+                var u = factors[(i * order) + i];
+                var magnitude = u.Magnitude;
+                if (magnitude == 0.0f)
+                {
+                    sign = Complex32.Zero;
+                    return float.NegativeInfinity;
+                }
+
+                // Every pivot contributes its phase, and every row interchange a factor of -1.
+                var phase = new Complex32(u.Real / magnitude, u.Imaginary / magnitude);
+                sign *= ipiv[i] == i ? phase : -phase;
+                logAbs += (float)Math.Log(magnitude);
+            }
+
+            return logAbs;
+        }
+
+        /// <summary>
+        /// Computes the Cholesky factorization of A.
+        /// </summary>
+        /// <param name="a">On entry, a square, positive definite matrix. On exit, the matrix is overwritten with the
+        /// the Cholesky factorization.</param>
+        /// <param name="order">The number of rows or columns in the matrix.</param>
+        /// <remarks>This is equivalent to the POTRF LAPACK routine.</remarks>
+        public virtual void CholeskyFactor(Complex32[] a, int order)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            var tmpColumn = new Complex32[order];
+
+            // Main loop - along the diagonal
+            for (var ij = 0; ij < order; ij++)
+            {
+                // "Pivot" element
+                var tmpVal = a[(ij * order) + ij];
+
+                if (tmpVal.Real > 0.0)
+                {
+                    tmpVal = tmpVal.SquareRoot();
+                    a[(ij * order) + ij] = tmpVal;
+                    tmpColumn[ij] = tmpVal;
+
+                    // Calculate multipliers and copy to local column
+                    // Current column, below the diagonal
+                    for (var i = ij + 1; i < order; i++)
+                    {
+                        a[(ij * order) + i] /= tmpVal;
+                        tmpColumn[i] = a[(ij * order) + i];
+                    }
+
+                    // Remaining columns, below the diagonal
+                    DoCholeskyStep(a, order, ij + 1, order, tmpColumn, Control.NumberOfParallelWorkerThreads);
+                }
+                else
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
+                }
+
+                for (var i = ij + 1; i < order; i++)
+                {
+                    a[(i * order) + ij] = 0.0f;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Computes the Cholesky factorization of a square block of a larger column-major array.
+        /// </summary>
+        /// <param name="a">The array holding the matrix. On exit the block is overwritten with the lower triangular
+        /// Cholesky factor and its strictly upper triangle is set to zero.</param>
+        /// <param name="offset">The index of the first element of the block in <paramref name="a"/>.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns of the block.</param>
+        /// <param name="order">The order of the square block.</param>
+        /// <remarks>This is equivalent to the POTRF LAPACK routine.</remarks>
+        public virtual void CholeskyFactor(Complex32[] a, int offset, int leadingDimension, int order)
+        {
+            CheckBlock(a, offset, leadingDimension, order, order, "a");
+
+            var block = ExtractBlock(a, offset, leadingDimension, order, order);
+            CholeskyFactor(block, order);
+            StoreBlock(block, a, offset, leadingDimension, order, order);
+        }
+
+        /// <summary>
+        /// Computes the Cholesky factorizations of a batch of equally sized symmetric positive definite matrices.
+        /// </summary>
+        /// <param name="a">The matrices, stored one after another in column-major order. On exit each one is
+        /// overwritten with its lower triangular Cholesky factor.</param>
+        /// <param name="order">The order of each square matrix.</param>
+        /// <param name="stride">The distance between the starts of two consecutive matrices; at least <paramref name="order"/>*<paramref name="order"/>.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        /// <remarks>This is equivalent to the POTRF LAPACK routine applied to every matrix of the batch.</remarks>
+        public virtual void CholeskyFactorBatch(Complex32[] a, int order, int stride, int batchCount)
+        {
+            CheckBlockBatch(a, order, order, stride, batchCount, "a");
+
+            if (order == 0 || batchCount == 0)
+            {
+                return;
+            }
+
+            var failed = false;
+            CommonParallel.For(
+                0,
+                batchCount,
+                index =>
+                {
+                    try
+                    {
+                        CholeskyFactor(a, index * stride, order, order);
+                    }
+                    catch (ArgumentException)
+                    {
+                        failed = true;
+                    }
+                });
+
+            if (failed)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
+            }
+        }
+
+        /// <summary>
+        /// Calculate Cholesky step
+        /// </summary>
+        /// <param name="data">Factor matrix</param>
+        /// <param name="rowDim">Number of rows</param>
+        /// <param name="firstCol">Column start</param>
+        /// <param name="colLimit">Total columns</param>
+        /// <param name="multipliers">Multipliers calculated previously</param>
+        /// <param name="availableCores">Number of available processors</param>
+        private static void DoCholeskyStep(Complex32[] data, int rowDim, int firstCol, int colLimit, Complex32[] multipliers, int availableCores)
+        {
+            var tmpColCount = colLimit - firstCol;
+
+            if ((availableCores > 1) && (tmpColCount > 200))
+            {
+                var tmpSplit = firstCol + (tmpColCount / 3);
+                var tmpCores = availableCores / 2;
+
+                CommonParallel.Invoke(
+                    () => DoCholeskyStep(data, rowDim, firstCol, tmpSplit, multipliers, tmpCores),
+                    () => DoCholeskyStep(data, rowDim, tmpSplit, colLimit, multipliers, tmpCores));
+            }
+            else
+            {
+                for (var j = firstCol; j < colLimit; j++)
+                {
+                    var tmpVal = multipliers[j];
+                    for (var i = j; i < rowDim; i++)
+                    {
+                        data[(j * rowDim) + i] -= multipliers[i] * tmpVal.Conjugate();
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using Cholesky factorization.
+        /// </summary>
+        /// <param name="a">The square, positive definite matrix A.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the POTRF add POTRS LAPACK routines.</remarks>
+        public virtual void CholeskySolve(Complex32[] a, int orderA, Complex32[] b, int columnsB)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (b.Length != orderA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            var clone = new Complex32[a.Length];
+            Array.Copy(a, 0, clone, 0, a.Length);
+            CholeskyFactor(clone, orderA);
+            CholeskySolveFactored(clone, orderA, b, columnsB);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously factored A matrix.
+        /// </summary>
+        /// <param name="a">The square, positive definite matrix A.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the POTRS LAPACK routine.</remarks>
+        public virtual void CholeskySolveFactored(Complex32[] a, int orderA, Complex32[] b, int columnsB)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (b.Length != orderA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            CommonParallel.For(
+                0,
+                columnsB,
+                c =>
+                {
+                    var cindex = c * orderA;
+
+                    // Solve L*Y = B;
+                    Complex32 sum;
+                    for (var i = 0; i < orderA; i++)
+                    {
+                        sum = b[cindex + i];
+                        for (var k = i - 1; k >= 0; k--)
+                        {
+                            sum -= a[(k * orderA) + i] * b[cindex + k];
+                        }
+
+                        b[cindex + i] = sum / a[(i * orderA) + i];
+                    }
+
+                    // Solve L'*X = Y;
+                    for (var i = orderA - 1; i >= 0; i--)
+                    {
+                        sum = b[cindex + i];
+                        var iindex = i * orderA;
+                        for (var k = i + 1; k < orderA; k++)
+                        {
+                            sum -= a[iindex + k].Conjugate() * b[cindex + k];
+                        }
+
+                        b[cindex + i] = sum / a[iindex + i];
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously Cholesky factored A, where A and B are blocks of larger column-major arrays.
+        /// </summary>
+        /// <param name="a">The array holding the Cholesky factor of A.</param>
+        /// <param name="offsetA">The index of the first element of A in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of A.</param>
+        /// <param name="orderA">The order of the square matrix A.</param>
+        /// <param name="b">The array holding the B matrix. On exit the B block is overwritten with the solution X.</param>
+        /// <param name="offsetB">The index of the first element of B in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of B.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <remarks>This is equivalent to the POTRS LAPACK routine.</remarks>
+        public virtual void CholeskySolveFactored(Complex32[] a, int offsetA, int leadingDimensionA, int orderA, Complex32[] b, int offsetB, int leadingDimensionB, int columnsB)
+        {
+            CheckBlock(a, offsetA, leadingDimensionA, orderA, orderA, "a");
+            CheckBlock(b, offsetB, leadingDimensionB, orderA, columnsB, "b");
+
+            var blockB = ExtractBlock(b, offsetB, leadingDimensionB, orderA, columnsB);
+            CholeskySolveFactored(ExtractBlock(a, offsetA, leadingDimensionA, orderA, orderA), orderA, blockB, columnsB);
+            StoreBlock(blockB, b, offsetB, leadingDimensionB, orderA, columnsB);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X for a batch of previously Cholesky factored systems of the same size.
+        /// </summary>
+        /// <param name="a">The Cholesky factors, stored one after another in column-major order.</param>
+        /// <param name="orderA">The order of each square matrix A.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive factors.</param>
+        /// <param name="b">The B matrices, stored one after another in column-major order. On exit each one is overwritten
+        /// with its solution X.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive B matrices.</param>
+        /// <param name="columnsB">The number of columns of each B.</param>
+        /// <param name="batchCount">The number of systems.</param>
+        /// <remarks>This is equivalent to the POTRS LAPACK routine applied to every system of the batch.</remarks>
+        public virtual void CholeskySolveFactoredBatch(Complex32[] a, int orderA, int strideA, Complex32[] b, int strideB, int columnsB, int batchCount)
+        {
+            CheckBlockBatch(a, orderA, orderA, strideA, batchCount, "a");
+            CheckBlockBatch(b, orderA, columnsB, strideB, batchCount, "b");
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            if (orderA == 0 || columnsB == 0 || batchCount == 0)
+            {
+                return;
+            }
+
+            CommonParallel.For(
+                0,
+                batchCount,
+                index => CholeskySolveFactored(a, index * strideA, orderA, orderA, b, index * strideB, orderA, columnsB));
+        }
+
+        /// <summary>
+        /// Estimates the reciprocal condition number of A from its Cholesky factorization.
+        /// </summary>
+        /// <param name="factors">The Cholesky factor of A, as computed by <see cref="CholeskyFactor(Complex32[],int)"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="matrixNorm">The one norm of A before it was factored.</param>
+        /// <returns>An estimate of 1/(norm(A)*norm(inverse(A))) in the one norm, which for a Hermitian matrix
+        /// equals the infinity norm.</returns>
+        /// <remarks>This is equivalent to the POCON LAPACK routine.</remarks>
+        public virtual Complex32 CholeskyCondition(Complex32[] factors, int order, Complex32 matrixNorm)
+        {
+            CheckCondition(Norm.OneNorm, factors, order);
+
+            if (order == 0)
+            {
+                return Complex32.One;
+            }
+
+            // A is Hermitian, so the same solve serves for its adjoint.
+            Action<Complex32[]> solve = x => CholeskySolveFactored(factors, order, x, 1);
+            var inverseNorm = EstimateInverseOneNorm(order, solve, solve);
+
+            return matrixNorm.Magnitude == 0.0f ? Complex32.Zero : new Complex32((1.0f / inverseNorm) / matrixNorm.Magnitude, 0.0f);
+        }
+
+        /// <summary>
+        /// Computes the Bunch-Kaufman LDL' factorization of a Hermitian, possibly indefinite matrix A.
+        /// </summary>
+        /// <param name="a">On entry, the Hermitian matrix A; only its lower triangle is referenced. On exit, the lower
+        /// triangle holds the unit lower triangular factor L below the block diagonal matrix D.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">On exit, the pivot indices. A non-negative <c>ipiv[k]</c> means D has a 1 by 1 block at k
+        /// and rows k and <c>ipiv[k]</c> were interchanged. If <c>ipiv[k] = ipiv[k+1]</c> is negative, D has a 2 by 2
+        /// block at k and rows k+1 and <c>~ipiv[k]</c> were interchanged.</param>
+        /// <remarks>This is equivalent to the HETRF LAPACK routine.</remarks>
+        public virtual void LDLTFactor(Complex32[] a, int order, int[] ipiv)
+        {
+            CheckLDLTFactor(a, order, ipiv);
+
+            // Bunch-Kaufman threshold, which bounds the element growth of the factorization.
+            var alpha = (float)((1.0 + Math.Sqrt(17.0)) / 8.0);
+
+            var k = 0;
+            while (k < order)
+            {
+                var kstep = 1;
+                var kp = k;
+                var absakk = Math.Abs(a[(k * order) + k].Real);
+
+                // Largest off-diagonal element in column k.
+                var imax = k;
+                var colmax = 0.0f;
+                for (var i = k + 1; i < order; i++)
+                {
+                    var abs = a[(k * order) + i].Magnitude;
+                    if (abs > colmax)
+                    {
+                        colmax = abs;
+                        imax = i;
+                    }
+                }
+
+                if (Math.Max(absakk, colmax) == 0.0f)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixNotSingular);
+                }
+
+                if (absakk < alpha * colmax)
+                {
+                    // Largest off-diagonal element in row imax of the trailing matrix.
+                    var rowmax = 0.0f;
+                    for (var j = k; j < imax; j++)
+                    {
+                        rowmax = Math.Max(rowmax, a[(j * order) + imax].Magnitude);
+                    }
+
+                    for (var i = imax + 1; i < order; i++)
+                    {
+                        rowmax = Math.Max(rowmax, a[(imax * order) + i].Magnitude);
+                    }
+
+                    if (absakk * rowmax < alpha * colmax * colmax)
+                    {
+                        kp = imax;
+                        if (Math.Abs(a[(imax * order) + imax].Real) < alpha * rowmax)
+                        {
+                            kstep = 2;
+                        }
+                    }
+                }
+
+                // Interchange rows and columns kk and kp of the trailing matrix, conjugating the elements that move
+                // across the diagonal. The diagonal of a Hermitian matrix is real.
+                var kk = k + kstep - 1;
+                if (kp != kk)
+                {
+                    Complex32 temp;
+                    for (var i = kp + 1; i < order; i++)
+                    {
+                        temp = a[(kk * order) + i];
+                        a[(kk * order) + i] = a[(kp * order) + i];
+                        a[(kp * order) + i] = temp;
+                    }
+
+                    for (var j = kk + 1; j < kp; j++)
+                    {
+                        temp = a[(kk * order) + j].Conjugate();
+                        a[(kk * order) + j] = a[(j * order) + kp].Conjugate();
+                        a[(j * order) + kp] = temp;
+                    }
+
+                    a[(kk * order) + kp] = a[(kk * order) + kp].Conjugate();
+
+                    var diagonal = a[(kk * order) + kk].Real;
+                    a[(kk * order) + kk] = new Complex32(a[(kp * order) + kp].Real, 0.0f);
+                    a[(kp * order) + kp] = new Complex32(diagonal, 0.0f);
+
+                    if (kstep == 2)
+                    {
+                        a[(k * order) + k] = new Complex32(a[(k * order) + k].Real, 0.0f);
+                        temp = a[(k * order) + k + 1];
+                        a[(k * order) + k + 1] = a[(k * order) + kp];
+                        a[(k * order) + kp] = temp;
+                    }
+                }
+                else
+                {
+                    a[(k * order) + k] = new Complex32(a[(k * order) + k].Real, 0.0f);
+                    if (kstep == 2)
+                    {
+                        a[((k + 1) * order) + k + 1] = new Complex32(a[((k + 1) * order) + k + 1].Real, 0.0f);
+                    }
+                }
+
+                if (kstep == 1)
+                {
+                    // A := A - L(k)*D(k)*L(k)' with L(k) = A(k+1:n,k)/D(k).
+                    var d11 = 1.0f / a[(k * order) + k].Real;
+                    for (var j = k + 1; j < order; j++)
+                    {
+                        var scale = d11 * a[(k * order) + j].Conjugate();
+                        for (var i = j; i < order; i++)
+                        {
+                            a[(j * order) + i] -= a[(k * order) + i] * scale;
+                        }
+
+                        a[(j * order) + j] = new Complex32(a[(j * order) + j].Real, 0.0f);
+                    }
+
+                    for (var i = k + 1; i < order; i++)
+                    {
+                        a[(k * order) + i] *= d11;
+                    }
+
+                    ipiv[k] = kp;
+                }
+                else
+                {
+                    // A := A - [L(k) L(k+1)]*D(k)*[L(k) L(k+1)]' with [L(k) L(k+1)] = A(k+2:n,k:k+1)*inverse(D(k)).
+                    if (k < order - 2)
+                    {
+                        var d = a[(k * order) + k + 1].Magnitude;
+                        var d11 = a[((k + 1) * order) + k + 1].Real / d;
+                        var d22 = a[(k * order) + k].Real / d;
+                        var d21 = a[(k * order) + k + 1] / d;
+                        d = (1.0f / ((d11 * d22) - 1.0f)) / d;
+
+                        for (var j = k + 2; j < order; j++)
+                        {
+                            var wk = d * ((d11 * a[(k * order) + j]) - (d21 * a[((k + 1) * order) + j]));
+                            var wkp1 = d * ((d22 * a[((k + 1) * order) + j]) - (d21.Conjugate() * a[(k * order) + j]));
+                            for (var i = j; i < order; i++)
+                            {
+                                a[(j * order) + i] -= (a[(k * order) + i] * wk.Conjugate()) + (a[((k + 1) * order) + i] * wkp1.Conjugate());
+                            }
+
+                            a[(k * order) + j] = wk;
+                            a[((k + 1) * order) + j] = wkp1;
+                            a[(j * order) + j] = new Complex32(a[(j * order) + j].Real, 0.0f);
+                        }
+                    }
+
+                    ipiv[k] = ~kp;
+                    ipiv[k + 1] = ~kp;
+                }
+
+                k += kstep;
+            }
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using the Bunch-Kaufman LDL' factorization of a Hermitian, possibly indefinite A.
+        /// </summary>
+        /// <param name="a">The Hermitian matrix A; only its lower triangle is referenced. It is left unchanged.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the HESV LAPACK routine.</remarks>
+        public virtual void LDLTSolve(Complex32[] a, int orderA, Complex32[] b, int columnsB)
+        {
+            CheckLDLTSolve(a, orderA, b, columnsB);
+
+            var clone = new Complex32[a.Length];
+            Array.Copy(a, 0, clone, 0, a.Length);
+            var ipiv = new int[orderA];
+            LDLTFactor(clone, orderA, ipiv);
+            LDLTSolveFactored(clone, orderA, ipiv, b, columnsB);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously computed Bunch-Kaufman LDL' factorization of A.
+        /// </summary>
+        /// <param name="a">The factored A, as computed by <see cref="LDLTFactor(Complex32[],int,int[])"/>.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="ipiv">The pivot indices of the factorization.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the HETRS LAPACK routine.</remarks>
+        public virtual void LDLTSolveFactored(Complex32[] a, int orderA, int[] ipiv, Complex32[] b, int columnsB)
+        {
+            CheckLDLTFactor(a, orderA, ipiv);
+            CheckLDLTSolve(a, orderA, b, columnsB);
+
+            CommonParallel.For(
+                0,
+                columnsB,
+                c =>
+                {
+                    var cindex = c * orderA;
+                    Complex32 temp;
+
+                    // Solve L*D*Y = P*B, one block of D at a time.
+                    var k = 0;
+                    while (k < orderA)
+                    {
+                        if (ipiv[k] >= 0)
+                        {
+                            var kp = ipiv[k];
+                            temp = b[cindex + k];
+                            b[cindex + k] = b[cindex + kp];
+                            b[cindex + kp] = temp;
+
+                            for (var i = k + 1; i < orderA; i++)
+                            {
+                                b[cindex + i] -= a[(k * orderA) + i] * b[cindex + k];
+                            }
+
+                            b[cindex + k] /= a[(k * orderA) + k].Real;
+                            k++;
+                        }
+                        else
+                        {
+                            var kp = ~ipiv[k];
+                            temp = b[cindex + k + 1];
+                            b[cindex + k + 1] = b[cindex + kp];
+                            b[cindex + kp] = temp;
+
+                            for (var i = k + 2; i < orderA; i++)
+                            {
+                                b[cindex + i] -= (a[(k * orderA) + i] * b[cindex + k]) + (a[((k + 1) * orderA) + i] * b[cindex + k + 1]);
+                            }
+
+                            var akm1k = a[(k * orderA) + k + 1];
+                            var akm1 = a[(k * orderA) + k] / akm1k.Conjugate();
+                            var ak = a[((k + 1) * orderA) + k + 1] / akm1k;
+                            var denom = (akm1 * ak) - Complex32.One;
+                            var bkm1 = b[cindex + k] / akm1k.Conjugate();
+                            var bk = b[cindex + k + 1] / akm1k;
+                            b[cindex + k] = ((ak * bkm1) - bk) / denom;
+                            b[cindex + k + 1] = ((akm1 * bk) - bkm1) / denom;
+                            k += 2;
+                        }
+                    }
+
+                    // Solve L'*P'*X = Y, from the last block back to the first.
+                    k = orderA - 1;
+                    while (k >= 0)
+                    {
+                        var first = ipiv[k] >= 0 ? k : k - 1;
+                        for (var j = first; j <= k; j++)
+                        {
+                            var sum = b[cindex + j];
+                            for (var i = k + 1; i < orderA; i++)
+                            {
+                                sum -= a[(j * orderA) + i].Conjugate() * b[cindex + i];
+                            }
+
+                            b[cindex + j] = sum;
+                        }
+
+                        var kp = ipiv[k] >= 0 ? ipiv[k] : ~ipiv[k];
+                        temp = b[cindex + k];
+                        b[cindex + k] = b[cindex + kp];
+                        b[cindex + kp] = temp;
+                        k = first - 1;
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a square band matrix, using an LU factorization with partial pivoting.
+        /// </summary>
+        /// <param name="ab">The band matrix A in LAPACK band storage: A(i,j) is at <c>ab[j*(kl+ku+1) + ku + i - j]</c>
+        /// for <c>max(0, j-ku) &lt;= i &lt;= min(order-1, j+kl)</c>. It is left unchanged.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="lowerBandwidth">The number of subdiagonals, kl.</param>
+        /// <param name="upperBandwidth">The number of superdiagonals, ku.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the GBSV LAPACK routine. It takes O(order*kl*(kl+ku)) time and
+        /// O(order*(2*kl+ku)) memory.</remarks>
+        public virtual void BandLUSolve(Complex32[] ab, int order, int lowerBandwidth, int upperBandwidth, Complex32[] b, int columnsB)
+        {
+            CheckBandSolve(ab, order, lowerBandwidth, upperBandwidth, b, columnsB);
+
+            // Copy A into a work array with kl extra rows above the band for the fill-in of the row interchanges.
+            var kl = lowerBandwidth;
+            var ku = upperBandwidth;
+            var kv = kl + ku;
+            var ld = kv + 1;
+            var ldwork = kv + kl + 1;
+            var work = new Complex32[ldwork * order];
+            for (var j = 0; j < order; j++)
+            {
+                Array.Copy(ab, j * ld, work, (j * ldwork) + kl, ld);
+            }
+
+            // A(i,j) is at work[(j * ldwork) + kv + i - j].
+            var ipiv = new int[order];
+            var ju = 0;
+            for (var j = 0; j < order; j++)
+            {
+                var km = Math.Min(kl, order - 1 - j);
+                var diagonal = (j * ldwork) + kv;
+
+                var jp = j;
+                var max = work[diagonal].Magnitude;
+                for (var i = j + 1; i <= j + km; i++)
+                {
+                    var abs = work[diagonal + i - j].Magnitude;
+                    if (abs > max)
+                    {
+                        max = abs;
+                        jp = i;
+                    }
+                }
+
+                if (max == 0.0f)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixNotSingular);
+                }
+
+                ipiv[j] = jp;
+                ju = Math.Max(ju, Math.Min(jp + ku, order - 1));
+
+                if (jp != j)
+                {
+                    for (var c = j; c <= ju; c++)
+                    {
+                        var temp = work[(c * ldwork) + kv + j - c];
+                        work[(c * ldwork) + kv + j - c] = work[(c * ldwork) + kv + jp - c];
+                        work[(c * ldwork) + kv + jp - c] = temp;
+                    }
+                }
+
+                var pivot = work[diagonal];
+                for (var i = j + 1; i <= j + km; i++)
+                {
+                    work[diagonal + i - j] /= pivot;
+                }
+
+                for (var c = j + 1; c <= ju; c++)
+                {
+                    var scale = work[(c * ldwork) + kv + j - c];
+                    if (scale == Complex32.Zero)
+                    {
+                        continue;
+                    }
+
+                    for (var i = j + 1; i <= j + km; i++)
+                    {
+                        work[(c * ldwork) + kv + i - c] -= work[diagonal + i - j] * scale;
+                    }
+                }
+            }
+
+            CommonParallel.For(
+                0,
+                columnsB,
+                c =>
+                {
+                    var cindex = c * order;
+
+                    // Solve L*Y = P*B, applying the interchanges in the order they were made.
+                    for (var j = 0; j < order; j++)
+                    {
+                        var jp = ipiv[j];
+                        var temp = b[cindex + j];
+                        b[cindex + j] = b[cindex + jp];
+                        b[cindex + jp] = temp;
+
+                        var km = Math.Min(kl, order - 1 - j);
+                        for (var i = j + 1; i <= j + km; i++)
+                        {
+                            b[cindex + i] -= work[(j * ldwork) + kv + i - j] * b[cindex + j];
+                        }
+                    }
+
+                    // Solve U*X = Y; U has kl + ku superdiagonals.
+                    for (var j = order - 1; j >= 0; j--)
+                    {
+                        b[cindex + j] /= work[(j * ldwork) + kv];
+                        for (var i = Math.Max(0, j - kv); i < j; i++)
+                        {
+                            b[cindex + i] -= work[(j * ldwork) + kv + i - j] * b[cindex + j];
+                        }
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a Hermitian positive definite band matrix, using a Cholesky factorization.
+        /// </summary>
+        /// <param name="ab">The lower triangle of the band matrix A in LAPACK band storage: A(i,j) is at
+        /// <c>ab[j*(kd+1) + i - j]</c> for <c>j &lt;= i &lt;= min(order-1, j+kd)</c>. It is left unchanged.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="bandwidth">The number of subdiagonals, kd.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the PBSV LAPACK routine. It takes O(order*kd*kd) time and
+        /// O(order*kd) memory.</remarks>
+        public virtual void BandCholeskySolve(Complex32[] ab, int order, int bandwidth, Complex32[] b, int columnsB)
+        {
+            CheckBandSolve(ab, order, bandwidth, 0, b, columnsB);
+
+            var kd = bandwidth;
+            var ld = kd + 1;
+            var factor = new Complex32[ab.Length];
+            Array.Copy(ab, 0, factor, 0, ab.Length);
+
+            // L(i,j) is at factor[(j * ld) + i - j].
+            for (var j = 0; j < order; j++)
+            {
+                var ajj = factor[j * ld].Real;
+                if (ajj <= 0.0f)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
+                }
+
+                ajj = (float)Math.Sqrt(ajj);
+                factor[j * ld] = ajj;
+
+                var kn = Math.Min(kd, order - 1 - j);
+                for (var i = 1; i <= kn; i++)
+                {
+                    factor[(j * ld) + i] /= ajj;
+                }
+
+                for (var c = 1; c <= kn; c++)
+                {
+                    var scale = factor[(j * ld) + c].Conjugate();
+                    for (var i = c; i <= kn; i++)
+                    {
+                        factor[((j + c) * ld) + i - c] -= factor[(j * ld) + i] * scale;
+                    }
+                }
+            }
+
+            CommonParallel.For(
+                0,
+                columnsB,
+                c =>
+                {
+                    var cindex = c * order;
+
+                    // Solve L*Y = B.
+                    for (var j = 0; j < order; j++)
+                    {
+                        b[cindex + j] /= factor[j * ld];
+                        var kn = Math.Min(kd, order - 1 - j);
+                        for (var i = 1; i <= kn; i++)
+                        {
+                            b[cindex + j + i] -= factor[(j * ld) + i] * b[cindex + j];
+                        }
+                    }
+
+                    // Solve L'*X = Y.
+                    for (var j = order - 1; j >= 0; j--)
+                    {
+                        var sum = b[cindex + j];
+                        var kn = Math.Min(kd, order - 1 - j);
+                        for (var i = 1; i <= kn; i++)
+                        {
+                            sum -= factor[(j * ld) + i].Conjugate() * b[cindex + j + i];
+                        }
+
+                        b[cindex + j] = sum / factor[j * ld];
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a tridiagonal matrix, using Gaussian elimination with partial pivoting.
+        /// </summary>
+        /// <param name="subdiagonal">The order-1 subdiagonal elements, A(i+1,i). It is left unchanged.</param>
+        /// <param name="diagonal">The order diagonal elements, A(i,i). It is left unchanged.</param>
+        /// <param name="superdiagonal">The order-1 superdiagonal elements, A(i,i+1). It is left unchanged.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the GTSV LAPACK routine. It takes O(order*columnsB) time.</remarks>
+        public virtual void TridiagonalSolve(Complex32[] subdiagonal, Complex32[] diagonal, Complex32[] superdiagonal, Complex32[] b, int columnsB)
+        {
+            if (diagonal == null)
+            {
+                throw new ArgumentNullException("diagonal");
+            }
+
+            CheckTridiagonalSolve(subdiagonal, diagonal, superdiagonal, b, diagonal.Length, columnsB, 1);
+
+            if (!TridiagonalSolveSystem(subdiagonal, diagonal, superdiagonal, b, diagonal.Length, columnsB, 0, true))
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixNotSingular);
+            }
+        }
+
+        /// <summary>
+        /// Solves A_k*X_k=B_k for X_k for a batch of tridiagonal matrices A_k of the same order, using Gaussian
+        /// elimination with partial pivoting.
+        /// </summary>
+        /// <param name="subdiagonal">The subdiagonals of the systems one after the other: system k starts at
+        /// <c>k*(order-1)</c>. It is left unchanged.</param>
+        /// <param name="diagonal">The diagonals of the systems one after the other: system k starts at
+        /// <c>k*order</c>. It is left unchanged.</param>
+        /// <param name="superdiagonal">The superdiagonals of the systems one after the other: system k starts at
+        /// <c>k*(order-1)</c>. It is left unchanged.</param>
+        /// <param name="b">On entry the B matrices one after the other, B_k starting at <c>k*order*columnsB</c>;
+        /// on exit the X matrices.</param>
+        /// <param name="order">The order of each system.</param>
+        /// <param name="columnsB">The number of columns in each B matrix.</param>
+        /// <param name="count">The number of systems.</param>
+        /// <remarks>This is equivalent to calling the GTSV LAPACK routine on each system. The systems are
+        /// solved in parallel. A singular system does not stop the others from being solved; its B matrix is left
+        /// unchanged and an <see cref="ArgumentException"/> naming the first singular system is thrown at the end.</remarks>
+        public virtual void TridiagonalSolveBatch(Complex32[] subdiagonal, Complex32[] diagonal, Complex32[] superdiagonal, Complex32[] b, int order, int columnsB, int count)
+        {
+            CheckTridiagonalSolve(subdiagonal, diagonal, superdiagonal, b, order, columnsB, count);
+
+            // Record the first singular system instead of throwing inside the parallel loop, so the others are
+            // still solved and the caller sees an ArgumentException.
+            var singular = count;
+            var sync = new object();
+            CommonParallel.For(
+                0,
+                count,
+                k =>
+                {
+                    if (!TridiagonalSolveSystem(subdiagonal, diagonal, superdiagonal, b, order, columnsB, k, false))
+                    {
+                        lock (sync)
+                        {
+                            if (k < singular)
+                            {
+                                singular = k;
+                            }
+                        }
+                    }
+                });
+
+            if (singular < count)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentMatrixNotSingularInBatch, singular));
+            }
+        }
+
+        /// <summary>
+        /// Solves one tridiagonal system of a batch in place of its B matrix, as GTSV does.
+        /// </summary>
+        /// <param name="subdiagonal">The subdiagonals of the batch.</param>
+        /// <param name="diagonal">The diagonals of the batch.</param>
+        /// <param name="superdiagonal">The superdiagonals of the batch.</param>
+        /// <param name="b">The B matrices of the batch.</param>
+        /// <param name="order">The order of each system.</param>
+        /// <param name="columnsB">The number of columns in each B matrix.</param>
+        /// <param name="system">The index of the system to solve.</param>
+        /// <param name="parallel">Whether to solve the columns of B in parallel.</param>
+        /// <returns><c>false</c> if the matrix is singular; otherwise <c>true</c>.</returns>
+        private static bool TridiagonalSolveSystem(Complex32[] subdiagonal, Complex32[] diagonal, Complex32[] superdiagonal, Complex32[] b, int order, int columnsB, int system, bool parallel)
+        {
+            if (order == 0 || columnsB == 0)
+            {
+                return true;
+            }
+
+            // Work on copies: dl receives the second superdiagonal created by the row interchanges.
+            var d = new Complex32[order];
+            var dl = new Complex32[order - 1];
+            var du = new Complex32[order - 1];
+            Array.Copy(diagonal, system * order, d, 0, order);
+            Array.Copy(subdiagonal, system * (order - 1), dl, 0, order - 1);
+            Array.Copy(superdiagonal, system * (order - 1), du, 0, order - 1);
+
+            var interchanged = new bool[order - 1];
+            var multipliers = new Complex32[order - 1];
+            for (var i = 0; i < order - 1; i++)
+            {
+                if (d[i].Magnitude >= dl[i].Magnitude)
+                {
+                    // No row interchange.
+                    if (d[i] == Complex32.Zero)
+                    {
+                        return false;
+                    }
+
+                    multipliers[i] = dl[i] / d[i];
+                    d[i + 1] -= multipliers[i] * du[i];
+                    dl[i] = Complex32.Zero;
+                }
+                else
+                {
+                    // Interchange rows i and i+1.
+                    interchanged[i] = true;
+                    multipliers[i] = d[i] / dl[i];
+                    d[i] = dl[i];
+                    var temp = d[i + 1];
+                    d[i + 1] = du[i] - (multipliers[i] * temp);
+                    if (i < order - 2)
+                    {
+                        dl[i] = du[i + 1];
+                        du[i + 1] = -multipliers[i] * dl[i];
+                    }
+                    else
+                    {
+                        dl[i] = Complex32.Zero;
+                    }
+
+                    du[i] = temp;
+                }
+            }
+
+            if (d[order - 1] == Complex32.Zero)
+            {
+                return false;
+            }
+
+            Action<int> solve = c =>
+            {
+                var cindex = (system * order * columnsB) + (c * order);
+
+                // Apply the eliminations and interchanges to B.
+                for (var i = 0; i < order - 1; i++)
+                {
+                    if (interchanged[i])
+                    {
+                        var temp = b[cindex + i];
+                        b[cindex + i] = b[cindex + i + 1];
+                        b[cindex + i + 1] = temp - (multipliers[i] * b[cindex + i + 1]);
+                    }
+                    else
+                    {
+                        b[cindex + i + 1] -= multipliers[i] * b[cindex + i];
+                    }
+                }
+
+                // Back substitution with the upper triangular factor, which has two superdiagonals.
+                b[cindex + order - 1] /= d[order - 1];
+                if (order > 1)
+                {
+                    b[cindex + order - 2] = (b[cindex + order - 2] - (du[order - 2] * b[cindex + order - 1])) / d[order - 2];
+                }
+
+                for (var i = order - 3; i >= 0; i--)
+                {
+                    b[cindex + i] = (b[cindex + i] - (du[i] * b[cindex + i + 1]) - (dl[i] * b[cindex + i + 2])) / d[i];
+                }
+            };
+
+            if (parallel)
+            {
+                CommonParallel.For(0, columnsB, solve);
+            }
+            else
+            {
+                for (var c = 0; c < columnsB; c++)
+                {
+                    solve(c);
+                }
+            }
+
+            return true;
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X, where A is a Hermitian positive definite tridiagonal matrix, using an L*D*L'
+        /// factorization.
+        /// </summary>
+        /// <param name="diagonal">The order diagonal elements, A(i,i). The imaginary parts are ignored. It is
+        /// left unchanged.</param>
+        /// <param name="subdiagonal">The order-1 subdiagonal elements, A(i+1,i). It is left unchanged.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the PTSV LAPACK routine. It takes O(order*columnsB) time.</remarks>
+        public virtual void PositiveDefiniteTridiagonalSolve(Complex32[] diagonal, Complex32[] subdiagonal, Complex32[] b, int columnsB)
+        {
+            if (diagonal == null)
+            {
+                throw new ArgumentNullException("diagonal");
+            }
+
+            CheckTridiagonalSolve(subdiagonal, diagonal, subdiagonal, b, diagonal.Length, columnsB, 1);
+
+            var order = diagonal.Length;
+            if (order == 0 || columnsB == 0)
+            {
+                return;
+            }
+
+            // A = L*D*L' with L unit lower bidiagonal, as PTTRF computes it.
+            var d = new float[order];
+            var e = new Complex32[order - 1];
+            for (var i = 0; i < order; i++)
+            {
+                d[i] = diagonal[i].Real;
+            }
+
+            Array.Copy(subdiagonal, e, order - 1);
+            for (var i = 0; i < order; i++)
+            {
+                if (d[i] <= 0.0f)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
+                }
+
+                if (i < order - 1)
+                {
+                    var ei = e[i];
+                    e[i] = ei / d[i];
+                    d[i + 1] -= (e[i].Real * ei.Real) + (e[i].Imaginary * ei.Imaginary);
+                }
+            }
+
+            CommonParallel.For(
+                0,
+                columnsB,
+                c =>
+                {
+                    var cindex = c * order;
+
+                    // Solve L*D*Y = B.
+                    for (var i = 1; i < order; i++)
+                    {
+                        b[cindex + i] -= e[i - 1] * b[cindex + i - 1];
+                    }
+
+                    for (var i = 0; i < order; i++)
+                    {
+                        b[cindex + i] /= d[i];
+                    }
+
+                    // Solve L'*X = Y.
+                    for (var i = order - 2; i >= 0; i--)
+                    {
+                        b[cindex + i] -= e[i].Conjugate() * b[cindex + i + 1];
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Estimates the one norm of the inverse of a matrix that is only available through solves, by Hager's
+        /// method with Higham's refinements as in the LACN2 LAPACK routine.
+        /// </summary>
+        /// <param name="order">The order of the matrix.</param>
+        /// <param name="solve">Overwrites a vector x with inverse(A)*x.</param>
+        /// <param name="solveAdjoint">Overwrites a vector x with adjoint(inverse(A))*x.</param>
+        /// <returns>A lower bound of the one norm of inverse(A), which is almost always within a factor of three of it.</returns>
+        private static float EstimateInverseOneNorm(int order, Action<Complex32[]> solve, Action<Complex32[]> solveAdjoint)
+        {
+            var x = new Complex32[order];
+            for (var i = 0; i < order; i++)
+            {
+                x[i] = 1.0f / order;
+            }
+
+            var estimate = 0.0f;
+            var last = -1;
+            for (var iteration = 0; iteration < 5; iteration++)
+            {
+                solve(x);
+                var norm = 0.0f;
+                for (var i = 0; i < order; i++)
+                {
+                    norm += x[i].Magnitude;
+                }
+
+                if (norm <= estimate)
+                {
+                    break;
+                }
+
+                estimate = norm;
+
+                // The gradient of the norm at x points to the unit vector most likely to increase it.
+                for (var i = 0; i < order; i++)
+                {
+                    var magnitude = x[i].Magnitude;
+                    x[i] = magnitude == 0.0f ? Complex32.One : new Complex32(x[i].Real / magnitude, x[i].Imaginary / magnitude);
+                }
+
+                solveAdjoint(x);
+                var next = 0;
+                for (var i = 1; i < order; i++)
+                {
+                    if (x[i].Magnitude > x[next].Magnitude)
+                    {
+                        next = i;
+                    }
+                }
+
+                if (next == last)
+                {
+                    break;
+                }
+
+                last = next;
+                Array.Clear(x, 0, order);
+                x[next] = 1.0f;
+            }
+
+            // Alternating signs of growing size catch the rare matrices the iteration underestimates.
+            for (var i = 0; i < order; i++)
+            {
+                x[i] = (i % 2 == 0 ? 1.0f : -1.0f) * (1.0f + ((float)i / Math.Max(order - 1, 1)));
+            }
+
+            solve(x);
+            var alternating = 0.0f;
+            for (var i = 0; i < order; i++)
+            {
+                alternating += x[i].Magnitude;
+            }
+
+            return Math.Max(estimate, 2 * alternating / (3 * order));
+        }
+
+        /// <summary>
+        /// Computes the QR factorization of A.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
+        /// it is overwritten with the R matrix of the QR factorization. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the
+        /// QR factorization.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
+        /// to be used by the QR solve routine.</param>
+        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
+        public virtual void QRFactor(Complex32[] r, int rowsR, int columnsR, Complex32[] q, Complex32[] tau)
+        {
+            if (r == null)
+            {
+                throw new ArgumentNullException("r");
+            }
+
+            if (q == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (r.Length != rowsR * columnsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
+            }
+
+            if (tau.Length < Math.Min(rowsR, columnsR))
+            {
+                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+            }
+
+            if (q.Length != rowsR * rowsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+            }
+
+            var work = new Complex32[rowsR * rowsR];
+            QRFactor(r, rowsR, columnsR, q, tau, work);
+        }
+
+        /// <summary>
+        /// Computes the QR factorization of A.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
+        /// it is overwritten with the R matrix of the QR factorization. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the 
+        /// QR factorization.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
+        /// to be used by the QR solve routine.</param>
+        /// <param name="work">The work array. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
+        public virtual void QRFactor(Complex32[] r, int rowsR, int columnsR, Complex32[] q, Complex32[] tau, Complex32[] work)
+        {
+            if (r == null)
+            {
+                throw new ArgumentNullException("r");
+            }
+
+            if (q == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (work == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (r.Length != rowsR * columnsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
+            }
+
+            if (tau.Length < Math.Min(rowsR, columnsR))
+            {
+                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+            }
+
+            if (q.Length != rowsR * rowsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+            }
+
+            if (work.Length < rowsR * rowsR)
+            {
+                work[0] = rowsR * rowsR;
+                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
+            }
+
+            CommonParallel.For(0, rowsR, i => q[(i * rowsR) + i] = Complex32.One);
+
+            var minmn = Math.Min(rowsR, columnsR);
+            for (var i = 0; i < minmn; i++)
+            {
+                GenerateColumn(work, r, rowsR, i, i);
+                ComputeQR(work, i, r, i, rowsR, i + 1, columnsR, Control.NumberOfParallelWorkerThreads);
+            }
+
+            for (var i = minmn - 1; i >= 0; i--)
+            {
+                ComputeQR(work, i, q, i, rowsR, i, rowsR, Control.NumberOfParallelWorkerThreads);
+            }
+
+            work[0] = rowsR * rowsR;
+        }
+
+        #region QR Factor Helper functions
+
+        /// <summary>
+        /// Perform calculation of Q or R
+        /// </summary>
+        /// <param name="work">Work array</param>
+        /// <param name="workIndex">Index of column in work array</param>
+        /// <param name="a">Q or R matrices</param>
+        /// <param name="rowStart">The first row in </param>
+        /// <param name="rowCount">The last row</param>
+        /// <param name="columnStart">The first column</param>
+        /// <param name="columnCount">The last column</param>
+        /// <param name="availableCores">Number of available CPUs</param>
+        private static void ComputeQR(Complex32[] work, int workIndex, Complex32[] a, int rowStart, int rowCount, int columnStart, int columnCount, int availableCores)
+        {
+            if (rowStart > rowCount || columnStart > columnCount)
+            {
+                return;
+            }
+
+            var tmpColCount = columnCount - columnStart;
+
+            if ((availableCores > 1) && (tmpColCount > 200))
+            {
+                var tmpSplit = columnStart + (tmpColCount / 2);
+                var tmpCores = availableCores / 2;
+
+                CommonParallel.Invoke(
+                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, columnStart, tmpSplit, tmpCores),
+                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, tmpSplit, columnCount, tmpCores));
+            }
+            else
+            {
+                for (var j = columnStart; j < columnCount; j++)
+                {
+                    var scale = Complex32.Zero;
+                    for (var i = rowStart; i < rowCount; i++)
+                    {
+                        scale += work[(workIndex * rowCount) + i - rowStart] * a[(j * rowCount) + i];
+                    }
+
+                    for (var i = rowStart; i < rowCount; i++)
+                    {
+                        a[(j * rowCount) + i] -= work[(workIndex * rowCount) + i - rowStart].Conjugate() * scale;
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Generate column from initial matrix to work array
+        /// </summary>
+        /// <param name="work">Work array</param>
+        /// <param name="a">Initial matrix</param>
+        /// <param name="rowCount">The number of rows in matrix</param>
+        /// <param name="row">The first row</param>
+        /// <param name="column">Column index</param>
+        private static void GenerateColumn(Complex32[] work, Complex32[] a, int rowCount, int row, int column)
+        {
+            var tmp = column * rowCount;
+            var index = tmp + row;
+
+            CommonParallel.For(
+                row,
+                rowCount,
+                i =>
+                {
+                    var iIndex = tmp + i;
+                    work[iIndex - row] = a[iIndex];
+                    a[iIndex] = Complex32.Zero;
+                });
+
+            var norm = Complex32.Zero;
+            for (var i = 0; i < rowCount - row; ++i)
+            {
+                var index1 = tmp + i;
+                norm += work[index1].Magnitude * work[index1].Magnitude;
+            }
+
+            norm = norm.SquareRoot();
+            if (row == rowCount - 1 || norm.Magnitude == 0)
+            {
+                a[index] = -work[tmp];
+                work[tmp] = new Complex32(2.0f, 0).SquareRoot();
+                return;
+            }
+
+            if (work[tmp].Magnitude != 0.0f)
+            {
+                norm = norm.Magnitude * (work[tmp] / work[tmp].Magnitude);
+            }
+
+            a[index] = -norm;
+            CommonParallel.For(0, rowCount - row, i => work[tmp + i] /= norm);
+            work[tmp] += 1.0f;
+
+            var s = (1.0f / work[tmp]).SquareRoot();
+            CommonParallel.For(0, rowCount - row, i => work[tmp + i] = work[tmp + i].Conjugate() * s);
+        }
+
+        #endregion
+
+        /// <summary>
+        /// Computes the QR factorization of A without forming Q.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit, the upper triangle
+        /// holds the R matrix and the part below the diagonal the Householder vectors that make up Q.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains the scalar factors of the Householder
+        /// reflectors.</param>
+        /// <remarks>This is equivalent to the GEQRF LAPACK routine. Q is applied with
+        /// <see cref="QRApplyQ"/>, and formed by applying it to the identity.</remarks>
+        public virtual void QRFactor(Complex32[] r, int rowsR, int columnsR, Complex32[] tau)
+        {
+            CheckQRFactor(r, rowsR, columnsR, tau);
+
+            var minmn = Math.Min(rowsR, columnsR);
+            for (var j = 0; j < minmn; j++)
+            {
+                ReduceColumn(r, rowsR, columnsR, j, tau);
+            }
+        }
+
+        /// <summary>
+        /// Computes the column-pivoted QR factorization A*P = Q*R without forming Q, and the numerical rank of A.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit, the upper triangle
+        /// holds the R matrix and the part below the diagonal the Householder vectors that make up Q.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains the scalar factors of the Householder
+        /// reflectors.</param>
+        /// <param name="pivots">An N vector. On exit, column j of A*P is column <c>pivots[j]</c> of A.</param>
+        /// <returns>The numerical rank: the number of leading diagonal entries of R larger than
+        /// max(m,n) times the machine epsilon times the magnitude of the first.</returns>
+        /// <remarks>This is equivalent to the GEQP3 LAPACK routine. The diagonal of R is non-increasing
+        /// in magnitude, and Q is applied with <see cref="QRApplyQ"/> as for an unpivoted factorization.</remarks>
+        public virtual int QRFactorPivoted(Complex32[] r, int rowsR, int columnsR, Complex32[] tau, int[] pivots)
+        {
+            CheckQRFactorPivoted(r, rowsR, columnsR, tau, pivots);
+
+            // Norms of the columns below the rows reduced so far. They are downdated after every step
+            // and recomputed once cancellation has eaten too many of their digits, as GEQP3 does.
+            var norms = new float[columnsR];
+            var exactNorms = new float[columnsR];
+            for (var k = 0; k < columnsR; k++)
+            {
+                pivots[k] = k;
+                norms[k] = exactNorms[k] = ColumnNorm(r, rowsR, k, 0);
+            }
+
+            var minmn = Math.Min(rowsR, columnsR);
+            var recomputeTolerance = (float)Math.Sqrt(Precision.SingleMachinePrecision);
+            for (var j = 0; j < minmn; j++)
+            {
+                // Bring the column with the largest remaining norm to the front.
+                var pivot = j;
+                for (var k = j + 1; k < columnsR; k++)
+                {
+                    if (norms[k] > norms[pivot])
+                    {
+                        pivot = k;
+                    }
+                }
+
+                if (pivot != j)
+                {
+                    for (var i = 0; i < rowsR; i++)
+                    {
+                        var temp = r[(j * rowsR) + i];
+                        r[(j * rowsR) + i] = r[(pivot * rowsR) + i];
+                        r[(pivot * rowsR) + i] = temp;
+                    }
+
+                    var index = pivots[j];
+                    pivots[j] = pivots[pivot];
+                    pivots[pivot] = index;
+                    norms[pivot] = norms[j];
+                    exactNorms[pivot] = exactNorms[j];
+                }
+
+                ReduceColumn(r, rowsR, columnsR, j, tau);
+
+                for (var k = j + 1; k < columnsR; k++)
+                {
+                    if (norms[k] == 0.0f)
+                    {
+                        continue;
+                    }
+
+                    var ratio = r[(k * rowsR) + j].Magnitude / norms[k];
+                    var remaining = Math.Max(0.0f, (1 + ratio) * (1 - ratio));
+                    var drift = norms[k] / exactNorms[k];
+                    if (remaining * drift * drift <= recomputeTolerance)
+                    {
+                        norms[k] = exactNorms[k] = ColumnNorm(r, rowsR, k, j + 1);
+                    }
+                    else
+                    {
+                        norms[k] *= (float)Math.Sqrt(remaining);
+                    }
+                }
+            }
+
+            var rank = 0;
+            if (minmn > 0)
+            {
+                var threshold = Math.Max(rowsR, columnsR) * 2 * (float)Precision.SingleMachinePrecision * r[0].Magnitude;
+                while (rank < minmn && r[(rank * rowsR) + rank].Magnitude > threshold)
+                {
+                    rank++;
+                }
+            }
+
+            return rank;
+        }
+
+        /// <summary>
+        /// Computes the Householder reflector that zeroes column j of r below the diagonal and applies the adjoint of H(j)
+        /// to the columns after it.
+        /// </summary>
+        /// <param name="r">The matrix being factored.</param>
+        /// <param name="rowsR">The number of rows in r.</param>
+        /// <param name="columnsR">The number of columns in r.</param>
+        /// <param name="j">The column to reduce.</param>
+        /// <param name="tau">On exit, <c>tau[j]</c> holds the scalar factor of the reflector.</param>
+        private static void ReduceColumn(Complex32[] r, int rowsR, int columnsR, int j, Complex32[] tau)
+        {
+            // H(j) = I - tau[j]*v*v' with v[j] = 1 and the rest of v stored below the diagonal of column j,
+            // laid out as GEQRF does so that the native providers can apply the same reflectors.
+            var column = j * rowsR;
+            var alpha = r[column + j];
+            var sumOfSquares = 0.0f;
+            for (var i = j + 1; i < rowsR; i++)
+            {
+                sumOfSquares += (r[column + i].Real * r[column + i].Real) + (r[column + i].Imaginary * r[column + i].Imaginary);
+            }
+
+            if (sumOfSquares == 0.0f && alpha.Imaginary == 0.0f)
+            {
+                tau[j] = Complex32.Zero;
+                return;
+            }
+
+            var beta = (float)Math.Sqrt((alpha.Real * alpha.Real) + (alpha.Imaginary * alpha.Imaginary) + sumOfSquares);
+            if (alpha.Real >= 0.0f)
+            {
+                beta = -beta;
+            }
+
+            tau[j] = new Complex32((beta - alpha.Real) / beta, -alpha.Imaginary / beta);
+            var scale = 1.0f / (alpha - beta);
+            for (var i = j + 1; i < rowsR; i++)
+            {
+                r[column + i] *= scale;
+            }
+
+            r[column + j] = beta;
+
+            // Apply the adjoint of H(j) to the remaining columns.
+            CommonParallel.For(j + 1, columnsR, k => ApplyReflector(r, rowsR, j, tau[j].Conjugate(), r, k * rowsR));
+        }
+
+        /// <summary>
+        /// Computes the two-norm of a column of r from a given row down.
+        /// </summary>
+        /// <param name="r">The matrix.</param>
+        /// <param name="rowsR">The number of rows in r.</param>
+        /// <param name="column">The column.</param>
+        /// <param name="firstRow">The first row to include.</param>
+        /// <returns>The norm of the column below and including <paramref name="firstRow"/>.</returns>
+        private static float ColumnNorm(Complex32[] r, int rowsR, int column, int firstRow)
+        {
+            var sumOfSquares = 0.0f;
+            for (var i = (column * rowsR) + firstRow; i < (column + 1) * rowsR; i++)
+            {
+                sumOfSquares += (r[i].Real * r[i].Real) + (r[i].Imaginary * r[i].Imaginary);
+            }
+
+            return (float)Math.Sqrt(sumOfSquares);
+        }
+
+        /// <summary>
+        /// Multiplies a matrix by the Q of a QR factorization kept as Householder reflectors. <c>b = op(Q)*b</c>
+        /// </summary>
+        /// <param name="transposeQ">Whether to apply Q or its adjoint. Transpose and ConjugateTranspose both
+        /// apply the adjoint, which is the transpose for real matrices.</param>
+        /// <param name="r">The factored matrix returned by <see cref="QRFactor(Complex32[],int,int,Complex32[])"/>.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">The scalar factors of the Householder reflectors.</param>
+        /// <param name="b">On entry the M by <paramref name="columnsB"/> B matrix; on exit the product.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <remarks>This is equivalent to the UNMQR LAPACK routine.</remarks>
+        public virtual void QRApplyQ(Transpose transposeQ, Complex32[] r, int rowsR, int columnsR, Complex32[] tau, Complex32[] b, int columnsB)
+        {
+            CheckQRApplyQ(r, rowsR, columnsR, tau, b, columnsB);
+
+            // Q = H(0)*H(1)*...*H(k-1), so its adjoint applies the reflectors first to last and Q last to first.
+            var minmn = Math.Min(rowsR, columnsR);
+            var adjoint = transposeQ != Transpose.DontTranspose;
+            CommonParallel.For(
+                0,
+                columnsB,
+                k =>
+                {
+                    for (var step = 0; step < minmn; step++)
+                    {
+                        var j = adjoint ? step : minmn - 1 - step;
+                        ApplyReflector(r, rowsR, j, adjoint ? tau[j].Conjugate() : tau[j], b, k * rowsR);
+                    }
+                });
+        }
 
         /// <summary>
-        /// Computes the inverse of a previously factored matrix.
+        /// Applies the Householder reflector <c>I - tau*v*v'</c> kept in a column of a factored matrix to a column of b.
         /// </summary>
-        /// <param name="a">The LU factored N by N matrix.  Contains the inverse On exit.</param>
-        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
-        /// <param name="ipiv">The pivot indices of <paramref name="a"/>.</param>
-        /// <param name="work">The work array. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>This is equivalent to the GETRI LAPACK routine.</remarks>
-        public virtual void LUInverseFactored(Complex32[] a, int order, int[] ipiv, Complex32[] work)
+        /// <param name="r">The factored matrix, holding v below its diagonal with an implicit one on it.</param>
+        /// <param name="rowsR">The number of rows in r and b.</param>
+        /// <param name="reflector">The column of r that holds v.</param>
+        /// <param name="tau">The scalar factor of the reflector.</param>
+        /// <param name="b">The matrix holding the column.</param>
+        /// <param name="offset">The index of the first element of the column.</param>
+        private static void ApplyReflector(Complex32[] r, int rowsR, int reflector, Complex32 tau, Complex32[] b, int offset)
         {
-            LUInverseFactored(a, order, ipiv);
+            var column = reflector * rowsR;
+            var sum = b[offset + reflector];
+            for (var i = reflector + 1; i < rowsR; i++)
+            {
+                sum += r[column + i].Conjugate() * b[offset + i];
+            }
+
+            sum *= tau;
+            b[offset + reflector] -= sum;
+            for (var i = reflector + 1; i < rowsR; i++)
+            {
+                b[offset + i] -= sum * r[column + i];
+            }
         }
 
         /// <summary>
-        /// Solves A*X=B for X using LU factorization.
+        /// Solves A*X=B for X using QR factorization of A.
         /// </summary>
-        /// <param name="columnsOfB">The number of columns of B.</param>
-        /// <param name="a">The square matrix A.</param>
-        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
-        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
-        /// <remarks>This is equivalent to the GETRF and GETRS LAPACK routines.</remarks>
-        public virtual void LUSolve(int columnsOfB, Complex32[] a, int order, Complex32[] b)
+        /// <param name="a">The A matrix.</param>
+        /// <param name="rows">The number of rows in the A matrix.</param>
+        /// <param name="columns">The number of columns in the A matrix.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolve(Complex32[] a, int rows, int columns, Complex32[] b, int columnsB, Complex32[] x)
         {
             if (a == null)
             {
@@ -1046,868 +3545,1087 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
                 throw new ArgumentNullException("b");
             }
 
-            if (a.Length != order * order)
+            if (x == null)
+            {
+                throw new ArgumentNullException("x");
+            }
+
+            if (a.Length != rows * columns)
             {
                 throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
             }
 
-            if (b.Length != order * columnsOfB)
+            if (b.Length != rows * columnsB)
             {
                 throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
             }
 
-            if (ReferenceEquals(a, b))
+            if (x.Length != columns * columnsB)
             {
-                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
             }
 
-            var ipiv = new int[order];
-            var clone = new Complex32[a.Length];
-            Array.Copy(a, 0, clone, 0, a.Length);
-            LUFactor(clone, order, ipiv);
-            LUSolveFactored(columnsOfB, clone, order, ipiv, b);
+            if (rows < columns)
+            {
+                throw new ArgumentException(Resources.RowsLessThanColumns);
+            }
+
+            var work = new Complex32[rows * rows];
+            QRSolve(a, rows, columns, b, columnsB, x, work);
         }
 
         /// <summary>
-        /// Solves A*X=B for X using a previously factored A matrix.
+        /// Solves A*X=B for X using QR factorization of A.
         /// </summary>
-        /// <param name="columnsOfB">The number of columns of B.</param>
-        /// <param name="a">The factored A matrix.</param>
-        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
-        /// <param name="ipiv">The pivot indices of <paramref name="a"/>.</param>
-        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
-        /// <remarks>This is equivalent to the GETRS LAPACK routine.</remarks>
-        public virtual void LUSolveFactored(int columnsOfB, Complex32[] a, int order, int[] ipiv, Complex32[] b)
+        /// <param name="a">The A matrix.</param>
+        /// <param name="rows">The number of rows in the A matrix.</param>
+        /// <param name="columns">The number of columns in the A matrix.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <param name="work">The work array. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolve(Complex32[] a, int rows, int columns, Complex32[] b, int columnsB, Complex32[] x, Complex32[] work)
         {
             if (a == null)
             {
                 throw new ArgumentNullException("a");
             }
 
-            if (ipiv == null)
+            if (b == null)
             {
-                throw new ArgumentNullException("ipiv");
+                throw new ArgumentNullException("b");
             }
 
-            if (b == null)
+            if (x == null)
             {
-                throw new ArgumentNullException("b");
+                throw new ArgumentNullException("x");
             }
 
-            if (a.Length != order * order)
+            if (work == null)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+                throw new ArgumentNullException("work");
             }
 
-            if (ipiv.Length != order)
+            if (a.Length != rows * columns)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
             }
 
-            if (b.Length != order * columnsOfB)
+            if (b.Length != rows * columnsB)
             {
                 throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
             }
 
-            if (ReferenceEquals(a, b))
+            if (x.Length != columns * columnsB)
             {
-                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
             }
 
-            // Compute the column vector  P*B
-            for (var i = 0; i < ipiv.Length; i++)
+            if (rows < columns)
             {
-                if (ipiv[i] == i)
-                {
-                    continue;
-                }
-
-                var p = ipiv[i];
-                for (var j = 0; j < columnsOfB; j++)
-                {
-                    var indexk = j * order;
-                    var indexkp = indexk + p;
-                    var indexkj = indexk + i;
-                    var temp = b[indexkp];
-                    b[indexkp] = b[indexkj];
-                    b[indexkj] = temp;
-                }
+                throw new ArgumentException(Resources.RowsLessThanColumns);
             }
 
-            // Solve L*Y = P*B
-            for (var k = 0; k < order; k++)
+            if (work.Length < rows * rows)
             {
-                var korder = k * order;
-                for (var i = k + 1; i < order; i++)
-                {
-                    for (var j = 0; j < columnsOfB; j++)
-                    {
-                        var index = j * order;
-                        b[i + index] -= b[k + index] * a[i + korder];
-                    }
-                }
+                work[0] = rows * rows;
+                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
             }
 
-            // Solve U*X = Y;
-            for (var k = order - 1; k >= 0; k--)
-            {
-                var korder = k + (k * order);
-                for (var j = 0; j < columnsOfB; j++)
-                {
-                    b[k + (j * order)] /= a[korder];
-                }
+            var clone = new Complex32[a.Length];
+            a.Copy(clone);
+            var q = new Complex32[rows * rows];
+            QRFactor(clone, rows, columns, q, work);
+            QRSolveFactored(q, clone, rows, columns, null, b, columnsB, x);
 
-                korder = k * order;
-                for (var i = 0; i < k; i++)
-                {
-                    for (var j = 0; j < columnsOfB; j++)
-                    {
-                        var index = j * order;
-                        b[i + index] -= b[k + index] * a[i + korder];
-                    }
-                }
-            }
+            work[0] = rows * rows;
         }
 
         /// <summary>
-        /// Computes the Cholesky factorization of A.
+        /// Solves A*X=B for X using a previously QR factored matrix.
         /// </summary>
-        /// <param name="a">On entry, a square, positive definite matrix. On exit, the matrix is overwritten with the
-        /// the Cholesky factorization.</param>
-        /// <param name="order">The number of rows or columns in the matrix.</param>
-        /// <remarks>This is equivalent to the POTRF LAPACK routine.</remarks>
-        public virtual void CholeskyFactor(Complex32[] a, int order)
+        /// <param name="q">The Q matrix obtained by QR factor. This is only used for the managed provider and can be
+        /// <c>null</c> for the native provider. The native provider uses the Q portion stored in the R matrix.</param>
+        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(Complex32[],int,int,Complex32[],Complex32[])"/>. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">Contains additional information on Q. Only used for the native solver
+        /// and can be <c>null</c> for the managed provider.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <param name="work">The work array - only used in the native provider. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolveFactored(Complex32[] q, Complex32[] r, int rowsR, int columnsR, Complex32[] tau, Complex32[] b, int columnsB, Complex32[] x, Complex32[] work)
         {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
-
-            var tmpColumn = new Complex32[order];
-
-            // Main loop - along the diagonal
-            for (var ij = 0; ij < order; ij++)
-            {
-                // "Pivot" element
-                var tmpVal = a[(ij * order) + ij];
-
-                if (tmpVal.Real > 0.0)
-                {
-                    tmpVal = tmpVal.SquareRoot();
-                    a[(ij * order) + ij] = tmpVal;
-                    tmpColumn[ij] = tmpVal;
-
-                    // Calculate multipliers and copy to local column
-                    // Current column, below the diagonal
-                    for (var i = ij + 1; i < order; i++)
-                    {
-                        a[(ij * order) + i] /= tmpVal;
-                        tmpColumn[i] = a[(ij * order) + i];
-                    }
-
-                    // Remaining columns, below the diagonal
-                    DoCholeskyStep(a, order, ij + 1, order, tmpColumn, Control.NumberOfParallelWorkerThreads);
-                }
-                else
-                {
-                    throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
-                }
-
-                for (var i = ij + 1; i < order; i++)
-                {
-                    a[(i * order) + ij] = 0.0f;
-                }
-            }
+            QRSolveFactored(q, r, rowsR, columnsR, tau, b, columnsB, x);
         }
 
         /// <summary>
-        /// Calculate Cholesky step
+        /// Solves A*X=B for X using a previously QR factored matrix.
         /// </summary>
-        /// <param name="data">Factor matrix</param>
-        /// <param name="rowDim">Number of rows</param>
-        /// <param name="firstCol">Column start</param>
-        /// <param name="colLimit">Total columns</param>
-        /// <param name="multipliers">Multipliers calculated previously</param>
-        /// <param name="availableCores">Number of available processors</param>
-        private static void DoCholeskyStep(Complex32[] data, int rowDim, int firstCol, int colLimit, Complex32[] multipliers, int availableCores)
-        {
-            var tmpColCount = colLimit - firstCol;
-
-            if ((availableCores > 1) && (tmpColCount > 200))
-            {
-                var tmpSplit = firstCol + (tmpColCount / 3);
-                var tmpCores = availableCores / 2;
-
-                CommonParallel.Invoke(
-                    () => DoCholeskyStep(data, rowDim, firstCol, tmpSplit, multipliers, tmpCores),
-                    () => DoCholeskyStep(data, rowDim, tmpSplit, colLimit, multipliers, tmpCores));
-            }
-            else
+        /// <param name="q">The Q matrix obtained by calling <see cref="QRFactor(Complex32[],int,int,Complex32[],Complex32[])"/>.</param>
+        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(Complex32[],int,int,Complex32[],Complex32[])"/>. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">Contains additional information on Q. Only used for the native solver
+        /// and can be <c>null</c> for the managed provider.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolveFactored(Complex32[] q, Complex32[] r, int rowsR, int columnsR, Complex32[] tau, Complex32[] b, int columnsB, Complex32[] x)
+        {
+            if (r == null)
             {
-                for (var j = firstCol; j < colLimit; j++)
-                {
-                    var tmpVal = multipliers[j];
-                    for (var i = j; i < rowDim; i++)
-                    {
-                        data[(j * rowDim) + i] -= multipliers[i] * tmpVal.Conjugate();
-                    }
-                }
+                throw new ArgumentNullException("r");
             }
-        }
 
-        /// <summary>
-        /// Solves A*X=B for X using Cholesky factorization.
-        /// </summary>
-        /// <param name="a">The square, positive definite matrix A.</param>
-        /// <param name="orderA">The number of rows and columns in A.</param>
-        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
-        /// <param name="columnsB">The number of columns in the B matrix.</param>
-        /// <remarks>This is equivalent to the POTRF add POTRS LAPACK routines.</remarks>
-        public virtual void CholeskySolve(Complex32[] a, int orderA, Complex32[] b, int columnsB)
-        {
-            if (a == null)
+            if (q == null)
             {
-                throw new ArgumentNullException("a");
+                throw new ArgumentNullException("q");
             }
 
             if (b == null)
             {
-                throw new ArgumentNullException("b");
+                throw new ArgumentNullException("q");
             }
 
-            if (b.Length != orderA * columnsB)
+            if (x == null)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                throw new ArgumentNullException("q");
             }
 
-            if (ReferenceEquals(a, b))
+            if (r.Length != rowsR * columnsR)
             {
-                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "r");
             }
 
-            var clone = new Complex32[a.Length];
-            Array.Copy(a, 0, clone, 0, a.Length);
-            CholeskyFactor(clone, orderA);
-            CholeskySolveFactored(clone, orderA, b, columnsB);
-        }
-
-        /// <summary>
-        /// Solves A*X=B for X using a previously factored A matrix.
-        /// </summary>
-        /// <param name="a">The square, positive definite matrix A.</param>
-        /// <param name="orderA">The number of rows and columns in A.</param>
-        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
-        /// <param name="columnsB">The number of columns in the B matrix.</param>
-        /// <remarks>This is equivalent to the POTRS LAPACK routine.</remarks>
-        public virtual void CholeskySolveFactored(Complex32[] a, int orderA, Complex32[] b, int columnsB)
-        {
-            if (a == null)
+            if (q.Length != rowsR * rowsR)
             {
-                throw new ArgumentNullException("a");
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
             }
 
-            if (b == null)
+            if (b.Length != rowsR * columnsB)
             {
-                throw new ArgumentNullException("b");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
             }
 
-            if (b.Length != orderA * columnsB)
+            if (x.Length != columnsR * columnsB)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
             }
 
-            if (ReferenceEquals(a, b))
+            if (rowsR < columnsR)
             {
-                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+                throw new ArgumentException(Resources.RowsLessThanColumns);
             }
 
-            CommonParallel.For(
-                0,
-                columnsB,
-                c =>
-                {
-                    var cindex = c * orderA;
+            var sol = new Complex32[b.Length];
 
-                    // Solve L*Y = B;
-                    Complex32 sum;
-                    for (var i = 0; i < orderA; i++)
+            // Copy B matrix to "sol", so B data will not be changed
+            CommonParallel.For(0, b.Length, index => sol[index] = b[index]);
+
+            // Compute Y = transpose(Q)*B
+            var column = new Complex32[rowsR];
+            for (var j = 0; j < columnsB; j++)
+            {
+                var jm = j * rowsR;
+                CommonParallel.For(0, rowsR, k => column[k] = sol[jm + k]);
+                CommonParallel.For(
+                    0,
+                    rowsR,
+                    i =>
                     {
-                        sum = b[cindex + i];
-                        for (var k = i - 1; k >= 0; k--)
+                        var im = i * rowsR;
+                        var sum = Complex32.Zero;
+                        for (var k = 0; k < rowsR; k++)
                         {
-                            sum -= a[(k * orderA) + i] * b[cindex + k];
+                            sum += q[im + k].Conjugate() * column[k];
                         }
 
-                        b[cindex + i] = sum / a[(i * orderA) + i];
-                    }
+                        sol[jm + i] = sum;
+                    });
+            }
 
-                    // Solve L'*X = Y;
-                    for (var i = orderA - 1; i >= 0; i--)
+            // Solve R*X = Y;
+            for (var k = columnsR - 1; k >= 0; k--)
+            {
+                var km = k * rowsR;
+                for (var j = 0; j < columnsB; j++)
+                {
+                    sol[(j * rowsR) + k] /= r[km + k];
+                }
+
+                for (var i = 0; i < k; i++)
+                {
+                    for (var j = 0; j < columnsB; j++)
                     {
-                        sum = b[cindex + i];
-                        var iindex = i * orderA;
-                        for (var k = i + 1; k < orderA; k++)
-                        {
-                            sum -= a[iindex + k].Conjugate() * b[cindex + k];
-                        }
+                        var jm = j * rowsR;
+                        sol[jm + i] -= sol[jm + k] * r[km + i];
+                    }
+                }
+            }
 
-                        b[cindex + i] = sum / a[iindex + i];
+            // Fill result matrix
+            CommonParallel.For(
+                0,
+                columnsR,
+                row =>
+                {
+                    for (var col = 0; col < columnsB; col++)
+                    {
+                        x[(col * columnsR) + row] = sol[row + (col * rowsR)];
                     }
                 });
         }
 
         /// <summary>
-        /// Computes the QR factorization of A.
+        /// Computes the singular value decomposition of A.
         /// </summary>
-        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
-        /// it is overwritten with the R matrix of the QR factorization. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the
-        /// QR factorization.</param>
-        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
-        /// to be used by the QR solve routine.</param>
-        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
-        public virtual void QRFactor(Complex32[] r, int rowsR, int columnsR, Complex32[] q, Complex32[] tau)
+        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in ascending value.</param>
+        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
+        /// singular vectors.</param>
+        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
+        /// right singular vectors.</param>
+        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
+        public virtual void SingularValueDecomposition(bool computeVectors, Complex32[] a, int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt)
         {
-            if (r == null)
+            if (a == null)
             {
-                throw new ArgumentNullException("r");
+                throw new ArgumentNullException("a");
             }
 
-            if (q == null)
+            if (s == null)
             {
-                throw new ArgumentNullException("q");
+                throw new ArgumentNullException("s");
             }
 
-            if (r.Length != rowsR * columnsR)
+            if (u == null)
             {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
+                throw new ArgumentNullException("u");
             }
 
-            if (tau.Length < Math.Min(rowsR, columnsR))
+            if (vt == null)
             {
-                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+                throw new ArgumentNullException("vt");
             }
 
-            if (q.Length != rowsR * rowsR)
+            if (u.Length != rowsA * rowsA)
             {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
             }
 
-            var work = new Complex32[rowsR * rowsR];
-            QRFactor(r, rowsR, columnsR, q, tau, work);
+            if (vt.Length != columnsA * columnsA)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+            }
+
+            if (s.Length != Math.Min(rowsA, columnsA))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+            }
+
+            var work = new Complex32[rowsA];
+            SingularValueDecomposition(computeVectors, a, rowsA, columnsA, s, u, vt, work);
         }
 
         /// <summary>
-        /// Computes the QR factorization of A.
+        /// Computes the singular value decomposition of A.
         /// </summary>
-        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
-        /// it is overwritten with the R matrix of the QR factorization. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the 
-        /// QR factorization.</param>
-        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
-        /// to be used by the QR solve routine.</param>
-        /// <param name="work">The work array. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
-        public virtual void QRFactor(Complex32[] r, int rowsR, int columnsR, Complex32[] q, Complex32[] tau, Complex32[] work)
+        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in ascending value.</param>
+        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
+        /// singular vectors.</param>
+        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
+        /// right singular vectors.</param>
+        /// <param name="work">The work array. Length should be at least <paramref name="rowsA"/>.</param>
+        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
+        public virtual void SingularValueDecomposition(bool computeVectors, Complex32[] a, int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt, Complex32[] work)
         {
-            if (r == null)
+            if (a == null)
             {
-                throw new ArgumentNullException("r");
+                throw new ArgumentNullException("a");
             }
 
-            if (q == null)
+            if (s == null)
             {
-                throw new ArgumentNullException("q");
+                throw new ArgumentNullException("s");
             }
 
-            if (work == null)
+            if (u == null)
             {
-                throw new ArgumentNullException("q");
+                throw new ArgumentNullException("u");
             }
 
-            if (r.Length != rowsR * columnsR)
+            if (vt == null)
             {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
+                throw new ArgumentNullException("vt");
             }
 
-            if (tau.Length < Math.Min(rowsR, columnsR))
+            if (work == null)
             {
-                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+                throw new ArgumentNullException("work");
             }
 
-            if (q.Length != rowsR * rowsR)
+            if (u.Length != rowsA * rowsA)
             {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
             }
 
-            if (work.Length < rowsR * rowsR)
+            if (vt.Length != columnsA * columnsA)
             {
-                work[0] = rowsR * rowsR;
-                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+            }
+
+            if (s.Length != Math.Min(rowsA, columnsA))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
             }
 
-            CommonParallel.For(0, rowsR, i => q[(i * rowsR) + i] = Complex32.One);
-
-            var minmn = Math.Min(rowsR, columnsR);
-            for (var i = 0; i < minmn; i++)
+            if (work.Length == 0)
             {
-                GenerateColumn(work, r, rowsR, i, i);
-                ComputeQR(work, i, r, i, rowsR, i + 1, columnsR, Control.NumberOfParallelWorkerThreads);
+                throw new ArgumentException(Resources.ArgumentSingleDimensionArray, "work");
             }
 
-            for (var i = minmn - 1; i >= 0; i--)
+            if (work.Length < rowsA)
             {
-                ComputeQR(work, i, q, i, rowsR, i, rowsR, Control.NumberOfParallelWorkerThreads);
+                work[0] = rowsA;
+                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
             }
 
-            work[0] = rowsR * rowsR;
+            SingularValueDecomposition(computeVectors, false, a, rowsA, columnsA, s, u, vt, work);
         }
 
-        #region QR Factor Helper functions
+        /// <summary>
+        /// Computes the singular value decomposition of A, or just the parts of it that <paramref name="mode"/> asks for.
+        /// </summary>
+        /// <param name="mode">Which factors to compute, and how.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in descending order.</param>
+        /// <param name="u">On exit, the left singular vectors: M by M for <see cref="SvdMode.Full"/>, M by Min(M, N)
+        /// for <see cref="SvdMode.Economy"/> and <see cref="SvdMode.DivideAndConquer"/>. Not referenced for
+        /// <see cref="SvdMode.ValuesOnly"/>.</param>
+        /// <param name="vt">On exit, the transposed right singular vectors: N by N for <see cref="SvdMode.Full"/>,
+        /// Min(M, N) by N for the economy modes. Not referenced for <see cref="SvdMode.ValuesOnly"/>.</param>
+        /// <remarks>This is equivalent to the GESVD LAPACK routine, or GESDD for <see cref="SvdMode.DivideAndConquer"/>.</remarks>
+        public virtual void SingularValueDecomposition(SvdMode mode, Complex32[] a, int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt)
+        {
+            CheckSingularValueDecomposition(mode, a, rowsA, columnsA, s, u, vt);
+
+            // There is no managed divide and conquer; the economy path returns the same factors.
+            var economy = mode == SvdMode.Economy || mode == SvdMode.DivideAndConquer;
+            SingularValueDecomposition(mode != SvdMode.ValuesOnly, economy, a, rowsA, columnsA, s, u, vt, new Complex32[rowsA]);
+        }
 
         /// <summary>
-        /// Perform calculation of Q or R
+        /// Computes the singular value decomposition of A with the LINPACK algorithm.
         /// </summary>
-        /// <param name="work">Work array</param>
-        /// <param name="workIndex">Index of column in work array</param>
-        /// <param name="a">Q or R matrices</param>
-        /// <param name="rowStart">The first row in </param>
-        /// <param name="rowCount">The last row</param>
-        /// <param name="columnStart">The first column</param>
-        /// <param name="columnCount">The last column</param>
-        /// <param name="availableCores">Number of available CPUs</param>
-        private static void ComputeQR(Complex32[] work, int workIndex, Complex32[] a, int rowStart, int rowCount, int columnStart, int columnCount, int availableCores)
+        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
+        /// <param name="economy">Whether U and VT hold only the leading Min(M, N) singular vectors.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A is overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in descending order.</param>
+        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
+        /// singular vectors.</param>
+        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
+        /// right singular vectors.</param>
+        /// <param name="work">The work array, of length at least <paramref name="rowsA"/>.</param>
+        private static void SingularValueDecomposition(bool computeVectors, bool economy, Complex32[] a, int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt, Complex32[] work)
         {
-            if (rowStart > rowCount || columnStart > columnCount)
-            {
-                return;
-            }
+            const int Maxiter = 1000;
 
-            var tmpColCount = columnCount - columnStart;
+            var e = new Complex32[columnsA];
+            var v = new Complex32[computeVectors ? columnsA * columnsA : 0];
+            var stemp = new Complex32[Math.Min(rowsA + 1, columnsA)];
 
-            if ((availableCores > 1) && (tmpColCount > 200))
-            {
-                var tmpSplit = columnStart + (tmpColCount / 2);
-                var tmpCores = availableCores / 2;
+            int i, j, l, lp1;
 
-                CommonParallel.Invoke(
-                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, columnStart, tmpSplit, tmpCores),
-                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, tmpSplit, columnCount, tmpCores));
-            }
-            else
+            var cs = 0.0f;
+            var sn = 0.0f;
+            Complex32 t;
+
+            var ncu = economy ? Math.Min(rowsA, columnsA) : rowsA;
+
+            // Reduce matrix to bidiagonal form, storing the diagonal elements
+            // in "s" and the super-diagonal elements in "e".
+            var nct = Math.Min(rowsA - 1, columnsA);
+            var nrt = Math.Max(0, Math.Min(columnsA - 2, rowsA));
+            var lu = Math.Max(nct, nrt);
+
+            for (l = 0; l < lu; l++)
             {
-                for (var j = columnStart; j < columnCount; j++)
+                lp1 = l + 1;
+                if (l < nct)
                 {
-                    var scale = Complex32.Zero;
-                    for (var i = rowStart; i < rowCount; i++)
+                    // Compute the transformation for the l-th column and
+                    // place the l-th diagonal in vector s[l].
+                    var sum = 0.0f;
+                    for (i = l; i < rowsA; i++)
                     {
-                        scale += work[(workIndex * rowCount) + i - rowStart] * a[(j * rowCount) + i];
+                        sum += a[(l * rowsA) + i].Magnitude * a[(l * rowsA) + i].Magnitude;
                     }
 
-                    for (var i = rowStart; i < rowCount; i++)
+                    stemp[l] = (float)Math.Sqrt(sum);
+                    if (stemp[l] != 0.0f)
                     {
-                        a[(j * rowCount) + i] -= work[(workIndex * rowCount) + i - rowStart].Conjugate() * scale;
+                        if (a[(l * rowsA) + l] != 0.0f)
+                        {
+                            stemp[l] = stemp[l].Magnitude * (a[(l * rowsA) + l] / a[(l * rowsA) + l].Magnitude);
+                        }
+
+                        // A part of column "l" of Matrix A from row "l" to end multiply by 1.0f / s[l]
+                        for (i = l; i < rowsA; i++)
+                        {
+                            a[(l * rowsA) + i] = a[(l * rowsA) + i] * (1.0f / stemp[l]);
+                        }
+
+                        a[(l * rowsA) + l] = 1.0f + a[(l * rowsA) + l];
                     }
+
+                    stemp[l] = -stemp[l];
                 }
-            }
-        }
 
-        /// <summary>
-        /// Generate column from initial matrix to work array
-        /// </summary>
-        /// <param name="work">Work array</param>
-        /// <param name="a">Initial matrix</param>
-        /// <param name="rowCount">The number of rows in matrix</param>
-        /// <param name="row">The first row</param>
-        /// <param name="column">Column index</param>
-        private static void GenerateColumn(Complex32[] work, Complex32[] a, int rowCount, int row, int column)
-        {
-            var tmp = column * rowCount;
-            var index = tmp + row;
+                for (j = lp1; j < columnsA; j++)
+                {
+                    if (l < nct)
+                    {
+                        if (stemp[l] != 0.0f)
+                        {
+                            // Apply the transformation.
+                            t = 0.0f;
+                            for (i = l; i < rowsA; i++)
+                            {
+                                t += a[(l * rowsA) + i].Conjugate() * a[(j * rowsA) + i];
+                            }
 
-            CommonParallel.For(
-                row,
-                rowCount,
-                i =>
+                            t = -t / a[(l * rowsA) + l];
+
+                            for (var ii = l; ii < rowsA; ii++)
+                            {
+                                a[(j * rowsA) + ii] += t * a[(l * rowsA) + ii];
+                            }
+                        }
+                    }
+
+                    // Place the l-th row of matrix into "e" for the
+                    // subsequent calculation of the row transformation.
+                    e[j] = a[(j * rowsA) + l].Conjugate();
+                }
+
+                if (computeVectors && l < nct)
                 {
-                    var iIndex = tmp + i;
-                    work[iIndex - row] = a[iIndex];
-                    a[iIndex] = Complex32.Zero;
-                });
+                    // Place the transformation in "u" for subsequent back multiplication.
+                    for (i = l; i < rowsA; i++)
+                    {
+                        u[(l * rowsA) + i] = a[(l * rowsA) + i];
+                    }
+                }
 
-            var norm = Complex32.Zero;
-            for (var i = 0; i < rowCount - row; ++i)
-            {
-                var index1 = tmp + i;
-                norm += work[index1].Magnitude * work[index1].Magnitude;
-            }
+                if (l >= nrt)
+                {
+                    continue;
+                }
 
-            norm = norm.SquareRoot();
-            if (row == rowCount - 1 || norm.Magnitude == 0)
-            {
-                a[index] = -work[tmp];
-                work[tmp] = new Complex32(2.0f, 0).SquareRoot();
-                return;
-            }
+                // Compute the l-th row transformation and place the l-th super-diagonal in e(l).
+                var enorm = 0.0f;
+                for (i = lp1; i < e.Length; i++)
+                {
+                    enorm += e[i].Magnitude * e[i].Magnitude;
+                }
 
-            if (work[tmp].Magnitude != 0.0f)
-            {
-                norm = norm.Magnitude * (work[tmp] / work[tmp].Magnitude);
-            }
+                e[l] = (float)Math.Sqrt(enorm);
+                if (e[l] != 0.0f)
+                {
+                    if (e[lp1] != 0.0f)
+                    {
+                        e[l] = e[l].Magnitude * (e[lp1] / e[lp1].Magnitude);
+                    }
 
-            a[index] = -norm;
-            CommonParallel.For(0, rowCount - row, i => work[tmp + i] /= norm);
-            work[tmp] += 1.0f;
+                    // Scale vector "e" from "lp1" by 1.0f / e[l]
+                    for (i = lp1; i < e.Length; i++)
+                    {
+                        e[i] = e[i] * (1.0f / e[l]);
+                    }
 
-            var s = (1.0f / work[tmp]).SquareRoot();
-            CommonParallel.For(0, rowCount - row, i => work[tmp + i] = work[tmp + i].Conjugate() * s);
-        }
+                    e[lp1] = 1.0f + e[lp1];
+                }
 
-        #endregion
+                e[l] = -e[l].Conjugate();
 
-        /// <summary>
-        /// Solves A*X=B for X using QR factorization of A.
-        /// </summary>
-        /// <param name="a">The A matrix.</param>
-        /// <param name="rows">The number of rows in the A matrix.</param>
-        /// <param name="columns">The number of columns in the A matrix.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolve(Complex32[] a, int rows, int columns, Complex32[] b, int columnsB, Complex32[] x)
-        {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
+                if (lp1 < rowsA && e[l] != 0.0f)
+                {
+                    // Apply the transformation.
+                    for (i = lp1; i < rowsA; i++)
+                    {
+                        work[i] = 0.0f;
+                    }
 
-            if (b == null)
-            {
-                throw new ArgumentNullException("b");
+                    for (j = lp1; j < columnsA; j++)
+                    {
+                        for (var ii = lp1; ii < rowsA; ii++)
+                        {
+                            work[ii] += e[j] * a[(j * rowsA) + ii];
+                        }
+                    }
+
+                    for (j = lp1; j < columnsA; j++)
+                    {
+                        var ww = (-e[j] / e[lp1]).Conjugate();
+                        for (var ii = lp1; ii < rowsA; ii++)
+                        {
+                            a[(j * rowsA) + ii] += ww * work[ii];
+                        }
+                    }
+                }
+
+                if (!computeVectors)
+                {
+                    continue;
+                }
+
+                // Place the transformation in v for subsequent back multiplication.
+                for (i = lp1; i < columnsA; i++)
+                {
+                    v[(l * columnsA) + i] = e[i];
+                }
             }
 
-            if (x == null)
+            // Set up the final bidiagonal matrix or order m.
+            var m = Math.Min(columnsA, rowsA + 1);
+            var nctp1 = nct + 1;
+            var nrtp1 = nrt + 1;
+            if (nct < columnsA)
             {
-                throw new ArgumentNullException("x");
+                stemp[nctp1 - 1] = a[((nctp1 - 1) * rowsA) + (nctp1 - 1)];
             }
 
-            if (a.Length != rows * columns)
+            if (rowsA < m)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+                stemp[m - 1] = 0.0f;
             }
 
-            if (b.Length != rows * columnsB)
+            if (nrtp1 < m)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                e[nrtp1 - 1] = a[((m - 1) * rowsA) + (nrtp1 - 1)];
             }
 
-            if (x.Length != columns * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
-            }
+            e[m - 1] = 0.0f;
 
-            if (rows < columns)
+            // If required, generate "u".
+            if (computeVectors)
             {
-                throw new ArgumentException(Resources.RowsLessThanColumns);
-            }
+                for (j = nctp1 - 1; j < ncu; j++)
+                {
+                    for (i = 0; i < rowsA; i++)
+                    {
+                        u[(j * rowsA) + i] = 0.0f;
+                    }
 
-            var work = new Complex32[rows * rows];
-            QRSolve(a, rows, columns, b, columnsB, x, work);
-        }
+                    u[(j * rowsA) + j] = 1.0f;
+                }
 
-        /// <summary>
-        /// Solves A*X=B for X using QR factorization of A.
-        /// </summary>
-        /// <param name="a">The A matrix.</param>
-        /// <param name="rows">The number of rows in the A matrix.</param>
-        /// <param name="columns">The number of columns in the A matrix.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <param name="work">The work array. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolve(Complex32[] a, int rows, int columns, Complex32[] b, int columnsB, Complex32[] x, Complex32[] work)
-        {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
+                for (l = nct - 1; l >= 0; l--)
+                {
+                    if (stemp[l] != 0.0f)
+                    {
+                        for (j = l + 1; j < ncu; j++)
+                        {
+                            t = 0.0f;
+                            for (i = l; i < rowsA; i++)
+                            {
+                                t += u[(l * rowsA) + i].Conjugate() * u[(j * rowsA) + i];
+                            }
 
-            if (b == null)
-            {
-                throw new ArgumentNullException("b");
+                            t = -t / u[(l * rowsA) + l];
+                            for (var ii = l; ii < rowsA; ii++)
+                            {
+                                u[(j * rowsA) + ii] += t * u[(l * rowsA) + ii];
+                            }
+                        }
+
+                        // A part of column "l" of matrix A from row "l" to end multiply by -1.0f
+                        for (i = l; i < rowsA; i++)
+                        {
+                            u[(l * rowsA) + i] = u[(l * rowsA) + i] * -1.0f;
+                        }
+
+                        u[(l * rowsA) + l] = 1.0f + u[(l * rowsA) + l];
+                        for (i = 0; i < l; i++)
+                        {
+                            u[(l * rowsA) + i] = 0.0f;
+                        }
+                    }
+                    else
+                    {
+                        for (i = 0; i < rowsA; i++)
+                        {
+                            u[(l * rowsA) + i] = 0.0f;
+                        }
+
+                        u[(l * rowsA) + l] = 1.0f;
+                    }
+                }
             }
 
-            if (x == null)
+            // If it is required, generate v.
+            if (computeVectors)
             {
-                throw new ArgumentNullException("x");
+                for (l = columnsA - 1; l >= 0; l--)
+                {
+                    lp1 = l + 1;
+                    if (l < nrt)
+                    {
+                        if (e[l] != 0.0f)
+                        {
+                            for (j = lp1; j < columnsA; j++)
+                            {
+                                t = 0.0f;
+                                for (i = lp1; i < columnsA; i++)
+                                {
+                                    t += v[(l * columnsA) + i].Conjugate() * v[(j * columnsA) + i];
+                                }
+
+                                t = -t / v[(l * columnsA) + lp1];
+                                for (var ii = l; ii < columnsA; ii++)
+                                {
+                                    v[(j * columnsA) + ii] += t * v[(l * columnsA) + ii];
+                                }
+                            }
+                        }
+                    }
+
+                    for (i = 0; i < columnsA; i++)
+                    {
+                        v[(l * columnsA) + i] = 0.0f;
+                    }
+
+                    v[(l * columnsA) + l] = 1.0f;
+                }
             }
 
-            if (work == null)
+            // Transform "s" and "e" so that they are float
+            for (i = 0; i < m; i++)
             {
-                throw new ArgumentNullException("work");
+                Complex32 r;
+                if (stemp[i] != 0.0f)
+                {
+                    t = stemp[i].Magnitude;
+                    r = stemp[i] / t;
+                    stemp[i] = t;
+                    if (i < m - 1)
+                    {
+                        e[i] = e[i] / r;
+                    }
+
+                    if (computeVectors)
+                    {
+                        // A part of column "i" of matrix U from row 0 to end multiply by r
+                        for (j = 0; j < rowsA; j++)
+                        {
+                            u[(i * rowsA) + j] = u[(i * rowsA) + j] * r;
+                        }
+                    }
+                }
+
+                // Exit
+                if (i == m - 1)
+                {
+                    break;
+                }
+
+                if (e[i] == 0.0f)
+                {
+                    continue;
+                }
+
+                t = e[i].Magnitude;
+                r = t / e[i];
+                e[i] = t;
+                stemp[i + 1] = stemp[i + 1] * r;
+                if (!computeVectors)
+                {
+                    continue;
+                }
+
+                // A part of column "i+1" of matrix VT from row 0 to end multiply by r
+                for (j = 0; j < columnsA; j++)
+                {
+                    v[((i + 1) * columnsA) + j] = v[((i + 1) * columnsA) + j] * r;
+                }
             }
 
-            if (a.Length != rows * columns)
+            // Main iteration loop for the singular values.
+            var mn = m;
+            var iter = 0;
+
+            while (m > 0)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
-            }
+                // Quit if all the singular values have been found.
+                // If too many iterations have been performed throw exception.
+                if (iter >= Maxiter)
+                {
+                    throw new ArgumentException(Resources.ConvergenceFailed);
+                }
+
+                // This section of the program inspects for negligible elements in the s and e arrays,  
+                // on completion the variables kase and l are set as follows:
+                // kase = 1: if mS[m] and e[l-1] are negligible and l < m
+                // kase = 2: if mS[l] is negligible and l < m
+                // kase = 3: if e[l-1] is negligible, l < m, and mS[l, ..., mS[m] are not negligible (qr step).
+                // kase = 4: if e[m-1] is negligible (convergence).
+                float ztest;
+                float test;
+                for (l = m - 2; l >= 0; l--)
+                {
+                    test = stemp[l].Magnitude + stemp[l + 1].Magnitude;
+                    ztest = test + e[l].Magnitude;
+                    if (ztest.AlmostEqualInDecimalPlaces(test, 7))
+                    {
+                        e[l] = 0.0f;
+                        break;
+                    }
+                }
+
+                int kase;
+                if (l == m - 2)
+                {
+                    kase = 4;
+                }
+                else
+                {
+                    int ls;
+                    for (ls = m - 1; ls > l; ls--)
+                    {
+                        test = 0.0f;
+                        if (ls != m - 1)
+                        {
+                            test = test + e[ls].Magnitude;
+                        }
+
+                        if (ls != l + 1)
+                        {
+                            test = test + e[ls - 1].Magnitude;
+                        }
+
+                        ztest = test + stemp[ls].Magnitude;
+                        if (ztest.AlmostEqualInDecimalPlaces(test, 7))
+                        {
+                            stemp[ls] = 0.0f;
+                            break;
+                        }
+                    }
+
+                    if (ls == l)
+                    {
+                        kase = 3;
+                    }
+                    else if (ls == m - 1)
+                    {
+                        kase = 1;
+                    }
+                    else
+                    {
+                        kase = 2;
+                        l = ls;
+                    }
+                }
 
-            if (b.Length != rows * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                l = l + 1;
 
-            if (x.Length != columns * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
-            }
+                // Perform the task indicated by kase.
+                int k;
+                float f;
+                switch (kase)
+                {
+                    // Deflate negligible s[m].
+                    case 1:
+                        f = e[m - 2].Real;
+                        e[m - 2] = 0.0f;
+                        float t1;
+                        for (var kk = l; kk < m - 1; kk++)
+                        {
+                            k = m - 2 - kk + l;
+                            t1 = stemp[k].Real;
+                            Drotg(ref t1, ref f, ref cs, ref sn);
+                            stemp[k] = t1;
+                            if (k != l)
+                            {
+                                f = -sn * e[k - 1].Real;
+                                e[k - 1] = cs * e[k - 1];
+                            }
 
-            if (rows < columns)
-            {
-                throw new ArgumentException(Resources.RowsLessThanColumns);
-            }
+                            if (computeVectors)
+                            {
+                                // Rotate
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((m - 1) * columnsA) + i]);
+                                    v[((m - 1) * columnsA) + i] = (cs * v[((m - 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
+                                    v[(k * columnsA) + i] = z;
+                                }
+                            }
+                        }
 
-            if (work.Length < rows * rows)
-            {
-                work[0] = rows * rows;
-                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
-            }
+                        break;
 
-            var clone = new Complex32[a.Length];
-            a.Copy(clone);
-            var q = new Complex32[rows * rows];
-            QRFactor(clone, rows, columns, q, work);
-            QRSolveFactored(q, clone, rows, columns, null, b, columnsB, x);
+                    // Split at negligible s[l].
+                    case 2:
+                        f = e[l - 1].Real;
+                        e[l - 1] = 0.0f;
+                        for (k = l; k < m; k++)
+                        {
+                            t1 = stemp[k].Real;
+                            Drotg(ref t1, ref f, ref cs, ref sn);
+                            stemp[k] = t1;
+                            f = -sn * e[k].Real;
+                            e[k] = cs * e[k];
+                            if (computeVectors)
+                            {
+                                // Rotate
+                                for (i = 0; i < rowsA; i++)
+                                {
+                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((l - 1) * rowsA) + i]);
+                                    u[((l - 1) * rowsA) + i] = (cs * u[((l - 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
+                                    u[(k * rowsA) + i] = z;
+                                }
+                            }
+                        }
 
-            work[0] = rows * rows;
-        }
+                        break;
 
-        /// <summary>
-        /// Solves A*X=B for X using a previously QR factored matrix.
-        /// </summary>
-        /// <param name="q">The Q matrix obtained by QR factor. This is only used for the managed provider and can be
-        /// <c>null</c> for the native provider. The native provider uses the Q portion stored in the R matrix.</param>
-        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(Complex32[],int,int,Complex32[],Complex32[])"/>. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="tau">Contains additional information on Q. Only used for the native solver
-        /// and can be <c>null</c> for the managed provider.</param>
-        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <param name="work">The work array - only used in the native provider. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolveFactored(Complex32[] q, Complex32[] r, int rowsR, int columnsR, Complex32[] tau, Complex32[] b, int columnsB, Complex32[] x, Complex32[] work)
-        {
-            QRSolveFactored(q, r, rowsR, columnsR, tau, b, columnsB, x);
-        }
+                    // Perform one qr step.
+                    case 3:
+                        // calculate the shift.
+                        var scale = 0.0f;
+                        scale = Math.Max(scale, stemp[m - 1].Magnitude);
+                        scale = Math.Max(scale, stemp[m - 2].Magnitude);
+                        scale = Math.Max(scale, e[m - 2].Magnitude);
+                        scale = Math.Max(scale, stemp[l].Magnitude);
+                        scale = Math.Max(scale, e[l].Magnitude);
+                        var sm = stemp[m - 1].Real / scale;
+                        var smm1 = stemp[m - 2].Real / scale;
+                        var emm1 = e[m - 2].Real / scale;
+                        var sl = stemp[l].Real / scale;
+                        var el = e[l].Real / scale;
+                        var b = (((smm1 + sm) * (smm1 - sm)) + (emm1 * emm1)) / 2.0f;
+                        var c = (sm * emm1) * (sm * emm1);
+                        var shift = 0.0f;
+                        if (b != 0.0f || c != 0.0f)
+                        {
+                            shift = (float)Math.Sqrt((b * b) + c);
+                            if (b < 0.0f)
+                            {
+                                shift = -shift;
+                            }
 
-        /// <summary>
-        /// Solves A*X=B for X using a previously QR factored matrix.
-        /// </summary>
-        /// <param name="q">The Q matrix obtained by calling <see cref="QRFactor(Complex32[],int,int,Complex32[],Complex32[])"/>.</param>
-        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(Complex32[],int,int,Complex32[],Complex32[])"/>. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="tau">Contains additional information on Q. Only used for the native solver
-        /// and can be <c>null</c> for the managed provider.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolveFactored(Complex32[] q, Complex32[] r, int rowsR, int columnsR, Complex32[] tau, Complex32[] b, int columnsB, Complex32[] x)
-        {
-            if (r == null)
-            {
-                throw new ArgumentNullException("r");
-            }
+                            shift = c / (b + shift);
+                        }
 
-            if (q == null)
-            {
-                throw new ArgumentNullException("q");
-            }
+                        f = ((sl + sm) * (sl - sm)) + shift;
+                        var g = sl * el;
 
-            if (b == null)
-            {
-                throw new ArgumentNullException("q");
-            }
+                        // Chase zeros
+                        for (k = l; k < m - 1; k++)
+                        {
+                            Drotg(ref f, ref g, ref cs, ref sn);
+                            if (k != l)
+                            {
+                                e[k - 1] = f;
+                            }
 
-            if (x == null)
-            {
-                throw new ArgumentNullException("q");
-            }
+                            f = (cs * stemp[k].Real) + (sn * e[k].Real);
+                            e[k] = (cs * e[k]) - (sn * stemp[k]);
+                            g = sn * stemp[k + 1].Real;
+                            stemp[k + 1] = cs * stemp[k + 1];
+                            if (computeVectors)
+                            {
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((k + 1) * columnsA) + i]);
+                                    v[((k + 1) * columnsA) + i] = (cs * v[((k + 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
+                                    v[(k * columnsA) + i] = z;
+                                }
+                            }
 
-            if (r.Length != rowsR * columnsR)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "r");
-            }
+                            Drotg(ref f, ref g, ref cs, ref sn);
+                            stemp[k] = f;
+                            f = (cs * e[k].Real) + (sn * stemp[k + 1].Real);
+                            stemp[k + 1] = -(sn * e[k]) + (cs * stemp[k + 1]);
+                            g = sn * e[k + 1].Real;
+                            e[k + 1] = cs * e[k + 1];
+                            if (computeVectors && k < rowsA)
+                            {
+                                for (i = 0; i < rowsA; i++)
+                                {
+                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((k + 1) * rowsA) + i]);
+                                    u[((k + 1) * rowsA) + i] = (cs * u[((k + 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
+                                    u[(k * rowsA) + i] = z;
+                                }
+                            }
+                        }
 
-            if (q.Length != rowsR * rowsR)
-            {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
-            }
+                        e[m - 2] = f;
+                        iter = iter + 1;
+                        break;
 
-            if (b.Length != rowsR * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                    // Convergence
+                    case 4:
 
-            if (x.Length != columnsR * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
-            }
+                        // Make the singular value  positive
+                        if (stemp[l].Real < 0.0f)
+                        {
+                            stemp[l] = -stemp[l];
+                            if (computeVectors)
+                            {
+                                // A part of column "l" of matrix VT from row 0 to end multiply by -1
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    v[(l * columnsA) + i] = v[(l * columnsA) + i] * -1.0f;
+                                }
+                            }
+                        }
 
-            if (rowsR < columnsR)
-            {
-                throw new ArgumentException(Resources.RowsLessThanColumns);
-            }
+                        // Order the singular value.
+                        while (l != mn - 1)
+                        {
+                            if (stemp[l].Real >= stemp[l + 1].Real)
+                            {
+                                break;
+                            }
 
-            var sol = new Complex32[b.Length];
+                            t = stemp[l];
+                            stemp[l] = stemp[l + 1];
+                            stemp[l + 1] = t;
+                            if (computeVectors && l < columnsA)
+                            {
+                                // Swap columns l, l + 1
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    var z = v[(l * columnsA) + i];
+                                    v[(l * columnsA) + i] = v[((l + 1) * columnsA) + i];
+                                    v[((l + 1) * columnsA) + i] = z;
+                                }
+                            }
 
-            // Copy B matrix to "sol", so B data will not be changed
-            CommonParallel.For(0, b.Length, index => sol[index] = b[index]);
+                            if (computeVectors && l < rowsA)
+                            {
+                                // Swap columns l, l + 1
+                                for (i = 0; i < rowsA; i++)
+                                {
+                                    var z = u[(l * rowsA) + i];
+                                    u[(l * rowsA) + i] = u[((l + 1) * rowsA) + i];
+                                    u[((l + 1) * rowsA) + i] = z;
+                                }
+                            }
 
-            // Compute Y = transpose(Q)*B
-            var column = new Complex32[rowsR];
-            for (var j = 0; j < columnsB; j++)
-            {
-                var jm = j * rowsR;
-                CommonParallel.For(0, rowsR, k => column[k] = sol[jm + k]);
-                CommonParallel.For(
-                    0,
-                    rowsR,
-                    i =>
-                    {
-                        var im = i * rowsR;
-                        var sum = Complex32.Zero;
-                        for (var k = 0; k < rowsR; k++)
-                        {
-                            sum += q[im + k].Conjugate() * column[k];
+                            l = l + 1;
                         }
 
-                        sol[jm + i] = sum;
-                    });
+                        iter = 0;
+                        m = m - 1;
+                        break;
+                }
             }
 
-            // Solve R*X = Y;
-            for (var k = columnsR - 1; k >= 0; k--)
+            if (computeVectors)
             {
-                var km = k * rowsR;
-                for (var j = 0; j < columnsB; j++)
-                {
-                    sol[(j * rowsR) + k] /= r[km + k];
-                }
-
-                for (var i = 0; i < k; i++)
+                // Finally transpose "v" to get "vt" matrix 
+                var ldvt = economy ? Math.Min(rowsA, columnsA) : columnsA;
+                for (i = 0; i < ldvt; i++)
                 {
-                    for (var j = 0; j < columnsB; j++)
+                    for (j = 0; j < columnsA; j++)
                     {
-                        var jm = j * rowsR;
-                        sol[jm + i] -= sol[jm + k] * r[km + i];
+                        vt[(j * ldvt) + i] = v[(i * columnsA) + j].Conjugate();
                     }
                 }
             }
 
-            // Fill result matrix
-            CommonParallel.For(
-                0,
-                columnsR,
-                row =>
-                {
-                    for (var col = 0; col < columnsB; col++)
-                    {
-                        x[(col * columnsR) + row] = sol[row + (col * rowsR)];
-                    }
-                });
+            // Copy stemp to s with size adjustment. We are using ported copy of linpack's svd code and it uses
+            // a singular vector of length rows+1 when rows < columns. The last element is not used and needs to be removed.
+            // We should port lapack's svd routine to remove this problem.
+            CommonParallel.For(0, Math.Min(rowsA, columnsA), index => s[index] = stemp[index]);
+
+            // On return the first element of the work array stores the min size of the work array could have been
+            // work[0] = Math.Max(3 * Math.Min(aRows, aColumns) + Math.Max(aRows, aColumns), 5 * Math.Min(aRows, aColumns));
+            work[0] = rowsA;            
         }
 
         /// <summary>
-        /// Computes the singular value decomposition of A.
+        /// Solves A*X=B for X using the singular value decomposition of A.
         /// </summary>
-        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
-        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose.</param>
         /// <param name="rowsA">The number of rows in the A matrix.</param>
         /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="s">The singular values of A in ascending value.</param>
-        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
-        /// singular vectors.</param>
-        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
-        /// right singular vectors.</param>
-        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
-        public virtual void SingularValueDecomposition(bool computeVectors, Complex32[] a, int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt)
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        public virtual void SvdSolve(Complex32[] a, int rowsA, int columnsA, Complex32[] b, int columnsB, Complex32[] x)
         {
             if (a == null)
             {
                 throw new ArgumentNullException("a");
             }
 
-            if (s == null)
-            {
-                throw new ArgumentNullException("s");
-            }
-
-            if (u == null)
-            {
-                throw new ArgumentNullException("u");
-            }
-
-            if (vt == null)
+            if (b == null)
             {
-                throw new ArgumentNullException("vt");
+                throw new ArgumentNullException("b");
             }
 
-            if (u.Length != rowsA * rowsA)
+            if (x == null)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+                throw new ArgumentNullException("x");
             }
 
-            if (vt.Length != columnsA * columnsA)
+            if (b.Length != rowsA * columnsB)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
             }
 
-            if (s.Length != Math.Min(rowsA, columnsA))
+            if (x.Length != columnsA * columnsB)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
             }
 
             var work = new Complex32[rowsA];
-            SingularValueDecomposition(computeVectors, a, rowsA, columnsA, s, u, vt, work);
+            var s = new Complex32[Math.Min(rowsA, columnsA)];
+            var u = new Complex32[rowsA * rowsA];
+            var vt = new Complex32[columnsA * columnsA];
+
+            var clone = new Complex32[a.Length];
+            a.Copy(clone);
+            SingularValueDecomposition(true, clone, rowsA, columnsA, s, u, vt, work);
+            SvdSolveFactored(rowsA, columnsA, s, u, vt, b, columnsB, x);
         }
 
         /// <summary>
-        /// Computes the singular value decomposition of A.
+        /// Solves A*X=B for X using a previously SVD decomposed matrix.
         /// </summary>
-        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
-        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
         /// <param name="rowsA">The number of rows in the A matrix.</param>
         /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="s">The singular values of A in ascending value.</param>
-        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
-        /// singular vectors.</param>
-        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
-        /// right singular vectors.</param>
-        /// <param name="work">The work array. Length should be at least <paramref name="rowsA"/>.</param>
-        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
-        public virtual void SingularValueDecomposition(bool computeVectors, Complex32[] a, int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt, Complex32[] work)
+        /// <param name="s">The s values returned by <see cref="SingularValueDecomposition(bool,Complex32[],int,int,Complex32[],Complex32[],Complex32[])"/>.</param>
+        /// <param name="u">The left singular vectors returned by  <see cref="SingularValueDecomposition(bool,Complex32[],int,int,Complex32[],Complex32[],Complex32[])"/>.</param>
+        /// <param name="vt">The right singular  vectors returned by  <see cref="SingularValueDecomposition(bool,Complex32[],int,int,Complex32[],Complex32[],Complex32[])"/>.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        public virtual void SvdSolveFactored(int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt, Complex32[] b, int columnsB, Complex32[] x)
         {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
-
             if (s == null)
             {
                 throw new ArgumentNullException("s");
@@ -1923,796 +4641,951 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
                 throw new ArgumentNullException("vt");
             }
 
-            if (work == null)
-            {
-                throw new ArgumentNullException("work");
-            }
-
-            if (u.Length != rowsA * rowsA)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
-            }
-
-            if (vt.Length != columnsA * columnsA)
+            if (b == null)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+                throw new ArgumentNullException("b");
             }
 
-            if (s.Length != Math.Min(rowsA, columnsA))
+            if (x == null)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+                throw new ArgumentNullException("x");
             }
 
-            if (work.Length == 0)
+            // Either the full or the economy factors will do.
+            var mn = Math.Min(rowsA, columnsA);
+            if (u.Length != rowsA * rowsA && u.Length != rowsA * mn)
             {
-                throw new ArgumentException(Resources.ArgumentSingleDimensionArray, "work");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
             }
 
-            if (work.Length < rowsA)
+            if (vt.Length != columnsA * columnsA && vt.Length != mn * columnsA)
             {
-                work[0] = rowsA;
-                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
             }
 
-            const int Maxiter = 1000;
-
-            var e = new Complex32[columnsA];
-            var v = new Complex32[vt.Length];
-            var stemp = new Complex32[Math.Min(rowsA + 1, columnsA)];
-
-            int i, j, l, lp1;
-
-            var cs = 0.0f;
-            var sn = 0.0f;
-            Complex32 t;
-
-            var ncu = rowsA;
-
-            // Reduce matrix to bidiagonal form, storing the diagonal elements
-            // in "s" and the super-diagonal elements in "e".
-            var nct = Math.Min(rowsA - 1, columnsA);
-            var nrt = Math.Max(0, Math.Min(columnsA - 2, rowsA));
-            var lu = Math.Max(nct, nrt);
-
-            for (l = 0; l < lu; l++)
-            {
-                lp1 = l + 1;
-                if (l < nct)
-                {
-                    // Compute the transformation for the l-th column and
-                    // place the l-th diagonal in vector s[l].
-                    var sum = 0.0f;
-                    for (i = l; i < rowsA; i++)
-                    {
-                        sum += a[(l * rowsA) + i].Magnitude * a[(l * rowsA) + i].Magnitude;
-                    }
-
-                    stemp[l] = (float)Math.Sqrt(sum);
-                    if (stemp[l] != 0.0f)
-                    {
-                        if (a[(l * rowsA) + l] != 0.0f)
-                        {
-                            stemp[l] = stemp[l].Magnitude * (a[(l * rowsA) + l] / a[(l * rowsA) + l].Magnitude);
-                        }
-
-                        // A part of column "l" of Matrix A from row "l" to end multiply by 1.0f / s[l]
-                        for (i = l; i < rowsA; i++)
-                        {
-                            a[(l * rowsA) + i] = a[(l * rowsA) + i] * (1.0f / stemp[l]);
-                        }
-
-                        a[(l * rowsA) + l] = 1.0f + a[(l * rowsA) + l];
-                    }
-
-                    stemp[l] = -stemp[l];
-                }
-
-                for (j = lp1; j < columnsA; j++)
-                {
-                    if (l < nct)
-                    {
-                        if (stemp[l] != 0.0f)
-                        {
-                            // Apply the transformation.
-                            t = 0.0f;
-                            for (i = l; i < rowsA; i++)
-                            {
-                                t += a[(l * rowsA) + i].Conjugate() * a[(j * rowsA) + i];
-                            }
-
-                            t = -t / a[(l * rowsA) + l];
-
-                            for (var ii = l; ii < rowsA; ii++)
-                            {
-                                a[(j * rowsA) + ii] += t * a[(l * rowsA) + ii];
-                            }
-                        }
-                    }
-
-                    // Place the l-th row of matrix into "e" for the
-                    // subsequent calculation of the row transformation.
-                    e[j] = a[(j * rowsA) + l].Conjugate();
-                }
+            if (s.Length != Math.Min(rowsA, columnsA))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+            }
 
-                if (computeVectors && l < nct)
-                {
-                    // Place the transformation in "u" for subsequent back multiplication.
-                    for (i = l; i < rowsA; i++)
-                    {
-                        u[(l * rowsA) + i] = a[(l * rowsA) + i];
-                    }
-                }
+            if (b.Length != rowsA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
 
-                if (l >= nrt)
-                {
-                    continue;
-                }
+            if (x.Length != columnsA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
 
-                // Compute the l-th row transformation and place the l-th super-diagonal in e(l).
-                var enorm = 0.0f;
-                for (i = lp1; i < e.Length; i++)
-                {
-                    enorm += e[i].Magnitude * e[i].Magnitude;
-                }
+            var ldvt = vt.Length / columnsA;
+            var tmp = new Complex32[columnsA];
 
-                e[l] = (float)Math.Sqrt(enorm);
-                if (e[l] != 0.0f)
+            for (var k = 0; k < columnsB; k++)
+            {
+                for (var j = 0; j < columnsA; j++)
                 {
-                    if (e[lp1] != 0.0f)
+                    var value = Complex32.Zero;
+                    if (j < mn)
                     {
-                        e[l] = e[l].Magnitude * (e[lp1] / e[lp1].Magnitude);
-                    }
+                        for (var i = 0; i < rowsA; i++)
+                        {
+                            value += u[(j * rowsA) + i].Conjugate() * b[(k * rowsA) + i];
+                        }
 
-                    // Scale vector "e" from "lp1" by 1.0f / e[l]
-                    for (i = lp1; i < e.Length; i++)
-                    {
-                        e[i] = e[i] * (1.0f / e[l]);
+                        value /= s[j];
                     }
 
-                    e[lp1] = 1.0f + e[lp1];
+                    tmp[j] = value;
                 }
 
-                e[l] = -e[l].Conjugate();
-
-                if (lp1 < rowsA && e[l] != 0.0f)
+                for (var j = 0; j < columnsA; j++)
                 {
-                    // Apply the transformation.
-                    for (i = lp1; i < rowsA; i++)
-                    {
-                        work[i] = 0.0f;
-                    }
-
-                    for (j = lp1; j < columnsA; j++)
+                    var value = Complex32.Zero;
+                    for (var i = 0; i < mn; i++)
                     {
-                        for (var ii = lp1; ii < rowsA; ii++)
-                        {
-                            work[ii] += e[j] * a[(j * rowsA) + ii];
-                        }
+                        value += vt[(j * ldvt) + i].Conjugate() * tmp[i];
                     }
 
-                    for (j = lp1; j < columnsA; j++)
-                    {
-                        var ww = (-e[j] / e[lp1]).Conjugate();
-                        for (var ii = lp1; ii < rowsA; ii++)
-                        {
-                            a[(j * rowsA) + ii] += ww * work[ii];
-                        }
-                    }
+                    x[(k * columnsA) + j] = value;
                 }
+            }
+        }
 
-                if (!computeVectors)
-                {
-                    continue;
-                }
+        /// <summary>
+        /// Computes the eigenvalues and eigenvectors of a Hermitian matrix.
+        /// </summary>
+        /// <param name="a">On entry, the Hermitian matrix; only its lower triangle is read. On exit,
+        /// the orthonormal eigenvectors, one per column.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues in ascending order, with zero imaginary parts.</param>
+        /// <remarks>This is equivalent to the HEEVD LAPACK routine.</remarks>
+        public virtual void EigenDecomposition(Complex32[] a, int order, Complex32[] eigenvalues)
+        {
+            CheckEigenDecomposition(a, order, eigenvalues);
 
-                // Place the transformation in v for subsequent back multiplication.
-                for (i = lp1; i < columnsA; i++)
+            if (order == 0)
+            {
+                return;
+            }
+
+            var matrix = new Complex32[order, order];
+            for (var j = 0; j < order; j++)
+            {
+                matrix[j, j] = a[(j * order) + j];
+                for (var i = j + 1; i < order; i++)
                 {
-                    v[(l * columnsA) + i] = e[i];
+                    matrix[i, j] = a[(j * order) + i];
+                    matrix[j, i] = a[(j * order) + i].Conjugate();
                 }
             }
 
-            // Set up the final bidiagonal matrix or order m.
-            var m = Math.Min(columnsA, rowsA + 1);
-            var nctp1 = nct + 1;
-            var nrtp1 = nrt + 1;
-            if (nct < columnsA)
+            // The eigenvectors are accumulated into the identity, then transformed back.
+            Array.Clear(a, 0, a.Length);
+            for (var i = 0; i < order; i++)
             {
-                stemp[nctp1 - 1] = a[((nctp1 - 1) * rowsA) + (nctp1 - 1)];
+                a[(i * order) + i] = Complex32.One;
             }
 
-            if (rowsA < m)
+            var tau = new Complex32[order];
+            var d = new float[order];
+            var e = new float[order];
+            SymmetricTridiagonalize(matrix, d, e, tau, order);
+            SymmetricDiagonalize(a, d, e, order);
+            SymmetricUntridiagonalize(a, matrix, tau, order);
+
+            for (var i = 0; i < order; i++)
             {
-                stemp[m - 1] = 0.0f;
+                eigenvalues[i] = new Complex32(d[i], 0.0f);
             }
+        }
 
-            if (nrtp1 < m)
+        /// <summary>
+        /// Computes the eigenvalues and, optionally, the left and right eigenvectors of a general matrix.
+        /// </summary>
+        /// <param name="computeLeft">Whether to compute the left eigenvectors.</param>
+        /// <param name="computeRight">Whether to compute the right eigenvectors.</param>
+        /// <param name="a">On entry, the square matrix A. On exit, A is overwritten.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues.</param>
+        /// <param name="leftVectors">If <paramref name="computeLeft"/> is <c>true</c>, on exit the left eigenvectors u(j),
+        /// <c>u(j)^H*A = lambda(j)*u(j)^H</c>, one per column and of unit length. Otherwise not referenced.</param>
+        /// <param name="rightVectors">If <paramref name="computeRight"/> is <c>true</c>, on exit the right eigenvectors v(j),
+        /// <c>A*v(j) = lambda(j)*v(j)</c>, one per column and of unit length. Otherwise not referenced.</param>
+        /// <remarks>This is equivalent to the GEEV LAPACK routine.</remarks>
+        public virtual void EigenDecomposition(bool computeLeft, bool computeRight, Complex32[] a, int order, Complex32[] eigenvalues, Complex32[] leftVectors, Complex32[] rightVectors)
+        {
+            CheckEigenDecomposition(a, order, eigenvalues);
+            CheckEigenvectors(computeLeft, leftVectors, order, "leftVectors");
+            CheckEigenvectors(computeRight, rightVectors, order, "rightVectors");
+
+            if (order == 0)
             {
-                e[nrtp1 - 1] = a[((m - 1) * rowsA) + (nrtp1 - 1)];
+                return;
             }
 
-            e[m - 1] = 0.0f;
-
-            // If required, generate "u".
-            if (computeVectors)
+            var matrixH = new Complex32[order, order];
+            for (var j = 0; j < order; j++)
             {
-                for (j = nctp1 - 1; j < ncu; j++)
+                for (var i = 0; i < order; i++)
                 {
-                    for (i = 0; i < rowsA; i++)
-                    {
-                        u[(j * rowsA) + i] = 0.0f;
-                    }
-
-                    u[(j * rowsA) + j] = 1.0f;
+                    matrixH[i, j] = a[(j * order) + i];
                 }
+            }
 
-                for (l = nct - 1; l >= 0; l--)
-                {
-                    if (stemp[l] != 0.0f)
-                    {
-                        for (j = l + 1; j < ncu; j++)
-                        {
-                            t = 0.0f;
-                            for (i = l; i < rowsA; i++)
-                            {
-                                t += u[(l * rowsA) + i].Conjugate() * u[(j * rowsA) + i];
-                            }
-
-                            t = -t / u[(l * rowsA) + l];
-                            for (var ii = l; ii < rowsA; ii++)
-                            {
-                                u[(j * rowsA) + ii] += t * u[(l * rowsA) + ii];
-                            }
-                        }
-
-                        // A part of column "l" of matrix A from row "l" to end multiply by -1.0f
-                        for (i = l; i < rowsA; i++)
-                        {
-                            u[(l * rowsA) + i] = u[(l * rowsA) + i] * -1.0f;
-                        }
-
-                        u[(l * rowsA) + l] = 1.0f + u[(l * rowsA) + l];
-                        for (i = 0; i < l; i++)
-                        {
-                            u[(l * rowsA) + i] = 0.0f;
-                        }
-                    }
-                    else
-                    {
-                        for (i = 0; i < rowsA; i++)
-                        {
-                            u[(l * rowsA) + i] = 0.0f;
-                        }
+            var vectors = new Complex32[order * order];
+            NonsymmetricReduceToHessenberg(vectors, matrixH, order);
+            NonsymmetricReduceHessenberToRealSchur(eigenvalues, vectors, matrixH, order, computeLeft || computeRight);
+            if (!computeLeft && !computeRight)
+            {
+                return;
+            }
 
-                        u[(l * rowsA) + l] = 1.0f;
-                    }
-                }
+            NormalizeEigenvectors(vectors, order);
+            if (computeRight)
+            {
+                Array.Copy(vectors, rightVectors, vectors.Length);
             }
 
-            // If it is required, generate v.
-            if (computeVectors)
+            if (computeLeft)
             {
-                for (l = columnsA - 1; l >= 0; l--)
+                // The conjugated rows of the inverse of the right eigenvectors are the left eigenvectors.
+                LUInverse(vectors, order);
+                for (var j = 0; j < order; j++)
                 {
-                    lp1 = l + 1;
-                    if (l < nrt)
+                    for (var i = 0; i < order; i++)
                     {
-                        if (e[l] != 0.0f)
-                        {
-                            for (j = lp1; j < columnsA; j++)
-                            {
-                                t = 0.0f;
-                                for (i = lp1; i < columnsA; i++)
-                                {
-                                    t += v[(l * columnsA) + i].Conjugate() * v[(j * columnsA) + i];
-                                }
-
-                                t = -t / v[(l * columnsA) + lp1];
-                                for (var ii = l; ii < columnsA; ii++)
-                                {
-                                    v[(j * columnsA) + ii] += t * v[(l * columnsA) + ii];
-                                }
-                            }
-                        }
+                        leftVectors[(j * order) + i] = vectors[(i * order) + j].Conjugate();
                     }
+                }
 
-                    for (i = 0; i < columnsA; i++)
-                    {
-                        v[(l * columnsA) + i] = 0.0f;
-                    }
+                NormalizeEigenvectors(leftVectors, order);
+            }
+        }
 
-                    v[(l * columnsA) + l] = 1.0f;
-                }
+        /// <summary>
+        /// Computes the Schur decomposition of a general matrix, <c>A = Z*T*Z^H</c> with Z unitary and
+        /// T upper triangular.
+        /// </summary>
+        /// <param name="a">On entry, the square matrix A. On exit, T.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues, which are the diagonal of T.</param>
+        /// <param name="schurVectors">On exit, the unitary matrix Z of Schur vectors.</param>
+        /// <remarks>This is equivalent to the GEES LAPACK routine without eigenvalue ordering.</remarks>
+        public virtual void SchurDecomposition(Complex32[] a, int order, Complex32[] eigenvalues, Complex32[] schurVectors)
+        {
+            CheckEigenDecomposition(a, order, eigenvalues);
+            CheckEigenvectors(true, schurVectors, order, "schurVectors");
+
+            if (order == 0)
+            {
+                return;
             }
 
-            // Transform "s" and "e" so that they are float
-            for (i = 0; i < m; i++)
+            var matrixH = new Complex32[order, order];
+            for (var j = 0; j < order; j++)
             {
-                Complex32 r;
-                if (stemp[i] != 0.0f)
+                for (var i = 0; i < order; i++)
                 {
-                    t = stemp[i].Magnitude;
-                    r = stemp[i] / t;
-                    stemp[i] = t;
-                    if (i < m - 1)
-                    {
-                        e[i] = e[i] / r;
-                    }
-
-                    if (computeVectors)
-                    {
-                        // A part of column "i" of matrix U from row 0 to end multiply by r
-                        for (j = 0; j < rowsA; j++)
-                        {
-                            u[(i * rowsA) + j] = u[(i * rowsA) + j] * r;
-                        }
-                    }
+                    matrixH[i, j] = a[(j * order) + i];
                 }
+            }
 
-                // Exit
-                if (i == m - 1)
-                {
-                    break;
-                }
+            NonsymmetricReduceToHessenberg(schurVectors, matrixH, order);
+            NonsymmetricReduceHessenberToRealSchur(eigenvalues, schurVectors, matrixH, order, false);
 
-                if (e[i] == 0.0f)
+            // Everything below the diagonal is round-off.
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = 0; i < order; i++)
                 {
-                    continue;
+                    a[(j * order) + i] = i <= j ? matrixH[i, j] : Complex32.Zero;
                 }
+            }
+        }
 
-                t = e[i].Magnitude;
-                r = t / e[i];
-                e[i] = t;
-                stemp[i + 1] = stemp[i + 1] * r;
-                if (!computeVectors)
+        /// <summary>
+        /// Scales eigenvectors to unit length.
+        /// </summary>
+        /// <param name="vectors">The eigenvectors, one per column.</param>
+        /// <param name="order">The number of rows and columns of <paramref name="vectors"/>.</param>
+        private static void NormalizeEigenvectors(Complex32[] vectors, int order)
+        {
+            for (var j = 0; j < order; j++)
+            {
+                var norm = 0.0f;
+                for (var i = 0; i < order; i++)
                 {
-                    continue;
+                    var value = vectors[(j * order) + i];
+                    norm += (value.Real * value.Real) + (value.Imaginary * value.Imaginary);
                 }
 
-                // A part of column "i+1" of matrix VT from row 0 to end multiply by r
-                for (j = 0; j < columnsA; j++)
+                if (norm > 0.0f)
                 {
-                    v[((i + 1) * columnsA) + j] = v[((i + 1) * columnsA) + j] * r;
+                    var scale = 1.0f / (float)Math.Sqrt(norm);
+                    for (var i = 0; i < order; i++)
+                    {
+                        vectors[(j * order) + i] *= scale;
+                    }
                 }
             }
+        }
 
-            // Main iteration loop for the singular values.
-            var mn = m;
-            var iter = 0;
+        /// <summary>
+        /// Reduces a complex hermitian matrix to a real symmetric tridiagonal matrix using unitary similarity transformations.
+        /// </summary>
+        /// <param name="matrixA">Source matrix to reduce</param>
+        /// <param name="d">Output: Arrays for internal storage of real parts of eigenvalues</param>
+        /// <param name="e">Output: Arrays for internal storage of imaginary parts of eigenvalues</param>
+        /// <param name="tau">Output: Arrays that contains further information about the transformations.</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <remarks>This is derived from the Algol procedures HTRIDI by 
+        /// Smith, Boyle, Dongarra, Garbow, Ikebe, Klema, Moler, and Wilkinson, Handbook for 
+        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding 
+        /// Fortran subroutine in EISPACK.</remarks>
+        private static void SymmetricTridiagonalize(Complex32[,] matrixA, float[] d, float[] e, Complex32[] tau, int order)
+        {
+            float hh;
+            tau[order - 1] = Complex32.One;
 
-            while (m > 0)
+            for (var i = 0; i < order; i++)
             {
-                // Quit if all the singular values have been found.
-                // If too many iterations have been performed throw exception.
-                if (iter >= Maxiter)
-                {
-                    throw new ArgumentException(Resources.ConvergenceFailed);
-                }
+                d[i] = matrixA[i, i].Real;
+            }
 
-                // This section of the program inspects for negligible elements in the s and e arrays,  
-                // on completion the variables kase and l are set as follows:
-                // kase = 1: if mS[m] and e[l-1] are negligible and l < m
-                // kase = 2: if mS[l] is negligible and l < m
-                // kase = 3: if e[l-1] is negligible, l < m, and mS[l, ..., mS[m] are not negligible (qr step).
-                // kase = 4: if e[m-1] is negligible (convergence).
-                float ztest;
-                float test;
-                for (l = m - 2; l >= 0; l--)
+            // Householder reduction to tridiagonal form.
+            for (var i = order - 1; i > 0; i--)
+            {
+                // Scale to avoid under/overflow.
+                var scale = 0.0f;
+                var h = 0.0f;
+
+                for (var k = 0; k < i; k++)
                 {
-                    test = stemp[l].Magnitude + stemp[l + 1].Magnitude;
-                    ztest = test + e[l].Magnitude;
-                    if (ztest.AlmostEqualInDecimalPlaces(test, 7))
-                    {
-                        e[l] = 0.0f;
-                        break;
-                    }
+                    scale = scale + Math.Abs(matrixA[i, k].Real) + Math.Abs(matrixA[i, k].Imaginary);
                 }
 
-                int kase;
-                if (l == m - 2)
+                if (scale == 0.0f)
                 {
-                    kase = 4;
+                    tau[i - 1] = Complex32.One;
+                    e[i] = 0.0f;
                 }
                 else
                 {
-                    int ls;
-                    for (ls = m - 1; ls > l; ls--)
+                    for (var k = 0; k < i; k++)
                     {
-                        test = 0.0f;
-                        if (ls != m - 1)
-                        {
-                            test = test + e[ls].Magnitude;
-                        }
-
-                        if (ls != l + 1)
-                        {
-                            test = test + e[ls - 1].Magnitude;
-                        }
-
-                        ztest = test + stemp[ls].Magnitude;
-                        if (ztest.AlmostEqualInDecimalPlaces(test, 7))
-                        {
-                            stemp[ls] = 0.0f;
-                            break;
-                        }
+                        matrixA[i, k] /= scale;
+                        h += matrixA[i, k].MagnitudeSquared;
                     }
 
-                    if (ls == l)
-                    {
-                        kase = 3;
-                    }
-                    else if (ls == m - 1)
+                    Complex32 g = (float)Math.Sqrt(h);
+                    e[i] = scale * g.Real;
+
+                    Complex32 temp;
+                    var f = matrixA[i, i - 1];
+                    if (f.Magnitude != 0)
                     {
-                        kase = 1;
+                        temp = -(matrixA[i, i - 1].Conjugate() * tau[i].Conjugate()) / f.Magnitude;
+                        h += f.Magnitude * g.Real;
+                        g = 1.0f + (g / f.Magnitude);
+                        matrixA[i, i - 1] *= g;
                     }
                     else
                     {
-                        kase = 2;
-                        l = ls;
+                        temp = -tau[i].Conjugate();
+                        matrixA[i, i - 1] = g;
                     }
-                }
-
-                l = l + 1;
 
-                // Perform the task indicated by kase.
-                int k;
-                float f;
-                switch (kase)
-                {
-                    // Deflate negligible s[m].
-                    case 1:
-                        f = e[m - 2].Real;
-                        e[m - 2] = 0.0f;
-                        float t1;
-                        for (var kk = l; kk < m - 1; kk++)
+                    if ((f.Magnitude == 0) || (i != 1))
+                    {
+                        f = Complex32.Zero;
+                        for (var j = 0; j < i; j++)
                         {
-                            k = m - 2 - kk + l;
-                            t1 = stemp[k].Real;
-                            Drotg(ref t1, ref f, ref cs, ref sn);
-                            stemp[k] = t1;
-                            if (k != l)
+                            var tmp = Complex32.Zero;
+
+                            // Form element of A*U.
+                            for (var k = 0; k <= j; k++)
                             {
-                                f = -sn * e[k - 1].Real;
-                                e[k - 1] = cs * e[k - 1];
+                                tmp += matrixA[j, k] * matrixA[i, k].Conjugate();
                             }
 
-                            if (computeVectors)
+                            for (var k = j + 1; k <= i - 1; k++)
                             {
-                                // Rotate
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((m - 1) * columnsA) + i]);
-                                    v[((m - 1) * columnsA) + i] = (cs * v[((m - 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
-                                    v[(k * columnsA) + i] = z;
-                                }
+                                tmp += matrixA[k, j].Conjugate() * matrixA[i, k].Conjugate();
                             }
+
+                            // Form element of P
+                            tau[j] = tmp / h;
+                            f += (tmp / h) * matrixA[i, j];
                         }
 
-                        break;
+                        hh = f.Real / (h + h);
 
-                    // Split at negligible s[l].
-                    case 2:
-                        f = e[l - 1].Real;
-                        e[l - 1] = 0.0f;
-                        for (k = l; k < m; k++)
+                        // Form the reduced A.
+                        for (var j = 0; j < i; j++)
                         {
-                            t1 = stemp[k].Real;
-                            Drotg(ref t1, ref f, ref cs, ref sn);
-                            stemp[k] = t1;
-                            f = -sn * e[k].Real;
-                            e[k] = cs * e[k];
-                            if (computeVectors)
+                            f = matrixA[i, j].Conjugate();
+                            g = tau[j] - (hh * f);
+                            tau[j] = g.Conjugate();
+
+                            for (var k = 0; k <= j; k++)
                             {
-                                // Rotate
-                                for (i = 0; i < rowsA; i++)
-                                {
-                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((l - 1) * rowsA) + i]);
-                                    u[((l - 1) * rowsA) + i] = (cs * u[((l - 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
-                                    u[(k * rowsA) + i] = z;
-                                }
+                                matrixA[j, k] -= (f * tau[k]) + (g * matrixA[i, k]);
                             }
                         }
+                    }
 
-                        break;
+                    for (var k = 0; k < i; k++)
+                    {
+                        matrixA[i, k] *= scale;
+                    }
 
-                    // Perform one qr step.
-                    case 3:
-                        // calculate the shift.
-                        var scale = 0.0f;
-                        scale = Math.Max(scale, stemp[m - 1].Magnitude);
-                        scale = Math.Max(scale, stemp[m - 2].Magnitude);
-                        scale = Math.Max(scale, e[m - 2].Magnitude);
-                        scale = Math.Max(scale, stemp[l].Magnitude);
-                        scale = Math.Max(scale, e[l].Magnitude);
-                        var sm = stemp[m - 1].Real / scale;
-                        var smm1 = stemp[m - 2].Real / scale;
-                        var emm1 = e[m - 2].Real / scale;
-                        var sl = stemp[l].Real / scale;
-                        var el = e[l].Real / scale;
-                        var b = (((smm1 + sm) * (smm1 - sm)) + (emm1 * emm1)) / 2.0f;
-                        var c = (sm * emm1) * (sm * emm1);
-                        var shift = 0.0f;
-                        if (b != 0.0f || c != 0.0f)
-                        {
-                            shift = (float)Math.Sqrt((b * b) + c);
-                            if (b < 0.0f)
-                            {
-                                shift = -shift;
-                            }
+                    tau[i - 1] = temp.Conjugate();
+                }
 
-                            shift = c / (b + shift);
-                        }
+                hh = d[i];
+                d[i] = matrixA[i, i].Real;
+                matrixA[i, i] = new Complex32(hh, scale * (float)Math.Sqrt(h));
+            }
 
-                        f = ((sl + sm) * (sl - sm)) + shift;
-                        var g = sl * el;
+            hh = d[0];
+            d[0] = matrixA[0, 0].Real;
+            matrixA[0, 0] = hh;
+            e[0] = 0.0f;
+        }
 
-                        // Chase zeros
-                        for (k = l; k < m - 1; k++)
-                        {
-                            Drotg(ref f, ref g, ref cs, ref sn);
-                            if (k != l)
-                            {
-                                e[k - 1] = f;
-                            }
+        /// <summary>
+        /// Symmetric tridiagonal QL algorithm.
+        /// </summary>
+        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
+        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
+        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <remarks>This is derived from the Algol procedures tql2, by
+        /// Bowdler, Martin, Reinsch, and Wilkinson, Handbook for
+        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding
+        /// Fortran subroutine in EISPACK.</remarks>
+        private static void SymmetricDiagonalize(Complex32[] dataEv, float[] d, float[] e, int order)
+        {
+            const int Maxiter = 1000;
 
-                            f = (cs * stemp[k].Real) + (sn * e[k].Real);
-                            e[k] = (cs * e[k]) - (sn * stemp[k]);
-                            g = sn * stemp[k + 1].Real;
-                            stemp[k + 1] = cs * stemp[k + 1];
-                            if (computeVectors)
-                            {
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((k + 1) * columnsA) + i]);
-                                    v[((k + 1) * columnsA) + i] = (cs * v[((k + 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
-                                    v[(k * columnsA) + i] = z;
-                                }
-                            }
+            for (var i = 1; i < order; i++)
+            {
+                e[i - 1] = e[i];
+            }
 
-                            Drotg(ref f, ref g, ref cs, ref sn);
-                            stemp[k] = f;
-                            f = (cs * e[k].Real) + (sn * stemp[k + 1].Real);
-                            stemp[k + 1] = -(sn * e[k]) + (cs * stemp[k + 1]);
-                            g = sn * e[k + 1].Real;
-                            e[k + 1] = cs * e[k + 1];
-                            if (computeVectors && k < rowsA)
-                            {
-                                for (i = 0; i < rowsA; i++)
-                                {
-                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((k + 1) * rowsA) + i]);
-                                    u[((k + 1) * rowsA) + i] = (cs * u[((k + 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
-                                    u[(k * rowsA) + i] = z;
-                                }
-                            }
-                        }
+            e[order - 1] = 0.0f;
 
-                        e[m - 2] = f;
-                        iter = iter + 1;
+            var f = 0.0f;
+            var tst1 = 0.0f;
+            var eps = Precision.DoubleMachinePrecision;
+            for (var l = 0; l < order; l++)
+            {
+                // Find small subdiagonal element
+                tst1 = Math.Max(tst1, Math.Abs(d[l]) + Math.Abs(e[l]));
+                var m = l;
+                while (m < order)
+                {
+                    if (Math.Abs(e[m]) <= eps * tst1)
+                    {
                         break;
+                    }
 
-                    // Convergence
-                    case 4:
+                    m++;
+                }
 
-                        // Make the singular value  positive
-                        if (stemp[l].Real < 0.0f)
+                // If m == l, d[l] is an eigenvalue,
+                // otherwise, iterate.
+                if (m > l)
+                {
+                    var iter = 0;
+                    do
+                    {
+                        iter = iter + 1; // (Could check iteration count here.)
+
+                        // Compute implicit shift
+                        var g = d[l];
+                        var p = (d[l + 1] - g) / (2.0f * e[l]);
+                        var r = SpecialFunctions.Hypotenuse(p, 1.0f);
+                        if (p < 0)
                         {
-                            stemp[l] = -stemp[l];
-                            if (computeVectors)
-                            {
-                                // A part of column "l" of matrix VT from row 0 to end multiply by -1
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    v[(l * columnsA) + i] = v[(l * columnsA) + i] * -1.0f;
-                                }
-                            }
+                            r = -r;
                         }
 
-                        // Order the singular value.
-                        while (l != mn - 1)
-                        {
-                            if (stemp[l].Real >= stemp[l + 1].Real)
-                            {
-                                break;
-                            }
+                        d[l] = e[l] / (p + r);
+                        d[l + 1] = e[l] * (p + r);
 
-                            t = stemp[l];
-                            stemp[l] = stemp[l + 1];
-                            stemp[l + 1] = t;
-                            if (computeVectors && l < columnsA)
-                            {
-                                // Swap columns l, l + 1
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    var z = v[(l * columnsA) + i];
-                                    v[(l * columnsA) + i] = v[((l + 1) * columnsA) + i];
-                                    v[((l + 1) * columnsA) + i] = z;
-                                }
-                            }
+                        var dl1 = d[l + 1];
+                        var h = g - d[l];
+                        for (var i = l + 2; i < order; i++)
+                        {
+                            d[i] -= h;
+                        }
 
-                            if (computeVectors && l < rowsA)
+                        f = f + h;
+
+                        // Implicit QL transformation.
+                        p = d[m];
+                        var c = 1.0f;
+                        var c2 = c;
+                        var c3 = c;
+                        var el1 = e[l + 1];
+                        var s = 0.0f;
+                        var s2 = 0.0f;
+                        for (var i = m - 1; i >= l; i--)
+                        {
+                            c3 = c2;
+                            c2 = c;
+                            s2 = s;
+                            g = c * e[i];
+                            h = c * p;
+                            r = SpecialFunctions.Hypotenuse(p, e[i]);
+                            e[i + 1] = s * r;
+                            s = e[i] / r;
+                            c = p / r;
+                            p = (c * d[i]) - (s * g);
+                            d[i + 1] = h + (s * ((c * g) + (s * d[i])));
+
+                            // Accumulate transformation.
+                            for (var k = 0; k < order; k++)
                             {
-                                // Swap columns l, l + 1
-                                for (i = 0; i < rowsA; i++)
-                                {
-                                    var z = u[(l * rowsA) + i];
-                                    u[(l * rowsA) + i] = u[((l + 1) * rowsA) + i];
-                                    u[((l + 1) * rowsA) + i] = z;
-                                }
+                                h = dataEv[((i + 1) * order) + k].Real;
+                                dataEv[((i + 1) * order) + k] = (s * dataEv[(i * order) + k].Real) + (c * h);
+                                dataEv[(i * order) + k] = (c * dataEv[(i * order) + k].Real) - (s * h);
                             }
-
-                            l = l + 1;
                         }
 
-                        iter = 0;
-                        m = m - 1;
-                        break;
+                        p = (-s) * s2 * c3 * el1 * e[l] / dl1;
+                        e[l] = s * p;
+                        d[l] = c * p;
+
+                        // Check for convergence. If too many iterations have been performed, 
+                        // throw exception that Convergence Failed
+                        if (iter >= Maxiter)
+                        {
+                            throw new ArgumentException(Resources.ConvergenceFailed);
+                        }
+                    }
+                    while (Math.Abs(e[l]) > eps * tst1);
                 }
+
+                d[l] = d[l] + f;
+                e[l] = 0.0f;
             }
 
-            if (computeVectors)
+            // Sort eigenvalues and corresponding vectors.
+            for (var i = 0; i < order - 1; i++)
             {
-                // Finally transpose "v" to get "vt" matrix 
-                for (i = 0; i < columnsA; i++)
+                var k = i;
+                var p = d[i];
+                for (var j = i + 1; j < order; j++)
                 {
-                    for (j = 0; j < columnsA; j++)
+                    if (d[j] < p)
                     {
-                        vt[(j * columnsA) + i] = v[(i * columnsA) + j].Conjugate();
+                        k = j;
+                        p = d[j];
                     }
                 }
-            }
-
-            // Copy stemp to s with size adjustment. We are using ported copy of linpack's svd code and it uses
-            // a singular vector of length rows+1 when rows < columns. The last element is not used and needs to be removed.
-            // We should port lapack's svd routine to remove this problem.
-            CommonParallel.For(0, Math.Min(rowsA, columnsA), index => s[index] = stemp[index]);
 
-            // On return the first element of the work array stores the min size of the work array could have been
-            // work[0] = Math.Max(3 * Math.Min(aRows, aColumns) + Math.Max(aRows, aColumns), 5 * Math.Min(aRows, aColumns));
-            work[0] = rowsA;            
+                if (k != i)
+                {
+                    d[k] = d[i];
+                    d[i] = p;
+                    for (var j = 0; j < order; j++)
+                    {
+                        p = dataEv[(i * order) + j].Real;
+                        dataEv[(i * order) + j] = dataEv[(k * order) + j];
+                        dataEv[(k * order) + j] = p;
+                    }
+                }
+            }
         }
 
         /// <summary>
-        /// Solves A*X=B for X using the singular value decomposition of A.
+        /// Determines eigenvectors by undoing the symmetric tridiagonalize transformation
         /// </summary>
-        /// <param name="a">On entry, the M by N matrix to decompose.</param>
-        /// <param name="rowsA">The number of rows in the A matrix.</param>
-        /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        public virtual void SvdSolve(Complex32[] a, int rowsA, int columnsA, Complex32[] b, int columnsB, Complex32[] x)
+        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
+        /// <param name="matrixA">Previously tridiagonalized matrix by <see cref="SymmetricTridiagonalize"/>.</param>
+        /// <param name="tau">Contains further information about the transformations</param>
+        /// <param name="order">Input matrix order</param>
+        /// <remarks>This is derived from the Algol procedures HTRIBK, by
+        /// by Smith, Boyle, Dongarra, Garbow, Ikebe, Klema, Moler, and Wilkinson, Handbook for
+        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding
+        /// Fortran subroutine in EISPACK.</remarks>
+        private static void SymmetricUntridiagonalize(Complex32[] dataEv, Complex32[,] matrixA, Complex32[] tau, int order)
         {
-            if (a == null)
+            for (var i = 0; i < order; i++)
             {
-                throw new ArgumentNullException("a");
+                for (var j = 0; j < order; j++)
+                {
+                    dataEv[(j * order) + i] = dataEv[(j * order) + i].Real * tau[i].Conjugate();
+                }
             }
 
-            if (b == null)
+            // Recover and apply the Householder matrices.
+            for (var i = 1; i < order; i++)
             {
-                throw new ArgumentNullException("b");
+                var h = matrixA[i, i].Imaginary;
+                if (h != 0)
+                {
+                    for (var j = 0; j < order; j++)
+                    {
+                        var s = Complex32.Zero;
+                        for (var k = 0; k < i; k++)
+                        {
+                            s += dataEv[(j * order) + k] * matrixA[i, k];
+                        }
+
+                        s = (s / h) / h;
+
+                        for (var k = 0; k < i; k++)
+                        {
+                            dataEv[(j * order) + k] -= s * matrixA[i, k].Conjugate();
+                        }
+                    }
+                }
             }
+        }
 
-            if (x == null)
+        /// <summary>
+        /// Nonsymmetric reduction to Hessenberg form.
+        /// </summary>
+        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
+        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <remarks>This is derived from the Algol procedures orthes and ortran,
+        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
+        /// Vol.ii-Linear Algebra, and the corresponding
+        /// Fortran subroutines in EISPACK.</remarks>
+        private static void NonsymmetricReduceToHessenberg(Complex32[] dataEv, Complex32[,] matrixH, int order)
+        {
+            var ort = new Complex32[order];
+
+            for (var m = 1; m < order - 1; m++)
             {
-                throw new ArgumentNullException("x");
+                // Scale column.
+                var scale = 0.0f;
+                for (var i = m; i < order; i++)
+                {
+                    scale += Math.Abs(matrixH[i, m - 1].Real) + Math.Abs(matrixH[i, m - 1].Imaginary);
+                }
+
+                if (scale != 0.0f)
+                {
+                    // Compute Householder transformation.
+                    var h = 0.0f;
+                    for (var i = order - 1; i >= m; i--)
+                    {
+                        ort[i] = matrixH[i, m - 1] / scale;
+                        h += ort[i].MagnitudeSquared;
+                    }
+
+                    var g = (float)Math.Sqrt(h);
+                    if (ort[m].Magnitude != 0)
+                    {
+                        h = h + (ort[m].Magnitude * g);
+                        g /= ort[m].Magnitude;
+                        ort[m] = (1.0f + g) * ort[m];
+                    }
+                    else
+                    {
+                        ort[m] = g;
+                        matrixH[m, m - 1] = scale;
+                    }
+
+                    // Apply Householder similarity transformation
+                    // H = (I-u*u'/h)*H*(I-u*u')/h)
+                    for (var j = m; j < order; j++)
+                    {
+                        var f = Complex32.Zero;
+                        for (var i = order - 1; i >= m; i--)
+                        {
+                            f += ort[i].Conjugate() * matrixH[i, j];
+                        }
+
+                        f = f / h;
+                        for (var i = m; i < order; i++)
+                        {
+                            matrixH[i, j] -= f * ort[i];
+                        }
+                    }
+
+                    for (var i = 0; i < order; i++)
+                    {
+                        var f = Complex32.Zero;
+                        for (var j = order - 1; j >= m; j--)
+                        {
+                            f += ort[j] * matrixH[i, j];
+                        }
+
+                        f = f / h;
+                        for (var j = m; j < order; j++)
+                        {
+                            matrixH[i, j] -= f * ort[j].Conjugate();
+                        }
+                    }
+
+                    ort[m] = scale * ort[m];
+                    matrixH[m, m - 1] *= -g;
+                }
             }
 
-            if (b.Length != rowsA * columnsB)
+            // Accumulate transformations (Algol's ortran).
+            for (var i = 0; i < order; i++)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                for (var j = 0; j < order; j++)
+                {
+                    dataEv[(j * order) + i] = i == j ? Complex32.One : Complex32.Zero;
+                }
             }
 
-            if (x.Length != columnsA * columnsB)
+            for (var m = order - 2; m >= 1; m--)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                if (matrixH[m, m - 1] != Complex32.Zero && ort[m] != Complex32.Zero)
+                {
+                    var norm = (matrixH[m, m - 1].Real * ort[m].Real) + (matrixH[m, m - 1].Imaginary * ort[m].Imaginary);
+
+                    for (var i = m + 1; i < order; i++)
+                    {
+                        ort[i] = matrixH[i, m - 1];
+                    }
+
+                    for (var j = m; j < order; j++)
+                    {
+                        var g = Complex32.Zero;
+                        for (var i = m; i < order; i++)
+                        {
+                            g += ort[i].Conjugate() * dataEv[(j * order) + i];
+                        }
+
+                        // Double division avoids possible underflow
+                        g /= norm;
+                        for (var i = m; i < order; i++)
+                        {
+                            dataEv[(j * order) + i] += g * ort[i];
+                        }
+                    }
+                }
             }
+            
+            // Create real subdiagonal elements.
+            for (var i = 1; i < order; i++)
+            {
+                if (matrixH[i, i - 1].Imaginary != 0.0f)
+                {
+                    var y = matrixH[i, i - 1] / matrixH[i, i - 1].Magnitude;
+                    matrixH[i, i - 1] = matrixH[i, i - 1].Magnitude;
+                    for (var j = i; j < order; j++)
+                    {
+                        matrixH[i, j] *= y.Conjugate();
+                    }
 
-            var work = new Complex32[rowsA];
-            var s = new Complex32[Math.Min(rowsA, columnsA)];
-            var u = new Complex32[rowsA * rowsA];
-            var vt = new Complex32[columnsA * columnsA];
+                    for (var j = 0; j <= Math.Min(i + 1, order - 1); j++)
+                    {
+                        matrixH[j, i] *= y;
+                    }
 
-            var clone = new Complex32[a.Length];
-            a.Copy(clone);
-            SingularValueDecomposition(true, clone, rowsA, columnsA, s, u, vt, work);
-            SvdSolveFactored(rowsA, columnsA, s, u, vt, b, columnsB, x);
+                    for (var j = 0; j < order; j++)
+                    {
+                        dataEv[(i * order) + j] *= y;
+                    }
+                }
+            }
         }
 
         /// <summary>
-        /// Solves A*X=B for X using a previously SVD decomposed matrix.
+        /// Nonsymmetric reduction from Hessenberg to real Schur form.
         /// </summary>
-        /// <param name="rowsA">The number of rows in the A matrix.</param>
-        /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="s">The s values returned by <see cref="SingularValueDecomposition(bool,Complex32[],int,int,Complex32[],Complex32[],Complex32[])"/>.</param>
-        /// <param name="u">The left singular vectors returned by  <see cref="SingularValueDecomposition(bool,Complex32[],int,int,Complex32[],Complex32[],Complex32[])"/>.</param>
-        /// <param name="vt">The right singular  vectors returned by  <see cref="SingularValueDecomposition(bool,Complex32[],int,int,Complex32[],Complex32[],Complex32[])"/>.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        public virtual void SvdSolveFactored(int rowsA, int columnsA, Complex32[] s, Complex32[] u, Complex32[] vt, Complex32[] b, int columnsB, Complex32[] x)
+        /// <param name="vectorV">Data array of the eigenvectors</param>
+        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
+        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <param name="computeVectors">If <c>false</c>, stops at the Schur form: <paramref name="matrixH"/> then holds
+        /// the upper triangular factor and <paramref name="dataEv"/> the Schur vectors.</param>
+        /// <remarks>This is derived from the Algol procedure hqr2,
+        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
+        /// Vol.ii-Linear Algebra, and the corresponding
+        /// Fortran subroutine in EISPACK.</remarks>
+        private static void NonsymmetricReduceHessenberToRealSchur(Complex32[] vectorV, Complex32[] dataEv, Complex32[,] matrixH, int order, bool computeVectors)
         {
-            if (s == null)
-            {
-                throw new ArgumentNullException("s");
-            }
+            // Initialize
+            var n = order - 1;
+            var eps = (float)Precision.SingleMachinePrecision;
 
-            if (u == null)
-            {
-                throw new ArgumentNullException("u");
-            }
+            float norm;
+            Complex32 s, x, y, z, exshift = Complex32.Zero;
 
-            if (vt == null)
+            // Outer loop over eigenvalue index
+            var iter = 0;
+            while (n >= 0)
             {
-                throw new ArgumentNullException("vt");
-            }
+                // Look for single small sub-diagonal element
+                var l = n;
+                while (l > 0)
+                {
+                    var tst1 = Math.Abs(matrixH[l - 1, l - 1].Real) + Math.Abs(matrixH[l - 1, l - 1].Imaginary) + Math.Abs(matrixH[l, l].Real) + Math.Abs(matrixH[l, l].Imaginary);
+                    if (Math.Abs(matrixH[l, l - 1].Real) < eps * tst1)
+                    {
+                        break;
+                    }
 
-            if (b == null)
-            {
-                throw new ArgumentNullException("b");
-            }
+                    l--;
+                }
 
-            if (x == null)
-            {
-                throw new ArgumentNullException("x");
-            }
+                // Check for convergence
+                // One root found
+                if (l == n)
+                {
+                    matrixH[n, n] += exshift;
+                    vectorV[n] = matrixH[n, n];
+                    n--;
+                    iter = 0;
+                }
+                else
+                {
+                    // Form shift
+                    if (iter != 10 && iter != 20)
+                    {
+                        s = matrixH[n, n];
+                        x = matrixH[n - 1, n] * matrixH[n, n - 1].Real;
 
-            if (u.Length != rowsA * rowsA)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+                        if (x.Real != 0.0f || x.Imaginary != 0.0f)
+                        {
+                            y = (matrixH[n - 1, n - 1] - s) / 2.0f;
+                            z = ((y * y) + x).SquareRoot();
+                            if ((y.Real * z.Real) + (y.Imaginary * z.Imaginary) < 0.0f)
+                            {
+                                z *= -1.0f;
+                            }
+
+                            x /= y + z; 
+                            s = s - x;
+                        }
+                    }
+                    else
+                    {
+                        // Form exceptional shift
+                        s = Math.Abs(matrixH[n, n - 1].Real) + Math.Abs(matrixH[n - 1, n - 2].Real);
+                    }
+
+                    for (var i = 0; i <= n; i++)
+                    {
+                        matrixH[i, i] -= s;
+                    }
+
+                    exshift += s;
+                    iter++;
+
+                    // Reduce to triangle (rows)
+                    for (var i = l + 1; i <= n; i++)
+                    {
+                        s = matrixH[i, i - 1].Real;
+                        norm = SpecialFunctions.Hypotenuse(matrixH[i - 1, i - 1].Magnitude, s.Real);
+                        x = matrixH[i - 1, i - 1] / norm;
+                        vectorV[i - 1] = x;
+                        matrixH[i - 1, i - 1] = norm;
+                        matrixH[i, i - 1] = new Complex32(0.0f, s.Real / norm);
+
+                        for (var j = i; j < order; j++)
+                        {
+                            y = matrixH[i - 1, j];
+                            z = matrixH[i, j];
+                            matrixH[i - 1, j] = (x.Conjugate() * y) + (matrixH[i, i - 1].Imaginary * z);
+                            matrixH[i, j] = (x * z) - (matrixH[i, i - 1].Imaginary * y);
+                        }
+                    }
+
+                    s = matrixH[n, n];
+                    if (s.Imaginary != 0.0f)
+                    {
+                        s /= matrixH[n, n].Magnitude;
+                        matrixH[n, n] = matrixH[n, n].Magnitude;
+
+                        for (var j = n + 1; j < order; j++)
+                        {
+                            matrixH[n, j] *= s.Conjugate();
+                        }
+                    }
+
+                    // Inverse operation (columns).
+                    for (var j = l + 1; j <= n; j++)
+                    {
+                        x = vectorV[j - 1];
+                        for (var i = 0; i <= j; i++)
+                        {
+                            z = matrixH[i, j];
+                            if (i != j)
+                            {
+                                y = matrixH[i, j - 1];
+                                matrixH[i, j - 1] = (x * y) + (matrixH[j, j - 1].Imaginary * z);
+                            }
+                            else
+                            {
+                                y = matrixH[i, j - 1].Real;
+                                matrixH[i, j - 1] = new Complex32((x.Real * y.Real) - (x.Imaginary * y.Imaginary) + (matrixH[j, j - 1].Imaginary * z.Real), matrixH[i, j - 1].Imaginary);
+                            }
+
+                            matrixH[i, j] = (x.Conjugate() * z) - (matrixH[j, j - 1].Imaginary * y);
+                        }
+
+                        for (var i = 0; i < order; i++)
+                        {
+                            y = dataEv[((j - 1) * order) + i];
+                            z = dataEv[(j * order) + i];
+                            dataEv[((j - 1) * order) + i] = (x * y) + (matrixH[j, j - 1].Imaginary * z);
+                            dataEv[(j * order) + i] = (x.Conjugate() * z) - (matrixH[j, j - 1].Imaginary * y);
+                        }
+                    }
+
+                    if (s.Imaginary != 0.0f)
+                    {
+                        for (var i = 0; i <= n; i++)
+                        {
+                            matrixH[i, n] *= s;
+                        }
+
+                        for (var i = 0; i < order; i++)
+                        {
+                            dataEv[(n * order) + i] *= s;
+                        }
+                    }
+                }
             }
 
-            if (vt.Length != columnsA * columnsA)
+            if (!computeVectors)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+                return;
             }
 
-            if (s.Length != Math.Min(rowsA, columnsA))
+            // All roots found.  
+            // Backsubstitute to find vectors of upper triangular form
+            norm = 0.0f;
+            for (var i = 0; i < order; i++)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+                for (var j = i; j < order; j++)
+                {
+                    norm = Math.Max(norm, Math.Abs(matrixH[i, j].Real) + Math.Abs(matrixH[i, j].Imaginary));
+                }
             }
 
-            if (b.Length != rowsA * columnsB)
+            if (order == 1)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                return;
             }
 
-            if (x.Length != columnsA * columnsB)
+            if (norm == 0.0f)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                return;
             }
 
-            var mn = Math.Min(rowsA, columnsA);
-            var tmp = new Complex32[columnsA];
-
-            for (var k = 0; k < columnsB; k++)
+            for (n = order - 1; n > 0; n--)
             {
-                for (var j = 0; j < columnsA; j++)
+                x = vectorV[n];
+                matrixH[n, n] = 1.0f;
+
+                for (var i = n - 1; i >= 0; i--)
                 {
-                    var value = Complex32.Zero;
-                    if (j < mn)
+                    z = 0.0f;
+                    for (var j = i + 1; j <= n; j++)
                     {
-                        for (var i = 0; i < rowsA; i++)
-                        {
-                            value += u[(j * rowsA) + i].Conjugate() * b[(k * rowsA) + i];
-                        }
+                        z += matrixH[i, j] * matrixH[j, n];
+                    }
 
-                        value /= s[j];
+                    y = x - vectorV[i];
+                    if (y.Real == 0.0f && y.Imaginary == 0.0f)
+                    {
+                        y = eps * norm;
                     }
 
-                    tmp[j] = value;
+                    matrixH[i, n] = z / y;
+
+                    // Overflow control
+                    var tr = Math.Abs(matrixH[i, n].Real) + Math.Abs(matrixH[i, n].Imaginary);
+                    if ((eps * tr) * tr > 1)
+                    {
+                        for (var j = i; j <= n; j++)
+                        {
+                            matrixH[j, n] = matrixH[j, n] / tr;
+                        }
+                    }
                 }
+            }
 
-                for (var j = 0; j < columnsA; j++)
+            // Back transformation to get eigenvectors of original matrix
+            for (var j = order - 1; j > 0; j--)
+            {
+                for (var i = 0; i < order; i++)
                 {
-                    var value = Complex32.Zero;
-                    for (var i = 0; i < columnsA; i++)
+                    z = Complex32.Zero;
+                    for (var k = 0; k <= j; k++)
                     {
-                        value += vt[(j * columnsA) + i].Conjugate() * tmp[i];
+                        z += dataEv[(k * order) + i] * matrixH[k, j];
                     }
 
-                    x[(k * columnsA) + j] = value;
+                    dataEv[(j * order) + i] = z;
                 }
             }
         }
+
     }
 }
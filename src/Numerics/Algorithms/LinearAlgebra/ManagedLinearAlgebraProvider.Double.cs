@@ -26,6 +26,7 @@
 namespace MathNet.Numerics.Algorithms.LinearAlgebra
 {
     using System;
+    using System.Numerics;
     using Properties;
     using Threading;
 
@@ -581,6 +582,499 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
             CacheObliviousMatrixMultiply(transposeA, transposeB, alpha, adata, 0, 0, bdata, 0, 0, c, 0, 0, m, n, k, m, n, k, true);
         }
 
+        /// <summary>
+        /// Multiplies two matrices and updates another with the result, where each matrix is a block
+        /// of a larger column-major array. <c>c = alpha*op(a)*op(b) + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="transposeB">How to transpose the <paramref name="b"/> matrix.</param>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="m">The number of rows of op(a) and of c.</param>
+        /// <param name="n">The number of columns of op(b) and of c.</param>
+        /// <param name="k">The number of columns of op(a) and the number of rows of op(b).</param>
+        /// <param name="a">The array holding the a matrix.</param>
+        /// <param name="offsetA">The index of the first element of the a matrix in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of the a matrix.</param>
+        /// <param name="b">The array holding the b matrix.</param>
+        /// <param name="offsetB">The index of the first element of the b matrix in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of the b matrix.</param>
+        /// <param name="beta">The value to scale the c matrix.</param>
+        /// <param name="c">The array holding the c matrix.</param>
+        /// <param name="offsetC">The index of the first element of the c matrix in <paramref name="c"/>.</param>
+        /// <param name="leadingDimensionC">The distance between the starts of two consecutive columns of the c matrix.</param>
+        /// <remarks>This is equivalent to the GEMM BLAS routine.</remarks>
+        public virtual void MatrixMultiplyWithUpdate(Transpose transposeA, Transpose transposeB, double alpha, int m, int n, int k, double[] a, int offsetA, int leadingDimensionA, double[] b, int offsetB, int leadingDimensionB, double beta, double[] c, int offsetC, int leadingDimensionC)
+        {
+            var rowsA = transposeA == Transpose.DontTranspose ? m : k;
+            var columnsA = transposeA == Transpose.DontTranspose ? k : m;
+            var rowsB = transposeB == Transpose.DontTranspose ? k : n;
+            var columnsB = transposeB == Transpose.DontTranspose ? n : k;
+
+            CheckBlock(a, offsetA, leadingDimensionA, rowsA, columnsA, "a");
+            CheckBlock(b, offsetB, leadingDimensionB, rowsB, columnsB, "b");
+            CheckBlock(c, offsetC, leadingDimensionC, m, n, "c");
+
+            if (m == 0 || n == 0)
+            {
+                return;
+            }
+
+            var blockC = ExtractBlock(c, offsetC, leadingDimensionC, m, n);
+            MatrixMultiplyWithUpdate(transposeA, transposeB, alpha, ExtractBlock(a, offsetA, leadingDimensionA, rowsA, columnsA), rowsA, columnsA, ExtractBlock(b, offsetB, leadingDimensionB, rowsB, columnsB), rowsB, columnsB, beta, blockC);
+            StoreBlock(blockC, c, offsetC, leadingDimensionC, m, n);
+        }
+
+        /// <summary>
+        /// Multiplies a batch of equally sized matrices and updates the results. <c>c[i] = alpha*op(a[i])*op(b[i]) + beta*c[i]</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the a matrices.</param>
+        /// <param name="transposeB">How to transpose the b matrices.</param>
+        /// <param name="alpha">The value to scale the a matrices.</param>
+        /// <param name="m">The number of rows of each op(a) and c.</param>
+        /// <param name="n">The number of columns of each op(b) and c.</param>
+        /// <param name="k">The number of columns of each op(a) and the number of rows of each op(b).</param>
+        /// <param name="a">The a matrices, stored one after another in column-major order.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive a matrices. Use zero to share one matrix across the batch.</param>
+        /// <param name="b">The b matrices, stored one after another in column-major order.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive b matrices. Use zero to share one matrix across the batch.</param>
+        /// <param name="beta">The value to scale the c matrices.</param>
+        /// <param name="c">The c matrices, stored one after another in column-major order.</param>
+        /// <param name="strideC">The distance between the starts of two consecutive c matrices; at least <paramref name="m"/>*<paramref name="n"/>.</param>
+        /// <param name="batchCount">The number of products to compute.</param>
+        /// <remarks>The products are computed in parallel, one block multiplication per matrix.</remarks>
+        public virtual void MatrixMultiplyBatch(Transpose transposeA, Transpose transposeB, double alpha, int m, int n, int k, double[] a, int strideA, double[] b, int strideB, double beta, double[] c, int strideC, int batchCount)
+        {
+            CheckMatrixMultiplyBatch(m, n, k, a, strideA, b, strideB, c, strideC, batchCount);
+
+            if (batchCount == 0 || m == 0 || n == 0)
+            {
+                return;
+            }
+
+            var leadingDimensionA = Math.Max(1, transposeA == Transpose.DontTranspose ? m : k);
+            var leadingDimensionB = Math.Max(1, transposeB == Transpose.DontTranspose ? k : n);
+
+            CommonParallel.For(0, batchCount, index => MatrixMultiplyWithUpdate(transposeA, transposeB, alpha, m, n, k, a, index * strideA, leadingDimensionA, b, index * strideB, leadingDimensionB, beta, c, index * strideC, m));
+        }
+
+        /// <summary>
+        /// Multiplies a matrix with a vector and updates another vector with the result. <c>y = alpha*op(a)*x + beta*y</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="x">The x vector, of length the number of columns of op(a).</param>
+        /// <param name="beta">The value to scale the <paramref name="y"/> vector.</param>
+        /// <param name="y">The y vector, of length the number of rows of op(a).</param>
+        /// <remarks>This is equivalent to the GEMV BLAS routine.</remarks>
+        public virtual void MatrixVectorMultiply(Transpose transposeA, double alpha, double[] a, int rowsA, int columnsA, double[] x, double beta, double[] y)
+        {
+            CheckMatrixVectorMultiply(transposeA, a, rowsA, columnsA, x, y);
+
+            if (ReferenceEquals(x, y))
+            {
+                x = (double[])x.Clone();
+            }
+
+            if (transposeA == Transpose.DontTranspose)
+            {
+                ScaleVector(beta, y);
+
+                // Walk a column by column, in storage order, adding each scaled column to y.
+                for (var j = 0; j < columnsA; j++)
+                {
+                    var scaled = alpha * x[j];
+                    if (scaled == 0.0)
+                    {
+                        continue;
+                    }
+
+                    var offset = j * rowsA;
+                    for (var i = 0; i < rowsA; i++)
+                    {
+                        y[i] += scaled * a[offset + i];
+                    }
+                }
+            }
+            else
+            {
+                // Each element of y is the dot product of a column of a with x.
+                CommonParallel.For(
+                    0,
+                    columnsA,
+                    j =>
+                    {
+                        var offset = j * rowsA;
+                        var sum = 0.0;
+                        for (var i = 0; i < rowsA; i++)
+                        {
+                            sum += a[offset + i] * x[i];
+                        }
+
+                        y[j] = beta == 0.0 ? alpha * sum : (alpha * sum) + (beta * y[j]);
+                    });
+            }
+        }
+
+        /// <summary>
+        /// Adds the scaled outer product of two vectors to a matrix. <c>a = a + alpha*x*y'</c>
+        /// </summary>
+        /// <param name="alpha">The value to scale the outer product.</param>
+        /// <param name="x">The x vector, of length the number of rows of <paramref name="a"/>.</param>
+        /// <param name="y">The y vector, of length the number of columns of <paramref name="a"/>. It is not conjugated.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <remarks>This is equivalent to the GER BLAS routine.</remarks>
+        public virtual void RankOneUpdate(double alpha, double[] x, double[] y, double[] a)
+        {
+            CheckRankOneUpdate(x, y, a);
+
+            var rows = x.Length;
+            CommonParallel.For(
+                0,
+                y.Length,
+                j =>
+                {
+                    var scaled = alpha * y[j];
+                    var offset = j * rows;
+                    for (var i = 0; i < rows; i++)
+                    {
+                        a[offset + i] += scaled * x[i];
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Multiplies a symmetric matrix with a vector and updates another vector with the result. <c>y = alpha*a*x + beta*y</c>
+        /// </summary>
+        /// <param name="alpha">The value to scale <paramref name="a"/> matrix.</param>
+        /// <param name="a">The symmetric matrix A. Only its lower triangle is read.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="x">The x vector.</param>
+        /// <param name="beta">The value to scale the <paramref name="y"/> vector.</param>
+        /// <param name="y">The y vector.</param>
+        /// <remarks>This is equivalent to the SYMV BLAS routine.</remarks>
+        public virtual void SymmetricMatrixVectorMultiply(double alpha, double[] a, int order, double[] x, double beta, double[] y)
+        {
+            CheckMatrixVectorMultiply(Transpose.DontTranspose, a, order, order, x, y);
+
+            if (ReferenceEquals(x, y))
+            {
+                x = (double[])x.Clone();
+            }
+
+            ScaleVector(beta, y);
+
+            // Each element below the diagonal stands for itself and its mirror image above it.
+            for (var j = 0; j < order; j++)
+            {
+                var offset = j * order;
+                var scaled = alpha * x[j];
+                var sum = 0.0;
+
+                y[j] += scaled * a[offset + j];
+                for (var i = j + 1; i < order; i++)
+                {
+                    y[i] += scaled * a[offset + i];
+                    sum += a[offset + i] * x[i];
+                }
+
+                y[j] += alpha * sum;
+            }
+        }
+
+        /// <summary>
+        /// Adds the scaled product of a matrix with its own transpose to a symmetric matrix. <c>c = alpha*op(a)*op(a)' + beta*c</c>
+        /// </summary>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix. Any value other than
+        /// <see cref="Transpose.DontTranspose"/> computes <c>a'*a</c>; the transpose is never conjugated.</param>
+        /// <param name="alpha">The value to scale the product.</param>
+        /// <param name="a">The a matrix.</param>
+        /// <param name="rowsA">The number of rows in the <paramref name="a"/> matrix.</param>
+        /// <param name="columnsA">The number of columns in the <paramref name="a"/> matrix.</param>
+        /// <param name="beta">The value to scale the <paramref name="c"/> matrix.</param>
+        /// <param name="c">The square c matrix, of order the number of rows of op(a). Only its lower triangle is updated.</param>
+        /// <param name="mirror">If <c>true</c>, the lower triangle is copied to the upper triangle afterwards so that
+        /// <paramref name="c"/> holds the full symmetric matrix.</param>
+        /// <remarks>This is equivalent to the SYRK BLAS routine.</remarks>
+        public virtual void SymmetricRankKUpdate(Transpose transposeA, double alpha, double[] a, int rowsA, int columnsA, double beta, double[] c, bool mirror)
+        {
+            CheckRankKUpdate(transposeA, a, rowsA, columnsA, c);
+
+            if (ReferenceEquals(a, c))
+            {
+                a = (double[])a.Clone();
+            }
+
+            var transposed = transposeA != Transpose.DontTranspose;
+            var order = transposed ? columnsA : rowsA;
+            var k = transposed ? rowsA : columnsA;
+
+            // Each task owns the lower part of one column of c, so the upper triangle is never touched.
+            CommonParallel.For(
+                0,
+                order,
+                j =>
+                {
+                    var offset = j * order;
+                    for (var i = j; i < order; i++)
+                    {
+                        c[offset + i] = beta == 0.0 ? 0.0 : beta * c[offset + i];
+                    }
+
+                    if (transposed)
+                    {
+                        // c[i,j] is the dot product of columns i and j of a.
+                        for (var i = j; i < order; i++)
+                        {
+                            var sum = 0.0;
+                            for (var l = 0; l < k; l++)
+                            {
+                                sum += a[(i * k) + l] * a[(j * k) + l];
+                            }
+
+                            c[offset + i] += alpha * sum;
+                        }
+                    }
+                    else
+                    {
+                        // Walk a column by column, adding the scaled lower part of each column to c.
+                        for (var l = 0; l < k; l++)
+                        {
+                            var column = l * order;
+                            var scaled = alpha * a[column + j];
+                            if (scaled == 0.0)
+                            {
+                                continue;
+                            }
+
+                            for (var i = j; i < order; i++)
+                            {
+                                c[offset + i] += scaled * a[column + i];
+                            }
+                        }
+                    }
+                });
+
+            if (mirror)
+            {
+                MirrorLowerTriangle(c, order);
+            }
+        }
+
+        /// <summary>
+        /// Copies the strictly lower triangle of a square matrix to its upper triangle.
+        /// </summary>
+        /// <param name="c">The square matrix.</param>
+        /// <param name="order">The number of rows and columns in <paramref name="c"/>.</param>
+        private static void MirrorLowerTriangle(double[] c, int order)
+        {
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = j + 1; i < order; i++)
+                {
+                    c[(i * order) + j] = c[(j * order) + i];
+                }
+            }
+        }
+
+        /// <summary>
+        /// Solves a triangular system with many right hand sides in place. <c>op(a)*x = alpha*b</c> or <c>x*op(a) = alpha*b</c>
+        /// </summary>
+        /// <param name="side">Whether the triangular matrix is on the left or the right of x.</param>
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read; the other one is ignored.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="alpha">The value to scale <paramref name="b"/> with.</param>
+        /// <param name="a">The square triangular matrix, of order <paramref name="rowsB"/> on the left or
+        /// <paramref name="columnsB"/> on the right.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="rowsB">The number of rows in the <paramref name="b"/> matrix.</param>
+        /// <param name="columnsB">The number of columns in the <paramref name="b"/> matrix.</param>
+        /// <remarks>This is equivalent to the TRSM BLAS routine.</remarks>
+        public virtual void TriangularSolve(Side side, Triangle triangle, Transpose transposeA, DiagonalType diagonal, double alpha, double[] a, double[] b, int rowsB, int columnsB)
+        {
+            CheckTriangular(side, a, b, rowsB, columnsB);
+
+            bool lower;
+            var order = side == Side.Left ? rowsB : columnsB;
+            var t = ExpandTriangle(triangle, transposeA, diagonal, a, order, out lower);
+
+            if (side == Side.Left)
+            {
+                // Every column of b is an independent system, solved by forward or back substitution.
+                CommonParallel.For(
+                    0,
+                    columnsB,
+                    j =>
+                    {
+                        var offset = j * rowsB;
+                        for (var step = 0; step < order; step++)
+                        {
+                            var i = lower ? step : order - 1 - step;
+                            var sum = alpha * b[offset + i];
+                            var start = lower ? 0 : i + 1;
+                            var end = lower ? i : order;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum -= t[(k * order) + i] * b[offset + k];
+                            }
+
+                            b[offset + i] = sum / t[(i * order) + i];
+                        }
+                    });
+            }
+            else
+            {
+                // Every row of b is an independent system; an upper op(a) is solved from its first column on.
+                CommonParallel.For(
+                    0,
+                    rowsB,
+                    i =>
+                    {
+                        for (var step = 0; step < order; step++)
+                        {
+                            var j = lower ? order - 1 - step : step;
+                            var sum = alpha * b[(j * rowsB) + i];
+                            var start = lower ? j + 1 : 0;
+                            var end = lower ? order : j;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum -= b[(k * rowsB) + i] * t[(j * order) + k];
+                            }
+
+                            b[(j * rowsB) + i] = sum / t[(j * order) + j];
+                        }
+                    });
+            }
+        }
+
+        /// <summary>
+        /// Multiplies a matrix with a triangular matrix in place. <c>b = alpha*op(a)*b</c> or <c>b = alpha*b*op(a)</c>
+        /// </summary>
+        /// <param name="side">Whether the triangular matrix is on the left or the right of b.</param>
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read; the other one is ignored.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="alpha">The value to scale the product with.</param>
+        /// <param name="a">The square triangular matrix, of order <paramref name="rowsB"/> on the left or
+        /// <paramref name="columnsB"/> on the right.</param>
+        /// <param name="b">On entry the B matrix; on exit the product.</param>
+        /// <param name="rowsB">The number of rows in the <paramref name="b"/> matrix.</param>
+        /// <param name="columnsB">The number of columns in the <paramref name="b"/> matrix.</param>
+        /// <remarks>This is equivalent to the TRMM BLAS routine.</remarks>
+        public virtual void TriangularMultiply(Side side, Triangle triangle, Transpose transposeA, DiagonalType diagonal, double alpha, double[] a, double[] b, int rowsB, int columnsB)
+        {
+            CheckTriangular(side, a, b, rowsB, columnsB);
+
+            bool lower;
+            var order = side == Side.Left ? rowsB : columnsB;
+            var t = ExpandTriangle(triangle, transposeA, diagonal, a, order, out lower);
+
+            // Each element is overwritten only after every element it depends on has been read,
+            // so a lower op(a) is applied from the last row (or first column) on.
+            if (side == Side.Left)
+            {
+                CommonParallel.For(
+                    0,
+                    columnsB,
+                    j =>
+                    {
+                        var offset = j * rowsB;
+                        for (var step = 0; step < order; step++)
+                        {
+                            var i = lower ? order - 1 - step : step;
+                            var sum = 0.0;
+                            var start = lower ? 0 : i;
+                            var end = lower ? i + 1 : order;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum += t[(k * order) + i] * b[offset + k];
+                            }
+
+                            b[offset + i] = alpha * sum;
+                        }
+                    });
+            }
+            else
+            {
+                CommonParallel.For(
+                    0,
+                    rowsB,
+                    i =>
+                    {
+                        for (var step = 0; step < order; step++)
+                        {
+                            var j = lower ? step : order - 1 - step;
+                            var sum = 0.0;
+                            var start = lower ? j : 0;
+                            var end = lower ? order : j + 1;
+                            for (var k = start; k < end; k++)
+                            {
+                                sum += b[(k * rowsB) + i] * t[(j * order) + k];
+                            }
+
+                            b[(j * rowsB) + i] = alpha * sum;
+                        }
+                    });
+            }
+        }
+
+        /// <summary>
+        /// Copies op(a) into a new square matrix, with zeros outside its triangle and ones on an implicit unit diagonal.
+        /// </summary>
+        /// <param name="triangle">Which triangle of <paramref name="a"/> is read.</param>
+        /// <param name="transposeA">How to transpose the <paramref name="a"/> matrix.</param>
+        /// <param name="diagonal">Whether <paramref name="a"/> has an implicit unit diagonal.</param>
+        /// <param name="a">The square triangular matrix.</param>
+        /// <param name="order">The number of rows and columns in <paramref name="a"/>.</param>
+        /// <param name="lower">On exit, whether op(a) is lower triangular.</param>
+        /// <returns>The matrix op(a).</returns>
+        private static double[] ExpandTriangle(Triangle triangle, Transpose transposeA, DiagonalType diagonal, double[] a, int order, out bool lower)
+        {
+            var transposed = transposeA != Transpose.DontTranspose;
+            lower = (triangle == Triangle.Lower) != transposed;
+
+            var t = new double[order * order];
+            for (var k = 0; k < order; k++)
+            {
+                var start = lower ? k : 0;
+                var end = lower ? order : k + 1;
+                for (var i = start; i < end; i++)
+                {
+                    t[(k * order) + i] = transposed ? a[(i * order) + k] : a[(k * order) + i];
+                }
+
+                if (diagonal == DiagonalType.Unit)
+                {
+                    t[(k * order) + k] = 1.0;
+                }
+            }
+
+            return t;
+        }
+
+        /// <summary>
+        /// Scales a vector in place, setting it to zero rather than multiplying when <paramref name="beta"/> is zero.
+        /// </summary>
+        /// <param name="beta">The value to scale <paramref name="y"/> by.</param>
+        /// <param name="y">The vector to scale.</param>
+        private static void ScaleVector(double beta, double[] y)
+        {
+            if (beta == 0.0)
+            {
+                Array.Clear(y, 0, y.Length);
+            }
+            else if (beta != 1.0)
+            {
+                for (var i = 0; i < y.Length; i++)
+                {
+                    y[i] *= beta;
+                }
+            }
+        }
+
         /// <summary>
         /// Cache-Oblivious Matrix Multiplication
         /// </summary>
@@ -826,21 +1320,81 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         }
 
         /// <summary>
-        /// Computes the inverse of matrix using LU factorization.
+        /// Computes the LUP factorization of a square block of a larger column-major array. P*A = L*U.
         /// </summary>
-        /// <param name="a">The N by N matrix to invert. Contains the inverse On exit.</param>
-        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
-        /// <remarks>This is equivalent to the GETRF and GETRI LAPACK routines.</remarks>
-        public virtual void LUInverse(double[] a, int order)
+        /// <param name="data">The array holding the matrix. The block is overwritten with the LU factorization on exit,
+        /// in the same layout as <see cref="LUFactor(double[],int,int[])"/>.</param>
+        /// <param name="offset">The index of the first element of the block in <paramref name="data"/>.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns of the block.</param>
+        /// <param name="order">The order of the square block.</param>
+        /// <param name="ipiv">On exit, it contains the pivot indices. The size of the array must be <paramref name="order"/>.</param>
+        /// <remarks>This is equivalent to the GETRF LAPACK routine.</remarks>
+        public virtual void LUFactor(double[] data, int offset, int leadingDimension, int order, int[] ipiv)
         {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
+            CheckBlock(data, offset, leadingDimension, order, order, "data");
 
-            if (a.Length != order * order)
+            if (ipiv == null)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+                throw new ArgumentNullException("ipiv");
+            }
+
+            if (ipiv.Length != order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "ipiv");
+            }
+
+            var block = ExtractBlock(data, offset, leadingDimension, order, order);
+            LUFactor(block, order, ipiv);
+            StoreBlock(block, data, offset, leadingDimension, order, order);
+        }
+
+        /// <summary>
+        /// Computes the LUP factorizations of a batch of equally sized square matrices. P*A = L*U.
+        /// </summary>
+        /// <param name="data">The matrices, stored one after another in column-major order. On exit each one is
+        /// overwritten with its LU factorization.</param>
+        /// <param name="order">The order of each square matrix.</param>
+        /// <param name="stride">The distance between the starts of two consecutive matrices; at least <paramref name="order"/>*<paramref name="order"/>.</param>
+        /// <param name="ipiv">On exit, the pivot indices of the matrices, <paramref name="order"/> entries per matrix.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        /// <remarks>This is equivalent to the GETRF LAPACK routine applied to every matrix of the batch.</remarks>
+        public virtual void LUFactorBatch(double[] data, int order, int stride, int[] ipiv, int batchCount)
+        {
+            CheckBlockBatch(data, order, order, stride, batchCount, "data");
+            CheckPivotBatch(ipiv, order, batchCount);
+
+            if (order == 0 || batchCount == 0)
+            {
+                return;
+            }
+
+            CommonParallel.For(
+                0,
+                batchCount,
+                index =>
+                {
+                    var pivots = new int[order];
+                    LUFactor(data, index * stride, order, order, pivots);
+                    Array.Copy(pivots, 0, ipiv, index * order, order);
+                });
+        }
+
+        /// <summary>
+        /// Computes the inverse of matrix using LU factorization.
+        /// </summary>
+        /// <param name="a">The N by N matrix to invert. Contains the inverse On exit.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <remarks>This is equivalent to the GETRF and GETRI LAPACK routines.</remarks>
+        public virtual void LUInverse(double[] a, int order)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
             }
 
             var ipiv = new int[order];
@@ -1059,6 +1613,218 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
             }
         }
 
+        /// <summary>
+        /// Solves A*X=B for X using a previously factored A, where A and B are blocks of larger column-major arrays.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="a">The array holding the factored A matrix.</param>
+        /// <param name="offsetA">The index of the first element of A in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of A.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">The pivot indices of A.</param>
+        /// <param name="b">The array holding the B matrix. On exit the B block is overwritten with the solution X.</param>
+        /// <param name="offsetB">The index of the first element of B in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of B.</param>
+        /// <remarks>This is equivalent to the GETRS LAPACK routine.</remarks>
+        public virtual void LUSolveFactored(int columnsOfB, double[] a, int offsetA, int leadingDimensionA, int order, int[] ipiv, double[] b, int offsetB, int leadingDimensionB)
+        {
+            CheckBlock(a, offsetA, leadingDimensionA, order, order, "a");
+            CheckBlock(b, offsetB, leadingDimensionB, order, columnsOfB, "b");
+
+            if (ipiv == null)
+            {
+                throw new ArgumentNullException("ipiv");
+            }
+
+            var blockB = ExtractBlock(b, offsetB, leadingDimensionB, order, columnsOfB);
+            LUSolveFactored(columnsOfB, ExtractBlock(a, offsetA, leadingDimensionA, order, order), order, ipiv, blockB);
+            StoreBlock(blockB, b, offsetB, leadingDimensionB, order, columnsOfB);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X for a batch of previously LU factored systems of the same size.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of each B.</param>
+        /// <param name="a">The factored A matrices, stored one after another in column-major order.</param>
+        /// <param name="order">The order of each square matrix A.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive A matrices.</param>
+        /// <param name="ipiv">The pivot indices of the A matrices, <paramref name="order"/> entries per matrix.</param>
+        /// <param name="b">The B matrices, stored one after another in column-major order. On exit each one is overwritten
+        /// with its solution X.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive B matrices.</param>
+        /// <param name="batchCount">The number of systems.</param>
+        /// <remarks>This is equivalent to the GETRS LAPACK routine applied to every system of the batch.</remarks>
+        public virtual void LUSolveFactoredBatch(int columnsOfB, double[] a, int order, int strideA, int[] ipiv, double[] b, int strideB, int batchCount)
+        {
+            CheckBlockBatch(a, order, order, strideA, batchCount, "a");
+            CheckBlockBatch(b, order, columnsOfB, strideB, batchCount, "b");
+            CheckPivotBatch(ipiv, order, batchCount);
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            if (order == 0 || columnsOfB == 0 || batchCount == 0)
+            {
+                return;
+            }
+
+            CommonParallel.For(
+                0,
+                batchCount,
+                index =>
+                {
+                    var pivots = new int[order];
+                    Array.Copy(ipiv, index * order, pivots, 0, order);
+                    LUSolveFactored(columnsOfB, a, index * strideA, order, order, pivots, b, index * strideB, order);
+                });
+        }
+
+        /// <summary>
+        /// Estimates the reciprocal condition number of A from its LU factorization.
+        /// </summary>
+        /// <param name="norm">The norm to measure the condition in: <see cref="Norm.OneNorm"/> or <see cref="Norm.InfinityNorm"/>.</param>
+        /// <param name="factors">The LU factors of A, as computed by <see cref="LUFactor(double[],int,int[])"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="matrixNorm">The <paramref name="norm"/> of A before it was factored.</param>
+        /// <returns>An estimate of 1/(norm(A)*norm(inverse(A))); zero if A is singular.</returns>
+        /// <remarks>This is equivalent to the GECON LAPACK routine. The norm of the inverse is estimated from
+        /// a few solves with the factors, so this costs O(n^2) where forming the inverse costs O(n^3).</remarks>
+        public virtual double LUCondition(Norm norm, double[] factors, int order, double matrixNorm)
+        {
+            CheckCondition(norm, factors, order);
+
+            if (order == 0)
+            {
+                return 1.0;
+            }
+
+            for (var i = 0; i < order; i++)
+            {
+                if (factors[(i * order) + i] == 0.0)
+                {
+                    return 0.0;
+                }
+            }
+
+            // The row interchanges do not change either norm of the inverse, so only L and U are solved with.
+            Action<double[]> solve = x =>
+            {
+                TriangularSolve(Side.Left, Triangle.Lower, Transpose.DontTranspose, DiagonalType.Unit, 1.0, factors, x, order, 1);
+                TriangularSolve(Side.Left, Triangle.Upper, Transpose.DontTranspose, DiagonalType.NonUnit, 1.0, factors, x, order, 1);
+            };
+            Action<double[]> solveTranspose = x =>
+            {
+                TriangularSolve(Side.Left, Triangle.Upper, Transpose.Transpose, DiagonalType.NonUnit, 1.0, factors, x, order, 1);
+                TriangularSolve(Side.Left, Triangle.Lower, Transpose.Transpose, DiagonalType.Unit, 1.0, factors, x, order, 1);
+            };
+
+            // The infinity norm of the inverse is the one norm of its transpose.
+            var inverseNorm = norm == Norm.OneNorm
+                ? EstimateInverseOneNorm(order, solve, solveTranspose)
+                : EstimateInverseOneNorm(order, solveTranspose, solve);
+
+            return matrixNorm == 0.0 ? 0.0 : (1.0 / inverseNorm) / matrixNorm;
+        }
+
+        /// <summary>
+        /// Computes the logarithm of the absolute value of the determinant of A, and its sign, from its LU factorization.
+        /// </summary>
+        /// <param name="factors">The LU factors of A, as computed by <see cref="LUFactor(double[],int,int[])"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">The pivot indices of A.</param>
+        /// <param name="sign">On exit, the sign of the determinant: 1 or -1, or zero if A is singular.</param>
+        /// <returns>The natural logarithm of the absolute value of the determinant; negative infinity if A is singular.</returns>
+        /// <remarks>The determinant is <c>sign*exp(result)</c>. Unlike the product of the pivots, the sum of
+        /// their logarithms does not overflow or underflow for large matrices.</remarks>
+        public virtual double LUDeterminant(double[] factors, int order, int[] ipiv, out double sign)
+        {
+            CheckLUDeterminant(factors, order, ipiv);
+
+            var logAbs = 0.0;
+            sign = 1.0;
+            for (var i = 0; i < order; i++)
+            {
+                var u = factors[(i * order) + i];
+                if (u == 0.0)
+                {
+                    sign = 0.0;
+                    return double.NegativeInfinity;
+                }
+
+                // Every negative pivot and every row interchange flips the sign.
+                if ((u < 0.0) != (ipiv[i] != i))
+                {
+                    sign = -sign;
+                }
+
+                logAbs += Math.Log(Math.Abs(u));
+            }
+
+            return logAbs;
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using an LU factorization computed in single precision, refined
+        /// iteratively with residuals computed in double precision.
+        /// </summary>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="a">The square matrix A.</param>
+        /// <param name="order">The order of the square matrix <paramref name="a"/>.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <returns>The number of refinement iterations, or a negative value if the solve fell back to
+        /// <see cref="LUSolve(int,double[],int,double[])"/>: -2 if A does not fit in single precision,
+        /// -3 if its single precision factorization failed and -31 if the refinement did not converge
+        /// within 30 iterations.</returns>
+        /// <remarks>This is equivalent to the DSGESV LAPACK routine. It pays off for large, well-conditioned
+        /// systems, where the single precision factorization is about twice as fast.</remarks>
+        public virtual int LUSolveMixed(int columnsOfB, double[] a, int order, double[] b)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (a.Length != order * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (b.Length != order * columnsOfB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (ReferenceEquals(a, b))
+            {
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
+            }
+
+            var factor = new float[a.Length];
+            var ipiv = new int[order];
+            var iterations = -2;
+            if (ConvertToSingle(a, factor))
+            {
+                LUFactor(factor, order, ipiv);
+                iterations = IsFactorUsable(factor, order)
+                    ? RefineMixed(a, order, b, columnsOfB, x => LUSolveFactored(columnsOfB, factor, order, ipiv, x))
+                    : -3;
+            }
+
+            if (iterations < 0)
+            {
+                LUSolve(columnsOfB, a, order, b);
+            }
+
+            return iterations;
+        }
+
         /// <summary>
         /// Computes the Cholesky factorization of A.
         /// </summary>
@@ -1110,6 +1876,64 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
             }
         }
 
+        /// <summary>
+        /// Computes the Cholesky factorization of a square block of a larger column-major array.
+        /// </summary>
+        /// <param name="a">The array holding the matrix. On exit the block is overwritten with the lower triangular
+        /// Cholesky factor and its strictly upper triangle is set to zero.</param>
+        /// <param name="offset">The index of the first element of the block in <paramref name="a"/>.</param>
+        /// <param name="leadingDimension">The distance between the starts of two consecutive columns of the block.</param>
+        /// <param name="order">The order of the square block.</param>
+        /// <remarks>This is equivalent to the POTRF LAPACK routine.</remarks>
+        public virtual void CholeskyFactor(double[] a, int offset, int leadingDimension, int order)
+        {
+            CheckBlock(a, offset, leadingDimension, order, order, "a");
+
+            var block = ExtractBlock(a, offset, leadingDimension, order, order);
+            CholeskyFactor(block, order);
+            StoreBlock(block, a, offset, leadingDimension, order, order);
+        }
+
+        /// <summary>
+        /// Computes the Cholesky factorizations of a batch of equally sized symmetric positive definite matrices.
+        /// </summary>
+        /// <param name="a">The matrices, stored one after another in column-major order. On exit each one is
+        /// overwritten with its lower triangular Cholesky factor.</param>
+        /// <param name="order">The order of each square matrix.</param>
+        /// <param name="stride">The distance between the starts of two consecutive matrices; at least <paramref name="order"/>*<paramref name="order"/>.</param>
+        /// <param name="batchCount">The number of matrices.</param>
+        /// <remarks>This is equivalent to the POTRF LAPACK routine applied to every matrix of the batch.</remarks>
+        public virtual void CholeskyFactorBatch(double[] a, int order, int stride, int batchCount)
+        {
+            CheckBlockBatch(a, order, order, stride, batchCount, "a");
+
+            if (order == 0 || batchCount == 0)
+            {
+                return;
+            }
+
+            var failed = false;
+            CommonParallel.For(
+                0,
+                batchCount,
+                index =>
+                {
+                    try
+                    {
+                        CholeskyFactor(a, index * stride, order, order);
+                    }
+                    catch (ArgumentException)
+                    {
+                        failed = true;
+                    }
+                });
+
+            if (failed)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
+            }
+        }
+
         /// <summary>
         /// Calculate Cholesky step
         /// </summary>
@@ -1247,1425 +2071,3898 @@ namespace MathNet.Numerics.Algorithms.LinearAlgebra
         }
 
         /// <summary>
-        /// Computes the QR factorization of A.
+        /// Solves A*X=B for X using a previously Cholesky factored A, where A and B are blocks of larger column-major arrays.
         /// </summary>
-        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
-        /// it is overwritten with the R matrix of the QR factorization. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the
-        /// QR factorization.</param>
-        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
-        /// to be used by the QR solve routine.</param>
-        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
-        public virtual void QRFactor(double[] r, int rowsR, int columnsR, double[] q, double[] tau)
+        /// <param name="a">The array holding the Cholesky factor of A.</param>
+        /// <param name="offsetA">The index of the first element of A in <paramref name="a"/>.</param>
+        /// <param name="leadingDimensionA">The distance between the starts of two consecutive columns of A.</param>
+        /// <param name="orderA">The order of the square matrix A.</param>
+        /// <param name="b">The array holding the B matrix. On exit the B block is overwritten with the solution X.</param>
+        /// <param name="offsetB">The index of the first element of B in <paramref name="b"/>.</param>
+        /// <param name="leadingDimensionB">The distance between the starts of two consecutive columns of B.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <remarks>This is equivalent to the POTRS LAPACK routine.</remarks>
+        public virtual void CholeskySolveFactored(double[] a, int offsetA, int leadingDimensionA, int orderA, double[] b, int offsetB, int leadingDimensionB, int columnsB)
         {
-            if (r == null)
-            {
-                throw new ArgumentNullException("r");
-            }
+            CheckBlock(a, offsetA, leadingDimensionA, orderA, orderA, "a");
+            CheckBlock(b, offsetB, leadingDimensionB, orderA, columnsB, "b");
 
-            if (q == null)
-            {
-                throw new ArgumentNullException("q");
-            }
+            var blockB = ExtractBlock(b, offsetB, leadingDimensionB, orderA, columnsB);
+            CholeskySolveFactored(ExtractBlock(a, offsetA, leadingDimensionA, orderA, orderA), orderA, blockB, columnsB);
+            StoreBlock(blockB, b, offsetB, leadingDimensionB, orderA, columnsB);
+        }
 
-            if (r.Length != rowsR * columnsR)
-            {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
-            }
+        /// <summary>
+        /// Solves A*X=B for X for a batch of previously Cholesky factored systems of the same size.
+        /// </summary>
+        /// <param name="a">The Cholesky factors, stored one after another in column-major order.</param>
+        /// <param name="orderA">The order of each square matrix A.</param>
+        /// <param name="strideA">The distance between the starts of two consecutive factors.</param>
+        /// <param name="b">The B matrices, stored one after another in column-major order. On exit each one is overwritten
+        /// with its solution X.</param>
+        /// <param name="strideB">The distance between the starts of two consecutive B matrices.</param>
+        /// <param name="columnsB">The number of columns of each B.</param>
+        /// <param name="batchCount">The number of systems.</param>
+        /// <remarks>This is equivalent to the POTRS LAPACK routine applied to every system of the batch.</remarks>
+        public virtual void CholeskySolveFactoredBatch(double[] a, int orderA, int strideA, double[] b, int strideB, int columnsB, int batchCount)
+        {
+            CheckBlockBatch(a, orderA, orderA, strideA, batchCount, "a");
+            CheckBlockBatch(b, orderA, columnsB, strideB, batchCount, "b");
 
-            if (tau.Length < Math.Min(rowsR, columnsR))
+            if (ReferenceEquals(a, b))
             {
-                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
             }
 
-            if (q.Length != rowsR * rowsR)
+            if (orderA == 0 || columnsB == 0 || batchCount == 0)
             {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+                return;
             }
 
-            var work = new double[rowsR * rowsR];
-            QRFactor(r, rowsR, columnsR, q, tau, work);
+            CommonParallel.For(
+                0,
+                batchCount,
+                index => CholeskySolveFactored(a, index * strideA, orderA, orderA, b, index * strideB, orderA, columnsB));
         }
 
         /// <summary>
-        /// Computes the QR factorization of A.
+        /// Estimates the reciprocal condition number of A from its Cholesky factorization.
         /// </summary>
-        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
-        /// it is overwritten with the R matrix of the QR factorization. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the 
-        /// QR factorization.</param>
-        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
-        /// to be used by the QR solve routine.</param>
-        /// <param name="work">The work array. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
-        public virtual void QRFactor(double[] r, int rowsR, int columnsR, double[] q, double[] tau, double[] work)
+        /// <param name="factors">The Cholesky factor of A, as computed by <see cref="CholeskyFactor(double[],int)"/>.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="matrixNorm">The one norm of A before it was factored.</param>
+        /// <returns>An estimate of 1/(norm(A)*norm(inverse(A))) in the one norm, which for a symmetric matrix
+        /// equals the infinity norm.</returns>
+        /// <remarks>This is equivalent to the POCON LAPACK routine.</remarks>
+        public virtual double CholeskyCondition(double[] factors, int order, double matrixNorm)
         {
-            if (r == null)
-            {
-                throw new ArgumentNullException("r");
-            }
+            CheckCondition(Norm.OneNorm, factors, order);
 
-            if (q == null)
+            if (order == 0)
             {
-                throw new ArgumentNullException("q");
+                return 1.0;
             }
 
-            if (work == null)
-            {
-                throw new ArgumentNullException("q");
-            }
+            // A is symmetric, so the same solve serves for its transpose.
+            Action<double[]> solve = x => CholeskySolveFactored(factors, order, x, 1);
+            var inverseNorm = EstimateInverseOneNorm(order, solve, solve);
 
-            if (r.Length != rowsR * columnsR)
-            {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
-            }
+            return matrixNorm == 0.0 ? 0.0 : (1.0 / inverseNorm) / matrixNorm;
+        }
 
-            if (tau.Length < Math.Min(rowsR, columnsR))
-            {
-                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
-            }
+        /// <summary>
+        /// Computes the Bunch-Kaufman LDL' factorization of a symmetric, possibly indefinite matrix A.
+        /// </summary>
+        /// <param name="a">On entry, the symmetric matrix A; only its lower triangle is referenced. On exit, the lower
+        /// triangle holds the unit lower triangular factor L below the block diagonal matrix D.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="ipiv">On exit, the pivot indices. A non-negative <c>ipiv[k]</c> means D has a 1 by 1 block at k
+        /// and rows k and <c>ipiv[k]</c> were interchanged. If <c>ipiv[k] = ipiv[k+1]</c> is negative, D has a 2 by 2
+        /// block at k and rows k+1 and <c>~ipiv[k]</c> were interchanged.</param>
+        /// <remarks>This is equivalent to the SYTRF LAPACK routine.</remarks>
+        public virtual void LDLTFactor(double[] a, int order, int[] ipiv)
+        {
+            CheckLDLTFactor(a, order, ipiv);
 
-            if (q.Length != rowsR * rowsR)
-            {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
-            }
+            // Bunch-Kaufman threshold, which bounds the element growth of the factorization.
+            var alpha = (1.0 + Math.Sqrt(17.0)) / 8.0;
 
-            if (work.Length < rowsR * rowsR)
+            var k = 0;
+            while (k < order)
             {
-                work[0] = rowsR * rowsR;
-                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
-            }
+                var kstep = 1;
+                var kp = k;
+                var absakk = Math.Abs(a[(k * order) + k]);
 
-            CommonParallel.For(0, rowsR, i => q[(i * rowsR) + i] = 1.0);
+                // Largest off-diagonal element in column k.
+                var imax = k;
+                var colmax = 0.0;
+                for (var i = k + 1; i < order; i++)
+                {
+                    var abs = Math.Abs(a[(k * order) + i]);
+                    if (abs > colmax)
+                    {
+                        colmax = abs;
+                        imax = i;
+                    }
+                }
 
-            var minmn = Math.Min(rowsR, columnsR);
-            for (var i = 0; i < minmn; i++)
-            {
-                GenerateColumn(work, r, rowsR, i, i);
-                ComputeQR(work, i, r, i, rowsR, i + 1, columnsR, Control.NumberOfParallelWorkerThreads);
-            }
+                if (Math.Max(absakk, colmax) == 0.0)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixNotSingular);
+                }
 
-            for (var i = minmn - 1; i >= 0; i--)
-            {
-                ComputeQR(work, i, q, i, rowsR, i, rowsR, Control.NumberOfParallelWorkerThreads);
-            }
+                if (absakk < alpha * colmax)
+                {
+                    // Largest off-diagonal element in row imax of the trailing matrix.
+                    var rowmax = 0.0;
+                    for (var j = k; j < imax; j++)
+                    {
+                        rowmax = Math.Max(rowmax, Math.Abs(a[(j * order) + imax]));
+                    }
 
-            work[0] = rowsR * rowsR;
-        }
+                    for (var i = imax + 1; i < order; i++)
+                    {
+                        rowmax = Math.Max(rowmax, Math.Abs(a[(imax * order) + i]));
+                    }
 
-        #region QR Factor Helper functions
+                    if (absakk * rowmax < alpha * colmax * colmax)
+                    {
+                        kp = imax;
+                        if (Math.Abs(a[(imax * order) + imax]) < alpha * rowmax)
+                        {
+                            kstep = 2;
+                        }
+                    }
+                }
 
-        /// <summary>
-        /// Perform calculation of Q or R
-        /// </summary>
-        /// <param name="work">Work array</param>
-        /// <param name="workIndex">Index of column in work array</param>
-        /// <param name="a">Q or R matrices</param>
-        /// <param name="rowStart">The first row in </param>
-        /// <param name="rowCount">The last row</param>
-        /// <param name="columnStart">The first column</param>
-        /// <param name="columnCount">The last column</param>
-        /// <param name="availableCores">Number of available CPUs</param>
-        private static void ComputeQR(double[] work, int workIndex, double[] a, int rowStart, int rowCount, int columnStart, int columnCount, int availableCores)
-        {
-            if (rowStart > rowCount || columnStart > columnCount)
-            {
-                return;
-            }
+                // Interchange rows and columns kk and kp of the trailing matrix.
+                var kk = k + kstep - 1;
+                if (kp != kk)
+                {
+                    double temp;
+                    for (var i = kp + 1; i < order; i++)
+                    {
+                        temp = a[(kk * order) + i];
+                        a[(kk * order) + i] = a[(kp * order) + i];
+                        a[(kp * order) + i] = temp;
+                    }
 
-            var tmpColCount = columnCount - columnStart;
+                    for (var j = kk + 1; j < kp; j++)
+                    {
+                        temp = a[(kk * order) + j];
+                        a[(kk * order) + j] = a[(j * order) + kp];
+                        a[(j * order) + kp] = temp;
+                    }
 
-            if ((availableCores > 1) && (tmpColCount > 200))
-            {
-                var tmpSplit = columnStart + (tmpColCount / 2);
-                var tmpCores = availableCores / 2;
+                    temp = a[(kk * order) + kk];
+                    a[(kk * order) + kk] = a[(kp * order) + kp];
+                    a[(kp * order) + kp] = temp;
 
-                CommonParallel.Invoke(
-                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, columnStart, tmpSplit, tmpCores),
-                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, tmpSplit, columnCount, tmpCores));
-            }
-            else
-            {
-                for (var j = columnStart; j < columnCount; j++)
+                    if (kstep == 2)
+                    {
+                        temp = a[(k * order) + k + 1];
+                        a[(k * order) + k + 1] = a[(k * order) + kp];
+                        a[(k * order) + kp] = temp;
+                    }
+                }
+
+                if (kstep == 1)
                 {
-                    var scale = 0.0;
-                    for (var i = rowStart; i < rowCount; i++)     
+                    // A := A - L(k)*D(k)*L(k)' with L(k) = A(k+1:n,k)/D(k).
+                    var d11 = 1.0 / a[(k * order) + k];
+                    for (var j = k + 1; j < order; j++)
                     {
-                        scale += work[(workIndex * rowCount) + i - rowStart] * a[(j * rowCount) + i];
+                        var scale = d11 * a[(k * order) + j];
+                        for (var i = j; i < order; i++)
+                        {
+                            a[(j * order) + i] -= a[(k * order) + i] * scale;
+                        }
                     }
-                
-                    for (var i = rowStart; i < rowCount; i++)    
+
+                    for (var i = k + 1; i < order; i++)
                     {
-                        a[(j * rowCount) + i] -= work[(workIndex * rowCount) + i - rowStart] * scale;
+                        a[(k * order) + i] *= d11;
+                    }
+
+                    ipiv[k] = kp;
+                }
+                else
+                {
+                    // A := A - [L(k) L(k+1)]*D(k)*[L(k) L(k+1)]' with [L(k) L(k+1)] = A(k+2:n,k:k+1)*inverse(D(k)).
+                    if (k < order - 2)
+                    {
+                        var d21 = a[(k * order) + k + 1];
+                        var d11 = a[((k + 1) * order) + k + 1] / d21;
+                        var d22 = a[(k * order) + k] / d21;
+                        d21 = (1.0 / ((d11 * d22) - 1.0)) / d21;
+
+                        for (var j = k + 2; j < order; j++)
+                        {
+                            var wk = d21 * ((d11 * a[(k * order) + j]) - a[((k + 1) * order) + j]);
+                            var wkp1 = d21 * ((d22 * a[((k + 1) * order) + j]) - a[(k * order) + j]);
+                            for (var i = j; i < order; i++)
+                            {
+                                a[(j * order) + i] -= (a[(k * order) + i] * wk) + (a[((k + 1) * order) + i] * wkp1);
+                            }
+
+                            a[(k * order) + j] = wk;
+                            a[((k + 1) * order) + j] = wkp1;
+                        }
                     }
+
+                    ipiv[k] = ~kp;
+                    ipiv[k + 1] = ~kp;
                 }
+
+                k += kstep;
             }
         }
 
         /// <summary>
-        /// Generate column from initial matrix to work array
+        /// Solves A*X=B for X using the Bunch-Kaufman LDL' factorization of a symmetric, possibly indefinite A.
         /// </summary>
-        /// <param name="work">Work array</param>
-        /// <param name="a">Initial matrix</param>
-        /// <param name="rowCount">The number of rows in matrix</param>
-        /// <param name="row">The first row</param>
-        /// <param name="column">Column index</param>
-        private static void GenerateColumn(double[] work, double[] a, int rowCount, int row, int column)
+        /// <param name="a">The symmetric matrix A; only its lower triangle is referenced. It is left unchanged.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the SYSV LAPACK routine.</remarks>
+        public virtual void LDLTSolve(double[] a, int orderA, double[] b, int columnsB)
         {
-            var tmp = column * rowCount;
-            var index = tmp + row;
+            CheckLDLTSolve(a, orderA, b, columnsB);
+
+            var clone = new double[a.Length];
+            Buffer.BlockCopy(a, 0, clone, 0, a.Length * Constants.SizeOfDouble);
+            var ipiv = new int[orderA];
+            LDLTFactor(clone, orderA, ipiv);
+            LDLTSolveFactored(clone, orderA, ipiv, b, columnsB);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously computed Bunch-Kaufman LDL' factorization of A.
+        /// </summary>
+        /// <param name="a">The factored A, as computed by <see cref="LDLTFactor(double[],int,int[])"/>.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="ipiv">The pivot indices of the factorization.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the SYTRS LAPACK routine.</remarks>
+        public virtual void LDLTSolveFactored(double[] a, int orderA, int[] ipiv, double[] b, int columnsB)
+        {
+            CheckLDLTFactor(a, orderA, ipiv);
+            CheckLDLTSolve(a, orderA, b, columnsB);
 
             CommonParallel.For(
-                row,
-                rowCount,
-                i =>
+                0,
+                columnsB,
+                c =>
                 {
-                    var iIndex = tmp + i;
-                    work[iIndex - row] = a[iIndex];
-                    a[iIndex] = 0.0;
-                });
+                    var cindex = c * orderA;
+                    double temp;
 
-            var norm = 0.0;
-            for (var i = 0; i < rowCount - row; ++i)
-            {
-                var iindex = tmp + i;
-                norm += work[iindex] * work[iindex];
-            }
+                    // Solve L*D*Y = P*B, one block of D at a time.
+                    var k = 0;
+                    while (k < orderA)
+                    {
+                        if (ipiv[k] >= 0)
+                        {
+                            var kp = ipiv[k];
+                            temp = b[cindex + k];
+                            b[cindex + k] = b[cindex + kp];
+                            b[cindex + kp] = temp;
 
-            norm = Math.Sqrt(norm);
-            if (row == rowCount - 1  || norm == 0)
-            {
-                a[index] = -work[tmp];
-                work[tmp] = Math.Sqrt(2.0);
-                return;
-            }
+                            for (var i = k + 1; i < orderA; i++)
+                            {
+                                b[cindex + i] -= a[(k * orderA) + i] * b[cindex + k];
+                            }
 
-            var scale = 1.0 / norm;
-            if (work[tmp] < 0.0)
-            {
-                scale *= -1.0;
-            }
+                            b[cindex + k] /= a[(k * orderA) + k];
+                            k++;
+                        }
+                        else
+                        {
+                            var kp = ~ipiv[k];
+                            temp = b[cindex + k + 1];
+                            b[cindex + k + 1] = b[cindex + kp];
+                            b[cindex + kp] = temp;
 
-            a[index] = -1.0 / scale;
-            CommonParallel.For(0, rowCount - row, i => work[tmp + i] *= scale);
-            work[tmp] += 1.0;
+                            for (var i = k + 2; i < orderA; i++)
+                            {
+                                b[cindex + i] -= (a[(k * orderA) + i] * b[cindex + k]) + (a[((k + 1) * orderA) + i] * b[cindex + k + 1]);
+                            }
 
-            var s = Math.Sqrt(1.0 / work[tmp]);
-            CommonParallel.For(0, rowCount - row, i => work[tmp + i] *= s);
-        }
+                            var akm1k = a[(k * orderA) + k + 1];
+                            var akm1 = a[(k * orderA) + k] / akm1k;
+                            var ak = a[((k + 1) * orderA) + k + 1] / akm1k;
+                            var denom = (akm1 * ak) - 1.0;
+                            var bkm1 = b[cindex + k] / akm1k;
+                            var bk = b[cindex + k + 1] / akm1k;
+                            b[cindex + k] = ((ak * bkm1) - bk) / denom;
+                            b[cindex + k + 1] = ((akm1 * bk) - bkm1) / denom;
+                            k += 2;
+                        }
+                    }
 
-        #endregion
+                    // Solve L'*P'*X = Y, from the last block back to the first.
+                    k = orderA - 1;
+                    while (k >= 0)
+                    {
+                        var first = ipiv[k] >= 0 ? k : k - 1;
+                        for (var j = first; j <= k; j++)
+                        {
+                            var sum = b[cindex + j];
+                            for (var i = k + 1; i < orderA; i++)
+                            {
+                                sum -= a[(j * orderA) + i] * b[cindex + i];
+                            }
+
+                            b[cindex + j] = sum;
+                        }
+
+                        var kp = ipiv[k] >= 0 ? ipiv[k] : ~ipiv[k];
+                        temp = b[cindex + k];
+                        b[cindex + k] = b[cindex + kp];
+                        b[cindex + kp] = temp;
+                        k = first - 1;
+                    }
+                });
+        }
 
         /// <summary>
-        /// Solves A*X=B for X using QR factorization of A.
+        /// Solves A*X=B for X, where A is a square band matrix, using an LU factorization with partial pivoting.
         /// </summary>
-        /// <param name="a">The A matrix.</param>
-        /// <param name="rows">The number of rows in the A matrix.</param>
-        /// <param name="columns">The number of columns in the A matrix.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolve(double[] a, int rows, int columns, double[] b, int columnsB, double[] x)
+        /// <param name="ab">The band matrix A in LAPACK band storage: A(i,j) is at <c>ab[j*(kl+ku+1) + ku + i - j]</c>
+        /// for <c>max(0, j-ku) &lt;= i &lt;= min(order-1, j+kl)</c>. It is left unchanged.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="lowerBandwidth">The number of subdiagonals, kl.</param>
+        /// <param name="upperBandwidth">The number of superdiagonals, ku.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the GBSV LAPACK routine. It takes O(order*kl*(kl+ku)) time and
+        /// O(order*(2*kl+ku)) memory.</remarks>
+        public virtual void BandLUSolve(double[] ab, int order, int lowerBandwidth, int upperBandwidth, double[] b, int columnsB)
         {
-            if (a == null)
+            CheckBandSolve(ab, order, lowerBandwidth, upperBandwidth, b, columnsB);
+
+            // Copy A into a work array with kl extra rows above the band for the fill-in of the row interchanges.
+            var kl = lowerBandwidth;
+            var ku = upperBandwidth;
+            var kv = kl + ku;
+            var ld = kv + 1;
+            var ldwork = kv + kl + 1;
+            var work = new double[ldwork * order];
+            for (var j = 0; j < order; j++)
             {
-                throw new ArgumentNullException("a");
+                Array.Copy(ab, j * ld, work, (j * ldwork) + kl, ld);
             }
 
-            if (b == null)
+            // A(i,j) is at work[(j * ldwork) + kv + i - j].
+            var ipiv = new int[order];
+            var ju = 0;
+            for (var j = 0; j < order; j++)
             {
-                throw new ArgumentNullException("b");
-            }
+                var km = Math.Min(kl, order - 1 - j);
+                var diagonal = (j * ldwork) + kv;
 
-            if (x == null)
-            {
-                throw new ArgumentNullException("x");
-            }
+                var jp = j;
+                var max = Math.Abs(work[diagonal]);
+                for (var i = j + 1; i <= j + km; i++)
+                {
+                    var abs = Math.Abs(work[diagonal + i - j]);
+                    if (abs > max)
+                    {
+                        max = abs;
+                        jp = i;
+                    }
+                }
 
-            if (a.Length != rows * columns)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
-            }
+                if (max == 0.0)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixNotSingular);
+                }
 
-            if (b.Length != rows * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                ipiv[j] = jp;
+                ju = Math.Max(ju, Math.Min(jp + ku, order - 1));
 
-            if (x.Length != columns * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
-            }
+                if (jp != j)
+                {
+                    for (var c = j; c <= ju; c++)
+                    {
+                        var temp = work[(c * ldwork) + kv + j - c];
+                        work[(c * ldwork) + kv + j - c] = work[(c * ldwork) + kv + jp - c];
+                        work[(c * ldwork) + kv + jp - c] = temp;
+                    }
+                }
 
-            if (rows < columns)
-            {
-                throw new ArgumentException(Resources.RowsLessThanColumns);
+                var pivot = work[diagonal];
+                for (var i = j + 1; i <= j + km; i++)
+                {
+                    work[diagonal + i - j] /= pivot;
+                }
+
+                for (var c = j + 1; c <= ju; c++)
+                {
+                    var scale = work[(c * ldwork) + kv + j - c];
+                    if (scale == 0.0)
+                    {
+                        continue;
+                    }
+
+                    for (var i = j + 1; i <= j + km; i++)
+                    {
+                        work[(c * ldwork) + kv + i - c] -= work[diagonal + i - j] * scale;
+                    }
+                }
             }
 
-            var work = new double[rows * rows];
-            QRSolve(a, rows, columns, b, columnsB, x, work);
+            CommonParallel.For(
+                0,
+                columnsB,
+                c =>
+                {
+                    var cindex = c * order;
+
+                    // Solve L*Y = P*B, applying the interchanges in the order they were made.
+                    for (var j = 0; j < order; j++)
+                    {
+                        var jp = ipiv[j];
+                        var temp = b[cindex + j];
+                        b[cindex + j] = b[cindex + jp];
+                        b[cindex + jp] = temp;
+
+                        var km = Math.Min(kl, order - 1 - j);
+                        for (var i = j + 1; i <= j + km; i++)
+                        {
+                            b[cindex + i] -= work[(j * ldwork) + kv + i - j] * b[cindex + j];
+                        }
+                    }
+
+                    // Solve U*X = Y; U has kl + ku superdiagonals.
+                    for (var j = order - 1; j >= 0; j--)
+                    {
+                        b[cindex + j] /= work[(j * ldwork) + kv];
+                        for (var i = Math.Max(0, j - kv); i < j; i++)
+                        {
+                            b[cindex + i] -= work[(j * ldwork) + kv + i - j] * b[cindex + j];
+                        }
+                    }
+                });
         }
 
         /// <summary>
-        /// Solves A*X=B for X using QR factorization of A.
+        /// Solves A*X=B for X, where A is a symmetric positive definite band matrix, using a Cholesky factorization.
         /// </summary>
-        /// <param name="a">The A matrix.</param>
-        /// <param name="rows">The number of rows in the A matrix.</param>
-        /// <param name="columns">The number of columns in the A matrix.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <param name="work">The work array. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolve(double[] a, int rows, int columns, double[] b, int columnsB, double[] x, double[] work)
+        /// <param name="ab">The lower triangle of the band matrix A in LAPACK band storage: A(i,j) is at
+        /// <c>ab[j*(kd+1) + i - j]</c> for <c>j &lt;= i &lt;= min(order-1, j+kd)</c>. It is left unchanged.</param>
+        /// <param name="order">The order of the square matrix A.</param>
+        /// <param name="bandwidth">The number of subdiagonals, kd.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the PBSV LAPACK routine. It takes O(order*kd*kd) time and
+        /// O(order*kd) memory.</remarks>
+        public virtual void BandCholeskySolve(double[] ab, int order, int bandwidth, double[] b, int columnsB)
         {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
-
-            if (b == null)
-            {
-                throw new ArgumentNullException("b");
-            }
+            CheckBandSolve(ab, order, bandwidth, 0, b, columnsB);
 
-            if (x == null)
-            {
-                throw new ArgumentNullException("x");
-            }
+            var kd = bandwidth;
+            var ld = kd + 1;
+            var factor = new double[ab.Length];
+            Array.Copy(ab, 0, factor, 0, ab.Length);
 
-            if (work == null)
+            // L(i,j) is at factor[(j * ld) + i - j].
+            for (var j = 0; j < order; j++)
             {
-                throw new ArgumentNullException("work");
-            }
+                var ajj = factor[j * ld];
+                if (ajj <= 0.0)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
+                }
 
-            if (a.Length != rows * columns)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
-            }
+                ajj = Math.Sqrt(ajj);
+                factor[j * ld] = ajj;
 
-            if (b.Length != rows * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                var kn = Math.Min(kd, order - 1 - j);
+                for (var i = 1; i <= kn; i++)
+                {
+                    factor[(j * ld) + i] /= ajj;
+                }
 
-            if (x.Length != columns * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
+                for (var c = 1; c <= kn; c++)
+                {
+                    var scale = factor[(j * ld) + c];
+                    for (var i = c; i <= kn; i++)
+                    {
+                        factor[((j + c) * ld) + i - c] -= factor[(j * ld) + i] * scale;
+                    }
+                }
             }
 
-            if (rows < columns)
-            {
-                throw new ArgumentException(Resources.RowsLessThanColumns);
-            }
+            CommonParallel.For(
+                0,
+                columnsB,
+                c =>
+                {
+                    var cindex = c * order;
 
-            if (work.Length < rows * rows)
-            {
-                work[0] = rows * rows;
-                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
-            }
+                    // Solve L*Y = B.
+                    for (var j = 0; j < order; j++)
+                    {
+                        b[cindex + j] /= factor[j * ld];
+                        var kn = Math.Min(kd, order - 1 - j);
+                        for (var i = 1; i <= kn; i++)
+                        {
+                            b[cindex + j + i] -= factor[(j * ld) + i] * b[cindex + j];
+                        }
+                    }
 
-            var clone = new double[a.Length];
-            Buffer.BlockCopy(a, 0, clone, 0, a.Length * Constants.SizeOfDouble);
-            var q = new double[rows * rows];
-            QRFactor(clone, rows, columns, q, work);
-            QRSolveFactored(q, clone, rows, columns, null, b, columnsB, x);
+                    // Solve L'*X = Y.
+                    for (var j = order - 1; j >= 0; j--)
+                    {
+                        var sum = b[cindex + j];
+                        var kn = Math.Min(kd, order - 1 - j);
+                        for (var i = 1; i <= kn; i++)
+                        {
+                            sum -= factor[(j * ld) + i] * b[cindex + j + i];
+                        }
 
-            work[0] = rows * rows;
+                        b[cindex + j] = sum / factor[j * ld];
+                    }
+                });
         }
 
         /// <summary>
-        /// Solves A*X=B for X using a previously QR factored matrix.
+        /// Solves A*X=B for X, where A is a tridiagonal matrix, using Gaussian elimination with partial pivoting.
         /// </summary>
-        /// <param name="q">The Q matrix obtained by QR factor. This is only used for the managed provider and can be
-        /// <c>null</c> for the native provider. The native provider uses the Q portion stored in the R matrix.</param>
-        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(double[],int,int,double[],double[])"/>. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="tau">Contains additional information on Q. Only used for the native solver
-        /// and can be <c>null</c> for the managed provider.</param>
+        /// <param name="subdiagonal">The order-1 subdiagonal elements, A(i+1,i). It is left unchanged.</param>
+        /// <param name="diagonal">The order diagonal elements, A(i,i). It is left unchanged.</param>
+        /// <param name="superdiagonal">The order-1 superdiagonal elements, A(i,i+1). It is left unchanged.</param>
         /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <param name="work">The work array - only used in the native provider. The array must have a length of at least N,
-        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
-        /// work size value.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolveFactored(double[] q, double[] r, int rowsR, int columnsR, double[] tau, double[] b, int columnsB, double[] x, double[] work)
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the GTSV LAPACK routine. It takes O(order*columnsB) time.</remarks>
+        public virtual void TridiagonalSolve(double[] subdiagonal, double[] diagonal, double[] superdiagonal, double[] b, int columnsB)
         {
-            QRSolveFactored(q, r, rowsR, columnsR, tau, b, columnsB, x);
+            if (diagonal == null)
+            {
+                throw new ArgumentNullException("diagonal");
+            }
+
+            CheckTridiagonalSolve(subdiagonal, diagonal, superdiagonal, b, diagonal.Length, columnsB, 1);
+
+            if (!TridiagonalSolveSystem(subdiagonal, diagonal, superdiagonal, b, diagonal.Length, columnsB, 0, true))
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixNotSingular);
+            }
         }
 
         /// <summary>
-        /// Solves A*X=B for X using a previously QR factored matrix.
+        /// Solves A_k*X_k=B_k for X_k for a batch of tridiagonal matrices A_k of the same order, using Gaussian
+        /// elimination with partial pivoting.
         /// </summary>
-        /// <param name="q">The Q matrix obtained by calling <see cref="QRFactor(double[],int,int,double[],double[])"/>.</param>
-        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(double[],int,int,double[],double[])"/>. </param>
-        /// <param name="rowsR">The number of rows in the A matrix.</param>
-        /// <param name="columnsR">The number of columns in the A matrix.</param>
-        /// <param name="tau">Contains additional information on Q. Only used for the native solver
-        /// and can be <c>null</c> for the managed provider.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        /// <remarks>Rows must be greater or equal to columns.</remarks>
-        public virtual void QRSolveFactored(double[] q, double[] r, int rowsR, int columnsR, double[] tau, double[] b, int columnsB, double[] x)
+        /// <param name="subdiagonal">The subdiagonals of the systems one after the other: system k starts at
+        /// <c>k*(order-1)</c>. It is left unchanged.</param>
+        /// <param name="diagonal">The diagonals of the systems one after the other: system k starts at
+        /// <c>k*order</c>. It is left unchanged.</param>
+        /// <param name="superdiagonal">The superdiagonals of the systems one after the other: system k starts at
+        /// <c>k*(order-1)</c>. It is left unchanged.</param>
+        /// <param name="b">On entry the B matrices one after the other, B_k starting at <c>k*order*columnsB</c>;
+        /// on exit the X matrices.</param>
+        /// <param name="order">The order of each system.</param>
+        /// <param name="columnsB">The number of columns in each B matrix.</param>
+        /// <param name="count">The number of systems.</param>
+        /// <remarks>This is equivalent to calling the GTSV LAPACK routine on each system. The systems are
+        /// solved in parallel. A singular system does not stop the others from being solved; its B matrix is left
+        /// unchanged and an <see cref="ArgumentException"/> naming the first singular system is thrown at the end.</remarks>
+        public virtual void TridiagonalSolveBatch(double[] subdiagonal, double[] diagonal, double[] superdiagonal, double[] b, int order, int columnsB, int count)
         {
-            if (r == null)
-            {
-                throw new ArgumentNullException("r");
-            }
+            CheckTridiagonalSolve(subdiagonal, diagonal, superdiagonal, b, order, columnsB, count);
 
-            if (q == null)
-            {
-                throw new ArgumentNullException("q");
-            }
+            // Record the first singular system instead of throwing inside the parallel loop, so the others are
+            // still solved and the caller sees an ArgumentException.
+            var singular = count;
+            var sync = new object();
+            CommonParallel.For(
+                0,
+                count,
+                k =>
+                {
+                    if (!TridiagonalSolveSystem(subdiagonal, diagonal, superdiagonal, b, order, columnsB, k, false))
+                    {
+                        lock (sync)
+                        {
+                            if (k < singular)
+                            {
+                                singular = k;
+                            }
+                        }
+                    }
+                });
 
-            if (b == null)
+            if (singular < count)
             {
-                throw new ArgumentNullException("q");
+                throw new ArgumentException(string.Format(Resources.ArgumentMatrixNotSingularInBatch, singular));
             }
+        }
 
-            if (x == null)
+        /// <summary>
+        /// Solves one tridiagonal system of a batch in place of its B matrix, as GTSV does.
+        /// </summary>
+        /// <param name="subdiagonal">The subdiagonals of the batch.</param>
+        /// <param name="diagonal">The diagonals of the batch.</param>
+        /// <param name="superdiagonal">The superdiagonals of the batch.</param>
+        /// <param name="b">The B matrices of the batch.</param>
+        /// <param name="order">The order of each system.</param>
+        /// <param name="columnsB">The number of columns in each B matrix.</param>
+        /// <param name="system">The index of the system to solve.</param>
+        /// <param name="parallel">Whether to solve the columns of B in parallel.</param>
+        /// <returns><c>false</c> if the matrix is singular; otherwise <c>true</c>.</returns>
+        private static bool TridiagonalSolveSystem(double[] subdiagonal, double[] diagonal, double[] superdiagonal, double[] b, int order, int columnsB, int system, bool parallel)
+        {
+            if (order == 0 || columnsB == 0)
             {
-                throw new ArgumentNullException("q");
+                return true;
             }
 
-            if (r.Length != rowsR * columnsR)
+            // Work on copies: dl receives the second superdiagonal created by the row interchanges.
+            var d = new double[order];
+            var dl = new double[order - 1];
+            var du = new double[order - 1];
+            Array.Copy(diagonal, system * order, d, 0, order);
+            Array.Copy(subdiagonal, system * (order - 1), dl, 0, order - 1);
+            Array.Copy(superdiagonal, system * (order - 1), du, 0, order - 1);
+
+            var interchanged = new bool[order - 1];
+            var multipliers = new double[order - 1];
+            for (var i = 0; i < order - 1; i++)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "r");
+                if (Math.Abs(d[i]) >= Math.Abs(dl[i]))
+                {
+                    // No row interchange.
+                    if (d[i] == 0.0)
+                    {
+                        return false;
+                    }
+
+                    multipliers[i] = dl[i] / d[i];
+                    d[i + 1] -= multipliers[i] * du[i];
+                    dl[i] = 0.0;
+                }
+                else
+                {
+                    // Interchange rows i and i+1.
+                    interchanged[i] = true;
+                    multipliers[i] = d[i] / dl[i];
+                    d[i] = dl[i];
+                    var temp = d[i + 1];
+                    d[i + 1] = du[i] - (multipliers[i] * temp);
+                    if (i < order - 2)
+                    {
+                        dl[i] = du[i + 1];
+                        du[i + 1] = -multipliers[i] * dl[i];
+                    }
+                    else
+                    {
+                        dl[i] = 0.0;
+                    }
+
+                    du[i] = temp;
+                }
             }
 
-            if (q.Length != rowsR * rowsR)
+            if (d[order - 1] == 0.0)
             {
-                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+                return false;
             }
 
-            if (b.Length != rowsR * columnsB)
+            Action<int> solve = c =>
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                var cindex = (system * order * columnsB) + (c * order);
 
-            if (x.Length != columnsR * columnsB)
+                // Apply the eliminations and interchanges to B.
+                for (var i = 0; i < order - 1; i++)
+                {
+                    if (interchanged[i])
+                    {
+                        var temp = b[cindex + i];
+                        b[cindex + i] = b[cindex + i + 1];
+                        b[cindex + i + 1] = temp - (multipliers[i] * b[cindex + i + 1]);
+                    }
+                    else
+                    {
+                        b[cindex + i + 1] -= multipliers[i] * b[cindex + i];
+                    }
+                }
+
+                // Back substitution with the upper triangular factor, which has two superdiagonals.
+                b[cindex + order - 1] /= d[order - 1];
+                if (order > 1)
+                {
+                    b[cindex + order - 2] = (b[cindex + order - 2] - (du[order - 2] * b[cindex + order - 1])) / d[order - 2];
+                }
+
+                for (var i = order - 3; i >= 0; i--)
+                {
+                    b[cindex + i] = (b[cindex + i] - (du[i] * b[cindex + i + 1]) - (dl[i] * b[cindex + i + 2])) / d[i];
+                }
+            };
+
+            if (parallel)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
+                CommonParallel.For(0, columnsB, solve);
             }
-
-            if (rowsR < columnsR)
+            else
             {
-                throw new ArgumentException(Resources.RowsLessThanColumns);
+                for (var c = 0; c < columnsB; c++)
+                {
+                    solve(c);
+                }
             }
 
-            var sol = new double[b.Length];
-
-            // Copy B matrix to "sol", so B data will not be changed
-            Buffer.BlockCopy(b, 0, sol, 0, b.Length * Constants.SizeOfDouble);
+            return true;
+        }
 
-            // Compute Y = transpose(Q)*B
-            var column = new double[rowsR];
-            for (var j = 0; j < columnsB; j++)
+        /// <summary>
+        /// Solves A*X=B for X, where A is a symmetric positive definite tridiagonal matrix, using an L*D*L'
+        /// factorization.
+        /// </summary>
+        /// <param name="diagonal">The order diagonal elements, A(i,i). It is left unchanged.</param>
+        /// <param name="subdiagonal">The order-1 subdiagonal elements, A(i+1,i). It is left unchanged.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <remarks>This is equivalent to the PTSV LAPACK routine. It takes O(order*columnsB) time.</remarks>
+        public virtual void PositiveDefiniteTridiagonalSolve(double[] diagonal, double[] subdiagonal, double[] b, int columnsB)
+        {
+            if (diagonal == null)
             {
-                var jm = j * rowsR;
-                CommonParallel.For(0, rowsR, k => column[k] = sol[jm + k]);
-                CommonParallel.For(
-                    0, 
-                    rowsR, 
-                    i =>
-                    {
-                        var im = i * rowsR;
+                throw new ArgumentNullException("diagonal");
+            }
 
-                        var sum = 0.0;
-                        for (var k = 0; k < rowsR; k++)
-                        {
-                            sum += q[im + k] * column[k];
-                        }
+            CheckTridiagonalSolve(subdiagonal, diagonal, subdiagonal, b, diagonal.Length, columnsB, 1);
 
-                        sol[jm + i] = sum;
-                    });
+            var order = diagonal.Length;
+            if (order == 0 || columnsB == 0)
+            {
+                return;
             }
 
-            // Solve R*X = Y;
-            for (var k = columnsR - 1; k >= 0; k--)
+            // A = L*D*L' with L unit lower bidiagonal, as PTTRF computes it.
+            var d = new double[order];
+            var e = new double[order - 1];
+            Array.Copy(diagonal, d, order);
+            Array.Copy(subdiagonal, e, order - 1);
+            for (var i = 0; i < order; i++)
             {
-                var km = k * rowsR;
-                for (var j = 0; j < columnsB; j++)
+                if (d[i] <= 0.0)
                 {
-                    sol[(j * rowsR) + k] /= r[km + k];
+                    throw new ArgumentException(Resources.ArgumentMatrixPositiveDefinite);
                 }
 
-                for (var i = 0; i < k; i++)
+                if (i < order - 1)
                 {
-                    for (var j = 0; j < columnsB; j++)
-                    {
-                        var jm = j * rowsR;
-                        sol[jm + i] -= sol[jm + k] * r[km + i];
-                    }
+                    var ei = e[i];
+                    e[i] = ei / d[i];
+                    d[i + 1] -= e[i] * ei;
                 }
             }
 
-            // Fill result matrix
             CommonParallel.For(
-                0, 
-                columnsR, 
-                row =>
+                0,
+                columnsB,
+                c =>
                 {
-                    for (var col = 0; col < columnsB; col++)
+                    var cindex = c * order;
+
+                    // Solve L*D*Y = B.
+                    for (var i = 1; i < order; i++)
                     {
-                        x[(col * columnsR) + row] = sol[row + (col * rowsR)];
+                        b[cindex + i] -= e[i - 1] * b[cindex + i - 1];
+                    }
+
+                    for (var i = 0; i < order; i++)
+                    {
+                        b[cindex + i] /= d[i];
+                    }
+
+                    // Solve L'*X = Y.
+                    for (var i = order - 2; i >= 0; i--)
+                    {
+                        b[cindex + i] -= e[i] * b[cindex + i + 1];
                     }
                 });
         }
 
         /// <summary>
-        /// Computes the singular value decomposition of A.
+        /// Estimates the one norm of the inverse of a matrix that is only available through solves, by Hager's
+        /// method with Higham's refinements as in the LACN2 LAPACK routine.
         /// </summary>
-        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
-        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
-        /// <param name="rowsA">The number of rows in the A matrix.</param>
-        /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="s">The singular values of A in ascending value.</param>
-        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
-        /// singular vectors.</param>
-        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
-        /// right singular vectors.</param>
-        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
-        public virtual void SingularValueDecomposition(bool computeVectors, double[] a, int rowsA, int columnsA, double[] s, double[] u, double[] vt)
+        /// <param name="order">The order of the matrix.</param>
+        /// <param name="solve">Overwrites a vector x with inverse(A)*x.</param>
+        /// <param name="solveTranspose">Overwrites a vector x with transpose(inverse(A))*x.</param>
+        /// <returns>A lower bound of the one norm of inverse(A), which is almost always within a factor of three of it.</returns>
+        private static double EstimateInverseOneNorm(int order, Action<double[]> solve, Action<double[]> solveTranspose)
         {
-            if (a == null)
+            var x = new double[order];
+            for (var i = 0; i < order; i++)
             {
-                throw new ArgumentNullException("a");
+                x[i] = 1.0 / order;
             }
 
-            if (s == null)
+            var estimate = 0.0;
+            var last = -1;
+            for (var iteration = 0; iteration < 5; iteration++)
             {
-                throw new ArgumentNullException("s");
-            }
+                solve(x);
+                var norm = 0.0;
+                for (var i = 0; i < order; i++)
+                {
+                    norm += Math.Abs(x[i]);
+                }
 
-            if (u == null)
-            {
-                throw new ArgumentNullException("u");
-            }
+                if (norm <= estimate)
+                {
+                    break;
+                }
 
-            if (vt == null)
-            {
-                throw new ArgumentNullException("vt");
-            }
+                estimate = norm;
 
-            if (u.Length != rowsA * rowsA)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+                // The gradient of the norm at x points to the unit vector most likely to increase it.
+                for (var i = 0; i < order; i++)
+                {
+                    x[i] = x[i] >= 0.0 ? 1.0 : -1.0;
+                }
+
+                solveTranspose(x);
+                var next = 0;
+                for (var i = 1; i < order; i++)
+                {
+                    if (Math.Abs(x[i]) > Math.Abs(x[next]))
+                    {
+                        next = i;
+                    }
+                }
+
+                if (next == last)
+                {
+                    break;
+                }
+
+                last = next;
+                Array.Clear(x, 0, order);
+                x[next] = 1.0;
             }
 
-            if (vt.Length != columnsA * columnsA)
+            // Alternating signs of growing size catch the rare matrices the iteration underestimates.
+            for (var i = 0; i < order; i++)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+                x[i] = (i % 2 == 0 ? 1.0 : -1.0) * (1.0 + ((double)i / Math.Max(order - 1, 1)));
             }
 
-            if (s.Length != Math.Min(rowsA, columnsA))
+            solve(x);
+            var alternating = 0.0;
+            for (var i = 0; i < order; i++)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+                alternating += Math.Abs(x[i]);
             }
 
-            var work = new double[rowsA];
-            SingularValueDecomposition(computeVectors, a, rowsA, columnsA, s, u, vt, work);
+            return Math.Max(estimate, 2 * alternating / (3 * order));
         }
 
         /// <summary>
-        /// Computes the singular value decomposition of A.
+        /// Solves A*X=B for X using a Cholesky factorization computed in single precision, refined
+        /// iteratively with residuals computed in double precision.
         /// </summary>
-        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
-        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
-        /// <param name="rowsA">The number of rows in the A matrix.</param>
-        /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="s">The singular values of A in ascending value.</param>
-        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
-        /// singular vectors.</param>
-        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
-        /// right singular vectors.</param>
-        /// <param name="work">The work array. Length should be at least <paramref name="rowsA"/>.</param>
-        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
-        public virtual void SingularValueDecomposition(bool computeVectors, double[] a, int rowsA, int columnsA, double[] s, double[] u, double[] vt, double[] work)
+        /// <param name="a">The square, positive definite matrix A.</param>
+        /// <param name="orderA">The number of rows and columns in A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns in the B matrix.</param>
+        /// <returns>The number of refinement iterations, or a negative value if the solve fell back to
+        /// <see cref="CholeskySolve(double[],int,double[],int)"/>, as for <see cref="LUSolveMixed"/>.</returns>
+        /// <remarks>This is equivalent to the DSPOSV LAPACK routine.</remarks>
+        public virtual int CholeskySolveMixed(double[] a, int orderA, double[] b, int columnsB)
         {
             if (a == null)
             {
                 throw new ArgumentNullException("a");
             }
 
-            if (s == null)
+            if (b == null)
             {
-                throw new ArgumentNullException("s");
+                throw new ArgumentNullException("b");
             }
 
-            if (u == null)
+            if (a.Length != orderA * orderA)
             {
-                throw new ArgumentNullException("u");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
             }
 
-            if (vt == null)
+            if (b.Length != orderA * columnsB)
             {
-                throw new ArgumentNullException("vt");
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
             }
 
-            if (work == null)
+            if (ReferenceEquals(a, b))
             {
-                throw new ArgumentNullException("work");
+                throw new ArgumentException(Resources.ArgumentReferenceDifferent);
             }
 
-            if (u.Length != rowsA * rowsA)
+            var factor = new float[a.Length];
+            var iterations = -2;
+            if (ConvertToSingle(a, factor))
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+                iterations = -3;
+                try
+                {
+                    CholeskyFactor(factor, orderA);
+                    if (IsFactorUsable(factor, orderA))
+                    {
+                        iterations = RefineMixed(a, orderA, b, columnsB, x => CholeskySolveFactored(factor, orderA, x, columnsB));
+                    }
+                }
+                catch (ArgumentException)
+                {
+                    // Not positive definite in single precision; the double precision solve decides.
+                }
             }
 
-            if (vt.Length != columnsA * columnsA)
+            if (iterations < 0)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+                CholeskySolve(a, orderA, b, columnsB);
             }
 
-            if (s.Length != Math.Min(rowsA, columnsA))
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
-            }
+            return iterations;
+        }
 
-            if (work.Length == 0)
+        /// <summary>
+        /// Copies <paramref name="source"/> to single precision.
+        /// </summary>
+        /// <returns><c>false</c> if an element overflows single precision.</returns>
+        private static bool ConvertToSingle(double[] source, float[] target)
+        {
+            for (var i = 0; i < source.Length; i++)
             {
-                throw new ArgumentException(Resources.ArgumentSingleDimensionArray, "work");
-            }
+                if (Math.Abs(source[i]) > float.MaxValue)
+                {
+                    return false;
+                }
 
-            if (work.Length < rowsA)
-            {
-                work[0] = rowsA;
-                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
+                target[i] = (float)source[i];
             }
 
-            const int Maxiter = 1000;
-
-            var e = new double[columnsA];
-            var v = new double[vt.Length];
-            var stemp = new double[Math.Min(rowsA + 1, columnsA)];
-
-            int i, j, l, lp1;
-
-            var cs = 0.0;
-            var sn = 0.0;
-            double t;
-
-            var ncu = rowsA;
-
-            // Reduce matrix to bidiagonal form, storing the diagonal elements
-            // in "s" and the super-diagonal elements in "e".
-            var nct = Math.Min(rowsA - 1, columnsA);
-            var nrt = Math.Max(0, Math.Min(columnsA - 2, rowsA));
-            var lu = Math.Max(nct, nrt);
+            return true;
+        }
 
-            for (l = 0; l < lu; l++)
+        /// <summary>
+        /// Checks that a single precision LU or Cholesky factor is finite with a nonzero diagonal.
+        /// </summary>
+        private static bool IsFactorUsable(float[] factor, int order)
+        {
+            for (var i = 0; i < factor.Length; i++)
             {
-                lp1 = l + 1;
-                if (l < nct)
+                if (float.IsNaN(factor[i]) || float.IsInfinity(factor[i]))
                 {
-                    // Compute the transformation for the l-th column and
-                    // place the l-th diagonal in vector s[l].
-                    var sum = 0.0;
-                    for (var i1 = l; i1 < rowsA; i1++)
-                    {
-                        sum += a[(l * rowsA) + i1] * a[(l * rowsA) + i1];
-                    }
-
-                    stemp[l] = Math.Sqrt(sum);
-
-                    if (stemp[l] != 0.0)
-                    {
-                        if (a[(l * rowsA) + l] != 0.0)
-                        {
-                            stemp[l] = Math.Abs(stemp[l]) * (a[(l * rowsA) + l] / Math.Abs(a[(l * rowsA) + l]));
-                        }
-
-                        // A part of column "l" of Matrix A from row "l" to end multiply by 1.0 / s[l]
-                        for (i = l; i < rowsA; i++)
-                        {
-                            a[(l * rowsA) + i] = a[(l * rowsA) + i] * (1.0 / stemp[l]);
-                        }
-
-                        a[(l * rowsA) + l] = 1.0 + a[(l * rowsA) + l];
-                    }
-
-                    stemp[l] = -stemp[l];
+                    return false;
                 }
+            }
 
-                for (j = lp1; j < columnsA; j++)
+            for (var i = 0; i < order; i++)
+            {
+                if (factor[(i * order) + i] == 0.0f)
                 {
-                    if (l < nct)
-                    {
-                        if (stemp[l] != 0.0)
-                        {
-                            // Apply the transformation.
-                            t = 0.0;
-                            for (i = l; i < rowsA; i++)
-                            {
-                                t += a[(j * rowsA) + i] * a[(l * rowsA) + i];
-                            }
-
-                            t = -t / a[(l * rowsA) + l];
+                    return false;
+                }
+            }
 
-                            for (var ii = l; ii < rowsA; ii++)
-                            {
-                                a[(j * rowsA) + ii] += t * a[(l * rowsA) + ii];
-                            }
-                        }
-                    }
+            return true;
+        }
 
-                    // Place the l-th row of matrix into "e" for the
-                    // subsequent calculation of the row transformation.
-                    e[j] = a[(j * rowsA) + l];
-                }
+        /// <summary>
+        /// Solves A*X=B with a single precision factorization of A and refines X until, in every column,
+        /// the double precision residual is below ||x||_inf * ||A||_inf * eps * sqrt(n), as DSGESV does.
+        /// </summary>
+        /// <param name="a">The square matrix A in double precision.</param>
+        /// <param name="order">The order of A.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix if the refinement converged.</param>
+        /// <param name="columnsOfB">The number of columns of B.</param>
+        /// <param name="solve">Overwrites a right hand side with the solution of the factored system.</param>
+        /// <returns>The number of refinement iterations, or -31 if it did not converge; B is then unchanged.</returns>
+        private int RefineMixed(double[] a, int order, double[] b, int columnsOfB, Action<float[]> solve)
+        {
+            const int MaxIterations = 30;
 
-                if (computeVectors && l < nct)
+            // Infinity norm computed here: the solve must not depend on the provider's MatrixNorm.
+            var normA = 0.0;
+            for (var i = 0; i < order; i++)
+            {
+                var sum = 0.0;
+                for (var j = 0; j < order; j++)
                 {
-                    // Place the transformation in "u" for subsequent back multiplication.
-                    for (i = l; i < rowsA; i++)
-                    {
-                        u[(l * rowsA) + i] = a[(l * rowsA) + i];
-                    }
+                    sum += Math.Abs(a[(j * order) + i]);
                 }
 
-                if (l >= nrt)
-                {
-                    continue;
-                }
+                normA = Math.Max(normA, sum);
+            }
 
-                // Compute the l-th row transformation and place the l-th super-diagonal in e(l).
-                var enorm = 0.0;
-                for (i = lp1; i < e.Length; i++)
+            var tolerance = normA * 2 * Precision.DoubleMachinePrecision * Math.Sqrt(order);
+            var x = new double[b.Length];
+            var residual = new double[b.Length];
+            var correction = new float[b.Length];
+            Buffer.BlockCopy(b, 0, residual, 0, b.Length * Constants.SizeOfDouble);
+
+            for (var iteration = 0; iteration <= MaxIterations; iteration++)
+            {
+                if (!ConvertToSingle(residual, correction))
                 {
-                    enorm += e[i] * e[i];
+                    break;
                 }
 
-                e[l] = Math.Sqrt(enorm);
-                if (e[l] != 0.0)
+                solve(correction);
+                for (var i = 0; i < x.Length; i++)
                 {
-                    if (e[lp1] != 0.0)
-                    {
-                        e[l] = Math.Abs(e[l]) * (e[lp1] / Math.Abs(e[lp1]));
-                    }
-
-                    // Scale vector "e" from "lp1" by 1.0 / e[l]
-                    for (i = lp1; i < e.Length; i++)
-                    {
-                        e[i] = e[i] * (1.0 / e[l]);
-                    }
-
-                    e[lp1] = 1.0 + e[lp1];
+                    x[i] += correction[i];
                 }
 
-                e[l] = -e[l];
+                Buffer.BlockCopy(b, 0, residual, 0, b.Length * Constants.SizeOfDouble);
+                MatrixMultiplyWithUpdate(Transpose.DontTranspose, Transpose.DontTranspose, -1.0, a, order, order, x, order, columnsOfB, 1.0, residual);
 
-                if (lp1 < rowsA && e[l] != 0.0)
+                var converged = true;
+                for (var column = 0; column < columnsOfB && converged; column++)
                 {
-                    // Apply the transformation.
-                    for (i = lp1; i < rowsA; i++)
-                    {
-                        work[i] = 0.0;
-                    }
-
-                    for (j = lp1; j < columnsA; j++)
-                    {
-                        for (var ii = lp1; ii < rowsA; ii++)
-                        {
-                            work[ii] += e[j] * a[(j * rowsA) + ii];
-                        }
-                    }
-
-                    for (j = lp1; j < columnsA; j++)
+                    var normX = 0.0;
+                    var normR = 0.0;
+                    for (var i = column * order; i < (column + 1) * order; i++)
                     {
-                        var ww = -e[j] / e[lp1];
-                        for (var ii = lp1; ii < rowsA; ii++)
-                        {
-                            a[(j * rowsA) + ii] += ww * work[ii];
-                        }
+                        normX = Math.Max(normX, Math.Abs(x[i]));
+                        normR = Math.Max(normR, Math.Abs(residual[i]));
                     }
-                }
 
-                if (!computeVectors)
-                {
-                    continue;
+                    converged = normR < normX * tolerance;
                 }
 
-                // Place the transformation in v for subsequent back multiplication.
-                for (i = lp1; i < columnsA; i++)
+                if (converged)
                 {
-                    v[(l * columnsA) + i] = e[i];
+                    Buffer.BlockCopy(x, 0, b, 0, b.Length * Constants.SizeOfDouble);
+                    return iteration;
                 }
             }
 
-            // Set up the final bidiagonal matrix or order m.
-            var m = Math.Min(columnsA, rowsA + 1);
-            var nctp1 = nct + 1;
-            var nrtp1 = nrt + 1;
-            if (nct < columnsA)
-            {
-                stemp[nctp1 - 1] = a[((nctp1 - 1) * rowsA) + (nctp1 - 1)];
-            }
+            return -(MaxIterations + 1);
+        }
 
-            if (rowsA < m)
+        /// <summary>
+        /// Computes the QR factorization of A.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
+        /// it is overwritten with the R matrix of the QR factorization. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the
+        /// QR factorization.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
+        /// to be used by the QR solve routine.</param>
+        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
+        public virtual void QRFactor(double[] r, int rowsR, int columnsR, double[] q, double[] tau)
+        {
+            if (r == null)
+            {
+                throw new ArgumentNullException("r");
+            }
+
+            if (q == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (r.Length != rowsR * columnsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
+            }
+
+            if (tau.Length < Math.Min(rowsR, columnsR))
+            {
+                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+            }
+
+            if (q.Length != rowsR * rowsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+            }
+
+            var work = new double[rowsR * rowsR];
+            QRFactor(r, rowsR, columnsR, q, tau, work);
+        }
+
+        /// <summary>
+        /// Computes the QR factorization of A.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit,
+        /// it is overwritten with the R matrix of the QR factorization. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="q">On exit, A M by M matrix that holds the Q matrix of the 
+        /// QR factorization.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains additional information
+        /// to be used by the QR solve routine.</param>
+        /// <param name="work">The work array. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>This is similar to the GEQRF and ORGQR LAPACK routines.</remarks>
+        public virtual void QRFactor(double[] r, int rowsR, int columnsR, double[] q, double[] tau, double[] work)
+        {
+            if (r == null)
+            {
+                throw new ArgumentNullException("r");
+            }
+
+            if (q == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (work == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (r.Length != rowsR * columnsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * columnsR"), "r");
+            }
+
+            if (tau.Length < Math.Min(rowsR, columnsR))
+            {
+                throw new ArgumentException(string.Format(Resources.ArrayTooSmall, "min(m,n)"), "tau");
+            }
+
+            if (q.Length != rowsR * rowsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+            }
+
+            if (work.Length < rowsR * rowsR)
+            {
+                work[0] = rowsR * rowsR;
+                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
+            }
+
+            CommonParallel.For(0, rowsR, i => q[(i * rowsR) + i] = 1.0);
+
+            var minmn = Math.Min(rowsR, columnsR);
+            for (var i = 0; i < minmn; i++)
+            {
+                GenerateColumn(work, r, rowsR, i, i);
+                ComputeQR(work, i, r, i, rowsR, i + 1, columnsR, Control.NumberOfParallelWorkerThreads);
+            }
+
+            for (var i = minmn - 1; i >= 0; i--)
+            {
+                ComputeQR(work, i, q, i, rowsR, i, rowsR, Control.NumberOfParallelWorkerThreads);
+            }
+
+            work[0] = rowsR * rowsR;
+        }
+
+        #region QR Factor Helper functions
+
+        /// <summary>
+        /// Perform calculation of Q or R
+        /// </summary>
+        /// <param name="work">Work array</param>
+        /// <param name="workIndex">Index of column in work array</param>
+        /// <param name="a">Q or R matrices</param>
+        /// <param name="rowStart">The first row in </param>
+        /// <param name="rowCount">The last row</param>
+        /// <param name="columnStart">The first column</param>
+        /// <param name="columnCount">The last column</param>
+        /// <param name="availableCores">Number of available CPUs</param>
+        private static void ComputeQR(double[] work, int workIndex, double[] a, int rowStart, int rowCount, int columnStart, int columnCount, int availableCores)
+        {
+            if (rowStart > rowCount || columnStart > columnCount)
+            {
+                return;
+            }
+
+            var tmpColCount = columnCount - columnStart;
+
+            if ((availableCores > 1) && (tmpColCount > 200))
+            {
+                var tmpSplit = columnStart + (tmpColCount / 2);
+                var tmpCores = availableCores / 2;
+
+                CommonParallel.Invoke(
+                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, columnStart, tmpSplit, tmpCores),
+                    () => ComputeQR(work, workIndex, a, rowStart, rowCount, tmpSplit, columnCount, tmpCores));
+            }
+            else
+            {
+                for (var j = columnStart; j < columnCount; j++)
+                {
+                    var scale = 0.0;
+                    for (var i = rowStart; i < rowCount; i++)     
+                    {
+                        scale += work[(workIndex * rowCount) + i - rowStart] * a[(j * rowCount) + i];
+                    }
+                
+                    for (var i = rowStart; i < rowCount; i++)    
+                    {
+                        a[(j * rowCount) + i] -= work[(workIndex * rowCount) + i - rowStart] * scale;
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Generate column from initial matrix to work array
+        /// </summary>
+        /// <param name="work">Work array</param>
+        /// <param name="a">Initial matrix</param>
+        /// <param name="rowCount">The number of rows in matrix</param>
+        /// <param name="row">The first row</param>
+        /// <param name="column">Column index</param>
+        private static void GenerateColumn(double[] work, double[] a, int rowCount, int row, int column)
+        {
+            var tmp = column * rowCount;
+            var index = tmp + row;
+
+            CommonParallel.For(
+                row,
+                rowCount,
+                i =>
+                {
+                    var iIndex = tmp + i;
+                    work[iIndex - row] = a[iIndex];
+                    a[iIndex] = 0.0;
+                });
+
+            var norm = 0.0;
+            for (var i = 0; i < rowCount - row; ++i)
+            {
+                var iindex = tmp + i;
+                norm += work[iindex] * work[iindex];
+            }
+
+            norm = Math.Sqrt(norm);
+            if (row == rowCount - 1  || norm == 0)
+            {
+                a[index] = -work[tmp];
+                work[tmp] = Math.Sqrt(2.0);
+                return;
+            }
+
+            var scale = 1.0 / norm;
+            if (work[tmp] < 0.0)
+            {
+                scale *= -1.0;
+            }
+
+            a[index] = -1.0 / scale;
+            CommonParallel.For(0, rowCount - row, i => work[tmp + i] *= scale);
+            work[tmp] += 1.0;
+
+            var s = Math.Sqrt(1.0 / work[tmp]);
+            CommonParallel.For(0, rowCount - row, i => work[tmp + i] *= s);
+        }
+
+        #endregion
+
+        /// <summary>
+        /// Computes the QR factorization of A without forming Q.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit, the upper triangle
+        /// holds the R matrix and the part below the diagonal the Householder vectors that make up Q.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains the scalar factors of the Householder
+        /// reflectors.</param>
+        /// <remarks>This is equivalent to the GEQRF LAPACK routine. Q is applied with
+        /// <see cref="QRApplyQ"/>, and formed by applying it to the identity.</remarks>
+        public virtual void QRFactor(double[] r, int rowsR, int columnsR, double[] tau)
+        {
+            CheckQRFactor(r, rowsR, columnsR, tau);
+
+            var minmn = Math.Min(rowsR, columnsR);
+            for (var j = 0; j < minmn; j++)
+            {
+                ReduceColumn(r, rowsR, columnsR, j, tau);
+            }
+        }
+
+        /// <summary>
+        /// Computes the column-pivoted QR factorization A*P = Q*R without forming Q, and the numerical rank of A.
+        /// </summary>
+        /// <param name="r">On entry, it is the M by N A matrix to factor. On exit, the upper triangle
+        /// holds the R matrix and the part below the diagonal the Householder vectors that make up Q.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">A min(m,n) vector. On exit, contains the scalar factors of the Householder
+        /// reflectors.</param>
+        /// <param name="pivots">An N vector. On exit, column j of A*P is column <c>pivots[j]</c> of A.</param>
+        /// <returns>The numerical rank: the number of leading diagonal entries of R larger than
+        /// max(m,n) times the machine epsilon times the magnitude of the first.</returns>
+        /// <remarks>This is equivalent to the GEQP3 LAPACK routine. The diagonal of R is non-increasing
+        /// in magnitude, and Q is applied with <see cref="QRApplyQ"/> as for an unpivoted factorization.</remarks>
+        public virtual int QRFactorPivoted(double[] r, int rowsR, int columnsR, double[] tau, int[] pivots)
+        {
+            CheckQRFactorPivoted(r, rowsR, columnsR, tau, pivots);
+
+            // Norms of the columns below the rows reduced so far. They are downdated after every step
+            // and recomputed once cancellation has eaten too many of their digits, as GEQP3 does.
+            var norms = new double[columnsR];
+            var exactNorms = new double[columnsR];
+            for (var k = 0; k < columnsR; k++)
+            {
+                pivots[k] = k;
+                norms[k] = exactNorms[k] = ColumnNorm(r, rowsR, k, 0);
+            }
+
+            var minmn = Math.Min(rowsR, columnsR);
+            var recomputeTolerance = Math.Sqrt(Precision.DoubleMachinePrecision);
+            for (var j = 0; j < minmn; j++)
+            {
+                // Bring the column with the largest remaining norm to the front.
+                var pivot = j;
+                for (var k = j + 1; k < columnsR; k++)
+                {
+                    if (norms[k] > norms[pivot])
+                    {
+                        pivot = k;
+                    }
+                }
+
+                if (pivot != j)
+                {
+                    for (var i = 0; i < rowsR; i++)
+                    {
+                        var temp = r[(j * rowsR) + i];
+                        r[(j * rowsR) + i] = r[(pivot * rowsR) + i];
+                        r[(pivot * rowsR) + i] = temp;
+                    }
+
+                    var index = pivots[j];
+                    pivots[j] = pivots[pivot];
+                    pivots[pivot] = index;
+                    norms[pivot] = norms[j];
+                    exactNorms[pivot] = exactNorms[j];
+                }
+
+                ReduceColumn(r, rowsR, columnsR, j, tau);
+
+                for (var k = j + 1; k < columnsR; k++)
+                {
+                    if (norms[k] == 0.0)
+                    {
+                        continue;
+                    }
+
+                    var ratio = Math.Abs(r[(k * rowsR) + j]) / norms[k];
+                    var remaining = Math.Max(0.0, (1 + ratio) * (1 - ratio));
+                    var drift = norms[k] / exactNorms[k];
+                    if (remaining * drift * drift <= recomputeTolerance)
+                    {
+                        norms[k] = exactNorms[k] = ColumnNorm(r, rowsR, k, j + 1);
+                    }
+                    else
+                    {
+                        norms[k] *= Math.Sqrt(remaining);
+                    }
+                }
+            }
+
+            var rank = 0;
+            if (minmn > 0)
+            {
+                var threshold = Math.Max(rowsR, columnsR) * 2 * Precision.DoubleMachinePrecision * Math.Abs(r[0]);
+                while (rank < minmn && Math.Abs(r[(rank * rowsR) + rank]) > threshold)
+                {
+                    rank++;
+                }
+            }
+
+            return rank;
+        }
+
+        /// <summary>
+        /// Computes the Householder reflector that zeroes column j of r below the diagonal and applies H(j)
+        /// to the columns after it.
+        /// </summary>
+        /// <param name="r">The matrix being factored.</param>
+        /// <param name="rowsR">The number of rows in r.</param>
+        /// <param name="columnsR">The number of columns in r.</param>
+        /// <param name="j">The column to reduce.</param>
+        /// <param name="tau">On exit, <c>tau[j]</c> holds the scalar factor of the reflector.</param>
+        private static void ReduceColumn(double[] r, int rowsR, int columnsR, int j, double[] tau)
+        {
+            // H(j) = I - tau[j]*v*v' with v[j] = 1 and the rest of v stored below the diagonal of column j,
+            // laid out as GEQRF does so that the native providers can apply the same reflectors.
+            var column = j * rowsR;
+            var alpha = r[column + j];
+            var sumOfSquares = 0.0;
+            for (var i = j + 1; i < rowsR; i++)
+            {
+                sumOfSquares += r[column + i] * r[column + i];
+            }
+
+            if (sumOfSquares == 0.0)
+            {
+                tau[j] = 0.0;
+                return;
+            }
+
+            var beta = Math.Sqrt((alpha * alpha) + sumOfSquares);
+            if (alpha >= 0.0)
+            {
+                beta = -beta;
+            }
+
+            tau[j] = (beta - alpha) / beta;
+            var scale = 1.0 / (alpha - beta);
+            for (var i = j + 1; i < rowsR; i++)
+            {
+                r[column + i] *= scale;
+            }
+
+            r[column + j] = beta;
+
+            // Apply H(j) to the remaining columns.
+            CommonParallel.For(j + 1, columnsR, k => ApplyReflector(r, rowsR, j, tau[j], r, k * rowsR));
+        }
+
+        /// <summary>
+        /// Computes the two-norm of a column of r from a given row down.
+        /// </summary>
+        /// <param name="r">The matrix.</param>
+        /// <param name="rowsR">The number of rows in r.</param>
+        /// <param name="column">The column.</param>
+        /// <param name="firstRow">The first row to include.</param>
+        /// <returns>The norm of the column below and including <paramref name="firstRow"/>.</returns>
+        private static double ColumnNorm(double[] r, int rowsR, int column, int firstRow)
+        {
+            var sumOfSquares = 0.0;
+            for (var i = (column * rowsR) + firstRow; i < (column + 1) * rowsR; i++)
+            {
+                sumOfSquares += r[i] * r[i];
+            }
+
+            return Math.Sqrt(sumOfSquares);
+        }
+
+        /// <summary>
+        /// Multiplies a matrix by the Q of a QR factorization kept as Householder reflectors. <c>b = op(Q)*b</c>
+        /// </summary>
+        /// <param name="transposeQ">Whether to apply Q or its adjoint. Transpose and ConjugateTranspose both
+        /// apply the adjoint, which is the transpose for real matrices.</param>
+        /// <param name="r">The factored matrix returned by <see cref="QRFactor(double[],int,int,double[])"/>.</param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">The scalar factors of the Householder reflectors.</param>
+        /// <param name="b">On entry the M by <paramref name="columnsB"/> B matrix; on exit the product.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <remarks>This is equivalent to the ORMQR LAPACK routine.</remarks>
+        public virtual void QRApplyQ(Transpose transposeQ, double[] r, int rowsR, int columnsR, double[] tau, double[] b, int columnsB)
+        {
+            CheckQRApplyQ(r, rowsR, columnsR, tau, b, columnsB);
+
+            // Q = H(0)*H(1)*...*H(k-1), so its adjoint applies the reflectors first to last and Q last to first.
+            var minmn = Math.Min(rowsR, columnsR);
+            var adjoint = transposeQ != Transpose.DontTranspose;
+            CommonParallel.For(
+                0,
+                columnsB,
+                k =>
+                {
+                    for (var step = 0; step < minmn; step++)
+                    {
+                        var j = adjoint ? step : minmn - 1 - step;
+                        ApplyReflector(r, rowsR, j, tau[j], b, k * rowsR);
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Applies the Householder reflector <c>I - tau*v*v'</c> kept in a column of a factored matrix to a column of b.
+        /// </summary>
+        /// <param name="r">The factored matrix, holding v below its diagonal with an implicit one on it.</param>
+        /// <param name="rowsR">The number of rows in r and b.</param>
+        /// <param name="reflector">The column of r that holds v.</param>
+        /// <param name="tau">The scalar factor of the reflector.</param>
+        /// <param name="b">The matrix holding the column.</param>
+        /// <param name="offset">The index of the first element of the column.</param>
+        private static void ApplyReflector(double[] r, int rowsR, int reflector, double tau, double[] b, int offset)
+        {
+            var column = reflector * rowsR;
+            var sum = b[offset + reflector];
+            for (var i = reflector + 1; i < rowsR; i++)
+            {
+                sum += r[column + i] * b[offset + i];
+            }
+
+            sum *= tau;
+            b[offset + reflector] -= sum;
+            for (var i = reflector + 1; i < rowsR; i++)
+            {
+                b[offset + i] -= sum * r[column + i];
+            }
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using QR factorization of A.
+        /// </summary>
+        /// <param name="a">The A matrix.</param>
+        /// <param name="rows">The number of rows in the A matrix.</param>
+        /// <param name="columns">The number of columns in the A matrix.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolve(double[] a, int rows, int columns, double[] b, int columnsB, double[] x)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (x == null)
+            {
+                throw new ArgumentNullException("x");
+            }
+
+            if (a.Length != rows * columns)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (b.Length != rows * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (x.Length != columns * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
+            }
+
+            if (rows < columns)
+            {
+                throw new ArgumentException(Resources.RowsLessThanColumns);
+            }
+
+            var work = new double[rows * rows];
+            QRSolve(a, rows, columns, b, columnsB, x, work);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using QR factorization of A.
+        /// </summary>
+        /// <param name="a">The A matrix.</param>
+        /// <param name="rows">The number of rows in the A matrix.</param>
+        /// <param name="columns">The number of columns in the A matrix.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <param name="work">The work array. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolve(double[] a, int rows, int columns, double[] b, int columnsB, double[] x, double[] work)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (x == null)
+            {
+                throw new ArgumentNullException("x");
+            }
+
+            if (work == null)
+            {
+                throw new ArgumentNullException("work");
+            }
+
+            if (a.Length != rows * columns)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "a");
+            }
+
+            if (b.Length != rows * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (x.Length != columns * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
+            }
+
+            if (rows < columns)
+            {
+                throw new ArgumentException(Resources.RowsLessThanColumns);
+            }
+
+            if (work.Length < rows * rows)
+            {
+                work[0] = rows * rows;
+                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
+            }
+
+            var clone = new double[a.Length];
+            Buffer.BlockCopy(a, 0, clone, 0, a.Length * Constants.SizeOfDouble);
+            var q = new double[rows * rows];
+            QRFactor(clone, rows, columns, q, work);
+            QRSolveFactored(q, clone, rows, columns, null, b, columnsB, x);
+
+            work[0] = rows * rows;
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously QR factored matrix.
+        /// </summary>
+        /// <param name="q">The Q matrix obtained by QR factor. This is only used for the managed provider and can be
+        /// <c>null</c> for the native provider. The native provider uses the Q portion stored in the R matrix.</param>
+        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(double[],int,int,double[],double[])"/>. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">Contains additional information on Q. Only used for the native solver
+        /// and can be <c>null</c> for the managed provider.</param>
+        /// <param name="b">On entry the B matrix; on exit the X matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <param name="work">The work array - only used in the native provider. The array must have a length of at least N,
+        /// but should be N*blocksize. The blocksize is machine dependent. On exit, work[0] contains the optimal
+        /// work size value.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolveFactored(double[] q, double[] r, int rowsR, int columnsR, double[] tau, double[] b, int columnsB, double[] x, double[] work)
+        {
+            QRSolveFactored(q, r, rowsR, columnsR, tau, b, columnsB, x);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously QR factored matrix.
+        /// </summary>
+        /// <param name="q">The Q matrix obtained by calling <see cref="QRFactor(double[],int,int,double[],double[])"/>.</param>
+        /// <param name="r">The R matrix obtained by calling <see cref="QRFactor(double[],int,int,double[],double[])"/>. </param>
+        /// <param name="rowsR">The number of rows in the A matrix.</param>
+        /// <param name="columnsR">The number of columns in the A matrix.</param>
+        /// <param name="tau">Contains additional information on Q. Only used for the native solver
+        /// and can be <c>null</c> for the managed provider.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        /// <remarks>Rows must be greater or equal to columns.</remarks>
+        public virtual void QRSolveFactored(double[] q, double[] r, int rowsR, int columnsR, double[] tau, double[] b, int columnsB, double[] x)
+        {
+            if (r == null)
+            {
+                throw new ArgumentNullException("r");
+            }
+
+            if (q == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (x == null)
+            {
+                throw new ArgumentNullException("q");
+            }
+
+            if (r.Length != rowsR * columnsR)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "r");
+            }
+
+            if (q.Length != rowsR * rowsR)
+            {
+                throw new ArgumentException(string.Format(Resources.ArgumentArrayWrongLength, "rowsR * rowsR"), "q");
+            }
+
+            if (b.Length != rowsR * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (x.Length != columnsR * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "x");
+            }
+
+            if (rowsR < columnsR)
+            {
+                throw new ArgumentException(Resources.RowsLessThanColumns);
+            }
+
+            var sol = new double[b.Length];
+
+            // Copy B matrix to "sol", so B data will not be changed
+            Buffer.BlockCopy(b, 0, sol, 0, b.Length * Constants.SizeOfDouble);
+
+            // Compute Y = transpose(Q)*B
+            var column = new double[rowsR];
+            for (var j = 0; j < columnsB; j++)
+            {
+                var jm = j * rowsR;
+                CommonParallel.For(0, rowsR, k => column[k] = sol[jm + k]);
+                CommonParallel.For(
+                    0, 
+                    rowsR, 
+                    i =>
+                    {
+                        var im = i * rowsR;
+
+                        var sum = 0.0;
+                        for (var k = 0; k < rowsR; k++)
+                        {
+                            sum += q[im + k] * column[k];
+                        }
+
+                        sol[jm + i] = sum;
+                    });
+            }
+
+            // Solve R*X = Y;
+            for (var k = columnsR - 1; k >= 0; k--)
+            {
+                var km = k * rowsR;
+                for (var j = 0; j < columnsB; j++)
+                {
+                    sol[(j * rowsR) + k] /= r[km + k];
+                }
+
+                for (var i = 0; i < k; i++)
+                {
+                    for (var j = 0; j < columnsB; j++)
+                    {
+                        var jm = j * rowsR;
+                        sol[jm + i] -= sol[jm + k] * r[km + i];
+                    }
+                }
+            }
+
+            // Fill result matrix
+            CommonParallel.For(
+                0, 
+                columnsR, 
+                row =>
+                {
+                    for (var col = 0; col < columnsB; col++)
+                    {
+                        x[(col * columnsR) + row] = sol[row + (col * rowsR)];
+                    }
+                });
+        }
+
+        /// <summary>
+        /// Computes the singular value decomposition of A.
+        /// </summary>
+        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in ascending value.</param>
+        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
+        /// singular vectors.</param>
+        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
+        /// right singular vectors.</param>
+        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
+        public virtual void SingularValueDecomposition(bool computeVectors, double[] a, int rowsA, int columnsA, double[] s, double[] u, double[] vt)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (s == null)
+            {
+                throw new ArgumentNullException("s");
+            }
+
+            if (u == null)
+            {
+                throw new ArgumentNullException("u");
+            }
+
+            if (vt == null)
+            {
+                throw new ArgumentNullException("vt");
+            }
+
+            if (u.Length != rowsA * rowsA)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+            }
+
+            if (vt.Length != columnsA * columnsA)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+            }
+
+            if (s.Length != Math.Min(rowsA, columnsA))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+            }
+
+            var work = new double[rowsA];
+            SingularValueDecomposition(computeVectors, a, rowsA, columnsA, s, u, vt, work);
+        }
+
+        /// <summary>
+        /// Computes the singular value decomposition of A.
+        /// </summary>
+        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in ascending value.</param>
+        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
+        /// singular vectors.</param>
+        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
+        /// right singular vectors.</param>
+        /// <param name="work">The work array. Length should be at least <paramref name="rowsA"/>.</param>
+        /// <remarks>This is equivalent to the GESVD LAPACK routine.</remarks>
+        public virtual void SingularValueDecomposition(bool computeVectors, double[] a, int rowsA, int columnsA, double[] s, double[] u, double[] vt, double[] work)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (s == null)
+            {
+                throw new ArgumentNullException("s");
+            }
+
+            if (u == null)
+            {
+                throw new ArgumentNullException("u");
+            }
+
+            if (vt == null)
+            {
+                throw new ArgumentNullException("vt");
+            }
+
+            if (work == null)
+            {
+                throw new ArgumentNullException("work");
+            }
+
+            if (u.Length != rowsA * rowsA)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+            }
+
+            if (vt.Length != columnsA * columnsA)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+            }
+
+            if (s.Length != Math.Min(rowsA, columnsA))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+            }
+
+            if (work.Length == 0)
+            {
+                throw new ArgumentException(Resources.ArgumentSingleDimensionArray, "work");
+            }
+
+            if (work.Length < rowsA)
+            {
+                work[0] = rowsA;
+                throw new ArgumentException(Resources.WorkArrayTooSmall, "work");
+            }
+
+            SingularValueDecomposition(computeVectors, false, a, rowsA, columnsA, s, u, vt, work);
+        }
+
+        /// <summary>
+        /// Computes the singular value decomposition of A, or just the parts of it that <paramref name="mode"/> asks for.
+        /// </summary>
+        /// <param name="mode">Which factors to compute, and how.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A may be overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in descending order.</param>
+        /// <param name="u">On exit, the left singular vectors: M by M for <see cref="SvdMode.Full"/>, M by Min(M, N)
+        /// for <see cref="SvdMode.Economy"/> and <see cref="SvdMode.DivideAndConquer"/>. Not referenced for
+        /// <see cref="SvdMode.ValuesOnly"/>.</param>
+        /// <param name="vt">On exit, the transposed right singular vectors: N by N for <see cref="SvdMode.Full"/>,
+        /// Min(M, N) by N for the economy modes. Not referenced for <see cref="SvdMode.ValuesOnly"/>.</param>
+        /// <remarks>This is equivalent to the GESVD LAPACK routine, or GESDD for <see cref="SvdMode.DivideAndConquer"/>.</remarks>
+        public virtual void SingularValueDecomposition(SvdMode mode, double[] a, int rowsA, int columnsA, double[] s, double[] u, double[] vt)
+        {
+            CheckSingularValueDecomposition(mode, a, rowsA, columnsA, s, u, vt);
+
+            // There is no managed divide and conquer; the economy path returns the same factors.
+            var economy = mode == SvdMode.Economy || mode == SvdMode.DivideAndConquer;
+            SingularValueDecomposition(mode != SvdMode.ValuesOnly, economy, a, rowsA, columnsA, s, u, vt, new double[rowsA]);
+        }
+
+        /// <summary>
+        /// Computes the singular value decomposition of A with the LINPACK algorithm.
+        /// </summary>
+        /// <param name="computeVectors">Compute the singular U and VT vectors or not.</param>
+        /// <param name="economy">Whether U and VT hold only the leading Min(M, N) singular vectors.</param>
+        /// <param name="a">On entry, the M by N matrix to decompose. On exit, A is overwritten.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The singular values of A in descending order.</param>
+        /// <param name="u">If <paramref name="computeVectors"/> is <c>true</c>, on exit U contains the left
+        /// singular vectors.</param>
+        /// <param name="vt">If <paramref name="computeVectors"/> is <c>true</c>, on exit VT contains the transposed
+        /// right singular vectors.</param>
+        /// <param name="work">The work array, of length at least <paramref name="rowsA"/>.</param>
+        private static void SingularValueDecomposition(bool computeVectors, bool economy, double[] a, int rowsA, int columnsA, double[] s, double[] u, double[] vt, double[] work)
+        {
+            const int Maxiter = 1000;
+
+            var e = new double[columnsA];
+            var v = new double[computeVectors ? columnsA * columnsA : 0];
+            var stemp = new double[Math.Min(rowsA + 1, columnsA)];
+
+            int i, j, l, lp1;
+
+            var cs = 0.0;
+            var sn = 0.0;
+            double t;
+
+            var ncu = economy ? Math.Min(rowsA, columnsA) : rowsA;
+
+            // Reduce matrix to bidiagonal form, storing the diagonal elements
+            // in "s" and the super-diagonal elements in "e".
+            var nct = Math.Min(rowsA - 1, columnsA);
+            var nrt = Math.Max(0, Math.Min(columnsA - 2, rowsA));
+            var lu = Math.Max(nct, nrt);
+
+            for (l = 0; l < lu; l++)
+            {
+                lp1 = l + 1;
+                if (l < nct)
+                {
+                    // Compute the transformation for the l-th column and
+                    // place the l-th diagonal in vector s[l].
+                    var sum = 0.0;
+                    for (var i1 = l; i1 < rowsA; i1++)
+                    {
+                        sum += a[(l * rowsA) + i1] * a[(l * rowsA) + i1];
+                    }
+
+                    stemp[l] = Math.Sqrt(sum);
+
+                    if (stemp[l] != 0.0)
+                    {
+                        if (a[(l * rowsA) + l] != 0.0)
+                        {
+                            stemp[l] = Math.Abs(stemp[l]) * (a[(l * rowsA) + l] / Math.Abs(a[(l * rowsA) + l]));
+                        }
+
+                        // A part of column "l" of Matrix A from row "l" to end multiply by 1.0 / s[l]
+                        for (i = l; i < rowsA; i++)
+                        {
+                            a[(l * rowsA) + i] = a[(l * rowsA) + i] * (1.0 / stemp[l]);
+                        }
+
+                        a[(l * rowsA) + l] = 1.0 + a[(l * rowsA) + l];
+                    }
+
+                    stemp[l] = -stemp[l];
+                }
+
+                for (j = lp1; j < columnsA; j++)
+                {
+                    if (l < nct)
+                    {
+                        if (stemp[l] != 0.0)
+                        {
+                            // Apply the transformation.
+                            t = 0.0;
+                            for (i = l; i < rowsA; i++)
+                            {
+                                t += a[(j * rowsA) + i] * a[(l * rowsA) + i];
+                            }
+
+                            t = -t / a[(l * rowsA) + l];
+
+                            for (var ii = l; ii < rowsA; ii++)
+                            {
+                                a[(j * rowsA) + ii] += t * a[(l * rowsA) + ii];
+                            }
+                        }
+                    }
+
+                    // Place the l-th row of matrix into "e" for the
+                    // subsequent calculation of the row transformation.
+                    e[j] = a[(j * rowsA) + l];
+                }
+
+                if (computeVectors && l < nct)
+                {
+                    // Place the transformation in "u" for subsequent back multiplication.
+                    for (i = l; i < rowsA; i++)
+                    {
+                        u[(l * rowsA) + i] = a[(l * rowsA) + i];
+                    }
+                }
+
+                if (l >= nrt)
+                {
+                    continue;
+                }
+
+                // Compute the l-th row transformation and place the l-th super-diagonal in e(l).
+                var enorm = 0.0;
+                for (i = lp1; i < e.Length; i++)
+                {
+                    enorm += e[i] * e[i];
+                }
+
+                e[l] = Math.Sqrt(enorm);
+                if (e[l] != 0.0)
+                {
+                    if (e[lp1] != 0.0)
+                    {
+                        e[l] = Math.Abs(e[l]) * (e[lp1] / Math.Abs(e[lp1]));
+                    }
+
+                    // Scale vector "e" from "lp1" by 1.0 / e[l]
+                    for (i = lp1; i < e.Length; i++)
+                    {
+                        e[i] = e[i] * (1.0 / e[l]);
+                    }
+
+                    e[lp1] = 1.0 + e[lp1];
+                }
+
+                e[l] = -e[l];
+
+                if (lp1 < rowsA && e[l] != 0.0)
+                {
+                    // Apply the transformation.
+                    for (i = lp1; i < rowsA; i++)
+                    {
+                        work[i] = 0.0;
+                    }
+
+                    for (j = lp1; j < columnsA; j++)
+                    {
+                        for (var ii = lp1; ii < rowsA; ii++)
+                        {
+                            work[ii] += e[j] * a[(j * rowsA) + ii];
+                        }
+                    }
+
+                    for (j = lp1; j < columnsA; j++)
+                    {
+                        var ww = -e[j] / e[lp1];
+                        for (var ii = lp1; ii < rowsA; ii++)
+                        {
+                            a[(j * rowsA) + ii] += ww * work[ii];
+                        }
+                    }
+                }
+
+                if (!computeVectors)
+                {
+                    continue;
+                }
+
+                // Place the transformation in v for subsequent back multiplication.
+                for (i = lp1; i < columnsA; i++)
+                {
+                    v[(l * columnsA) + i] = e[i];
+                }
+            }
+
+            // Set up the final bidiagonal matrix or order m.
+            var m = Math.Min(columnsA, rowsA + 1);
+            var nctp1 = nct + 1;
+            var nrtp1 = nrt + 1;
+            if (nct < columnsA)
+            {
+                stemp[nctp1 - 1] = a[((nctp1 - 1) * rowsA) + (nctp1 - 1)];
+            }
+
+            if (rowsA < m)
+            {
+                stemp[m - 1] = 0.0;
+            }
+
+            if (nrtp1 < m)
+            {
+                e[nrtp1 - 1] = a[((m - 1) * rowsA) + (nrtp1 - 1)];
+            }
+
+            e[m - 1] = 0.0;
+
+            // If required, generate "u".
+            if (computeVectors)
+            {
+                for (j = nctp1 - 1; j < ncu; j++)
+                {
+                    for (i = 0; i < rowsA; i++)
+                    {
+                        u[(j * rowsA) + i] = 0.0;
+                    }
+
+                    u[(j * rowsA) + j] = 1.0;
+                }
+
+                for (l = nct - 1; l >= 0; l--)
+                {
+                    if (stemp[l] != 0.0)
+                    {
+                        for (j = l + 1; j < ncu; j++)
+                        {
+                            t = 0.0;
+                            for (i = l; i < rowsA; i++)
+                            {
+                                t += u[(j * rowsA) + i] * u[(l * rowsA) + i];
+                            }
+
+                            t = -t / u[(l * rowsA) + l];
+
+                            for (var ii = l; ii < rowsA; ii++)
+                            {
+                                u[(j * rowsA) + ii] += t * u[(l * rowsA) + ii];
+                            }
+                        }
+
+                        // A part of column "l" of matrix A from row "l" to end multiply by -1.0
+                        for (i = l; i < rowsA; i++)
+                        {
+                            u[(l * rowsA) + i] = u[(l * rowsA) + i] * -1.0;
+                        }
+
+                        u[(l * rowsA) + l] = 1.0 + u[(l * rowsA) + l];
+                        for (i = 0; i < l; i++)
+                        {
+                            u[(l * rowsA) + i] = 0.0;
+                        }
+                    }
+                    else
+                    {
+                        for (i = 0; i < rowsA; i++)
+                        {
+                            u[(l * rowsA) + i] = 0.0;
+                        }
+
+                        u[(l * rowsA) + l] = 1.0;
+                    }
+                }
+            }
+
+            // If it is required, generate v.
+            if (computeVectors)
+            {
+                for (l = columnsA - 1; l >= 0; l--)
+                {
+                    lp1 = l + 1;
+                    if (l < nrt)
+                    {
+                        if (e[l] != 0.0)
+                        {
+                            for (j = lp1; j < columnsA; j++)
+                            {
+                                t = 0.0;
+                                for (i = lp1; i < columnsA; i++)
+                                {
+                                    t += v[(j * columnsA) + i] * v[(l * columnsA) + i];
+                                }
+
+                                t = -t / v[(l * columnsA) + lp1];
+                                for (var ii = l; ii < columnsA; ii++)
+                                {
+                                    v[(j * columnsA) + ii] += t * v[(l * columnsA) + ii];
+                                }
+                            }
+                        }
+                    }
+
+                    for (i = 0; i < columnsA; i++)
+                    {
+                        v[(l * columnsA) + i] = 0.0;
+                    }
+
+                    v[(l * columnsA) + l] = 1.0;
+                }
+            }
+
+            // Transform "s" and "e" so that they are double
+            for (i = 0; i < m; i++)
+            {
+                double r;
+                if (stemp[i] != 0.0)
+                {
+                    t = stemp[i];
+                    r = stemp[i] / t;
+                    stemp[i] = t;
+                    if (i < m - 1)
+                    {
+                        e[i] = e[i] / r;
+                    }
+
+                    if (computeVectors)
+                    {
+                        // A part of column "i" of matrix U from row 0 to end multiply by r
+                        for (j = 0; j < rowsA; j++)
+                        {
+                            u[(i * rowsA) + j] = u[(i * rowsA) + j] * r;
+                        }
+                    }
+                }
+
+                // Exit
+                if (i == m - 1)
+                {
+                    break;
+                }
+
+                if (e[i] == 0.0)
+                {
+                    continue;
+                }
+
+                t = e[i];
+                r = t / e[i];
+                e[i] = t;
+                stemp[i + 1] = stemp[i + 1] * r;
+                if (!computeVectors)
+                {
+                    continue;
+                }
+
+                // A part of column "i+1" of matrix VT from row 0 to end multiply by r
+                for (j = 0; j < columnsA; j++)
+                {
+                    v[((i + 1) * columnsA) + j] = v[((i + 1) * columnsA) + j] * r;
+                }
+            }
+
+            // Main iteration loop for the singular values.
+            var mn = m;
+            var iter = 0;
+
+            while (m > 0)
+            {
+                // Quit if all the singular values have been found.
+                // If too many iterations have been performed throw exception.
+                if (iter >= Maxiter)
+                {
+                    throw new ArgumentException(Resources.ConvergenceFailed);
+                }
+
+                // This section of the program inspects for negligible elements in the s and e arrays,  
+                // on completion the variables kase and l are set as follows:
+                // kase = 1: if mS[m] and e[l-1] are negligible and l < m
+                // kase = 2: if mS[l] is negligible and l < m
+                // kase = 3: if e[l-1] is negligible, l < m, and mS[l, ..., mS[m] are not negligible (qr step).
+                // kase = 4: if e[m-1] is negligible (convergence).
+                double ztest;
+                double test;
+                for (l = m - 2; l >= 0; l--)
+                {
+                    test = Math.Abs(stemp[l]) + Math.Abs(stemp[l + 1]);
+                    ztest = test + Math.Abs(e[l]);
+                    if (ztest.AlmostEqualInDecimalPlaces(test, 15))
+                    {
+                        e[l] = 0.0;
+                        break;
+                    }
+                }
+
+                int kase;
+                if (l == m - 2)
+                {
+                    kase = 4;
+                }
+                else
+                {
+                    int ls;
+                    for (ls = m - 1; ls > l; ls--)
+                    {
+                        test = 0.0;
+                        if (ls != m - 1)
+                        {
+                            test = test + Math.Abs(e[ls]);
+                        }
+
+                        if (ls != l + 1)
+                        {
+                            test = test + Math.Abs(e[ls - 1]);
+                        }
+
+                        ztest = test + Math.Abs(stemp[ls]);
+                        if (ztest.AlmostEqualInDecimalPlaces(test, 15))
+                        {
+                            stemp[ls] = 0.0;
+                            break;
+                        }
+                    }
+
+                    if (ls == l)
+                    {
+                        kase = 3;
+                    }
+                    else if (ls == m - 1)
+                    {
+                        kase = 1;
+                    }
+                    else
+                    {
+                        kase = 2;
+                        l = ls;
+                    }
+                }
+
+                l = l + 1;
+
+                // Perform the task indicated by kase.
+                int k;
+                double f;
+                switch (kase)
+                {
+                        // Deflate negligible s[m].
+                    case 1:
+                        f = e[m - 2];
+                        e[m - 2] = 0.0;
+                        double t1;
+                        for (var kk = l; kk < m - 1; kk++)
+                        {
+                            k = m - 2 - kk + l;
+                            t1 = stemp[k];
+
+                            Drotg(ref t1, ref f, ref cs, ref sn);
+                            stemp[k] = t1;
+                            if (k != l)
+                            {
+                                f = -sn * e[k - 1];
+                                e[k - 1] = cs * e[k - 1];
+                            }
+
+                            if (computeVectors)
+                            {
+                                // Rotate
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((m - 1) * columnsA) + i]);
+                                    v[((m - 1) * columnsA) + i] = (cs * v[((m - 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
+                                    v[(k * columnsA) + i] = z;
+                                }
+                            }
+                        }
+
+                        break;
+
+                    // Split at negligible s[l].
+                    case 2:
+                        f = e[l - 1];
+                        e[l - 1] = 0.0;
+                        for (k = l; k < m; k++)
+                        {
+                            t1 = stemp[k];
+                            Drotg(ref t1, ref f, ref cs, ref sn);
+                            stemp[k] = t1;
+                            f = -sn * e[k];
+                            e[k] = cs * e[k];
+                            if (computeVectors)
+                            {
+                                // Rotate
+                                for (i = 0; i < rowsA; i++)
+                                {
+                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((l - 1) * rowsA) + i]);
+                                    u[((l - 1) * rowsA) + i] = (cs * u[((l - 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
+                                    u[(k * rowsA) + i] = z;
+                                }
+                            }
+                        }
+
+                        break;
+
+                        // Perform one qr step.
+                    case 3:
+
+                        // calculate the shift.
+                        var scale = 0.0;
+                        scale = Math.Max(scale, Math.Abs(stemp[m - 1]));
+                        scale = Math.Max(scale, Math.Abs(stemp[m - 2]));
+                        scale = Math.Max(scale, Math.Abs(e[m - 2]));
+                        scale = Math.Max(scale, Math.Abs(stemp[l]));
+                        scale = Math.Max(scale, Math.Abs(e[l]));
+                        var sm = stemp[m - 1] / scale;
+                        var smm1 = stemp[m - 2] / scale;
+                        var emm1 = e[m - 2] / scale;
+                        var sl = stemp[l] / scale;
+                        var el = e[l] / scale;
+                        var b = (((smm1 + sm) * (smm1 - sm)) + (emm1 * emm1)) / 2.0;
+                        var c = (sm * emm1) * (sm * emm1);
+                        var shift = 0.0;
+                        if (b != 0.0 || c != 0.0)
+                        {
+                            shift = Math.Sqrt((b * b) + c);
+                            if (b < 0.0)
+                            {
+                                shift = -shift;
+                            }
+
+                            shift = c / (b + shift);
+                        }
+
+                        f = ((sl + sm) * (sl - sm)) + shift;
+                        var g = sl * el;
+
+                        // Chase zeros
+                        for (k = l; k < m - 1; k++)
+                        {
+                            Drotg(ref f, ref g, ref cs, ref sn);
+                            if (k != l)
+                            {
+                                e[k - 1] = f;
+                            }
+
+                            f = (cs * stemp[k]) + (sn * e[k]);
+                            e[k] = (cs * e[k]) - (sn * stemp[k]);
+                            g = sn * stemp[k + 1];
+                            stemp[k + 1] = cs * stemp[k + 1];
+                            if (computeVectors)
+                            {
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((k + 1) * columnsA) + i]);
+                                    v[((k + 1) * columnsA) + i] = (cs * v[((k + 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
+                                    v[(k * columnsA) + i] = z;
+                                }
+                            }
+
+                            Drotg(ref f, ref g, ref cs, ref sn);
+                            stemp[k] = f;
+                            f = (cs * e[k]) + (sn * stemp[k + 1]);
+                            stemp[k + 1] = -(sn * e[k]) + (cs * stemp[k + 1]);
+                            g = sn * e[k + 1];
+                            e[k + 1] = cs * e[k + 1];
+                            if (computeVectors && k < rowsA)
+                            {
+                                for (i = 0; i < rowsA; i++)
+                                {
+                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((k + 1) * rowsA) + i]);
+                                    u[((k + 1) * rowsA) + i] = (cs * u[((k + 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
+                                    u[(k * rowsA) + i] = z;
+                                }
+                            }
+                        }
+
+                        e[m - 2] = f;
+                        iter = iter + 1;
+                        break;
+
+                        // Convergence
+                    case 4:
+
+                        // Make the singular value  positive
+                        if (stemp[l] < 0.0)
+                        {
+                            stemp[l] = -stemp[l];
+                            if (computeVectors)
+                            {
+                                // A part of column "l" of matrix VT from row 0 to end multiply by -1
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    v[(l * columnsA) + i] = v[(l * columnsA) + i] * -1.0;
+                                }
+                            }
+                        }
+
+                        // Order the singular value.
+                        while (l != mn - 1)
+                        {
+                            if (stemp[l] >= stemp[l + 1])
+                            {
+                                break;
+                            }
+
+                            t = stemp[l];
+                            stemp[l] = stemp[l + 1];
+                            stemp[l + 1] = t;
+                            if (computeVectors && l < columnsA)
+                            {
+                                // Swap columns l, l + 1
+                                for (i = 0; i < columnsA; i++)
+                                {
+                                    var z = v[(l * columnsA) + i];
+                                    v[(l * columnsA) + i] = v[((l + 1) * columnsA) + i];
+                                    v[((l + 1) * columnsA) + i] = z;
+                                }
+                            }
+
+                            if (computeVectors && l < rowsA)
+                            {
+                                // Swap columns l, l + 1
+                                for (i = 0; i < rowsA; i++)
+                                {
+                                    var z = u[(l * rowsA) + i];
+                                    u[(l * rowsA) + i] = u[((l + 1) * rowsA) + i];
+                                    u[((l + 1) * rowsA) + i] = z;
+                                }
+                            }
+
+                            l = l + 1;
+                        }
+
+                        iter = 0;
+                        m = m - 1;
+                        break;
+                }
+            }
+
+            if (computeVectors)
+            {
+                // Finally transpose "v" to get "vt" matrix 
+                var ldvt = economy ? Math.Min(rowsA, columnsA) : columnsA;
+                for (i = 0; i < ldvt; i++)
+                {
+                    for (j = 0; j < columnsA; j++)
+                    {
+                        vt[(j * ldvt) + i] = v[(i * columnsA) + j];
+                    }
+                }
+            }
+
+            // Copy stemp to s with size adjustment. We are using ported copy of linpack's svd code and it uses
+            // a singular vector of length rows+1 when rows < columns. The last element is not used and needs to be removed.
+            // We should port lapack's svd routine to remove this problem.
+            Buffer.BlockCopy(stemp, 0, s, 0, Math.Min(rowsA, columnsA) * Constants.SizeOfDouble);
+
+            // On return the first element of the work array stores the min size of the work array could have been
+            // work[0] = Math.Max(3 * Math.Min(aRows, aColumns) + Math.Max(aRows, aColumns), 5 * Math.Min(aRows, aColumns));
+            work[0] = rowsA;
+        }
+
+        /// <summary>
+        /// Given the Cartesian coordinates (da, db) of a point p, these function return the parameters da, db, c, and s 
+        /// associated with the Givens rotation that zeros the y-coordinate of the point.
+        /// </summary>
+        /// <param name="da">Provides the x-coordinate of the point p. On exit contains the parameter r associated with the Givens rotation</param>
+        /// <param name="db">Provides the y-coordinate of the point p. On exit contains the parameter z associated with the Givens rotation</param>
+        /// <param name="c">Contains the parameter c associated with the Givens rotation</param>
+        /// <param name="s">Contains the parameter s associated with the Givens rotation</param>
+        /// <remarks>This is equivalent to the DROTG LAPACK routine.</remarks>
+        private static void Drotg(ref double da, ref double db, ref double c, ref double s)
+        {
+            double r, z;
+
+            var roe = db;
+            var absda = Math.Abs(da);
+            var absdb = Math.Abs(db);
+            if (absda > absdb)
             {
-                stemp[m - 1] = 0.0;
+                roe = da;
+            }
+
+            var scale = absda + absdb;
+            if (scale == 0.0)
+            {
+                c = 1.0;
+                s = 0.0;
+                r = 0.0;
+                z = 0.0;
+            }
+            else
+            {
+                var sda = da / scale;
+                var sdb = db / scale;
+                r = scale * Math.Sqrt((sda * sda) + (sdb * sdb));
+                if (roe < 0.0)
+                {
+                    r = -r;
+                }
+
+                c = da / r;
+                s = db / r;
+                z = 1.0;
+                if (absda > absdb)
+                {
+                    z = s;
+                }
+
+                if (absdb >= absda && c != 0.0)
+                {
+                    z = 1.0 / c;
+                }
+            }
+
+            da = r;
+            db = z;
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using the singular value decomposition of A.
+        /// </summary>
+        /// <param name="a">On entry, the M by N matrix to decompose.</param>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        public virtual void SvdSolve(double[] a, int rowsA, int columnsA, double[] b, int columnsB, double[] x)
+        {
+            if (a == null)
+            {
+                throw new ArgumentNullException("a");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (x == null)
+            {
+                throw new ArgumentNullException("x");
+            }
+
+            if (b.Length != rowsA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (x.Length != columnsA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            var work = new double[rowsA];
+            var s = new double[Math.Min(rowsA, columnsA)];
+            var u = new double[rowsA * rowsA];
+            var vt = new double[columnsA * columnsA];
+
+            var clone = new double[a.Length];
+            Buffer.BlockCopy(a, 0, clone, 0, a.Length * Constants.SizeOfDouble);
+            SingularValueDecomposition(true, clone, rowsA, columnsA, s, u, vt, work);
+            SvdSolveFactored(rowsA, columnsA, s, u, vt, b, columnsB, x);
+        }
+
+        /// <summary>
+        /// Solves A*X=B for X using a previously SVD decomposed matrix.
+        /// </summary>
+        /// <param name="rowsA">The number of rows in the A matrix.</param>
+        /// <param name="columnsA">The number of columns in the A matrix.</param>
+        /// <param name="s">The s values returned by <see cref="SingularValueDecomposition(bool,double[],int,int,double[],double[],double[])"/>.</param>
+        /// <param name="u">The left singular vectors returned by  <see cref="SingularValueDecomposition(bool,double[],int,int,double[],double[],double[])"/>.</param>
+        /// <param name="vt">The right singular  vectors returned by  <see cref="SingularValueDecomposition(bool,double[],int,int,double[],double[],double[])"/>.</param>
+        /// <param name="b">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="x">On exit, the solution matrix.</param>
+        public virtual void SvdSolveFactored(int rowsA, int columnsA, double[] s, double[] u, double[] vt, double[] b, int columnsB, double[] x)
+        {
+            if (s == null)
+            {
+                throw new ArgumentNullException("s");
+            }
+
+            if (u == null)
+            {
+                throw new ArgumentNullException("u");
+            }
+
+            if (vt == null)
+            {
+                throw new ArgumentNullException("vt");
+            }
+
+            if (b == null)
+            {
+                throw new ArgumentNullException("b");
+            }
+
+            if (x == null)
+            {
+                throw new ArgumentNullException("x");
+            }
+
+            // Either the full or the economy factors will do.
+            var mn = Math.Min(rowsA, columnsA);
+            if (u.Length != rowsA * rowsA && u.Length != rowsA * mn)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
+            }
+
+            if (vt.Length != columnsA * columnsA && vt.Length != mn * columnsA)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
+            }
+
+            if (s.Length != Math.Min(rowsA, columnsA))
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+            }
+
+            if (b.Length != rowsA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            if (x.Length != columnsA * columnsB)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+            }
+
+            var ldvt = vt.Length / columnsA;
+            var tmp = new double[columnsA];
+
+            for (var k = 0; k < columnsB; k++)
+            {
+                for (var j = 0; j < columnsA; j++)
+                {
+                    double value = 0;
+                    if (j < mn)
+                    {
+                        for (var i = 0; i < rowsA; i++)
+                        {
+                            value += u[(j * rowsA) + i] * b[(k * rowsA) + i];
+                        }
+
+                        value /= s[j];
+                    }
+
+                    tmp[j] = value;
+                }
+
+                for (var j = 0; j < columnsA; j++)
+                {
+                    double value = 0;
+                    for (var i = 0; i < mn; i++)
+                    {
+                        value += vt[(j * ldvt) + i] * tmp[i];
+                    }
+
+                    x[(k * columnsA) + j] = value;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Computes the eigenvalues and eigenvectors of a symmetric matrix.
+        /// </summary>
+        /// <param name="a">On entry, the symmetric matrix; only its lower triangle is read. On exit,
+        /// the orthonormal eigenvectors, one per column.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="eigenvalues">On exit, the eigenvalues in ascending order.</param>
+        /// <remarks>This is equivalent to the SYEVD LAPACK routine.</remarks>
+        public virtual void EigenDecomposition(double[] a, int order, double[] eigenvalues)
+        {
+            CheckEigenDecomposition(a, order, eigenvalues);
+
+            if (order == 0)
+            {
+                return;
+            }
+
+            // The Householder reduction reads both triangles and starts from the last row.
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = j + 1; i < order; i++)
+                {
+                    a[(i * order) + j] = a[(j * order) + i];
+                }
+
+                eigenvalues[j] = a[(j * order) + order - 1];
+            }
+
+            var e = new double[order];
+            SymmetricTridiagonalize(a, eigenvalues, e, order);
+            SymmetricDiagonalize(a, eigenvalues, e, order);
+        }
+
+        /// <summary>
+        /// Computes the eigenvalues and, optionally, the left and right eigenvectors of a general matrix.
+        /// </summary>
+        /// <param name="computeLeft">Whether to compute the left eigenvectors.</param>
+        /// <param name="computeRight">Whether to compute the right eigenvectors.</param>
+        /// <param name="a">On entry, the square matrix A. On exit, A is overwritten.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="realEigenvalues">On exit, the real parts of the eigenvalues.</param>
+        /// <param name="imaginaryEigenvalues">On exit, the imaginary parts of the eigenvalues. Complex conjugate pairs
+        /// are stored next to each other, the one with the positive imaginary part first.</param>
+        /// <param name="leftVectors">If <paramref name="computeLeft"/> is <c>true</c>, on exit the left eigenvectors u(j),
+        /// <c>u(j)^H*A = lambda(j)*u(j)^H</c>, one per column and of unit length. For a complex pair j, j+1, columns j and j+1
+        /// hold the real and imaginary parts of u(j), and u(j+1) is its conjugate. Otherwise not referenced.</param>
+        /// <param name="rightVectors">If <paramref name="computeRight"/> is <c>true</c>, on exit the right eigenvectors v(j),
+        /// <c>A*v(j) = lambda(j)*v(j)</c>, stored like the left ones. Otherwise not referenced.</param>
+        /// <remarks>This is equivalent to the GEEV LAPACK routine.</remarks>
+        public virtual void EigenDecomposition(bool computeLeft, bool computeRight, double[] a, int order, double[] realEigenvalues, double[] imaginaryEigenvalues, double[] leftVectors, double[] rightVectors)
+        {
+            CheckEigenDecomposition(a, order, realEigenvalues);
+            CheckEigenvalues(imaginaryEigenvalues, order, "imaginaryEigenvalues");
+            CheckEigenvectors(computeLeft, leftVectors, order, "leftVectors");
+            CheckEigenvectors(computeRight, rightVectors, order, "rightVectors");
+
+            if (order == 0)
+            {
+                return;
+            }
+
+            var matrixH = new double[order, order];
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = 0; i < order; i++)
+                {
+                    matrixH[i, j] = a[(j * order) + i];
+                }
+            }
+
+            var vectors = new double[order * order];
+            NonsymmetricReduceToHessenberg(vectors, matrixH, order);
+            NonsymmetricReduceHessenberToRealSchur(vectors, matrixH, realEigenvalues, imaginaryEigenvalues, order, computeLeft || computeRight);
+            if (!computeLeft && !computeRight)
+            {
+                return;
+            }
+
+            NormalizeEigenvectors(vectors, imaginaryEigenvalues, order);
+            if (computeRight)
+            {
+                Array.Copy(vectors, rightVectors, vectors.Length);
+            }
+
+            if (computeLeft)
+            {
+                // The rows of the inverse of the right eigenvectors are the left eigenvectors, in the same real form.
+                LUInverse(vectors, order);
+                for (var j = 0; j < order; j++)
+                {
+                    for (var i = 0; i < order; i++)
+                    {
+                        leftVectors[(j * order) + i] = vectors[(i * order) + j];
+                    }
+                }
+
+                NormalizeEigenvectors(leftVectors, imaginaryEigenvalues, order);
+            }
+        }
+
+        /// <summary>
+        /// Computes the real Schur decomposition of a general matrix, <c>A = Z*T*Z'</c> with Z orthogonal and
+        /// T upper quasi-triangular.
+        /// </summary>
+        /// <param name="a">On entry, the square matrix A. On exit, T; its 2 by 2 diagonal blocks hold the
+        /// complex conjugate pairs of eigenvalues.</param>
+        /// <param name="order">The number of rows and columns in A.</param>
+        /// <param name="realEigenvalues">On exit, the real parts of the eigenvalues, in the order they appear on the diagonal of T.</param>
+        /// <param name="imaginaryEigenvalues">On exit, the imaginary parts of the eigenvalues.</param>
+        /// <param name="schurVectors">On exit, the orthogonal matrix Z of Schur vectors.</param>
+        /// <remarks>This is equivalent to the GEES LAPACK routine without eigenvalue ordering.</remarks>
+        public virtual void SchurDecomposition(double[] a, int order, double[] realEigenvalues, double[] imaginaryEigenvalues, double[] schurVectors)
+        {
+            CheckEigenDecomposition(a, order, realEigenvalues);
+            CheckEigenvalues(imaginaryEigenvalues, order, "imaginaryEigenvalues");
+            CheckEigenvectors(true, schurVectors, order, "schurVectors");
+
+            if (order == 0)
+            {
+                return;
+            }
+
+            var matrixH = new double[order, order];
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = 0; i < order; i++)
+                {
+                    matrixH[i, j] = a[(j * order) + i];
+                }
+            }
+
+            NonsymmetricReduceToHessenberg(schurVectors, matrixH, order);
+            NonsymmetricReduceHessenberToRealSchur(schurVectors, matrixH, realEigenvalues, imaginaryEigenvalues, order, false);
+
+            // Below the diagonal only the blocks of complex pairs are nonzero; the rest is round-off.
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = 0; i < order; i++)
+                {
+                    a[(j * order) + i] = i <= j || (i == j + 1 && imaginaryEigenvalues[j] > 0.0) ? matrixH[i, j] : 0.0;
+                }
             }
+        }
 
-            if (nrtp1 < m)
+        /// <summary>
+        /// Scales eigenvectors in the real form of <see cref="EigenDecomposition(bool,bool,double[],int,double[],double[],double[],double[])"/> to unit length.
+        /// </summary>
+        /// <param name="vectors">The eigenvectors, one per column.</param>
+        /// <param name="imaginaryEigenvalues">The imaginary parts of the eigenvalues, which mark the complex pairs.</param>
+        /// <param name="order">The number of rows and columns of <paramref name="vectors"/>.</param>
+        private static void NormalizeEigenvectors(double[] vectors, double[] imaginaryEigenvalues, int order)
+        {
+            for (var j = 0; j < order; j++)
             {
-                e[nrtp1 - 1] = a[((m - 1) * rowsA) + (nrtp1 - 1)];
-            }
-
-            e[m - 1] = 0.0;
+                // A complex pair shares columns j and j + 1.
+                var columns = imaginaryEigenvalues[j] > 0.0 ? 2 : 1;
+                var norm = 0.0;
+                for (var i = 0; i < columns * order; i++)
+                {
+                    norm += vectors[(j * order) + i] * vectors[(j * order) + i];
+                }
 
-            // If required, generate "u".
-            if (computeVectors)
-            {
-                for (j = nctp1 - 1; j < ncu; j++)
+                if (norm > 0.0)
                 {
-                    for (i = 0; i < rowsA; i++)
+                    var scale = 1.0 / Math.Sqrt(norm);
+                    for (var i = 0; i < columns * order; i++)
                     {
-                        u[(j * rowsA) + i] = 0.0;
+                        vectors[(j * order) + i] *= scale;
                     }
+                }
 
-                    u[(j * rowsA) + j] = 1.0;
+                j += columns - 1;
+            }
+        }
+
+        /// <summary>
+        /// Symmetric Householder reduction to tridiagonal form.
+        /// </summary>
+        /// <param name="a">Data array of matrix V (eigenvectors)</param>
+        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
+        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <remarks>This is derived from the Algol procedures tred2 by 
+        /// Bowdler, Martin, Reinsch, and Wilkinson, Handbook for 
+        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding 
+        /// Fortran subroutine in EISPACK.</remarks>
+        private static void SymmetricTridiagonalize(double[] a, double[] d, double[] e, int order)
+        {
+            // Householder reduction to tridiagonal form.
+            for (var i = order - 1; i > 0; i--)
+            {
+                // Scale to avoid under/overflow.
+                var scale = 0.0;
+                var h = 0.0;
+
+                for (var k = 0; k < i; k++)
+                {
+                    scale = scale + Math.Abs(d[k]);
                 }
 
-                for (l = nct - 1; l >= 0; l--)
+                if (scale == 0.0)
                 {
-                    if (stemp[l] != 0.0)
+                    e[i] = d[i - 1];
+                    for (var j = 0; j < i; j++)
                     {
-                        for (j = l + 1; j < ncu; j++)
-                        {
-                            t = 0.0;
-                            for (i = l; i < rowsA; i++)
-                            {
-                                t += u[(j * rowsA) + i] * u[(l * rowsA) + i];
-                            }
+                        d[j] = a[(j * order) + i - 1];
+                        a[(j * order) + i] = 0.0;
+                        a[(i * order) + j] = 0.0;
+                    }
+                }
+                else
+                {
+                    // Generate Householder vector.
+                    for (var k = 0; k < i; k++)
+                    {
+                        d[k] /= scale;
+                        h += d[k] * d[k];
+                    }
 
-                            t = -t / u[(l * rowsA) + l];
+                    var f = d[i - 1];
+                    var g = Math.Sqrt(h);
+                    if (f > 0)
+                    {
+                        g = -g;
+                    }
 
-                            for (var ii = l; ii < rowsA; ii++)
-                            {
-                                u[(j * rowsA) + ii] += t * u[(l * rowsA) + ii];
-                            }
-                        }
+                    e[i] = scale * g;
+                    h = h - (f * g);
+                    d[i - 1] = f - g;
 
-                        // A part of column "l" of matrix A from row "l" to end multiply by -1.0
-                        for (i = l; i < rowsA; i++)
-                        {
-                            u[(l * rowsA) + i] = u[(l * rowsA) + i] * -1.0;
-                        }
+                    for (var j = 0; j < i; j++)
+                    {
+                        e[j] = 0.0;
+                    }
 
-                        u[(l * rowsA) + l] = 1.0 + u[(l * rowsA) + l];
-                        for (i = 0; i < l; i++)
+                    // Apply similarity transformation to remaining columns.
+                    for (var j = 0; j < i; j++)
+                    {
+                        f = d[j];
+                        a[(i * order) + j] = f;
+                        g = e[j] + (a[(j * order) + j] * f);
+
+                        for (var k = j + 1; k <= i - 1; k++)
                         {
-                            u[(l * rowsA) + i] = 0.0;
+                            g += a[(j * order) + k] * d[k];
+                            e[k] += a[(j * order) + k] * f;
                         }
+
+                        e[j] = g;
                     }
-                    else
+
+                    f = 0.0;
+
+                    for (var j = 0; j < i; j++)
                     {
-                        for (i = 0; i < rowsA; i++)
+                        e[j] /= h;
+                        f += e[j] * d[j];
+                    }
+
+                    var hh = f / (h + h);
+
+                    for (var j = 0; j < i; j++)
+                    {
+                        e[j] -= hh * d[j];
+                    }
+
+                    for (var j = 0; j < i; j++)
+                    {
+                        f = d[j];
+                        g = e[j];
+
+                        for (var k = j; k <= i - 1; k++)
                         {
-                            u[(l * rowsA) + i] = 0.0;
+                            a[(j * order) + k] -= (f * e[k]) + (g * d[k]);
                         }
 
-                        u[(l * rowsA) + l] = 1.0;
+                        d[j] = a[(j * order) + i - 1];
+                        a[(j * order) + i] = 0.0;
                     }
                 }
+
+                d[i] = h;
             }
 
-            // If it is required, generate v.
-            if (computeVectors)
+            // Accumulate transformations.
+            for (var i = 0; i < order - 1; i++)
             {
-                for (l = columnsA - 1; l >= 0; l--)
+                a[(i * order) + order - 1] = a[(i * order) + i];
+                a[(i * order) + i] = 1.0;
+                var h = d[i + 1];
+                if (h != 0.0)
                 {
-                    lp1 = l + 1;
-                    if (l < nrt)
+                    for (var k = 0; k <= i; k++)
                     {
-                        if (e[l] != 0.0)
-                        {
-                            for (j = lp1; j < columnsA; j++)
-                            {
-                                t = 0.0;
-                                for (i = lp1; i < columnsA; i++)
-                                {
-                                    t += v[(j * columnsA) + i] * v[(l * columnsA) + i];
-                                }
-
-                                t = -t / v[(l * columnsA) + lp1];
-                                for (var ii = l; ii < columnsA; ii++)
-                                {
-                                    v[(j * columnsA) + ii] += t * v[(l * columnsA) + ii];
-                                }
-                            }
-                        }
+                        d[k] = a[((i + 1) * order) + k] / h;
                     }
 
-                    for (i = 0; i < columnsA; i++)
+                    for (var j = 0; j <= i; j++)
                     {
-                        v[(l * columnsA) + i] = 0.0;
+                        var g = 0.0;
+                        for (var k = 0; k <= i; k++)
+                        {
+                            g += a[((i + 1) * order) + k] * a[(j * order) + k];
+                        }
+
+                        for (var k = 0; k <= i; k++)
+                        {
+                            a[(j * order) + k] -= g * d[k];
+                        }
                     }
+                }
 
-                    v[(l * columnsA) + l] = 1.0;
+                for (var k = 0; k <= i; k++)
+                {
+                    a[((i + 1) * order) + k] = 0.0;
                 }
             }
 
-            // Transform "s" and "e" so that they are double
-            for (i = 0; i < m; i++)
+            for (var j = 0; j < order; j++)
             {
-                double r;
-                if (stemp[i] != 0.0)
+                d[j] = a[(j * order) + order - 1];
+                a[(j * order) + order - 1] = 0.0;
+            }
+
+            a[(order * order) - 1] = 1.0;
+            e[0] = 0.0;
+        }
+
+        /// <summary>
+        /// Symmetric tridiagonal QL algorithm.
+        /// </summary>
+        /// <param name="a">Data array of matrix V (eigenvectors)</param>
+        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
+        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <remarks>This is derived from the Algol procedures tql2, by
+        /// Bowdler, Martin, Reinsch, and Wilkinson, Handbook for
+        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding
+        /// Fortran subroutine in EISPACK.</remarks>
+        private static void SymmetricDiagonalize(double[] a, double[] d, double[] e, int order)
+        {
+            const int Maxiter = 1000;
+
+            for (var i = 1; i < order; i++)
+            {
+                e[i - 1] = e[i];
+            }
+
+            e[order - 1] = 0.0;
+
+            var f = 0.0;
+            var tst1 = 0.0;
+            var eps = Precision.DoubleMachinePrecision;
+            for (var l = 0; l < order; l++)
+            {
+                // Find small subdiagonal element
+                tst1 = Math.Max(tst1, Math.Abs(d[l]) + Math.Abs(e[l]));
+                var m = l;
+                while (m < order)
                 {
-                    t = stemp[i];
-                    r = stemp[i] / t;
-                    stemp[i] = t;
-                    if (i < m - 1)
+                    if (Math.Abs(e[m]) <= eps * tst1)
                     {
-                        e[i] = e[i] / r;
+                        break;
                     }
 
-                    if (computeVectors)
+                    m++;
+                }
+
+                // If m == l, d[l] is an eigenvalue,
+                // otherwise, iterate.
+                if (m > l)
+                {
+                    var iter = 0;
+                    do
                     {
-                        // A part of column "i" of matrix U from row 0 to end multiply by r
-                        for (j = 0; j < rowsA; j++)
+                        iter = iter + 1; // (Could check iteration count here.)
+
+                        // Compute implicit shift
+                        var g = d[l];
+                        var p = (d[l + 1] - g) / (2.0 * e[l]);
+                        var r = SpecialFunctions.Hypotenuse(p, 1.0);
+                        if (p < 0)
                         {
-                            u[(i * rowsA) + j] = u[(i * rowsA) + j] * r;
+                            r = -r;
                         }
-                    }
-                }
 
-                // Exit
-                if (i == m - 1)
-                {
-                    break;
-                }
+                        d[l] = e[l] / (p + r);
+                        d[l + 1] = e[l] * (p + r);
 
-                if (e[i] == 0.0)
-                {
-                    continue;
+                        var dl1 = d[l + 1];
+                        var h = g - d[l];
+                        for (var i = l + 2; i < order; i++)
+                        {
+                            d[i] -= h;
+                        }
+
+                        f = f + h;
+
+                        // Implicit QL transformation.
+                        p = d[m];
+                        var c = 1.0;
+                        var c2 = c;
+                        var c3 = c;
+                        var el1 = e[l + 1];
+                        var s = 0.0;
+                        var s2 = 0.0;
+                        for (var i = m - 1; i >= l; i--)
+                        {
+                            c3 = c2;
+                            c2 = c;
+                            s2 = s;
+                            g = c * e[i];
+                            h = c * p;
+                            r = SpecialFunctions.Hypotenuse(p, e[i]);
+                            e[i + 1] = s * r;
+                            s = e[i] / r;
+                            c = p / r;
+                            p = (c * d[i]) - (s * g);
+                            d[i + 1] = h + (s * ((c * g) + (s * d[i])));
+
+                            // Accumulate transformation.
+                            for (var k = 0; k < order; k++)
+                            {
+                                h = a[((i + 1) * order) + k];
+                                a[((i + 1) * order) + k] = (s * a[(i * order) + k]) + (c * h);
+                                a[(i * order) + k] = (c * a[(i * order) + k]) - (s * h);
+                            }
+                        }
+
+                        p = (-s) * s2 * c3 * el1 * e[l] / dl1;
+                        e[l] = s * p;
+                        d[l] = c * p;
+
+                        // Check for convergence. If too many iterations have been performed, 
+                        // throw exception that Convergence Failed
+                        if (iter >= Maxiter)
+                        {
+                            throw new ArgumentException(Resources.ConvergenceFailed);
+                        }
+                    }
+                    while (Math.Abs(e[l]) > eps * tst1);
                 }
 
-                t = e[i];
-                r = t / e[i];
-                e[i] = t;
-                stemp[i + 1] = stemp[i + 1] * r;
-                if (!computeVectors)
+                d[l] = d[l] + f;
+                e[l] = 0.0;
+            }
+
+            // Sort eigenvalues and corresponding vectors.
+            for (var i = 0; i < order - 1; i++)
+            {
+                var k = i;
+                var p = d[i];
+                for (var j = i + 1; j < order; j++)
                 {
-                    continue;
+                    if (d[j] < p)
+                    {
+                        k = j;
+                        p = d[j];
+                    }
                 }
 
-                // A part of column "i+1" of matrix VT from row 0 to end multiply by r
-                for (j = 0; j < columnsA; j++)
+                if (k != i)
                 {
-                    v[((i + 1) * columnsA) + j] = v[((i + 1) * columnsA) + j] * r;
+                    d[k] = d[i];
+                    d[i] = p;
+                    for (var j = 0; j < order; j++)
+                    {
+                        p = a[(i * order) + j];
+                        a[(i * order) + j] = a[(k * order) + j];
+                        a[(k * order) + j] = p;
+                    }
                 }
             }
+        }
 
-            // Main iteration loop for the singular values.
-            var mn = m;
-            var iter = 0;
+        /// <summary>
+        /// Nonsymmetric reduction to Hessenberg form.
+        /// </summary>
+        /// <param name="a">Data array of matrix V (eigenvectors)</param>
+        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <remarks>This is derived from the Algol procedures orthes and ortran,
+        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
+        /// Vol.ii-Linear Algebra, and the corresponding
+        /// Fortran subroutines in EISPACK.</remarks>
+        private static void NonsymmetricReduceToHessenberg(double[] a, double[,] matrixH, int order)
+        {
+            var ort = new double[order];
 
-            while (m > 0)
+            for (var m = 1; m < order - 1; m++)
             {
-                // Quit if all the singular values have been found.
-                // If too many iterations have been performed throw exception.
-                if (iter >= Maxiter)
+                // Scale column.
+                var scale = 0.0;
+                for (var i = m; i < order; i++)
                 {
-                    throw new ArgumentException(Resources.ConvergenceFailed);
+                    scale = scale + Math.Abs(matrixH[i, m - 1]);
                 }
 
-                // This section of the program inspects for negligible elements in the s and e arrays,  
-                // on completion the variables kase and l are set as follows:
-                // kase = 1: if mS[m] and e[l-1] are negligible and l < m
-                // kase = 2: if mS[l] is negligible and l < m
-                // kase = 3: if e[l-1] is negligible, l < m, and mS[l, ..., mS[m] are not negligible (qr step).
-                // kase = 4: if e[m-1] is negligible (convergence).
-                double ztest;
-                double test;
-                for (l = m - 2; l >= 0; l--)
+                if (scale != 0.0)
                 {
-                    test = Math.Abs(stemp[l]) + Math.Abs(stemp[l + 1]);
-                    ztest = test + Math.Abs(e[l]);
-                    if (ztest.AlmostEqualInDecimalPlaces(test, 15))
+                    // Compute Householder transformation.
+                    var h = 0.0;
+                    for (var i = order - 1; i >= m; i--)
                     {
-                        e[l] = 0.0;
-                        break;
+                        ort[i] = matrixH[i, m - 1] / scale;
+                        h += ort[i] * ort[i];
+                    }
+
+                    var g = Math.Sqrt(h);
+                    if (ort[m] > 0)
+                    {
+                        g = -g;
+                    }
+
+                    h = h - (ort[m] * g);
+                    ort[m] = ort[m] - g;
+
+                    // Apply Householder similarity transformation
+                    // H = (I-u*u'/h)*H*(I-u*u')/h)
+                    for (var j = m; j < order; j++)
+                    {
+                        var f = 0.0;
+                        for (var i = order - 1; i >= m; i--)
+                        {
+                            f += ort[i] * matrixH[i, j];
+                        }
+
+                        f = f / h;
+                        for (var i = m; i < order; i++)
+                        {
+                            matrixH[i, j] -= f * ort[i];
+                        }
+                    }
+
+                    for (var i = 0; i < order; i++)
+                    {
+                        var f = 0.0;
+                        for (var j = order - 1; j >= m; j--)
+                        {
+                            f += ort[j] * matrixH[i, j];
+                        }
+
+                        f = f / h;
+                        for (var j = m; j < order; j++)
+                        {
+                            matrixH[i, j] -= f * ort[j];
+                        }
                     }
+
+                    ort[m] = scale * ort[m];
+                    matrixH[m, m - 1] = scale * g;
                 }
+            }
 
-                int kase;
-                if (l == m - 2)
+            // Accumulate transformations (Algol's ortran).
+            for (var i = 0; i < order; i++)
+            {
+                for (var j = 0; j < order; j++)
                 {
-                    kase = 4;
+                    a[(j * order) + i] = i == j ? 1.0 : 0.0;
                 }
-                else
+            }
+
+            for (var m = order - 2; m >= 1; m--)
+            {
+                if (matrixH[m, m - 1] != 0.0)
                 {
-                    int ls;
-                    for (ls = m - 1; ls > l; ls--)
+                    for (var i = m + 1; i < order; i++)
                     {
-                        test = 0.0;
-                        if (ls != m - 1)
-                        {
-                            test = test + Math.Abs(e[ls]);
-                        }
+                        ort[i] = matrixH[i, m - 1];
+                    }
 
-                        if (ls != l + 1)
+                    for (var j = m; j < order; j++)
+                    {
+                        var g = 0.0;
+                        for (var i = m; i < order; i++)
                         {
-                            test = test + Math.Abs(e[ls - 1]);
+                            g += ort[i] * a[(j * order) + i];
                         }
-
-                        ztest = test + Math.Abs(stemp[ls]);
-                        if (ztest.AlmostEqualInDecimalPlaces(test, 15))
+
+                        // Double division avoids possible underflow
+                        g = (g / ort[m]) / matrixH[m, m - 1];
+                        for (var i = m; i < order; i++)
                         {
-                            stemp[ls] = 0.0;
-                            break;
+                            a[(j * order) + i] += g * ort[i];
                         }
                     }
+                }
+            }
+        }
 
-                    if (ls == l)
-                    {
-                        kase = 3;
-                    }
-                    else if (ls == m - 1)
+        /// <summary>
+        /// Nonsymmetric reduction from Hessenberg to real Schur form.
+        /// </summary>
+        /// <param name="a">Data array of matrix V (eigenvectors)</param>
+        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
+        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
+        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
+        /// <param name="order">Order of initial matrix</param>
+        /// <param name="computeVectors">If <c>false</c>, stops at the real Schur form: <paramref name="matrixH"/> then holds
+        /// the quasi-triangular factor and <paramref name="a"/> the Schur vectors.</param>
+        /// <remarks>This is derived from the Algol procedure hqr2,
+        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
+        /// Vol.ii-Linear Algebra, and the corresponding
+        /// Fortran subroutine in EISPACK.</remarks>
+        private static void NonsymmetricReduceHessenberToRealSchur(double[] a, double[,] matrixH, double[] d, double[] e, int order, bool computeVectors)
+        {
+            // Initialize
+            var n = order - 1;
+            var eps = Precision.DoubleMachinePrecision;
+            var exshift = 0.0;
+            double p = 0, q = 0, r = 0, s = 0, z = 0, w, x, y;
+
+            // Store roots isolated by balanc and compute matrix norm
+            var norm = 0.0;
+            for (var i = 0; i < order; i++)
+            {
+                for (var j = Math.Max(i - 1, 0); j < order; j++)
+                {
+                    norm = norm + Math.Abs(matrixH[i, j]);
+                }
+            }
+
+            // Outer loop over eigenvalue index
+            var iter = 0;
+            while (n >= 0)
+            {
+                // Look for single small sub-diagonal element
+                var l = n;
+                while (l > 0)
+                {
+                    s = Math.Abs(matrixH[l - 1, l - 1]) + Math.Abs(matrixH[l, l]);
+
+                    if (s == 0.0)
                     {
-                        kase = 1;
+                        s = norm;
                     }
-                    else
+
+                    if (Math.Abs(matrixH[l, l - 1]) < eps * s)
                     {
-                        kase = 2;
-                        l = ls;
+                        break;
                     }
+
+                    l--;
                 }
 
-                l = l + 1;
+                // Check for convergence
+                // One root found
+                if (l == n)
+                {
+                    matrixH[n, n] = matrixH[n, n] + exshift;
+                    d[n] = matrixH[n, n];
+                    e[n] = 0.0;
+                    n--;
+                    iter = 0;
 
-                // Perform the task indicated by kase.
-                int k;
-                double f;
-                switch (kase)
+                    // Two roots found
+                }
+                else if (l == n - 1)
                 {
-                        // Deflate negligible s[m].
-                    case 1:
-                        f = e[m - 2];
-                        e[m - 2] = 0.0;
-                        double t1;
-                        for (var kk = l; kk < m - 1; kk++)
+                    w = matrixH[n, n - 1] * matrixH[n - 1, n];
+                    p = (matrixH[n - 1, n - 1] - matrixH[n, n]) / 2.0;
+                    q = (p * p) + w;
+                    z = Math.Sqrt(Math.Abs(q));
+                    matrixH[n, n] = matrixH[n, n] + exshift;
+                    matrixH[n - 1, n - 1] = matrixH[n - 1, n - 1] + exshift;
+                    x = matrixH[n, n];
+
+                    // Real pair
+                    if (q >= 0)
+                    {
+                        if (p >= 0)
                         {
-                            k = m - 2 - kk + l;
-                            t1 = stemp[k];
-
-                            Drotg(ref t1, ref f, ref cs, ref sn);
-                            stemp[k] = t1;
-                            if (k != l)
-                            {
-                                f = -sn * e[k - 1];
-                                e[k - 1] = cs * e[k - 1];
-                            }
-
-                            if (computeVectors)
-                            {
-                                // Rotate
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((m - 1) * columnsA) + i]);
-                                    v[((m - 1) * columnsA) + i] = (cs * v[((m - 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
-                                    v[(k * columnsA) + i] = z;
-                                }
-                            }
+                            z = p + z;
                         }
-
-                        break;
-
-                    // Split at negligible s[l].
-                    case 2:
-                        f = e[l - 1];
-                        e[l - 1] = 0.0;
-                        for (k = l; k < m; k++)
+                        else
                         {
-                            t1 = stemp[k];
-                            Drotg(ref t1, ref f, ref cs, ref sn);
-                            stemp[k] = t1;
-                            f = -sn * e[k];
-                            e[k] = cs * e[k];
-                            if (computeVectors)
-                            {
-                                // Rotate
-                                for (i = 0; i < rowsA; i++)
-                                {
-                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((l - 1) * rowsA) + i]);
-                                    u[((l - 1) * rowsA) + i] = (cs * u[((l - 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
-                                    u[(k * rowsA) + i] = z;
-                                }
-                            }
+                            z = p - z;
                         }
 
-                        break;
-
-                        // Perform one qr step.
-                    case 3:
+                        d[n - 1] = x + z;
 
-                        // calculate the shift.
-                        var scale = 0.0;
-                        scale = Math.Max(scale, Math.Abs(stemp[m - 1]));
-                        scale = Math.Max(scale, Math.Abs(stemp[m - 2]));
-                        scale = Math.Max(scale, Math.Abs(e[m - 2]));
-                        scale = Math.Max(scale, Math.Abs(stemp[l]));
-                        scale = Math.Max(scale, Math.Abs(e[l]));
-                        var sm = stemp[m - 1] / scale;
-                        var smm1 = stemp[m - 2] / scale;
-                        var emm1 = e[m - 2] / scale;
-                        var sl = stemp[l] / scale;
-                        var el = e[l] / scale;
-                        var b = (((smm1 + sm) * (smm1 - sm)) + (emm1 * emm1)) / 2.0;
-                        var c = (sm * emm1) * (sm * emm1);
-                        var shift = 0.0;
-                        if (b != 0.0 || c != 0.0)
+                        d[n] = d[n - 1];
+                        if (z != 0.0)
                         {
-                            shift = Math.Sqrt((b * b) + c);
-                            if (b < 0.0)
-                            {
-                                shift = -shift;
-                            }
-
-                            shift = c / (b + shift);
+                            d[n] = x - (w / z);
                         }
 
-                        f = ((sl + sm) * (sl - sm)) + shift;
-                        var g = sl * el;
-
-                        // Chase zeros
-                        for (k = l; k < m - 1; k++)
+                        e[n - 1] = 0.0;
+                        e[n] = 0.0;
+                        x = matrixH[n, n - 1];
+                        s = Math.Abs(x) + Math.Abs(z);
+                        p = x / s;
+                        q = z / s;
+                        r = Math.Sqrt((p * p) + (q * q));
+                        p = p / r;
+                        q = q / r;
+
+                        // Row modification
+                        for (var j = n - 1; j < order; j++)
                         {
-                            Drotg(ref f, ref g, ref cs, ref sn);
-                            if (k != l)
-                            {
-                                e[k - 1] = f;
-                            }
-
-                            f = (cs * stemp[k]) + (sn * e[k]);
-                            e[k] = (cs * e[k]) - (sn * stemp[k]);
-                            g = sn * stemp[k + 1];
-                            stemp[k + 1] = cs * stemp[k + 1];
-                            if (computeVectors)
-                            {
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    var z = (cs * v[(k * columnsA) + i]) + (sn * v[((k + 1) * columnsA) + i]);
-                                    v[((k + 1) * columnsA) + i] = (cs * v[((k + 1) * columnsA) + i]) - (sn * v[(k * columnsA) + i]);
-                                    v[(k * columnsA) + i] = z;
-                                }
-                            }
-
-                            Drotg(ref f, ref g, ref cs, ref sn);
-                            stemp[k] = f;
-                            f = (cs * e[k]) + (sn * stemp[k + 1]);
-                            stemp[k + 1] = -(sn * e[k]) + (cs * stemp[k + 1]);
-                            g = sn * e[k + 1];
-                            e[k + 1] = cs * e[k + 1];
-                            if (computeVectors && k < rowsA)
-                            {
-                                for (i = 0; i < rowsA; i++)
-                                {
-                                    var z = (cs * u[(k * rowsA) + i]) + (sn * u[((k + 1) * rowsA) + i]);
-                                    u[((k + 1) * rowsA) + i] = (cs * u[((k + 1) * rowsA) + i]) - (sn * u[(k * rowsA) + i]);
-                                    u[(k * rowsA) + i] = z;
-                                }
-                            }
+                            z = matrixH[n - 1, j];
+                            matrixH[n - 1, j] = (q * z) + (p * matrixH[n, j]);
+                            matrixH[n, j] = (q * matrixH[n, j]) - (p * z);
                         }
 
-                        e[m - 2] = f;
-                        iter = iter + 1;
-                        break;
-
-                        // Convergence
-                    case 4:
-
-                        // Make the singular value  positive
-                        if (stemp[l] < 0.0)
+                        // Column modification
+                        for (var i = 0; i <= n; i++)
                         {
-                            stemp[l] = -stemp[l];
-                            if (computeVectors)
-                            {
-                                // A part of column "l" of matrix VT from row 0 to end multiply by -1
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    v[(l * columnsA) + i] = v[(l * columnsA) + i] * -1.0;
-                                }
-                            }
+                            z = matrixH[i, n - 1];
+                            matrixH[i, n - 1] = (q * z) + (p * matrixH[i, n]);
+                            matrixH[i, n] = (q * matrixH[i, n]) - (p * z);
                         }
 
-                        // Order the singular value.
-                        while (l != mn - 1)
+                        // Accumulate transformations
+                        for (var i = 0; i < order; i++)
                         {
-                            if (stemp[l] >= stemp[l + 1])
-                            {
-                                break;
-                            }
-
-                            t = stemp[l];
-                            stemp[l] = stemp[l + 1];
-                            stemp[l + 1] = t;
-                            if (computeVectors && l < columnsA)
-                            {
-                                // Swap columns l, l + 1
-                                for (i = 0; i < columnsA; i++)
-                                {
-                                    var z = v[(l * columnsA) + i];
-                                    v[(l * columnsA) + i] = v[((l + 1) * columnsA) + i];
-                                    v[((l + 1) * columnsA) + i] = z;
-                                }
-                            }
+                            z = a[((n - 1) * order) + i];
+                            a[((n - 1) * order) + i] = (q * z) + (p * a[(n * order) + i]);
+                            a[(n * order) + i] = (q * a[(n * order) + i]) - (p * z);
+                        }
 
-                            if (computeVectors && l < rowsA)
-                            {
-                                // Swap columns l, l + 1
-                                for (i = 0; i < rowsA; i++)
-                                {
-                                    var z = u[(l * rowsA) + i];
-                                    u[(l * rowsA) + i] = u[((l + 1) * rowsA) + i];
-                                    u[((l + 1) * rowsA) + i] = z;
-                                }
-                            }
+                        // Complex pair
+                    }
+                    else
+                    {
+                        d[n - 1] = x + p;
+                        d[n] = x + p;
+                        e[n - 1] = z;
+                        e[n] = -z;
+                    }
 
-                            l = l + 1;
-                        }
+                    n = n - 2;
+                    iter = 0;
 
-                        iter = 0;
-                        m = m - 1;
-                        break;
+                    // No convergence yet
                 }
-            }
-
-            if (computeVectors)
-            {
-                // Finally transpose "v" to get "vt" matrix 
-                for (i = 0; i < columnsA; i++)
+                else
                 {
-                    for (j = 0; j < columnsA; j++)
+                    // Form shift
+                    x = matrixH[n, n];
+                    y = 0.0;
+                    w = 0.0;
+                    if (l < n)
                     {
-                        vt[(j * columnsA) + i] = v[(i * columnsA) + j];
+                        y = matrixH[n - 1, n - 1];
+                        w = matrixH[n, n - 1] * matrixH[n - 1, n];
                     }
-                }
-            }
 
-            // Copy stemp to s with size adjustment. We are using ported copy of linpack's svd code and it uses
-            // a singular vector of length rows+1 when rows < columns. The last element is not used and needs to be removed.
-            // We should port lapack's svd routine to remove this problem.
-            Buffer.BlockCopy(stemp, 0, s, 0, Math.Min(rowsA, columnsA) * Constants.SizeOfDouble);
+                    // Wilkinson's original ad hoc shift
+                    if (iter == 10)
+                    {
+                        exshift += x;
+                        for (var i = 0; i <= n; i++)
+                        {
+                            matrixH[i, i] -= x;
+                        }
 
-            // On return the first element of the work array stores the min size of the work array could have been
-            // work[0] = Math.Max(3 * Math.Min(aRows, aColumns) + Math.Max(aRows, aColumns), 5 * Math.Min(aRows, aColumns));
-            work[0] = rowsA;
-        }
+                        s = Math.Abs(matrixH[n, n - 1]) + Math.Abs(matrixH[n - 1, n - 2]);
+                        x = y = 0.75 * s;
+                        w = (-0.4375) * s * s;
+                    }
 
-        /// <summary>
-        /// Given the Cartesian coordinates (da, db) of a point p, these function return the parameters da, db, c, and s 
-        /// associated with the Givens rotation that zeros the y-coordinate of the point.
-        /// </summary>
-        /// <param name="da">Provides the x-coordinate of the point p. On exit contains the parameter r associated with the Givens rotation</param>
-        /// <param name="db">Provides the y-coordinate of the point p. On exit contains the parameter z associated with the Givens rotation</param>
-        /// <param name="c">Contains the parameter c associated with the Givens rotation</param>
-        /// <param name="s">Contains the parameter s associated with the Givens rotation</param>
-        /// <remarks>This is equivalent to the DROTG LAPACK routine.</remarks>
-        private static void Drotg(ref double da, ref double db, ref double c, ref double s)
-        {
-            double r, z;
+                    // MATLAB's new ad hoc shift
+                    if (iter == 30)
+                    {
+                        s = (y - x) / 2.0;
+                        s = (s * s) + w;
+                        if (s > 0)
+                        {
+                            s = Math.Sqrt(s);
+                            if (y < x)
+                            {
+                                s = -s;
+                            }
+
+                            s = x - (w / (((y - x) / 2.0) + s));
+                            for (var i = 0; i <= n; i++)
+                            {
+                                matrixH[i, i] -= s;
+                            }
 
-            var roe = db;
-            var absda = Math.Abs(da);
-            var absdb = Math.Abs(db);
-            if (absda > absdb)
-            {
-                roe = da;
-            }
+                            exshift += s;
+                            x = y = w = 0.964;
+                        }
+                    }
 
-            var scale = absda + absdb;
-            if (scale == 0.0)
-            {
-                c = 1.0;
-                s = 0.0;
-                r = 0.0;
-                z = 0.0;
-            }
-            else
-            {
-                var sda = da / scale;
-                var sdb = db / scale;
-                r = scale * Math.Sqrt((sda * sda) + (sdb * sdb));
-                if (roe < 0.0)
-                {
-                    r = -r;
-                }
+                    iter = iter + 1; // (Could check iteration count here.)
 
-                c = da / r;
-                s = db / r;
-                z = 1.0;
-                if (absda > absdb)
-                {
-                    z = s;
-                }
+                    // Look for two consecutive small sub-diagonal elements
+                    var m = n - 2;
+                    while (m >= l)
+                    {
+                        z = matrixH[m, m];
+                        r = x - z;
+                        s = y - z;
+                        p = (((r * s) - w) / matrixH[m + 1, m]) + matrixH[m, m + 1];
+                        q = matrixH[m + 1, m + 1] - z - r - s;
+                        r = matrixH[m + 2, m + 1];
+                        s = Math.Abs(p) + Math.Abs(q) + Math.Abs(r);
+                        p = p / s;
+                        q = q / s;
+                        r = r / s;
+
+                        if (m == l)
+                        {
+                            break;
+                        }
 
-                if (absdb >= absda && c != 0.0)
-                {
-                    z = 1.0 / c;
-                }
-            }
+                        if (Math.Abs(matrixH[m, m - 1]) * (Math.Abs(q) + Math.Abs(r)) < eps * (Math.Abs(p) * (Math.Abs(matrixH[m - 1, m - 1]) + Math.Abs(z) + Math.Abs(matrixH[m + 1, m + 1]))))
+                        {
+                            break;
+                        }
 
-            da = r;
-            db = z;
-        }
+                        m--;
+                    }
 
-        /// <summary>
-        /// Solves A*X=B for X using the singular value decomposition of A.
-        /// </summary>
-        /// <param name="a">On entry, the M by N matrix to decompose.</param>
-        /// <param name="rowsA">The number of rows in the A matrix.</param>
-        /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        public virtual void SvdSolve(double[] a, int rowsA, int columnsA, double[] b, int columnsB, double[] x)
-        {
-            if (a == null)
-            {
-                throw new ArgumentNullException("a");
-            }
+                    for (var i = m + 2; i <= n; i++)
+                    {
+                        matrixH[i, i - 2] = 0.0;
+                        if (i > m + 2)
+                        {
+                            matrixH[i, i - 3] = 0.0;
+                        }
+                    }
 
-            if (b == null)
-            {
-                throw new ArgumentNullException("b");
-            }
+                    // Double QR step involving rows l:n and columns m:n
+                    for (var k = m; k <= n - 1; k++)
+                    {
+                        bool notlast = k != n - 1;
 
-            if (x == null)
-            {
-                throw new ArgumentNullException("x");
-            }
+                        if (k != m)
+                        {
+                            p = matrixH[k, k - 1];
+                            q = matrixH[k + 1, k - 1];
+                            r = notlast ? matrixH[k + 2, k - 1] : 0.0;
+                            x = Math.Abs(p) + Math.Abs(q) + Math.Abs(r);
+                            if (x != 0.0)
+                            {
+                                p = p / x;
+                                q = q / x;
+                                r = r / x;
+                            }
+                        }
 
-            if (b.Length != rowsA * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                        if (x == 0.0)
+                        {
+                            break;
+                        }
 
-            if (x.Length != columnsA * columnsB)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                        s = Math.Sqrt((p * p) + (q * q) + (r * r));
+                        if (p < 0)
+                        {
+                            s = -s;
+                        }
 
-            var work = new double[rowsA];
-            var s = new double[Math.Min(rowsA, columnsA)];
-            var u = new double[rowsA * rowsA];
-            var vt = new double[columnsA * columnsA];
+                        if (s != 0.0)
+                        {
+                            if (k != m)
+                            {
+                                matrixH[k, k - 1] = (-s) * x;
+                            }
+                            else if (l != m)
+                            {
+                                matrixH[k, k - 1] = -matrixH[k, k - 1];
+                            }
 
-            var clone = new double[a.Length];
-            Buffer.BlockCopy(a, 0, clone, 0, a.Length * Constants.SizeOfDouble);
-            SingularValueDecomposition(true, clone, rowsA, columnsA, s, u, vt, work);
-            SvdSolveFactored(rowsA, columnsA, s, u, vt, b, columnsB, x);
-        }
+                            p = p + s;
+                            x = p / s;
+                            y = q / s;
+                            z = r / s;
+                            q = q / p;
+                            r = r / p;
 
-        /// <summary>
-        /// Solves A*X=B for X using a previously SVD decomposed matrix.
-        /// </summary>
-        /// <param name="rowsA">The number of rows in the A matrix.</param>
-        /// <param name="columnsA">The number of columns in the A matrix.</param>
-        /// <param name="s">The s values returned by <see cref="SingularValueDecomposition(bool,double[],int,int,double[],double[],double[])"/>.</param>
-        /// <param name="u">The left singular vectors returned by  <see cref="SingularValueDecomposition(bool,double[],int,int,double[],double[],double[])"/>.</param>
-        /// <param name="vt">The right singular  vectors returned by  <see cref="SingularValueDecomposition(bool,double[],int,int,double[],double[],double[])"/>.</param>
-        /// <param name="b">The B matrix.</param>
-        /// <param name="columnsB">The number of columns of B.</param>
-        /// <param name="x">On exit, the solution matrix.</param>
-        public virtual void SvdSolveFactored(int rowsA, int columnsA, double[] s, double[] u, double[] vt, double[] b, int columnsB, double[] x)
-        {
-            if (s == null)
-            {
-                throw new ArgumentNullException("s");
-            }
+                            // Row modification
+                            for (var j = k; j < order; j++)
+                            {
+                                p = matrixH[k, j] + (q * matrixH[k + 1, j]);
 
-            if (u == null)
-            {
-                throw new ArgumentNullException("u");
-            }
+                                if (notlast)
+                                {
+                                    p = p + (r * matrixH[k + 2, j]);
+                                    matrixH[k + 2, j] = matrixH[k + 2, j] - (p * z);
+                                }
 
-            if (vt == null)
-            {
-                throw new ArgumentNullException("vt");
-            }
+                                matrixH[k, j] = matrixH[k, j] - (p * x);
+                                matrixH[k + 1, j] = matrixH[k + 1, j] - (p * y);
+                            }
 
-            if (b == null)
-            {
-                throw new ArgumentNullException("b");
-            }
+                            // Column modification
+                            for (var i = 0; i <= Math.Min(n, k + 3); i++)
+                            {
+                                p = (x * matrixH[i, k]) + (y * matrixH[i, k + 1]);
 
-            if (x == null)
-            {
-                throw new ArgumentNullException("x");
-            }
+                                if (notlast)
+                                {
+                                    p = p + (z * matrixH[i, k + 2]);
+                                    matrixH[i, k + 2] = matrixH[i, k + 2] - (p * r);
+                                }
 
-            if (u.Length != rowsA * rowsA)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "u");
-            }
+                                matrixH[i, k] = matrixH[i, k] - p;
+                                matrixH[i, k + 1] = matrixH[i, k + 1] - (p * q);
+                            }
 
-            if (vt.Length != columnsA * columnsA)
-            {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "vt");
-            }
+                            // Accumulate transformations
+                            for (var i = 0; i < order; i++)
+                            {
+                                p = (x * a[(k * order) + i]) + (y * a[((k + 1) * order) + i]);
 
-            if (s.Length != Math.Min(rowsA, columnsA))
+                                if (notlast)
+                                {
+                                    p = p + (z * a[((k + 2) * order) + i]);
+                                    a[((k + 2) * order) + i] -= p * r;
+                                }
+
+                                a[(k * order) + i] -= p;
+                                a[((k + 1) * order) + i] -= p * q;
+                            }
+                        } // (s != 0)
+                    } // k loop
+                } // check convergence
+            } // while (n >= low)
+
+            if (!computeVectors)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "s");
+                return;
             }
 
-            if (b.Length != rowsA * columnsB)
+            // Backsubstitute to find vectors of upper triangular form
+            if (norm == 0.0)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
+                return;
             }
 
-            if (x.Length != columnsA * columnsB)
+            for (n = order - 1; n >= 0; n--)
             {
-                throw new ArgumentException(Resources.ArgumentArraysSameLength, "b");
-            }
+                double t;
 
-            var mn = Math.Min(rowsA, columnsA);
-            var tmp = new double[columnsA];
+                p = d[n];
+                q = e[n];
 
-            for (var k = 0; k < columnsB; k++)
-            {
-                for (var j = 0; j < columnsA; j++)
+                // Real vector
+                if (q == 0.0)
                 {
-                    double value = 0;
-                    if (j < mn)
+                    var l = n;
+                    matrixH[n, n] = 1.0;
+                    for (var i = n - 1; i >= 0; i--)
                     {
-                        for (var i = 0; i < rowsA; i++)
+                        w = matrixH[i, i] - p;
+                        r = 0.0;
+                        for (var j = l; j <= n; j++)
                         {
-                            value += u[(j * rowsA) + i] * b[(k * rowsA) + i];
+                            r = r + (matrixH[i, j] * matrixH[j, n]);
                         }
 
-                        value /= s[j];
+                        if (e[i] < 0.0)
+                        {
+                            z = w;
+                            s = r;
+                        }
+                        else
+                        {
+                            l = i;
+                            if (e[i] == 0.0)
+                            {
+                                if (w != 0.0)
+                                {
+                                    matrixH[i, n] = (-r) / w;
+                                }
+                                else
+                                {
+                                    matrixH[i, n] = (-r) / (eps * norm);
+                                }
+
+                                // Solve real equations
+                            }
+                            else
+                            {
+                                x = matrixH[i, i + 1];
+                                y = matrixH[i + 1, i];
+                                q = ((d[i] - p) * (d[i] - p)) + (e[i] * e[i]);
+                                t = ((x * s) - (z * r)) / q;
+                                matrixH[i, n] = t;
+                                if (Math.Abs(x) > Math.Abs(z))
+                                {
+                                    matrixH[i + 1, n] = (-r - (w * t)) / x;
+                                }
+                                else
+                                {
+                                    matrixH[i + 1, n] = (-s - (y * t)) / z;
+                                }
+                            }
+
+                            // Overflow control
+                            t = Math.Abs(matrixH[i, n]);
+                            if ((eps * t) * t > 1)
+                            {
+                                for (var j = i; j <= n; j++)
+                                {
+                                    matrixH[j, n] = matrixH[j, n] / t;
+                                }
+                            }
+                        }
                     }
 
-                    tmp[j] = value;
+                    // Complex vector
                 }
+                else if (q < 0)
+                {
+                    var l = n - 1;
 
-                for (var j = 0; j < columnsA; j++)
+                    // Last vector component imaginary so matrix is triangular
+                    if (Math.Abs(matrixH[n, n - 1]) > Math.Abs(matrixH[n - 1, n]))
+                    {
+                        matrixH[n - 1, n - 1] = q / matrixH[n, n - 1];
+                        matrixH[n - 1, n] = (-(matrixH[n, n] - p)) / matrixH[n, n - 1];
+                    }
+                    else
+                    {
+                        var res = Cdiv(0.0, -matrixH[n - 1, n], matrixH[n - 1, n - 1] - p, q);
+                        matrixH[n - 1, n - 1] = res.Real;
+                        matrixH[n - 1, n] = res.Imaginary;
+                    }
+
+                    matrixH[n, n - 1] = 0.0;
+                    matrixH[n, n] = 1.0;
+                    for (var i = n - 2; i >= 0; i--)
+                    {
+                        double ra = 0.0;
+                        double sa = 0.0;
+                        for (var j = l; j <= n; j++)
+                        {
+                            ra = ra + (matrixH[i, j] * matrixH[j, n - 1]);
+                            sa = sa + (matrixH[i, j] * matrixH[j, n]);
+                        }
+
+                        w = matrixH[i, i] - p;
+
+                        if (e[i] < 0.0)
+                        {
+                            z = w;
+                            r = ra;
+                            s = sa;
+                        }
+                        else
+                        {
+                            l = i;
+                            if (e[i] == 0.0)
+                            {
+                                var res = Cdiv(-ra, -sa, w, q);
+                                matrixH[i, n - 1] = res.Real;
+                                matrixH[i, n] = res.Imaginary;
+                            }
+                            else
+                            {
+                                // Solve complex equations
+                                x = matrixH[i, i + 1];
+                                y = matrixH[i + 1, i];
+
+                                double vr = ((d[i] - p) * (d[i] - p)) + (e[i] * e[i]) - (q * q);
+                                double vi = (d[i] - p) * 2.0 * q;
+                                if ((vr == 0.0) && (vi == 0.0))
+                                {
+                                    vr = eps * norm * (Math.Abs(w) + Math.Abs(q) + Math.Abs(x) + Math.Abs(y) + Math.Abs(z));
+                                }
+
+                                var res = Cdiv((x * r) - (z * ra) + (q * sa), (x * s) - (z * sa) - (q * ra), vr, vi);
+                                matrixH[i, n - 1] = res.Real;
+                                matrixH[i, n] = res.Imaginary;
+                                if (Math.Abs(x) > (Math.Abs(z) + Math.Abs(q)))
+                                {
+                                    matrixH[i + 1, n - 1] = (-ra - (w * matrixH[i, n - 1]) + (q * matrixH[i, n])) / x;
+                                    matrixH[i + 1, n] = (-sa - (w * matrixH[i, n]) - (q * matrixH[i, n - 1])) / x;
+                                }
+                                else
+                                {
+                                    res = Cdiv(-r - (y * matrixH[i, n - 1]), -s - (y * matrixH[i, n]), z, q);
+                                    matrixH[i + 1, n - 1] = res.Real;
+                                    matrixH[i + 1, n] = res.Imaginary;
+                                }
+                            }
+
+                            // Overflow control
+                            t = Math.Max(Math.Abs(matrixH[i, n - 1]), Math.Abs(matrixH[i, n]));
+                            if ((eps * t) * t > 1)
+                            {
+                                for (var j = i; j <= n; j++)
+                                {
+                                    matrixH[j, n - 1] = matrixH[j, n - 1] / t;
+                                    matrixH[j, n] = matrixH[j, n] / t;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            // Back transformation to get eigenvectors of original matrix
+            for (var j = order - 1; j >= 0; j--)
+            {
+                for (var i = 0; i < order; i++)
                 {
-                    double value = 0;
-                    for (var i = 0; i < columnsA; i++)
+                    z = 0.0;
+                    for (var k = 0; k <= j; k++)
                     {
-                        value += vt[(j * columnsA) + i] * tmp[i];
+                        z = z + (a[(k * order) + i] * matrixH[k, j]);
                     }
 
-                    x[(k * columnsA) + j] = value;
+                    a[(j * order) + i] = z;
                 }
             }
         }
+
+        /// <summary>
+        /// Complex scalar division X/Y.
+        /// </summary>
+        /// <param name="xreal">Real part of X</param>
+        /// <param name="ximag">Imaginary part of X</param>
+        /// <param name="yreal">Real part of Y</param>
+        /// <param name="yimag">Imaginary part of Y</param>
+        /// <returns>Division result as a <see cref="Complex"/> number.</returns>
+        private static Complex Cdiv(double xreal, double ximag, double yreal, double yimag)
+        {
+            if (Math.Abs(yimag) < Math.Abs(yreal))
+            {
+                return new Complex((xreal + (ximag * (yimag / yreal))) / (yreal + (yimag * (yimag / yreal))), (ximag - (xreal * (yimag / yreal))) / (yreal + (yimag * (yimag / yreal))));
+            }
+
+            return new Complex((ximag + (xreal * (yreal / yimag))) / (yimag + (yreal * (yreal / yimag))), (-xreal + (ximag * (yreal / yimag))) / (yimag + (yreal * (yreal / yimag))));
+        }
+
     }
 }
@@ -0,0 +1,208 @@
+﻿// <copyright file="ProviderStatistics.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+//
+// Copyright (c) 2009-2010 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+namespace MathNet.Numerics.Algorithms.LinearAlgebra
+{
+    using System;
+    using System.Collections.Generic;
+    using System.Collections.ObjectModel;
+    using System.Globalization;
+    using System.Text;
+
+    /// <summary>
+    /// Call statistics of a single native export, such as <c>d_matrix_multiply</c>.
+    /// </summary>
+    public class ExportStatistics
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="ExportStatistics"/> class.
+        /// </summary>
+        /// <param name="name">The name of the export.</param>
+        /// <param name="callCount">The number of calls.</param>
+        /// <param name="totalTime">The wall time of all calls.</param>
+        /// <param name="maximumTime">The wall time of the longest call.</param>
+        /// <param name="flops">The estimated number of floating point operations of all calls.</param>
+        /// <param name="bytes">The estimated number of bytes of matrix data all calls touched.</param>
+        public ExportStatistics(string name, long callCount, TimeSpan totalTime, TimeSpan maximumTime, long flops, long bytes)
+        {
+            if (name == null)
+            {
+                throw new ArgumentNullException("name");
+            }
+
+            Name = name;
+            CallCount = callCount;
+            TotalTime = totalTime;
+            MaximumTime = maximumTime;
+            Flops = flops;
+            Bytes = bytes;
+        }
+
+        /// <summary>
+        /// Gets the name of the export.
+        /// </summary>
+        public string Name { get; private set; }
+
+        /// <summary>
+        /// Gets the number of calls.
+        /// </summary>
+        public long CallCount { get; private set; }
+
+        /// <summary>
+        /// Gets the wall time of all calls.
+        /// </summary>
+        public TimeSpan TotalTime { get; private set; }
+
+        /// <summary>
+        /// Gets the wall time of the longest call.
+        /// </summary>
+        public TimeSpan MaximumTime { get; private set; }
+
+        /// <summary>
+        /// Gets the estimated number of floating point operations of all calls, from the leading-order
+        /// operation counts of the underlying LAPACK routines.
+        /// </summary>
+        public long Flops { get; private set; }
+
+        /// <summary>
+        /// Gets the estimated number of bytes of matrix data all calls read or wrote, counting every operand once.
+        /// </summary>
+        public long Bytes { get; private set; }
+
+        /// <summary>
+        /// Gets the achieved rate in billions of floating point operations per second, or zero if no time was recorded.
+        /// </summary>
+        public double GigaflopsPerSecond
+        {
+            get
+            {
+                return TotalTime.Ticks == 0 ? 0.0 : Flops / TotalTime.TotalSeconds / 1e9;
+            }
+        }
+
+        /// <summary>
+        /// Formats a human-readable summary of the statistics.
+        /// </summary>
+        /// <returns>The name, call count, times and rate.</returns>
+        public override string ToString()
+        {
+            return string.Format(
+                CultureInfo.InvariantCulture,
+                "{0}: {1} calls, {2:F3} ms total, {3:F3} ms max, {4:F2} GFlop/s, {5} bytes",
+                Name,
+                CallCount,
+                TotalTime.TotalMilliseconds,
+                MaximumTime.TotalMilliseconds,
+                GigaflopsPerSecond,
+                Bytes);
+        }
+    }
+
+    /// <summary>
+    /// A snapshot of the call statistics a native linear algebra provider records per export.
+    /// </summary>
+    public class ProviderStatistics
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="ProviderStatistics"/> class.
+        /// </summary>
+        /// <param name="exports">The statistics of each export.</param>
+        public ProviderStatistics(IList<ExportStatistics> exports)
+        {
+            if (exports == null)
+            {
+                throw new ArgumentNullException("exports");
+            }
+
+            Exports = new ReadOnlyCollection<ExportStatistics>(exports);
+        }
+
+        /// <summary>
+        /// Gets the statistics of every instrumented export, including those that were not called.
+        /// </summary>
+        public ReadOnlyCollection<ExportStatistics> Exports { get; private set; }
+
+        /// <summary>
+        /// Gets the statistics of the export with the given name.
+        /// </summary>
+        /// <param name="name">The name of the export, such as <c>d_lu_solve</c>.</param>
+        /// <returns>The statistics of the export, or <c>null</c> if it is not instrumented.</returns>
+        public ExportStatistics this[string name]
+        {
+            get
+            {
+                foreach (var export in Exports)
+                {
+                    if (export.Name == name)
+                    {
+                        return export;
+                    }
+                }
+
+                return null;
+            }
+        }
+
+        /// <summary>
+        /// Gets the wall time of all calls of all exports.
+        /// </summary>
+        public TimeSpan TotalTime
+        {
+            get
+            {
+                var total = TimeSpan.Zero;
+                foreach (var export in Exports)
+                {
+                    total += export.TotalTime;
+                }
+
+                return total;
+            }
+        }
+
+        /// <summary>
+        /// Formats a human-readable summary, one line per export that was called.
+        /// </summary>
+        /// <returns>The summary.</returns>
+        public override string ToString()
+        {
+            var builder = new StringBuilder();
+            foreach (var export in Exports)
+            {
+                if (export.CallCount > 0)
+                {
+                    builder.AppendLine(export.ToString());
+                }
+            }
+
+            return builder.ToString();
+        }
+    }
+}
@@ -46,6 +46,11 @@ namespace MathNet.Numerics
         private static int _numberOfThreads = Environment.ProcessorCount;
 #endif
 
+        /// <summary>
+        /// The linear algebra provider.
+        /// </summary>
+        private static ILinearAlgebraProvider _linearAlgebraProvider;
+
         /// <summary>
         /// Initial block size for the native linear algebra provider.
         /// </summary>
@@ -92,16 +97,29 @@ namespace MathNet.Numerics
         /// Gets or sets the linear algebra provider.
         /// </summary>
         /// <value>The linear algebra provider.</value>
+        /// <remarks>A provider with its own threads is set up to use <see cref="NumberOfParallelWorkerThreads"/> of them.</remarks>
         public static ILinearAlgebraProvider LinearAlgebraProvider
         {
-            get; set;
+            get
+            {
+                return _linearAlgebraProvider;
+            }
+
+            set
+            {
+                _linearAlgebraProvider = value;
+                ApplyNumberOfParallelWorkerThreads();
+            }
         }
 
         /// <summary>
         /// Gets or sets a value indicating how many parallel worker threads shall be used
         /// when parallelization is applicable.
         /// </summary>
-        /// <remarks>The Silverlight version of the library defaults to one thread.</remarks>
+        /// <remarks>
+        /// The Silverlight version of the library defaults to one thread.
+        /// A native <see cref="LinearAlgebraProvider"/> uses the same number of threads for a single call.
+        /// </remarks>
         public static int NumberOfParallelWorkerThreads
         {
 #if SILVERLIGHT
@@ -116,6 +134,7 @@ namespace MathNet.Numerics
             set
             {   // instead of throwing an out of range exception, simply normalize
                 _numberOfThreads = Math.Max(1, Math.Min(1024, value));
+                ApplyNumberOfParallelWorkerThreads();
             }
 #endif
         }
@@ -161,5 +180,16 @@ namespace MathNet.Numerics
             }
         }
 
+        /// <summary>
+        /// Passes <see cref="NumberOfParallelWorkerThreads"/> on to the linear algebra provider.
+        /// </summary>
+        private static void ApplyNumberOfParallelWorkerThreads()
+        {
+            var provider = _linearAlgebraProvider as ManagedLinearAlgebraProvider;
+            if (provider != null)
+            {
+                provider.ApplyNumberOfParallelWorkerThreads(NumberOfParallelWorkerThreads);
+            }
+        }
     }
 }
@@ -33,6 +33,7 @@ namespace MathNet.Numerics.Interpolation.Algorithms
     using System;
     using System.Collections.Generic;
     using Properties;
+    using Threading;
 
     /// <summary>
     /// Cubic Spline Interpolation Algorithm with continuous first and second derivatives.
@@ -184,6 +185,200 @@ namespace MathNet.Numerics.Interpolation.Algorithms
             double leftBoundary,
             SplineBoundaryCondition rightBoundaryCondition,
             double rightBoundary)
+        {
+            CheckSamples(samplePoints, sampleValues);
+
+            int n = samplePoints.Count;
+            NormalizeBoundaryConditions(n, ref leftBoundaryCondition, ref leftBoundary, ref rightBoundaryCondition, ref rightBoundary);
+
+            double[] dl = new double[n - 1];
+            double[] d = new double[n];
+            double[] du = new double[n - 1];
+            double[] b = new double[n];
+
+            BuildSplineMatrix(samplePoints, leftBoundaryCondition, rightBoundaryCondition, dl, d, du, 0);
+            BuildSplineRightHandSide(samplePoints, sampleValues, leftBoundaryCondition, leftBoundary, rightBoundaryCondition, rightBoundary, b, 0);
+
+            // Build Spline
+            Control.LinearAlgebraProvider.TridiagonalSolve(dl, d, du, b, 1);
+            return b;
+        }
+
+        /// <summary>
+        /// Evaluate the spline derivatives of a set of curves sharing the same sample points.
+        /// </summary>
+        /// <remarks>
+        /// The spline matrix only depends on the sample points, so it is built once and all
+        /// curves are solved as right hand sides of a single tridiagonal system.
+        /// </remarks>
+        /// <param name="samplePoints">Sample Points t, sorted ascending, shared by all curves.</param>
+        /// <param name="sampleValues">Sample Values x(t) of each curve.</param>
+        /// <param name="leftBoundaryCondition">Condition of the left boundary.</param>
+        /// <param name="leftBoundary">Left boundary value. Ignored in the parabolic case.</param>
+        /// <param name="rightBoundaryCondition">Condition of the right boundary.</param>
+        /// <param name="rightBoundary">Right boundary value. Ignored in the parabolic case.</param>
+        /// <returns>Spline Derivative Vector of each curve.</returns>
+        public static double[][] EvaluateSplineDerivativesBatch(
+            IList<double> samplePoints,
+            IList<IList<double>> sampleValues,
+            SplineBoundaryCondition leftBoundaryCondition,
+            double leftBoundary,
+            SplineBoundaryCondition rightBoundaryCondition,
+            double rightBoundary)
+        {
+            if (null == samplePoints)
+            {
+                throw new ArgumentNullException("samplePoints");
+            }
+
+            if (null == sampleValues)
+            {
+                throw new ArgumentNullException("sampleValues");
+            }
+
+            for (int k = 0; k < sampleValues.Count; k++)
+            {
+                CheckSamples(samplePoints, sampleValues[k]);
+            }
+
+            int count = sampleValues.Count;
+            if (count == 0)
+            {
+                return new double[0][];
+            }
+
+            int n = samplePoints.Count;
+            NormalizeBoundaryConditions(n, ref leftBoundaryCondition, ref leftBoundary, ref rightBoundaryCondition, ref rightBoundary);
+
+            double[] dl = new double[n - 1];
+            double[] d = new double[n];
+            double[] du = new double[n - 1];
+            double[] b = new double[n * count];
+
+            BuildSplineMatrix(samplePoints, leftBoundaryCondition, rightBoundaryCondition, dl, d, du, 0);
+            CommonParallel.For(
+                0,
+                count,
+                k => BuildSplineRightHandSide(samplePoints, sampleValues[k], leftBoundaryCondition, leftBoundary, rightBoundaryCondition, rightBoundary, b, k * n));
+
+            Control.LinearAlgebraProvider.TridiagonalSolve(dl, d, du, b, count);
+            return SplitDerivatives(b, n, count);
+        }
+
+        /// <summary>
+        /// Evaluate the spline derivatives of a set of curves with their own sample points.
+        /// </summary>
+        /// <remarks>
+        /// All curves must have the same number of samples; their tridiagonal systems
+        /// are solved together in a single batched call.
+        /// </remarks>
+        /// <param name="samplePoints">Sample Points t of each curve, sorted ascending.</param>
+        /// <param name="sampleValues">Sample Values x(t) of each curve.</param>
+        /// <param name="leftBoundaryCondition">Condition of the left boundary.</param>
+        /// <param name="leftBoundary">Left boundary value. Ignored in the parabolic case.</param>
+        /// <param name="rightBoundaryCondition">Condition of the right boundary.</param>
+        /// <param name="rightBoundary">Right boundary value. Ignored in the parabolic case.</param>
+        /// <returns>Spline Derivative Vector of each curve.</returns>
+        public static double[][] EvaluateSplineDerivativesBatch(
+            IList<IList<double>> samplePoints,
+            IList<IList<double>> sampleValues,
+            SplineBoundaryCondition leftBoundaryCondition,
+            double leftBoundary,
+            SplineBoundaryCondition rightBoundaryCondition,
+            double rightBoundary)
+        {
+            if (null == samplePoints)
+            {
+                throw new ArgumentNullException("samplePoints");
+            }
+
+            if (null == sampleValues)
+            {
+                throw new ArgumentNullException("sampleValues");
+            }
+
+            if (samplePoints.Count != sampleValues.Count)
+            {
+                throw new ArgumentException(Resources.ArgumentVectorsSameLength);
+            }
+
+            for (int k = 0; k < samplePoints.Count; k++)
+            {
+                CheckSamples(samplePoints[k], sampleValues[k]);
+                if (samplePoints[k].Count != samplePoints[0].Count)
+                {
+                    throw new ArgumentException(Resources.ArgumentVectorsSameLength);
+                }
+            }
+
+            int count = samplePoints.Count;
+            if (count == 0)
+            {
+                return new double[0][];
+            }
+
+            int n = samplePoints[0].Count;
+            NormalizeBoundaryConditions(n, ref leftBoundaryCondition, ref leftBoundary, ref rightBoundaryCondition, ref rightBoundary);
+
+            double[] dl = new double[(n - 1) * count];
+            double[] d = new double[n * count];
+            double[] du = new double[(n - 1) * count];
+            double[] b = new double[n * count];
+
+            CommonParallel.For(
+                0,
+                count,
+                k =>
+                {
+                    BuildSplineMatrix(samplePoints[k], leftBoundaryCondition, rightBoundaryCondition, dl, d, du, k);
+                    BuildSplineRightHandSide(samplePoints[k], sampleValues[k], leftBoundaryCondition, leftBoundary, rightBoundaryCondition, rightBoundary, b, k * n);
+                });
+
+            Control.LinearAlgebraProvider.TridiagonalSolveBatch(dl, d, du, b, n, 1, count);
+            return SplitDerivatives(b, n, count);
+        }
+
+        /// <summary>
+        /// Evaluate the spline coefficients as used
+        /// internally by this interpolation algorithm.
+        /// </summary>
+        /// <param name="samplePoints">Sample Points t, sorted ascending.</param>
+        /// <param name="sampleValues">Sample Values x(t)</param>
+        /// <param name="leftBoundaryCondition">Condition of the left boundary.</param>
+        /// <param name="leftBoundary">Left boundary value. Ignored in the parabolic case.</param>
+        /// <param name="rightBoundaryCondition">Condition of the right boundary.</param>
+        /// <param name="rightBoundary">Right boundary value. Ignored in the parabolic case.</param>
+        /// <returns>Spline Coefficient Vector</returns>
+        public static double[] EvaluateSplineCoefficients(
+            IList<double> samplePoints,
+            IList<double> sampleValues,
+            SplineBoundaryCondition leftBoundaryCondition,
+            double leftBoundary,
+            SplineBoundaryCondition rightBoundaryCondition,
+            double rightBoundary)
+        {
+            double[] derivatives = EvaluateSplineDerivatives(
+                samplePoints,
+                sampleValues,
+                leftBoundaryCondition,
+                leftBoundary,
+                rightBoundaryCondition,
+                rightBoundary);
+
+            return CubicHermiteSplineInterpolation.EvaluateSplineCoefficients(
+                samplePoints,
+                sampleValues,
+                derivatives);
+        }
+
+        /// <summary>
+        /// Validates the samples of a single curve.
+        /// </summary>
+        /// <param name="samplePoints">Sample Points t.</param>
+        /// <param name="sampleValues">Sample Values x(t)</param>
+        private static void CheckSamples(
+            IList<double> samplePoints,
+            IList<double> sampleValues)
         {
             if (null == samplePoints)
             {
@@ -204,10 +399,23 @@ namespace MathNet.Numerics.Interpolation.Algorithms
             {
                 throw new ArgumentException(Resources.ArgumentVectorsSameLength);
             }
+        }
 
-            int n = samplePoints.Count;
-
-            // normalize special cases
+        /// <summary>
+        /// Maps the natural and degenerate parabolic boundary conditions to their second derivative equivalents.
+        /// </summary>
+        /// <param name="n">Number of samples.</param>
+        /// <param name="leftBoundaryCondition">Condition of the left boundary.</param>
+        /// <param name="leftBoundary">Left boundary value.</param>
+        /// <param name="rightBoundaryCondition">Condition of the right boundary.</param>
+        /// <param name="rightBoundary">Right boundary value.</param>
+        private static void NormalizeBoundaryConditions(
+            int n,
+            ref SplineBoundaryCondition leftBoundaryCondition,
+            ref double leftBoundary,
+            ref SplineBoundaryCondition rightBoundaryCondition,
+            ref double rightBoundary)
+        {
             if ((n == 2)
                 && (leftBoundaryCondition == SplineBoundaryCondition.ParabolicallyTerminated)
                 && (rightBoundaryCondition == SplineBoundaryCondition.ParabolicallyTerminated))
@@ -229,138 +437,157 @@ namespace MathNet.Numerics.Interpolation.Algorithms
                 rightBoundaryCondition = SplineBoundaryCondition.SecondDerivative;
                 rightBoundary = 0d;
             }
+        }
 
-            double[] a1 = new double[n];
-            double[] a2 = new double[n];
-            double[] a3 = new double[n];
-            double[] b = new double[n];
+        /// <summary>
+        /// Builds the tridiagonal spline matrix, which only depends on the sample points.
+        /// </summary>
+        /// <param name="samplePoints">Sample Points t, sorted ascending.</param>
+        /// <param name="leftBoundaryCondition">Normalized condition of the left boundary.</param>
+        /// <param name="rightBoundaryCondition">Normalized condition of the right boundary.</param>
+        /// <param name="subdiagonal">Receives the subdiagonal, n-1 entries per system.</param>
+        /// <param name="diagonal">Receives the diagonal, n entries per system.</param>
+        /// <param name="superdiagonal">Receives the superdiagonal, n-1 entries per system.</param>
+        /// <param name="system">Index of the system within the arrays.</param>
+        private static void BuildSplineMatrix(
+            IList<double> samplePoints,
+            SplineBoundaryCondition leftBoundaryCondition,
+            SplineBoundaryCondition rightBoundaryCondition,
+            double[] subdiagonal,
+            double[] diagonal,
+            double[] superdiagonal,
+            int system)
+        {
+            int n = samplePoints.Count;
+            int offset = system * n;
+            int offdiagonalOffset = system * (n - 1);
 
             // Left Boundary
             switch (leftBoundaryCondition)
             {
                 case SplineBoundaryCondition.ParabolicallyTerminated:
-                    a1[0] = 0;
-                    a2[0] = 1;
-                    a3[0] = 1;
-                    b[0] = 2 * (sampleValues[1] - sampleValues[0]) / (samplePoints[1] - samplePoints[0]);
+                    diagonal[offset] = 1;
+                    superdiagonal[offdiagonalOffset] = 1;
                     break;
                 case SplineBoundaryCondition.FirstDerivative:
-                    a1[0] = 0;
-                    a2[0] = 1;
-                    a3[0] = 0;
-                    b[0] = leftBoundary;
+                    diagonal[offset] = 1;
+                    superdiagonal[offdiagonalOffset] = 0;
                     break;
                 case SplineBoundaryCondition.SecondDerivative:
-                    a1[0] = 0;
-                    a2[0] = 2;
-                    a3[0] = 1;
-                    b[0] = (3 * ((sampleValues[1] - sampleValues[0]) / (samplePoints[1] - samplePoints[0]))) - (0.5 * leftBoundary * (samplePoints[1] - samplePoints[0]));
+                    diagonal[offset] = 2;
+                    superdiagonal[offdiagonalOffset] = 1;
                     break;
                 default:
                     throw new NotSupportedException(Resources.InvalidLeftBoundaryCondition);
             }
 
             // Central Conditions
-            for (int i = 1; i < samplePoints.Count - 1; i++)
+            for (int i = 1; i < n - 1; i++)
             {
-                a1[i] = samplePoints[i + 1] - samplePoints[i];
-                a2[i] = 2 * (samplePoints[i + 1] - samplePoints[i - 1]);
-                a3[i] = samplePoints[i] - samplePoints[i - 1];
-                b[i] = (3 * (sampleValues[i] - sampleValues[i - 1]) / (samplePoints[i] - samplePoints[i - 1]) * (samplePoints[i + 1] - samplePoints[i])) + (3 * (sampleValues[i + 1] - sampleValues[i]) / (samplePoints[i + 1] - samplePoints[i]) * (samplePoints[i] - samplePoints[i - 1]));
+                subdiagonal[offdiagonalOffset + i - 1] = samplePoints[i + 1] - samplePoints[i];
+                diagonal[offset + i] = 2 * (samplePoints[i + 1] - samplePoints[i - 1]);
+                superdiagonal[offdiagonalOffset + i] = samplePoints[i] - samplePoints[i - 1];
             }
 
             // Right Boundary
             switch (rightBoundaryCondition)
             {
                 case SplineBoundaryCondition.ParabolicallyTerminated:
-                    a1[n - 1] = 1;
-                    a2[n - 1] = 1;
-                    a3[n - 1] = 0;
-                    b[n - 1] = 2 * (sampleValues[n - 1] - sampleValues[n - 2]) / (samplePoints[n - 1] - samplePoints[n - 2]);
+                    subdiagonal[offdiagonalOffset + n - 2] = 1;
+                    diagonal[offset + n - 1] = 1;
                     break;
                 case SplineBoundaryCondition.FirstDerivative:
-                    a1[n - 1] = 0;
-                    a2[n - 1] = 1;
-                    a3[n - 1] = 0;
-                    b[n - 1] = rightBoundary;
+                    subdiagonal[offdiagonalOffset + n - 2] = 0;
+                    diagonal[offset + n - 1] = 1;
                     break;
                 case SplineBoundaryCondition.SecondDerivative:
-                    a1[n - 1] = 1;
-                    a2[n - 1] = 2;
-                    a3[n - 1] = 0;
-                    b[n - 1] = (3 * (sampleValues[n - 1] - sampleValues[n - 2]) / (samplePoints[n - 1] - samplePoints[n - 2])) + (0.5 * rightBoundary * (samplePoints[n - 1] - samplePoints[n - 2]));
+                    subdiagonal[offdiagonalOffset + n - 2] = 1;
+                    diagonal[offset + n - 1] = 2;
                     break;
                 default:
                     throw new NotSupportedException(Resources.InvalidRightBoundaryCondition);
             }
-
-            // Build Spline
-            return SolveTridiagonal(a1, a2, a3, b);
         }
 
         /// <summary>
-        /// Evaluate the spline coefficients as used
-        /// internally by this interpolation algorithm.
+        /// Builds the right hand side of the spline system.
         /// </summary>
         /// <param name="samplePoints">Sample Points t, sorted ascending.</param>
         /// <param name="sampleValues">Sample Values x(t)</param>
-        /// <param name="leftBoundaryCondition">Condition of the left boundary.</param>
+        /// <param name="leftBoundaryCondition">Normalized condition of the left boundary.</param>
         /// <param name="leftBoundary">Left boundary value. Ignored in the parabolic case.</param>
-        /// <param name="rightBoundaryCondition">Condition of the right boundary.</param>
+        /// <param name="rightBoundaryCondition">Normalized condition of the right boundary.</param>
         /// <param name="rightBoundary">Right boundary value. Ignored in the parabolic case.</param>
-        /// <returns>Spline Coefficient Vector</returns>
-        public static double[] EvaluateSplineCoefficients(
+        /// <param name="b">Receives the right hand side.</param>
+        /// <param name="offset">Index of the first entry to write in <paramref name="b"/>.</param>
+        private static void BuildSplineRightHandSide(
             IList<double> samplePoints,
             IList<double> sampleValues,
             SplineBoundaryCondition leftBoundaryCondition,
             double leftBoundary,
             SplineBoundaryCondition rightBoundaryCondition,
-            double rightBoundary)
+            double rightBoundary,
+            double[] b,
+            int offset)
         {
-            double[] derivatives = EvaluateSplineDerivatives(
-                samplePoints,
-                sampleValues,
-                leftBoundaryCondition,
-                leftBoundary,
-                rightBoundaryCondition,
-                rightBoundary);
+            int n = samplePoints.Count;
 
-            return CubicHermiteSplineInterpolation.EvaluateSplineCoefficients(
-                samplePoints,
-                sampleValues,
-                derivatives);
-        }
+            // Left Boundary
+            switch (leftBoundaryCondition)
+            {
+                case SplineBoundaryCondition.ParabolicallyTerminated:
+                    b[offset] = 2 * (sampleValues[1] - sampleValues[0]) / (samplePoints[1] - samplePoints[0]);
+                    break;
+                case SplineBoundaryCondition.FirstDerivative:
+                    b[offset] = leftBoundary;
+                    break;
+                case SplineBoundaryCondition.SecondDerivative:
+                    b[offset] = (3 * ((sampleValues[1] - sampleValues[0]) / (samplePoints[1] - samplePoints[0]))) - (0.5 * leftBoundary * (samplePoints[1] - samplePoints[0]));
+                    break;
+                default:
+                    throw new NotSupportedException(Resources.InvalidLeftBoundaryCondition);
+            }
 
-        /// <summary>
-        /// Tridiagonal Solve Helper.
-        /// </summary>
-        /// <param name="a">The a-vector[n].</param>
-        /// <param name="b">The b-vector[n], will be modified by this function.</param>
-        /// <param name="c">The c-vector[n].</param>
-        /// <param name="d">The d-vector[n], will be modified by this function.</param>
-        /// <returns>The x-vector[n]</returns>
-        private static double[] SolveTridiagonal(
-            double[] a,
-            double[] b,
-            double[] c,
-            double[] d)
-        {
-            double[] x = new double[a.Length];
+            // Central Conditions
+            for (int i = 1; i < n - 1; i++)
+            {
+                b[offset + i] = (3 * (sampleValues[i] - sampleValues[i - 1]) / (samplePoints[i] - samplePoints[i - 1]) * (samplePoints[i + 1] - samplePoints[i])) + (3 * (sampleValues[i + 1] - sampleValues[i]) / (samplePoints[i + 1] - samplePoints[i]) * (samplePoints[i] - samplePoints[i - 1]));
+            }
 
-            for (int k = 1; k < a.Length; k++)
+            // Right Boundary
+            switch (rightBoundaryCondition)
             {
-                double t = a[k] / b[k - 1];
-                b[k] = b[k] - (t * c[k - 1]);
-                d[k] = d[k] - (t * d[k - 1]);
+                case SplineBoundaryCondition.ParabolicallyTerminated:
+                    b[offset + n - 1] = 2 * (sampleValues[n - 1] - sampleValues[n - 2]) / (samplePoints[n - 1] - samplePoints[n - 2]);
+                    break;
+                case SplineBoundaryCondition.FirstDerivative:
+                    b[offset + n - 1] = rightBoundary;
+                    break;
+                case SplineBoundaryCondition.SecondDerivative:
+                    b[offset + n - 1] = (3 * (sampleValues[n - 1] - sampleValues[n - 2]) / (samplePoints[n - 1] - samplePoints[n - 2])) + (0.5 * rightBoundary * (samplePoints[n - 1] - samplePoints[n - 2]));
+                    break;
+                default:
+                    throw new NotSupportedException(Resources.InvalidRightBoundaryCondition);
             }
+        }
 
-            x[x.Length - 1] = d[d.Length - 1] / b[b.Length - 1];
-            for (int k = x.Length - 2; k >= 0; k--)
+        /// <summary>
+        /// Splits the solved right hand sides into one derivative vector per curve.
+        /// </summary>
+        /// <param name="b">The solved right hand sides, n entries per curve.</param>
+        /// <param name="n">Number of samples per curve.</param>
+        /// <param name="count">Number of curves.</param>
+        /// <returns>Spline Derivative Vector of each curve.</returns>
+        private static double[][] SplitDerivatives(double[] b, int n, int count)
+        {
+            var derivatives = new double[count][];
+            for (int k = 0; k < count; k++)
             {
-                x[k] = (d[k] - (c[k] * x[k + 1])) / b[k];
+                derivatives[k] = new double[n];
+                Buffer.BlockCopy(b, k * n * Constants.SizeOfDouble, derivatives[k], 0, n * Constants.SizeOfDouble);
             }
 
-            return x;
+            return derivatives;
         }
 
         /// <summary>
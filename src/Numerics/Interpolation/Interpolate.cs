@@ -74,6 +74,72 @@ namespace MathNet.Numerics.Interpolation
             return method;
         }
 
+        /// <summary>
+        /// Create natural cubic spline interpolations for a set of curves sharing the same sample points (sorted ascending).
+        /// </summary>
+        /// <param name="points">The sample points t shared by all curves, sorted ascending. Supports both lists and arrays.</param>
+        /// <param name="values">The sample point values x(t) of each curve. Supports both lists and arrays.</param>
+        /// <returns>
+        /// One interpolation scheme per curve, all built from a single tridiagonal solve,
+        /// which can then be used to compute interpolations and extrapolations
+        /// on arbitrary points.
+        /// </returns>
+        public static IInterpolation[] CubicSplines(
+            IList<double> points,
+            IList<IList<double>> values)
+        {
+            double[][] derivatives = CubicSplineInterpolation.EvaluateSplineDerivativesBatch(
+                points,
+                values,
+                SplineBoundaryCondition.Natural,
+                0.0,
+                SplineBoundaryCondition.Natural,
+                0.0);
+
+            IInterpolation[] methods = new IInterpolation[derivatives.Length];
+            for (int k = 0; k < methods.Length; k++)
+            {
+                CubicHermiteSplineInterpolation method = new CubicHermiteSplineInterpolation();
+                method.Initialize(points, values[k], derivatives[k]);
+                methods[k] = method;
+            }
+
+            return methods;
+        }
+
+        /// <summary>
+        /// Create natural cubic spline interpolations for a set of curves with the same number of samples.
+        /// </summary>
+        /// <param name="points">The sample points t of each curve, sorted ascending. Supports both lists and arrays.</param>
+        /// <param name="values">The sample point values x(t) of each curve. Supports both lists and arrays.</param>
+        /// <returns>
+        /// One interpolation scheme per curve, all built from a single batched tridiagonal solve,
+        /// which can then be used to compute interpolations and extrapolations
+        /// on arbitrary points.
+        /// </returns>
+        public static IInterpolation[] CubicSplines(
+            IList<IList<double>> points,
+            IList<IList<double>> values)
+        {
+            double[][] derivatives = CubicSplineInterpolation.EvaluateSplineDerivativesBatch(
+                points,
+                values,
+                SplineBoundaryCondition.Natural,
+                0.0,
+                SplineBoundaryCondition.Natural,
+                0.0);
+
+            IInterpolation[] methods = new IInterpolation[derivatives.Length];
+            for (int k = 0; k < methods.Length; k++)
+            {
+                CubicHermiteSplineInterpolation method = new CubicHermiteSplineInterpolation();
+                method.Initialize(points[k], values[k], derivatives[k]);
+                methods[k] = method;
+            }
+
+            return methods;
+        }
+
         /// <summary>
         /// Create a floater hormann rational pole-free interpolation based on arbitrary points.
         /// </summary>
@@ -31,6 +31,7 @@
 namespace MathNet.Numerics.LinearAlgebra.Complex.Factorization
 {
     using System;
+    using System.Collections.Generic;
     using System.Numerics;
     using Algorithms.LinearAlgebra;
     using Generic;
@@ -47,6 +48,11 @@ namespace MathNet.Numerics.LinearAlgebra.Complex.Factorization
     /// </remarks>
     public class DenseLU : LU
     {
+        /// <summary>
+        /// The one norm of the factored matrix, which the condition number estimate needs.
+        /// </summary>
+        private Complex _matrixNorm;
+
         /// <summary>
         /// Initializes a new instance of the <see cref="DenseLU"/> class. This object will compute the
         /// LU factorization when the constructor is called and cache it's factorization.
@@ -69,12 +75,77 @@ namespace MathNet.Numerics.LinearAlgebra.Complex.Factorization
             // Create an array for the pivot indices.
             Pivots = new int[matrix.RowCount];
 
+            _matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(Norm.OneNorm, matrix.RowCount, matrix.ColumnCount, matrix.Data);
+
             // Create a new matrix for the LU factors, then perform factorization (while overwriting).
             var factors = (DenseMatrix)matrix.Clone();
             Control.LinearAlgebraProvider.LUFactor(factors.Data, factors.RowCount, Pivots);
             Factors = factors;
         }
 
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DenseLU"/> class without computing a factorization.
+        /// Used by <see cref="FactorBatch"/>, which sets the factors itself.
+        /// </summary>
+        private DenseLU()
+        {
+        }
+
+        /// <summary>
+        /// Computes the LU factorizations of a batch of matrices of the same order with a single call into the
+        /// linear algebra provider, which is far cheaper than factoring many small matrices one at a time.
+        /// </summary>
+        /// <param name="matrices">The matrices to factor.</param>
+        /// <returns>The factorizations, in the order of <paramref name="matrices"/>.</returns>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrices"/> or one of its entries is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If the matrices are not square or not all of the same order.</exception>
+        public static DenseLU[] FactorBatch(IList<DenseMatrix> matrices)
+        {
+            int order;
+            var data = PackBatch(matrices, out order);
+            var size = order * order;
+            var pivots = new int[matrices.Count * order];
+            Control.LinearAlgebraProvider.LUFactorBatch(data, order, size, pivots, matrices.Count);
+
+            var factorizations = new DenseLU[matrices.Count];
+            for (var i = 0; i < factorizations.Length; i++)
+            {
+                var factors = new Complex[size];
+                Array.Copy(data, i * size, factors, 0, size);
+                var ipiv = new int[order];
+                Array.Copy(pivots, i * order, ipiv, 0, order);
+                factorizations[i] = new DenseLU
+                {
+                    Factors = new DenseMatrix(order, order, factors),
+                    Pivots = ipiv,
+                    _matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(Norm.OneNorm, order, order, matrices[i].Data)
+                };
+            }
+
+            return factorizations;
+        }
+
+        /// <summary>
+        /// Solves <c>A[i]x[i] = b[i]</c> for a batch of systems of the same order. All systems are factored with one call
+        /// into the linear algebra provider and solved with another.
+        /// </summary>
+        /// <param name="matrices">The matrices <c>A[i]</c>. They are left unchanged.</param>
+        /// <param name="inputs">The right hand side vectors <c>b[i]</c>.</param>
+        /// <returns>The solutions <c>x[i]</c>, in the order of <paramref name="matrices"/>.</returns>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrices"/>, <paramref name="inputs"/> or one of their entries is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If the dimensions of the matrices and vectors do not agree.</exception>
+        public static DenseVector[] SolveBatch(IList<DenseMatrix> matrices, IList<DenseVector> inputs)
+        {
+            int order;
+            var a = PackBatch(matrices, out order);
+            var b = PackInputs(inputs, matrices.Count, order);
+            var pivots = new int[matrices.Count * order];
+
+            Control.LinearAlgebraProvider.LUFactorBatch(a, order, order * order, pivots, matrices.Count);
+            Control.LinearAlgebraProvider.LUSolveFactoredBatch(1, a, order, order * order, pivots, b, order, matrices.Count);
+            return UnpackVectors(b, matrices.Count, order);
+        }
+
         /// <summary>
         /// Solves a system of linear equations, <c>AX = B</c>, with A LU factorized.
         /// </summary>
@@ -178,6 +249,34 @@ namespace MathNet.Numerics.LinearAlgebra.Complex.Factorization
             Control.LinearAlgebraProvider.LUSolveFactored(1, dfactors.Data, dfactors.RowCount, Pivots, dresult.Data);
         }
 
+        /// <summary>
+        /// Gets an estimate of the condition number of the factored matrix in the one norm. It is computed from the
+        /// factors in O(n^2) time, where forming the inverse would take O(n^3), and is positive infinity if the
+        /// matrix is singular.
+        /// </summary>
+        public double ConditionNumber
+        {
+            get
+            {
+                var dfactors = (DenseMatrix)Factors;
+                var rcond = Control.LinearAlgebraProvider.LUCondition(Norm.OneNorm, dfactors.Data, dfactors.RowCount, _matrixNorm);
+                return 1.0 / rcond.Real;
+            }
+        }
+
+        /// <summary>
+        /// Computes the natural logarithm of the absolute value of the determinant and its sign. Unlike
+        /// <see cref="LU{T}.Determinant"/>, this does not overflow or underflow for large matrices.
+        /// </summary>
+        /// <param name="sign">On exit, the sign of the determinant: a complex number of magnitude one, or zero if the matrix is singular.</param>
+        /// <returns>The natural logarithm of the absolute value of the determinant; negative infinity if the matrix is singular.</returns>
+        public double DeterminantLn(out Complex sign)
+        {
+            var dfactors = (DenseMatrix)Factors;
+            var logAbs = Control.LinearAlgebraProvider.LUDeterminant(dfactors.Data, dfactors.RowCount, Pivots, out sign);
+            return logAbs.Real;
+        }
+
         /// <summary>
         /// Returns the inverse of this matrix. The inverse is calculated using LU decomposition.
         /// </summary>
@@ -188,5 +287,103 @@ namespace MathNet.Numerics.LinearAlgebra.Complex.Factorization
             Control.LinearAlgebraProvider.LUInverseFactored(result.Data, result.RowCount, Pivots);
             return result;
         }
+
+        /// <summary>
+        /// Copies a batch of square matrices of the same order into one column-major array, one after another.
+        /// </summary>
+        /// <param name="matrices">The matrices to pack.</param>
+        /// <param name="order">On exit, the order of the matrices.</param>
+        /// <returns>The packed matrices.</returns>
+        private static Complex[] PackBatch(IList<DenseMatrix> matrices, out int order)
+        {
+            if (matrices == null)
+            {
+                throw new ArgumentNullException("matrices");
+            }
+
+            order = matrices.Count > 0 && matrices[0] != null ? matrices[0].RowCount : 0;
+            var size = order * order;
+            var data = new Complex[matrices.Count * size];
+            for (var i = 0; i < matrices.Count; i++)
+            {
+                var matrix = matrices[i];
+                if (matrix == null)
+                {
+                    throw new ArgumentNullException("matrices");
+                }
+
+                if (matrix.RowCount != matrix.ColumnCount)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixSquare);
+                }
+
+                if (matrix.RowCount != order)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixDimensions);
+                }
+
+                Array.Copy(matrix.Data, 0, data, i * size, size);
+            }
+
+            return data;
+        }
+
+        /// <summary>
+        /// Copies a batch of right hand side vectors into one array, one after another.
+        /// </summary>
+        /// <param name="inputs">The vectors to pack.</param>
+        /// <param name="count">The expected number of vectors.</param>
+        /// <param name="order">The expected length of each vector.</param>
+        /// <returns>The packed vectors.</returns>
+        private static Complex[] PackInputs(IList<DenseVector> inputs, int count, int order)
+        {
+            if (inputs == null)
+            {
+                throw new ArgumentNullException("inputs");
+            }
+
+            if (inputs.Count != count)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "inputs");
+            }
+
+            var data = new Complex[count * order];
+            for (var i = 0; i < count; i++)
+            {
+                if (inputs[i] == null)
+                {
+                    throw new ArgumentNullException("inputs");
+                }
+
+                if (inputs[i].Count != order)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixDimensions);
+                }
+
+                Array.Copy(inputs[i].Data, 0, data, i * order, order);
+            }
+
+            return data;
+        }
+
+        /// <summary>
+        /// Splits packed solution vectors back into separate vectors.
+        /// </summary>
+        /// <param name="data">The packed vectors.</param>
+        /// <param name="count">The number of vectors.</param>
+        /// <param name="order">The length of each vector.</param>
+        /// <returns>The vectors.</returns>
+        private static DenseVector[] UnpackVectors(Complex[] data, int count, int order)
+        {
+            var vectors = new DenseVector[count];
+            for (var i = 0; i < count; i++)
+            {
+                var vector = new Complex[order];
+                Array.Copy(data, i * order, vector, 0, order);
+                vectors[i] = new DenseVector(vector);
+            }
+
+            return vectors;
+        }
     }
 }
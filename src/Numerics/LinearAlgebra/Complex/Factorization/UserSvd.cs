@@ -65,6 +65,8 @@ namespace MathNet.Numerics.LinearAlgebra.Complex.Factorization
                 throw new ArgumentNullException("matrix");
             }
 
+            RowCount = matrix.RowCount;
+            ColumnCount = matrix.ColumnCount;
             ComputeVectors = computeVectors;
             var nm = Math.Min(matrix.RowCount + 1, matrix.ColumnCount);
             var matrixCopy = matrix.Clone();
@@ -886,7 +886,7 @@ namespace MathNet.Numerics.LinearAlgebra.Complex
         /// <returns>The Frobenius norm of this matrix.</returns>
         public override Complex FrobeniusNorm()
         {
-            var transpose = (SparseMatrix)Transpose();
+            var transpose = (SparseMatrix)ConjugateTranspose();
             var aat = this * transpose;
 
             var norm = 0.0;
@@ -88,724 +88,28 @@ namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
                 }
             }
 
+            var eigenvalues = new Complex32[order];
             if (IsSymmetric)
             {
-                var matrixCopy = matrix.ToArray();
-                var tau = new Complex32[order];
-                var d = new float[order];
-                var e = new float[order];
-
-                SymmetricTridiagonalize(matrixCopy, d, e, tau, order);
-                SymmetricDiagonalize(((DenseMatrix)MatrixEv).Data, d, e, order);
-                SymmetricUntridiagonalize(((DenseMatrix)MatrixEv).Data, matrixCopy, tau, order);
-
-                for (var i = 0; i < order; i++)
-                {
-                    VectorEv[i] = new Complex(d[i], e[i]);
-                }
+                matrix.CopyTo(MatrixEv);
+                Control.LinearAlgebraProvider.EigenDecomposition(((DenseMatrix)MatrixEv).Data, order, eigenvalues);
             }
             else
             {
-                var matrixH = matrix.ToArray();
-                NonsymmetricReduceToHessenberg(((DenseMatrix)MatrixEv).Data, matrixH, order);
-                NonsymmetricReduceHessenberToRealSchur(((LinearAlgebra.Complex.DenseVector)VectorEv).Data, ((DenseMatrix)MatrixEv).Data, matrixH, order);
-            }
-
-            for (var i = 0; i < VectorEv.Count; i++)
-            {
-                MatrixD.At(i, i, (Complex32)VectorEv[i]);
+                Control.LinearAlgebraProvider.EigenDecomposition(false, true, matrix.ToColumnWiseArray(), order, eigenvalues, null, ((DenseMatrix)MatrixEv).Data);
             }
-        }
-
-        /// <summary>
-        /// Reduces a complex hermitian matrix to a real symmetric tridiagonal matrix using unitary similarity transformations.
-        /// </summary>
-        /// <param name="matrixA">Source matrix to reduce</param>
-        /// <param name="d">Output: Arrays for internal storage of real parts of eigenvalues</param>
-        /// <param name="e">Output: Arrays for internal storage of imaginary parts of eigenvalues</param>
-        /// <param name="tau">Output: Arrays that contains further information about the transformations.</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedures HTRIDI by 
-        /// Smith, Boyle, Dongarra, Garbow, Ikebe, Klema, Moler, and Wilkinson, Handbook for 
-        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding 
-        /// Fortran subroutine in EISPACK.</remarks>
-        private static void SymmetricTridiagonalize(Complex32[,] matrixA, float[] d, float[] e, Complex32[] tau, int order)
-        {
-            float hh;
-            tau[order - 1] = Complex32.One;
 
             for (var i = 0; i < order; i++)
             {
-                d[i] = matrixA[i, i].Real;
+                VectorEv[i] = new Complex(eigenvalues[i].Real, eigenvalues[i].Imaginary);
             }
 
-            // Householder reduction to tridiagonal form.
-            for (var i = order - 1; i > 0; i--)
-            {
-                // Scale to avoid under/overflow.
-                var scale = 0.0f;
-                var h = 0.0f;
-
-                for (var k = 0; k < i; k++)
-                {
-                    scale = scale + Math.Abs(matrixA[i, k].Real) + Math.Abs(matrixA[i, k].Imaginary);
-                }
-
-                if (scale == 0.0f)
-                {
-                    tau[i - 1] = Complex32.One;
-                    e[i] = 0.0f;
-                }
-                else
-                {
-                    for (var k = 0; k < i; k++)
-                    {
-                        matrixA[i, k] /= scale;
-                        h += matrixA[i, k].MagnitudeSquared;
-                    }
-
-                    Complex32 g = (float)Math.Sqrt(h);
-                    e[i] = scale * g.Real;
-
-                    Complex32 temp;
-                    var f = matrixA[i, i - 1];
-                    if (f.Magnitude != 0)
-                    {
-                        temp = -(matrixA[i, i - 1].Conjugate() * tau[i].Conjugate()) / f.Magnitude;
-                        h += f.Magnitude * g.Real;
-                        g = 1.0f + (g / f.Magnitude);
-                        matrixA[i, i - 1] *= g;
-                    }
-                    else
-                    {
-                        temp = -tau[i].Conjugate();
-                        matrixA[i, i - 1] = g;
-                    }
-
-                    if ((f.Magnitude == 0) || (i != 1))
-                    {
-                        f = Complex32.Zero;
-                        for (var j = 0; j < i; j++)
-                        {
-                            var tmp = Complex32.Zero;
-
-                            // Form element of A*U.
-                            for (var k = 0; k <= j; k++)
-                            {
-                                tmp += matrixA[j, k] * matrixA[i, k].Conjugate();
-                            }
-
-                            for (var k = j + 1; k <= i - 1; k++)
-                            {
-                                tmp += matrixA[k, j].Conjugate() * matrixA[i, k].Conjugate();
-                            }
-
-                            // Form element of P
-                            tau[j] = tmp / h;
-                            f += (tmp / h) * matrixA[i, j];
-                        }
-
-                        hh = f.Real / (h + h);
-
-                        // Form the reduced A.
-                        for (var j = 0; j < i; j++)
-                        {
-                            f = matrixA[i, j].Conjugate();
-                            g = tau[j] - (hh * f);
-                            tau[j] = g.Conjugate();
-
-                            for (var k = 0; k <= j; k++)
-                            {
-                                matrixA[j, k] -= (f * tau[k]) + (g * matrixA[i, k]);
-                            }
-                        }
-                    }
-
-                    for (var k = 0; k < i; k++)
-                    {
-                        matrixA[i, k] *= scale;
-                    }
-
-                    tau[i - 1] = temp.Conjugate();
-                }
-
-                hh = d[i];
-                d[i] = matrixA[i, i].Real;
-                matrixA[i, i] = new Complex32(hh, scale * (float)Math.Sqrt(h));
-            }
-
-            hh = d[0];
-            d[0] = matrixA[0, 0].Real;
-            matrixA[0, 0] = hh;
-            e[0] = 0.0f;
-        }
-
-        /// <summary>
-        /// Symmetric tridiagonal QL algorithm.
-        /// </summary>
-        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
-        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
-        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedures tql2, by
-        /// Bowdler, Martin, Reinsch, and Wilkinson, Handbook for
-        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding
-        /// Fortran subroutine in EISPACK.</remarks>
-        private static void SymmetricDiagonalize(Complex32[] dataEv, float[] d, float[] e, int order)
-        {
-            const int Maxiter = 1000;
-
-            for (var i = 1; i < order; i++)
-            {
-                e[i - 1] = e[i];
-            }
-
-            e[order - 1] = 0.0f;
-
-            var f = 0.0f;
-            var tst1 = 0.0f;
-            var eps = Precision.DoubleMachinePrecision;
-            for (var l = 0; l < order; l++)
-            {
-                // Find small subdiagonal element
-                tst1 = Math.Max(tst1, Math.Abs(d[l]) + Math.Abs(e[l]));
-                var m = l;
-                while (m < order)
-                {
-                    if (Math.Abs(e[m]) <= eps * tst1)
-                    {
-                        break;
-                    }
-
-                    m++;
-                }
-
-                // If m == l, d[l] is an eigenvalue,
-                // otherwise, iterate.
-                if (m > l)
-                {
-                    var iter = 0;
-                    do
-                    {
-                        iter = iter + 1; // (Could check iteration count here.)
-
-                        // Compute implicit shift
-                        var g = d[l];
-                        var p = (d[l + 1] - g) / (2.0f * e[l]);
-                        var r = SpecialFunctions.Hypotenuse(p, 1.0f);
-                        if (p < 0)
-                        {
-                            r = -r;
-                        }
-
-                        d[l] = e[l] / (p + r);
-                        d[l + 1] = e[l] * (p + r);
-
-                        var dl1 = d[l + 1];
-                        var h = g - d[l];
-                        for (var i = l + 2; i < order; i++)
-                        {
-                            d[i] -= h;
-                        }
-
-                        f = f + h;
-
-                        // Implicit QL transformation.
-                        p = d[m];
-                        var c = 1.0f;
-                        var c2 = c;
-                        var c3 = c;
-                        var el1 = e[l + 1];
-                        var s = 0.0f;
-                        var s2 = 0.0f;
-                        for (var i = m - 1; i >= l; i--)
-                        {
-                            c3 = c2;
-                            c2 = c;
-                            s2 = s;
-                            g = c * e[i];
-                            h = c * p;
-                            r = SpecialFunctions.Hypotenuse(p, e[i]);
-                            e[i + 1] = s * r;
-                            s = e[i] / r;
-                            c = p / r;
-                            p = (c * d[i]) - (s * g);
-                            d[i + 1] = h + (s * ((c * g) + (s * d[i])));
-
-                            // Accumulate transformation.
-                            for (var k = 0; k < order; k++)
-                            {
-                                h = dataEv[((i + 1) * order) + k].Real;
-                                dataEv[((i + 1) * order) + k] = (s * dataEv[(i * order) + k].Real) + (c * h);
-                                dataEv[(i * order) + k] = (c * dataEv[(i * order) + k].Real) - (s * h);
-                            }
-                        }
-
-                        p = (-s) * s2 * c3 * el1 * e[l] / dl1;
-                        e[l] = s * p;
-                        d[l] = c * p;
-
-                        // Check for convergence. If too many iterations have been performed, 
-                        // throw exception that Convergence Failed
-                        if (iter >= Maxiter)
-                        {
-                            throw new ArgumentException(Resources.ConvergenceFailed);
-                        }
-                    }
-                    while (Math.Abs(e[l]) > eps * tst1);
-                }
-
-                d[l] = d[l] + f;
-                e[l] = 0.0f;
-            }
-
-            // Sort eigenvalues and corresponding vectors.
-            for (var i = 0; i < order - 1; i++)
-            {
-                var k = i;
-                var p = d[i];
-                for (var j = i + 1; j < order; j++)
-                {
-                    if (d[j] < p)
-                    {
-                        k = j;
-                        p = d[j];
-                    }
-                }
-
-                if (k != i)
-                {
-                    d[k] = d[i];
-                    d[i] = p;
-                    for (var j = 0; j < order; j++)
-                    {
-                        p = dataEv[(i * order) + j].Real;
-                        dataEv[(i * order) + j] = dataEv[(k * order) + j];
-                        dataEv[(k * order) + j] = p;
-                    }
-                }
-            }
-        }
-
-        /// <summary>
-        /// Determines eigenvectors by undoing the symmetric tridiagonalize transformation
-        /// </summary>
-        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
-        /// <param name="matrixA">Previously tridiagonalized matrix by <see cref="SymmetricTridiagonalize"/>.</param>
-        /// <param name="tau">Contains further information about the transformations</param>
-        /// <param name="order">Input matrix order</param>
-        /// <remarks>This is derived from the Algol procedures HTRIBK, by
-        /// by Smith, Boyle, Dongarra, Garbow, Ikebe, Klema, Moler, and Wilkinson, Handbook for
-        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding
-        /// Fortran subroutine in EISPACK.</remarks>
-        private static void SymmetricUntridiagonalize(Complex32[] dataEv, Complex32[,] matrixA, Complex32[] tau, int order)
-        {
-            for (var i = 0; i < order; i++)
-            {
-                for (var j = 0; j < order; j++)
-                {
-                    dataEv[(j * order) + i] = dataEv[(j * order) + i].Real * tau[i].Conjugate();
-                }
-            }
-
-            // Recover and apply the Householder matrices.
-            for (var i = 1; i < order; i++)
-            {
-                var h = matrixA[i, i].Imaginary;
-                if (h != 0)
-                {
-                    for (var j = 0; j < order; j++)
-                    {
-                        var s = Complex32.Zero;
-                        for (var k = 0; k < i; k++)
-                        {
-                            s += dataEv[(j * order) + k] * matrixA[i, k];
-                        }
-
-                        s = (s / h) / h;
-
-                        for (var k = 0; k < i; k++)
-                        {
-                            dataEv[(j * order) + k] -= s * matrixA[i, k].Conjugate();
-                        }
-                    }
-                }
-            }
-        }
-
-        /// <summary>
-        /// Nonsymmetric reduction to Hessenberg form.
-        /// </summary>
-        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
-        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedures orthes and ortran,
-        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
-        /// Vol.ii-Linear Algebra, and the corresponding
-        /// Fortran subroutines in EISPACK.</remarks>
-        private static void NonsymmetricReduceToHessenberg(Complex32[] dataEv, Complex32[,] matrixH, int order)
-        {
-            var ort = new Complex32[order];
-
-            for (var m = 1; m < order - 1; m++)
-            {
-                // Scale column.
-                var scale = 0.0f;
-                for (var i = m; i < order; i++)
-                {
-                    scale += Math.Abs(matrixH[i, m - 1].Real) + Math.Abs(matrixH[i, m - 1].Imaginary);
-                }
-
-                if (scale != 0.0f)
-                {
-                    // Compute Householder transformation.
-                    var h = 0.0f;
-                    for (var i = order - 1; i >= m; i--)
-                    {
-                        ort[i] = matrixH[i, m - 1] / scale;
-                        h += ort[i].MagnitudeSquared;
-                    }
-
-                    var g = (float)Math.Sqrt(h);
-                    if (ort[m].Magnitude != 0)
-                    {
-                        h = h + (ort[m].Magnitude * g);
-                        g /= ort[m].Magnitude;
-                        ort[m] = (1.0f + g) * ort[m];
-                    }
-                    else
-                    {
-                        ort[m] = g;
-                        matrixH[m, m - 1] = scale;
-                    }
-
-                    // Apply Householder similarity transformation
-                    // H = (I-u*u'/h)*H*(I-u*u')/h)
-                    for (var j = m; j < order; j++)
-                    {
-                        var f = Complex32.Zero;
-                        for (var i = order - 1; i >= m; i--)
-                        {
-                            f += ort[i].Conjugate() * matrixH[i, j];
-                        }
-
-                        f = f / h;
-                        for (var i = m; i < order; i++)
-                        {
-                            matrixH[i, j] -= f * ort[i];
-                        }
-                    }
-
-                    for (var i = 0; i < order; i++)
-                    {
-                        var f = Complex32.Zero;
-                        for (var j = order - 1; j >= m; j--)
-                        {
-                            f += ort[j] * matrixH[i, j];
-                        }
-
-                        f = f / h;
-                        for (var j = m; j < order; j++)
-                        {
-                            matrixH[i, j] -= f * ort[j].Conjugate();
-                        }
-                    }
-
-                    ort[m] = scale * ort[m];
-                    matrixH[m, m - 1] *= -g;
-                }
-            }
-
-            // Accumulate transformations (Algol's ortran).
-            for (var i = 0; i < order; i++)
-            {
-                for (var j = 0; j < order; j++)
-                {
-                    dataEv[(j * order) + i] = i == j ? Complex32.One : Complex32.Zero;
-                }
-            }
-
-            for (var m = order - 2; m >= 1; m--)
-            {
-                if (matrixH[m, m - 1] != Complex32.Zero && ort[m] != Complex32.Zero)
-                {
-                    var norm = (matrixH[m, m - 1].Real * ort[m].Real) + (matrixH[m, m - 1].Imaginary * ort[m].Imaginary);
-
-                    for (var i = m + 1; i < order; i++)
-                    {
-                        ort[i] = matrixH[i, m - 1];
-                    }
-
-                    for (var j = m; j < order; j++)
-                    {
-                        var g = Complex32.Zero;
-                        for (var i = m; i < order; i++)
-                        {
-                            g += ort[i].Conjugate() * dataEv[(j * order) + i];
-                        }
-
-                        // Double division avoids possible underflow
-                        g /= norm;
-                        for (var i = m; i < order; i++)
-                        {
-                            dataEv[(j * order) + i] += g * ort[i];
-                        }
-                    }
-                }
-            }
-            
-            // Create real subdiagonal elements.
-            for (var i = 1; i < order; i++)
+            for (var i = 0; i < VectorEv.Count; i++)
             {
-                if (matrixH[i, i - 1].Imaginary != 0.0f)
-                {
-                    var y = matrixH[i, i - 1] / matrixH[i, i - 1].Magnitude;
-                    matrixH[i, i - 1] = matrixH[i, i - 1].Magnitude;
-                    for (var j = i; j < order; j++)
-                    {
-                        matrixH[i, j] *= y.Conjugate();
-                    }
-
-                    for (var j = 0; j <= Math.Min(i + 1, order - 1); j++)
-                    {
-                        matrixH[j, i] *= y;
-                    }
-
-                    for (var j = 0; j < order; j++)
-                    {
-                        dataEv[(i * order) + j] *= y;
-                    }
-                }
+                MatrixD.At(i, i, (Complex32)VectorEv[i]);
             }
         }
 
-        /// <summary>
-        /// Nonsymmetric reduction from Hessenberg to real Schur form.
-        /// </summary>
-        /// <param name="vectorV">Data array of the eigenvectors</param>
-        /// <param name="dataEv">Data array of matrix V (eigenvectors)</param>
-        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedure hqr2,
-        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
-        /// Vol.ii-Linear Algebra, and the corresponding
-        /// Fortran subroutine in EISPACK.</remarks>
-        private static void NonsymmetricReduceHessenberToRealSchur(Complex[] vectorV, Complex32[] dataEv, Complex32[,] matrixH, int order)
-        {
-            // Initialize
-            var n = order - 1;
-            var eps = (float)Precision.SingleMachinePrecision;
-
-            float norm;
-            Complex32 s, x, y, z, exshift = Complex32.Zero;
-
-            // Outer loop over eigenvalue index
-            var iter = 0;
-            while (n >= 0)
-            {
-                // Look for single small sub-diagonal element
-                var l = n;
-                while (l > 0)
-                {
-                    var tst1 = Math.Abs(matrixH[l - 1, l - 1].Real) + Math.Abs(matrixH[l - 1, l - 1].Imaginary) + Math.Abs(matrixH[l, l].Real) + Math.Abs(matrixH[l, l].Imaginary);
-                    if (Math.Abs(matrixH[l, l - 1].Real) < eps * tst1)
-                    {
-                        break;
-                    }
-
-                    l--;
-                }
-
-                // Check for convergence
-                // One root found
-                if (l == n)
-                {
-                    matrixH[n, n] += exshift;
-                    vectorV[n] = matrixH[n, n].ToComplex();
-                    n--;
-                    iter = 0;
-                }
-                else
-                {
-                    // Form shift
-                    if (iter != 10 && iter != 20)
-                    {
-                        s = matrixH[n, n];
-                        x = matrixH[n - 1, n] * matrixH[n, n - 1].Real;
-
-                        if (x.Real != 0.0f || x.Imaginary != 0.0f)
-                        {
-                            y = (matrixH[n - 1, n - 1] - s) / 2.0f;
-                            z = ((y * y) + x).SquareRoot();
-                            if ((y.Real * z.Real) + (y.Imaginary * z.Imaginary) < 0.0f)
-                            {
-                                z *= -1.0f;
-                            }
-
-                            x /= y + z; 
-                            s = s - x;
-                        }
-                    }
-                    else
-                    {
-                        // Form exceptional shift
-                        s = Math.Abs(matrixH[n, n - 1].Real) + Math.Abs(matrixH[n - 1, n - 2].Real);
-                    }
-
-                    for (var i = 0; i <= n; i++)
-                    {
-                        matrixH[i, i] -= s;
-                    }
-
-                    exshift += s;
-                    iter++;
-
-                    // Reduce to triangle (rows)
-                    for (var i = l + 1; i <= n; i++)
-                    {
-                        s = matrixH[i, i - 1].Real;
-                        norm = SpecialFunctions.Hypotenuse(matrixH[i - 1, i - 1].Magnitude, s.Real);
-                        x = matrixH[i - 1, i - 1] / norm;
-                        vectorV[i - 1] = x.ToComplex();
-                        matrixH[i - 1, i - 1] = norm;
-                        matrixH[i, i - 1] = new Complex32(0.0f, s.Real / norm);
-
-                        for (var j = i; j < order; j++)
-                        {
-                            y = matrixH[i - 1, j];
-                            z = matrixH[i, j];
-                            matrixH[i - 1, j] = (x.Conjugate() * y) + (matrixH[i, i - 1].Imaginary * z);
-                            matrixH[i, j] = (x * z) - (matrixH[i, i - 1].Imaginary * y);
-                        }
-                    }
-
-                    s = matrixH[n, n];
-                    if (s.Imaginary != 0.0f)
-                    {
-                        s /= matrixH[n, n].Magnitude;
-                        matrixH[n, n] = matrixH[n, n].Magnitude;
-
-                        for (var j = n + 1; j < order; j++)
-                        {
-                            matrixH[n, j] *= s.Conjugate();
-                        }
-                    }
-
-                    // Inverse operation (columns).
-                    for (var j = l + 1; j <= n; j++)
-                    {
-                        x = (Complex32)vectorV[j - 1];
-                        for (var i = 0; i <= j; i++)
-                        {
-                            z = matrixH[i, j];
-                            if (i != j)
-                            {
-                                y = matrixH[i, j - 1];
-                                matrixH[i, j - 1] = (x * y) + (matrixH[j, j - 1].Imaginary * z);
-                            }
-                            else
-                            {
-                                y = matrixH[i, j - 1].Real;
-                                matrixH[i, j - 1] = new Complex32((x.Real * y.Real) - (x.Imaginary * y.Imaginary) + (matrixH[j, j - 1].Imaginary * z.Real), matrixH[i, j - 1].Imaginary);
-                            }
-
-                            matrixH[i, j] = (x.Conjugate() * z) - (matrixH[j, j - 1].Imaginary * y);
-                        }
-
-                        for (var i = 0; i < order; i++)
-                        {
-                            y = dataEv[((j - 1) * order) + i];
-                            z = dataEv[(j * order) + i];
-                            dataEv[((j - 1) * order) + i] = (x * y) + (matrixH[j, j - 1].Imaginary * z);
-                            dataEv[(j * order) + i] = (x.Conjugate() * z) - (matrixH[j, j - 1].Imaginary * y);
-                        }
-                    }
-
-                    if (s.Imaginary != 0.0f)
-                    {
-                        for (var i = 0; i <= n; i++)
-                        {
-                            matrixH[i, n] *= s;
-                        }
-
-                        for (var i = 0; i < order; i++)
-                        {
-                            dataEv[(n * order) + i] *= s;
-                        }
-                    }
-                }
-            }
-
-            // All roots found.  
-            // Backsubstitute to find vectors of upper triangular form
-            norm = 0.0f;
-            for (var i = 0; i < order; i++)
-            {
-                for (var j = i; j < order; j++)
-                {
-                    norm = Math.Max(norm, Math.Abs(matrixH[i, j].Real) + Math.Abs(matrixH[i, j].Imaginary));
-                }
-            }
-
-            if (order == 1)
-            {
-                return;
-            }
-
-            if (norm == 0.0f)
-            {
-                return;
-            }
-
-            for (n = order - 1; n > 0; n--)
-            {
-                x = (Complex32)vectorV[n];
-                matrixH[n, n] = 1.0f;
-
-                for (var i = n - 1; i >= 0; i--)
-                {
-                    z = 0.0f;
-                    for (var j = i + 1; j <= n; j++)
-                    {
-                        z += matrixH[i, j] * matrixH[j, n];
-                    }
-
-                    y = x - (Complex32)vectorV[i];
-                    if (y.Real == 0.0f && y.Imaginary == 0.0f)
-                    {
-                        y = eps * norm;
-                    }
-
-                    matrixH[i, n] = z / y;
-
-                    // Overflow control
-                    var tr = Math.Abs(matrixH[i, n].Real) + Math.Abs(matrixH[i, n].Imaginary);
-                    if ((eps * tr) * tr > 1)
-                    {
-                        for (var j = i; j <= n; j++)
-                        {
-                            matrixH[j, n] = matrixH[j, n] / tr;
-                        }
-                    }
-                }
-            }
-
-            // Back transformation to get eigenvectors of original matrix
-            for (var j = order - 1; j > 0; j--)
-            {
-                for (var i = 0; i < order; i++)
-                {
-                    z = Complex32.Zero;
-                    for (var k = 0; k <= j; k++)
-                    {
-                        z += dataEv[(k * order) + i] * matrixH[k, j];
-                    }
-
-                    dataEv[(j * order) + i] = z;
-                }
-            }
-        }
-        
         /// <summary>
         /// Solves a system of linear equations, <b>AX = B</b>, with A SVD factorized.
         /// </summary>
@@ -31,6 +31,7 @@
 namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
 {
     using System;
+    using Algorithms.LinearAlgebra;
     using Generic;
     using Numerics;
     using Properties;
@@ -167,7 +168,7 @@ namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
                 throw new NotSupportedException("Can only do GramSchmidt factorization for dense matrices at the moment.");
             }
 
-            Control.LinearAlgebraProvider.QRSolveFactored(((DenseMatrix)MatrixQ).Data, ((DenseMatrix)MatrixR).Data, MatrixQ.RowCount, MatrixQ.ColumnCount, null, dinput.Data, input.ColumnCount, dresult.Data);
+            SolveFactored(dinput.Data, input.ColumnCount, dresult.Data);
         }
 
         /// <summary>
@@ -212,7 +213,22 @@ namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
                 throw new NotSupportedException("Can only do GramSchmidt factorization for dense vectors at the moment.");
             }
 
-            Control.LinearAlgebraProvider.QRSolveFactored(((DenseMatrix)MatrixQ).Data, ((DenseMatrix)MatrixR).Data, MatrixQ.RowCount, MatrixQ.ColumnCount, null, dinput.Data, 1, dresult.Data);
+            SolveFactored(dinput.Data, 1, dresult.Data);
+        }
+
+        /// <summary>
+        /// Solves A*X=B as R*X = Q^H*B.
+        /// </summary>
+        /// <param name="input">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="result">On exit, the X matrix.</param>
+        private void SolveFactored(Complex32[] input, int columnsB, Complex32[] result)
+        {
+            var rows = MatrixQ.RowCount;
+            var columns = MatrixQ.ColumnCount;
+
+            Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(Transpose.ConjugateTranspose, Transpose.DontTranspose, Complex32.One, ((DenseMatrix)MatrixQ).Data, rows, columns, input, rows, columnsB, Complex32.Zero, result);
+            Control.LinearAlgebraProvider.TriangularSolve(Side.Left, Triangle.Upper, Transpose.DontTranspose, DiagonalType.NonUnit, Complex32.One, ((DenseMatrix)MatrixR).Data, result, columns, columnsB);
         }
     }
 }
@@ -30,6 +30,7 @@
 namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
 {
     using System;
+    using Algorithms.LinearAlgebra;
     using Generic;
     using Numerics;
     using Properties;
@@ -59,18 +60,45 @@ namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
         /// <exception cref="ArgumentNullException">If <paramref name="matrix"/> is <c>null</c>.</exception>
         /// <exception cref="ArgumentException">If SVD algorithm failed to converge with matrix <paramref name="matrix"/>.</exception>
         public DenseSvd(DenseMatrix matrix, bool computeVectors)
+            : this(matrix, computeVectors ? SvdMode.Full : SvdMode.ValuesOnly)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DenseSvd"/> class, computing only the parts of the
+        /// decomposition that <paramref name="mode"/> asks for.
+        /// </summary>
+        /// <param name="matrix">The matrix to factor.</param>
+        /// <param name="mode">Which factors to compute, and how. The economy modes keep only the leading Min(M, N)
+        /// columns of U and rows of VT, which is all that solving or projecting onto the singular vectors of a tall or
+        /// wide matrix needs; <see cref="SvdMode.ValuesOnly"/> keeps neither.</param>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrix"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If SVD algorithm failed to converge with matrix <paramref name="matrix"/>.</exception>
+        public DenseSvd(DenseMatrix matrix, SvdMode mode)
         {
             if (matrix == null)
             {
                 throw new ArgumentNullException("matrix");
             }
 
-            ComputeVectors = computeVectors;
+            RowCount = matrix.RowCount;
+            ColumnCount = matrix.ColumnCount;
+            ComputeVectors = mode != SvdMode.ValuesOnly;
             var nm = Math.Min(matrix.RowCount, matrix.ColumnCount);
             VectorS = new DenseVector(nm);
-            MatrixU = new DenseMatrix(matrix.RowCount);
-            MatrixVT = new DenseMatrix(matrix.ColumnCount);
-            Control.LinearAlgebraProvider.SingularValueDecomposition(computeVectors, ((DenseMatrix)matrix.Clone()).Data, matrix.RowCount, matrix.ColumnCount, ((DenseVector)VectorS).Data, ((DenseMatrix)MatrixU).Data, ((DenseMatrix)MatrixVT).Data);
+
+            Complex32[] u = null;
+            Complex32[] vt = null;
+            if (ComputeVectors)
+            {
+                var full = mode == SvdMode.Full;
+                MatrixU = new DenseMatrix(matrix.RowCount, full ? matrix.RowCount : nm);
+                MatrixVT = new DenseMatrix(full ? matrix.ColumnCount : nm, matrix.ColumnCount);
+                u = ((DenseMatrix)MatrixU).Data;
+                vt = ((DenseMatrix)MatrixVT).Data;
+            }
+
+            Control.LinearAlgebraProvider.SingularValueDecomposition(mode, ((DenseMatrix)matrix.Clone()).Data, matrix.RowCount, matrix.ColumnCount, ((DenseVector)VectorS).Data, u, vt);
         }
 
         /// <summary>
@@ -85,7 +85,7 @@ namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
         {
             get
             {
-                var tmp = Math.Min(MatrixU.RowCount, MatrixVT.ColumnCount) - 1;
+                var tmp = Math.Min(RowCount, ColumnCount) - 1;
                 return VectorS[0].Magnitude / VectorS[tmp].Magnitude;
             }
         }
@@ -97,7 +97,7 @@ namespace MathNet.Numerics.LinearAlgebra.Complex32.Factorization
         {
             get
             {
-                if (MatrixU.RowCount != MatrixVT.ColumnCount)
+                if (RowCount != ColumnCount)
                 {
                     throw new ArgumentException(Resources.ArgumentMatrixSquare);
                 }
@@ -887,7 +887,7 @@ namespace MathNet.Numerics.LinearAlgebra.Complex32
         /// <returns>The Frobenius norm of this matrix.</returns>
         public override Complex32 FrobeniusNorm()
         {
-            var transpose = (SparseMatrix)Transpose();
+            var transpose = (SparseMatrix)ConjugateTranspose();
             var aat = this * transpose;
 
             var norm = 0.0f;
@@ -404,16 +404,13 @@ namespace MathNet.Numerics.LinearAlgebra.Double
             }
             else
             {
-                Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
+                Control.LinearAlgebraProvider.MatrixVectorMultiply(
                     Algorithms.LinearAlgebra.Transpose.DontTranspose,
                     1.0,
                     Data,
                     RowCount,
                     ColumnCount,
                     denseRight.Data,
-                    denseRight.Count,
-                    1,
                     0.0,
                     denseResult.Data);
             }
@@ -435,16 +432,13 @@ namespace MathNet.Numerics.LinearAlgebra.Double
             }
             else
             {
-                Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
+                Control.LinearAlgebraProvider.MatrixVectorMultiply(
+                    Algorithms.LinearAlgebra.Transpose.Transpose,
                     1.0,
-                    denseLeft.Data,
-                    1,
-                    denseLeft.Count,
                     Data,
                     RowCount,
                     ColumnCount,
+                    denseLeft.Data,
                     0.0,
                     denseResult.Data);
             }
@@ -495,6 +489,19 @@ namespace MathNet.Numerics.LinearAlgebra.Double
             {
                 base.DoTransposeAndMultiply(other, result);
             }
+            else if (ReferenceEquals(denseOther, this))
+            {
+                // this*this' is symmetric, so only one triangle needs to be computed.
+                Control.LinearAlgebraProvider.SymmetricRankKUpdate(
+                                  Algorithms.LinearAlgebra.Transpose.DontTranspose,
+                                  1.0,
+                                  Data,
+                                  RowCount,
+                                  ColumnCount,
+                                  0.0,
+                                  denseResult.Data,
+                                  true);
+            }
             else
             {
                 Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
@@ -528,16 +535,13 @@ namespace MathNet.Numerics.LinearAlgebra.Double
             }
             else
             {
-                Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
+                Control.LinearAlgebraProvider.MatrixVectorMultiply(
                     Algorithms.LinearAlgebra.Transpose.Transpose,
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
                     1.0,
                     Data,
                     RowCount,
                     ColumnCount,
                     denseRight.Data,
-                    denseRight.Count,
-                    1,
                     0.0,
                     denseResult.Data);
             }
@@ -557,6 +561,19 @@ namespace MathNet.Numerics.LinearAlgebra.Double
             {
                 base.DoTransposeThisAndMultiply(other, result);
             }
+            else if (ReferenceEquals(denseOther, this))
+            {
+                // this'*this is symmetric, so only one triangle needs to be computed.
+                Control.LinearAlgebraProvider.SymmetricRankKUpdate(
+                                  Algorithms.LinearAlgebra.Transpose.Transpose,
+                                  1.0,
+                                  Data,
+                                  RowCount,
+                                  ColumnCount,
+                                  0.0,
+                                  denseResult.Data,
+                                  true);
+            }
             else
             {
                 Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
@@ -889,19 +889,31 @@ namespace MathNet.Numerics.LinearAlgebra.Double
             }
 
             var matrix = new DenseMatrix(u.Count, v.Count);
-            CommonParallel.For(
-                0, 
-                u.Count, 
-                i =>
-                {
-                    for (var j = 0; j < v.Count; j++)
-                    {
-                        matrix.At(i, j, u.Data[i] * v.Data[j]);
-                    }
-                });
+            Control.LinearAlgebraProvider.RankOneUpdate(1.0, u.Data, v.Data, matrix.Data);
             return matrix;
         }
 
+        /// <summary>
+        /// Computes the outer product of this vector and another into a zero matrix.
+        /// </summary>
+        /// <param name="other">The right vector of the product.</param>
+        /// <param name="result">A zero matrix with as many rows as this vector and as many columns as <paramref name="other"/>,
+        /// which receives M[i,j] = this[i]*other[j].</param>
+        protected override void DoOuterProduct(Vector<double> other, Matrix<double> result)
+        {
+            var denseOther = other as DenseVector;
+            var denseResult = result as DenseMatrix;
+
+            if (denseOther == null || denseResult == null)
+            {
+                base.DoOuterProduct(other, result);
+            }
+            else
+            {
+                Control.LinearAlgebraProvider.RankOneUpdate(1.0, Data, denseOther.Data, denseResult.Data);
+            }
+        }
+
         /// <summary>
         /// Outer product of this and another vector.
         /// </summary>
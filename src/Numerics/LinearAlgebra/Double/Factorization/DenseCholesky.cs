@@ -31,6 +31,8 @@
 namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
 {
     using System;
+    using System.Collections.Generic;
+    using Algorithms.LinearAlgebra;
     using Generic;
     using Properties;
 
@@ -45,6 +47,11 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
     /// </remarks>
     public class DenseCholesky : Cholesky
     {
+        /// <summary>
+        /// The one norm of the factored matrix, which the condition number estimate needs.
+        /// </summary>
+        private double _matrixNorm;
+
         /// <summary>
         /// Initializes a new instance of the <see cref="DenseCholesky"/> class. This object will compute the
         /// Cholesky factorization when the constructor is called and cache it's factorization.
@@ -65,12 +72,161 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
                 throw new ArgumentException(Resources.ArgumentMatrixSquare);
             }
 
+            _matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(Norm.OneNorm, matrix.RowCount, matrix.ColumnCount, matrix.Data);
+
             // Create a new matrix for the Cholesky factor, then perform factorization (while overwriting).
             var factor = (DenseMatrix)matrix.Clone();
             Control.LinearAlgebraProvider.CholeskyFactor(factor.Data, factor.RowCount);
             CholeskyFactor = factor;
         }
 
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DenseCholesky"/> class without computing a factorization.
+        /// Used by <see cref="FactorBatch"/>, which sets the factor itself.
+        /// </summary>
+        private DenseCholesky()
+        {
+        }
+
+        /// <summary>
+        /// Computes the Cholesky factorizations of a batch of matrices of the same order with a single call into the
+        /// linear algebra provider, which is far cheaper than factoring many small matrices one at a time.
+        /// </summary>
+        /// <param name="matrices">The matrices to factor.</param>
+        /// <returns>The factorizations, in the order of <paramref name="matrices"/>.</returns>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrices"/> or one of its entries is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If the matrices are not square or not all of the same order.</exception>
+        /// <exception cref="ArgumentException">If one of the matrices is not positive definite.</exception>
+        public static DenseCholesky[] FactorBatch(IList<DenseMatrix> matrices)
+        {
+            int order;
+            var data = PackBatch(matrices, out order);
+            var size = order * order;
+            Control.LinearAlgebraProvider.CholeskyFactorBatch(data, order, size, matrices.Count);
+
+            var factorizations = new DenseCholesky[matrices.Count];
+            for (var i = 0; i < factorizations.Length; i++)
+            {
+                var factor = new double[size];
+                Array.Copy(data, i * size, factor, 0, size);
+                factorizations[i] = new DenseCholesky
+                {
+                    CholeskyFactor = new DenseMatrix(order, order, factor),
+                    _matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(Norm.OneNorm, order, order, matrices[i].Data)
+                };
+            }
+
+            return factorizations;
+        }
+
+        /// <summary>
+        /// Solves <b>A[i]x[i] = b[i]</b> for a batch of symmetric positive definite systems of the same order. All systems
+        /// are factored with one call into the linear algebra provider and solved with another.
+        /// </summary>
+        /// <param name="matrices">The matrices <b>A[i]</b>. They are left unchanged.</param>
+        /// <param name="inputs">The right hand side vectors <b>b[i]</b>.</param>
+        /// <returns>The solutions <b>x[i]</b>, in the order of <paramref name="matrices"/>.</returns>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrices"/>, <paramref name="inputs"/> or one of their entries is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If the dimensions of the matrices and vectors do not agree.</exception>
+        /// <exception cref="ArgumentException">If one of the matrices is not positive definite.</exception>
+        public static DenseVector[] SolveBatch(IList<DenseMatrix> matrices, IList<DenseVector> inputs)
+        {
+            int order;
+            var a = PackBatch(matrices, out order);
+            var b = PackInputs(inputs, matrices.Count, order);
+
+            Control.LinearAlgebraProvider.CholeskyFactorBatch(a, order, order * order, matrices.Count);
+            Control.LinearAlgebraProvider.CholeskySolveFactoredBatch(a, order, order * order, b, order, 1, matrices.Count);
+            return UnpackVectors(b, matrices.Count, order);
+        }
+
+        /// <summary>
+        /// Solves <b>Ax = b</b> with a Cholesky factorization computed in single precision and refined iteratively with
+        /// residuals computed in double precision, which gives a double precision solution at close to the speed of
+        /// a single precision solve when A is well-conditioned. If the refinement does not converge, the system is
+        /// solved in double precision instead.
+        /// </summary>
+        /// <param name="matrix">The matrix <b>A</b>. It is left unchanged.</param>
+        /// <param name="input">The right hand side vector, <b>b</b>.</param>
+        /// <returns>The solution <b>x</b>.</returns>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrix"/> or <paramref name="input"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If the dimensions of the matrix and vector do not agree.</exception>
+        /// <exception cref="ArgumentException">If <paramref name="matrix"/> is not positive definite.</exception>
+        public static DenseVector SolveMixed(DenseMatrix matrix, DenseVector input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            return new DenseVector(SolveMixed(matrix, input.Data, input.Count, 1));
+        }
+
+        /// <summary>
+        /// Solves <b>AX = B</b> with a Cholesky factorization computed in single precision and refined iteratively with
+        /// residuals computed in double precision, as <see cref="SolveMixed(DenseMatrix,DenseVector)"/> does.
+        /// </summary>
+        /// <param name="matrix">The matrix <b>A</b>. It is left unchanged.</param>
+        /// <param name="input">The right hand side matrix, <b>B</b>.</param>
+        /// <returns>The solution <b>X</b>.</returns>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrix"/> or <paramref name="input"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If the dimensions of the matrices do not agree.</exception>
+        /// <exception cref="ArgumentException">If <paramref name="matrix"/> is not positive definite.</exception>
+        public static DenseMatrix SolveMixed(DenseMatrix matrix, DenseMatrix input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            return new DenseMatrix(input.RowCount, input.ColumnCount, SolveMixed(matrix, input.Data, input.RowCount, input.ColumnCount));
+        }
+
+        /// <summary>
+        /// Solves <b>AX = B</b> in mixed precision for a column-major <b>B</b>.
+        /// </summary>
+        /// <param name="matrix">The matrix <b>A</b>.</param>
+        /// <param name="input">The right hand side, which is left unchanged.</param>
+        /// <param name="rows">The number of rows of <paramref name="input"/>.</param>
+        /// <param name="columns">The number of columns of <paramref name="input"/>.</param>
+        /// <returns>The solution, in a new array.</returns>
+        private static double[] SolveMixed(DenseMatrix matrix, double[] input, int rows, int columns)
+        {
+            if (matrix == null)
+            {
+                throw new ArgumentNullException("matrix");
+            }
+
+            if (matrix.RowCount != matrix.ColumnCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixSquare);
+            }
+
+            if (rows != matrix.RowCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions);
+            }
+
+            var result = new double[rows * columns];
+            Array.Copy(input, 0, result, 0, result.Length);
+            Control.LinearAlgebraProvider.CholeskySolveMixed(matrix.Data, rows, result, columns);
+            return result;
+        }
+
+        /// <summary>
+        /// Gets an estimate of the condition number of the factored matrix in the one norm. It is computed from the
+        /// factor in O(n^2) time, where forming the inverse would take O(n^3).
+        /// </summary>
+        public double ConditionNumber
+        {
+            get
+            {
+                var dfactor = (DenseMatrix)CholeskyFactor;
+                var rcond = Control.LinearAlgebraProvider.CholeskyCondition(dfactor.Data, dfactor.RowCount, _matrixNorm);
+                return 1.0 / rcond;
+            }
+        }
+
         /// <summary>
         /// Solves a system of linear equations, <b>AX = B</b>, with A Cholesky factorized.
         /// </summary>
@@ -120,9 +276,10 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
             // Copy the contents of input to result.
             Buffer.BlockCopy(dinput.Data, 0, dresult.Data, 0, dinput.Data.Length * Constants.SizeOfDouble);
 
-            // Cholesky solve by overwriting result.
+            // Cholesky solve by overwriting result: L*Y = B, then L'*X = Y.
             var dfactor = (DenseMatrix)CholeskyFactor;
-            Control.LinearAlgebraProvider.CholeskySolveFactored(dfactor.Data, dfactor.RowCount, dresult.Data, dresult.ColumnCount);
+            Control.LinearAlgebraProvider.TriangularSolve(Side.Left, Triangle.Lower, Transpose.DontTranspose, DiagonalType.NonUnit, 1.0, dfactor.Data, dresult.Data, dresult.RowCount, dresult.ColumnCount);
+            Control.LinearAlgebraProvider.TriangularSolve(Side.Left, Triangle.Lower, Transpose.Transpose, DiagonalType.NonUnit, 1.0, dfactor.Data, dresult.Data, dresult.RowCount, dresult.ColumnCount);
         }
 
         /// <summary>
@@ -169,9 +326,108 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
             // Copy the contents of input to result.
             Buffer.BlockCopy(dinput.Data, 0, dresult.Data, 0, dinput.Data.Length * Constants.SizeOfDouble);
 
-            // Cholesky solve by overwriting result.
+            // Cholesky solve by overwriting result: L*Y = B, then L'*X = Y.
             var dfactor = (DenseMatrix)CholeskyFactor;
-            Control.LinearAlgebraProvider.CholeskySolveFactored(dfactor.Data, dfactor.RowCount, dresult.Data, 1);
+            Control.LinearAlgebraProvider.TriangularSolve(Side.Left, Triangle.Lower, Transpose.DontTranspose, DiagonalType.NonUnit, 1.0, dfactor.Data, dresult.Data, dresult.Count, 1);
+            Control.LinearAlgebraProvider.TriangularSolve(Side.Left, Triangle.Lower, Transpose.Transpose, DiagonalType.NonUnit, 1.0, dfactor.Data, dresult.Data, dresult.Count, 1);
+        }
+
+        /// <summary>
+        /// Copies a batch of square matrices of the same order into one column-major array, one after another.
+        /// </summary>
+        /// <param name="matrices">The matrices to pack.</param>
+        /// <param name="order">On exit, the order of the matrices.</param>
+        /// <returns>The packed matrices.</returns>
+        private static double[] PackBatch(IList<DenseMatrix> matrices, out int order)
+        {
+            if (matrices == null)
+            {
+                throw new ArgumentNullException("matrices");
+            }
+
+            order = matrices.Count > 0 && matrices[0] != null ? matrices[0].RowCount : 0;
+            var size = order * order;
+            var data = new double[matrices.Count * size];
+            for (var i = 0; i < matrices.Count; i++)
+            {
+                var matrix = matrices[i];
+                if (matrix == null)
+                {
+                    throw new ArgumentNullException("matrices");
+                }
+
+                if (matrix.RowCount != matrix.ColumnCount)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixSquare);
+                }
+
+                if (matrix.RowCount != order)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixDimensions);
+                }
+
+                Array.Copy(matrix.Data, 0, data, i * size, size);
+            }
+
+            return data;
+        }
+
+        /// <summary>
+        /// Copies a batch of right hand side vectors into one array, one after another.
+        /// </summary>
+        /// <param name="inputs">The vectors to pack.</param>
+        /// <param name="count">The expected number of vectors.</param>
+        /// <param name="order">The expected length of each vector.</param>
+        /// <returns>The packed vectors.</returns>
+        private static double[] PackInputs(IList<DenseVector> inputs, int count, int order)
+        {
+            if (inputs == null)
+            {
+                throw new ArgumentNullException("inputs");
+            }
+
+            if (inputs.Count != count)
+            {
+                throw new ArgumentException(Resources.ArgumentArraysSameLength, "inputs");
+            }
+
+            var data = new double[count * order];
+            for (var i = 0; i < count; i++)
+            {
+                if (inputs[i] == null)
+                {
+                    throw new ArgumentNullException("inputs");
+                }
+
+                if (inputs[i].Count != order)
+                {
+                    throw new ArgumentException(Resources.ArgumentMatrixDimensions);
+                }
+
+                Array.Copy(inputs[i].Data, 0, data, i * order, order);
+            }
+
+            return data;
+        }
+
+        /// <summary>
+        /// Splits packed solution vectors back into separate vectors.
+        /// </summary>
+        /// <param name="data">The packed vectors.</param>
+        /// <param name="count">The number of vectors.</param>
+        /// <param name="order">The length of each vector.</param>
+        /// <returns>The vectors.</returns>
+        private static DenseVector[] UnpackVectors(double[] data, int count, int order)
+        {
+            var vectors = new DenseVector[count];
+            for (var i = 0; i < count; i++)
+            {
+                var vector = new double[order];
+                Array.Copy(data, i * order, vector, 0, order);
+                vectors[i] = new DenseVector(vector);
+            }
+
+            return vectors;
         }
     }
 }
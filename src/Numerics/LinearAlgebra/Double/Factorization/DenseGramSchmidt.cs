@@ -31,6 +31,7 @@
 namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
 {
     using System;
+    using Algorithms.LinearAlgebra;
     using Generic;
     using Properties;
 
@@ -166,7 +167,7 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
                 throw new NotSupportedException("Can only do GramSchmidt factorization for dense matrices at the moment.");
             }
 
-            Control.LinearAlgebraProvider.QRSolveFactored(((DenseMatrix)MatrixQ).Data, ((DenseMatrix)MatrixR).Data, MatrixQ.RowCount, MatrixQ.ColumnCount, null, dinput.Data, input.ColumnCount, dresult.Data);
+            SolveFactored(dinput.Data, input.ColumnCount, dresult.Data);
         }
 
         /// <summary>
@@ -211,7 +212,22 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
                 throw new NotSupportedException("Can only do GramSchmidt factorization for dense vectors at the moment.");
             }
 
-            Control.LinearAlgebraProvider.QRSolveFactored(((DenseMatrix)MatrixQ).Data, ((DenseMatrix)MatrixR).Data, MatrixQ.RowCount, MatrixQ.ColumnCount, null, dinput.Data, 1, dresult.Data);
+            SolveFactored(dinput.Data, 1, dresult.Data);
+        }
+
+        /// <summary>
+        /// Solves A*X=B as R*X = Q'*B.
+        /// </summary>
+        /// <param name="input">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="result">On exit, the X matrix.</param>
+        private void SolveFactored(double[] input, int columnsB, double[] result)
+        {
+            var rows = MatrixQ.RowCount;
+            var columns = MatrixQ.ColumnCount;
+
+            Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(Transpose.Transpose, Transpose.DontTranspose, 1.0, ((DenseMatrix)MatrixQ).Data, rows, columns, input, rows, columnsB, 0.0, result);
+            Control.LinearAlgebraProvider.TriangularSolve(Side.Left, Triangle.Upper, Transpose.DontTranspose, DiagonalType.NonUnit, 1.0, ((DenseMatrix)MatrixR).Data, result, columns, columnsB);
         }
     }
 }
@@ -0,0 +1,231 @@
+﻿// <copyright file="DenseLDLT.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+//
+// Copyright (c) 2009-2010 Math.NET
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
+{
+    using System;
+    using Algorithms.LinearAlgebra;
+    using Generic;
+    using Properties;
+
+    /// <summary>
+    /// <para>A class which encapsulates the functionality of a Bunch-Kaufman LDL' factorization for dense matrices.</para>
+    /// <para>For a symmetric, possibly indefinite matrix A, the LDL' factorization is a unit lower triangular matrix L
+    /// and a block diagonal matrix D with 1 by 1 and 2 by 2 blocks so that P*A*P' = L*D*L', where the permutation P
+    /// is chosen for numerical stability.</para>
+    /// </summary>
+    /// <remarks>
+    /// The computation of the LDL' factorization is done at construction time. Only the lower triangle of the matrix
+    /// is referenced. It takes half the work and storage of an LU factorization, and unlike the Cholesky factorization
+    /// it does not require the matrix to be positive definite, which makes it the factorization of choice for
+    /// saddle point (KKT) systems.
+    /// </remarks>
+    public class DenseLDLT : ISolver<double>
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DenseLDLT"/> class. This object will compute the
+        /// LDL' factorization when the constructor is called and cache it's factorization.
+        /// </summary>
+        /// <param name="matrix">The matrix to factor.</param>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrix"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If <paramref name="matrix"/> is not a square matrix.</exception>
+        /// <exception cref="ArgumentException">If <paramref name="matrix"/> is singular.</exception>
+        public DenseLDLT(DenseMatrix matrix)
+        {
+            if (matrix == null)
+            {
+                throw new ArgumentNullException("matrix");
+            }
+
+            if (matrix.RowCount != matrix.ColumnCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixSquare);
+            }
+
+            // Create a new matrix for the factors, then perform factorization (while overwriting).
+            var factors = (DenseMatrix)matrix.Clone();
+            Pivots = new int[matrix.RowCount];
+            Control.LinearAlgebraProvider.LDLTFactor(factors.Data, factors.RowCount, Pivots);
+            Factors = factors;
+        }
+
+        /// <summary>
+        /// Gets or sets the L and D factors, packed into the lower triangle of one matrix.
+        /// </summary>
+        protected DenseMatrix Factors
+        {
+            get;
+            set;
+        }
+
+        /// <summary>
+        /// Gets or sets the pivot indices of the factorization, as returned by
+        /// <see cref="ILinearAlgebraProvider{T}.LDLTFactor"/>.
+        /// </summary>
+        protected int[] Pivots
+        {
+            get;
+            set;
+        }
+
+        /// <summary>
+        /// Solves a system of linear equations, <b>AX = B</b>, with A LDL' factorized.
+        /// </summary>
+        /// <param name="input">The right hand side <see cref="Matrix{T}"/>, <b>B</b>.</param>
+        /// <returns>The left hand side <see cref="Matrix{T}"/>, <b>X</b>.</returns>
+        public virtual Matrix<double> Solve(Matrix<double> input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            var x = input.CreateMatrix(input.RowCount, input.ColumnCount);
+            Solve(input, x);
+            return x;
+        }
+
+        /// <summary>
+        /// Solves a system of linear equations, <b>AX = B</b>, with A LDL' factorized.
+        /// </summary>
+        /// <param name="input">The right hand side <see cref="Matrix{T}"/>, <b>B</b>.</param>
+        /// <param name="result">The left hand side <see cref="Matrix{T}"/>, <b>X</b>.</param>
+        public virtual void Solve(Matrix<double> input, Matrix<double> result)
+        {
+            // Check for proper arguments.
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            if (result == null)
+            {
+                throw new ArgumentNullException("result");
+            }
+
+            // Check for proper dimensions.
+            if (result.RowCount != input.RowCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixSameRowDimension);
+            }
+
+            if (result.ColumnCount != input.ColumnCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixSameColumnDimension);
+            }
+
+            if (input.RowCount != Factors.RowCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions);
+            }
+
+            var dinput = input as DenseMatrix;
+            if (dinput == null)
+            {
+                throw new NotSupportedException("Can only do LDL' factorization for dense matrices at the moment.");
+            }
+
+            var dresult = result as DenseMatrix;
+            if (dresult == null)
+            {
+                throw new NotSupportedException("Can only do LDL' factorization for dense matrices at the moment.");
+            }
+
+            // Copy the contents of input to result.
+            Buffer.BlockCopy(dinput.Data, 0, dresult.Data, 0, dinput.Data.Length * Constants.SizeOfDouble);
+
+            Control.LinearAlgebraProvider.LDLTSolveFactored(Factors.Data, Factors.RowCount, Pivots, dresult.Data, dresult.ColumnCount);
+        }
+
+        /// <summary>
+        /// Solves a system of linear equations, <b>Ax = b</b>, with A LDL' factorized.
+        /// </summary>
+        /// <param name="input">The right hand side vector, <b>b</b>.</param>
+        /// <returns>The left hand side <see cref="Vector{T}"/>, <b>x</b>.</returns>
+        public virtual Vector<double> Solve(Vector<double> input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            var x = input.CreateVector(input.Count);
+            Solve(input, x);
+            return x;
+        }
+
+        /// <summary>
+        /// Solves a system of linear equations, <b>Ax = b</b>, with A LDL' factorized.
+        /// </summary>
+        /// <param name="input">The right hand side vector, <b>b</b>.</param>
+        /// <param name="result">The left hand side <see cref="Vector{T}"/>, <b>x</b>.</param>
+        public virtual void Solve(Vector<double> input, Vector<double> result)
+        {
+            // Check for proper arguments.
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            if (result == null)
+            {
+                throw new ArgumentNullException("result");
+            }
+
+            // Check for proper dimensions.
+            if (input.Count != result.Count)
+            {
+                throw new ArgumentException(Resources.ArgumentVectorsSameLength);
+            }
+
+            if (input.Count != Factors.RowCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions);
+            }
+
+            var dinput = input as DenseVector;
+            if (dinput == null)
+            {
+                throw new NotSupportedException("Can only do LDL' factorization for dense vectors at the moment.");
+            }
+
+            var dresult = result as DenseVector;
+            if (dresult == null)
+            {
+                throw new NotSupportedException("Can only do LDL' factorization for dense vectors at the moment.");
+            }
+
+            // Copy the contents of input to result.
+            Buffer.BlockCopy(dinput.Data, 0, dresult.Data, 0, dinput.Data.Length * Constants.SizeOfDouble);
+
+            Control.LinearAlgebraProvider.LDLTSolveFactored(Factors.Data, Factors.RowCount, Pivots, dresult.Data, 1);
+        }
+    }
+}
@@ -31,6 +31,7 @@
 namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
 {
     using System;
+    using Algorithms.LinearAlgebra;
     using Generic;
     using Properties;
 
@@ -42,17 +43,34 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
     /// </summary>
     /// <remarks>
     /// The computation of the QR decomposition is done at construction time by Householder transformation.
+    /// Q is kept as the Householder reflectors and only formed the first time <see cref="Q"/> is read.
+    /// With column pivoting the factorization is A*P = Q*R, which reveals the numerical rank of A.
     /// </remarks>
     public class DenseQR : QR
     {
         /// <summary>
-        ///  Gets or sets Tau vector. Contains additional information on Q - used for native solver.
+        /// The numerical rank found by a pivoted factorization.
+        /// </summary>
+        private readonly int _rank;
+
+        /// <summary>
+        /// Gets or sets Tau vector. Contains the scalar factors of the Householder reflectors that make up Q.
         /// </summary>
         public double[] Tau
         {
             get;
             set;
         }
+
+        /// <summary>
+        /// Gets the column permutation of a pivoted factorization: column j of A*P is column <c>Pivots[j]</c>
+        /// of A, and R is the factor of A*P. <c>null</c> when the factorization is not pivoted.
+        /// </summary>
+        public int[] Pivots
+        {
+            get;
+            private set;
+        }
         
         /// <summary>
         /// Initializes a new instance of the <see cref="DenseQR"/> class. This object will compute the
@@ -62,6 +80,21 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
         /// <exception cref="ArgumentNullException">If <paramref name="matrix"/> is <c>null</c>.</exception>
         /// <exception cref="ArgumentException">If <paramref name="matrix"/> row count is less then column count</exception>
         public DenseQR(DenseMatrix matrix)
+            : this(matrix, false)
+        {
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="DenseQR"/> class. This object will compute the
+        /// QR factorization when the constructor is called and cache it's factorization.
+        /// </summary>
+        /// <param name="matrix">The matrix to factor.</param>
+        /// <param name="pivoting">Whether to permute the columns so that the diagonal of R is non-increasing in
+        /// magnitude. This reveals the numerical <see cref="Rank"/>, and <c>Solve</c> then returns the basic
+        /// least squares solution of a rank deficient matrix, at about the cost of an unpivoted factorization.</param>
+        /// <exception cref="ArgumentNullException">If <paramref name="matrix"/> is <c>null</c>.</exception>
+        /// <exception cref="ArgumentException">If <paramref name="matrix"/> row count is less then column count</exception>
+        public DenseQR(DenseMatrix matrix, bool pivoting)
         {
             if (matrix == null)
             {
@@ -74,9 +107,73 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
             }
 
             MatrixR = matrix.Clone();
-            MatrixQ = new DenseMatrix(matrix.RowCount);
             Tau = new double[Math.Min(matrix.RowCount, matrix.ColumnCount)];
-            Control.LinearAlgebraProvider.QRFactor(((DenseMatrix)MatrixR).Data, matrix.RowCount, matrix.ColumnCount, ((DenseMatrix)MatrixQ).Data, Tau);
+            if (pivoting)
+            {
+                Pivots = new int[matrix.ColumnCount];
+                _rank = Control.LinearAlgebraProvider.QRFactorPivoted(((DenseMatrix)MatrixR).Data, matrix.RowCount, matrix.ColumnCount, Tau, Pivots);
+            }
+            else
+            {
+                Control.LinearAlgebraProvider.QRFactor(((DenseMatrix)MatrixR).Data, matrix.RowCount, matrix.ColumnCount, Tau);
+            }
+        }
+
+        /// <summary>
+        /// Gets the numerical rank of the matrix. Without pivoting R does not reveal the rank, and this
+        /// only counts the diagonal entries of R that are not zero.
+        /// </summary>
+        public int Rank
+        {
+            get
+            {
+                if (Pivots != null)
+                {
+                    return _rank;
+                }
+
+                var rank = 0;
+                for (var i = 0; i < MatrixR.ColumnCount; i++)
+                {
+                    if (!Math.Abs(MatrixR.At(i, i)).AlmostEqual(0.0))
+                    {
+                        rank++;
+                    }
+                }
+
+                return rank;
+            }
+        }
+
+        /// <summary>
+        /// Gets a value indicating whether the matrix is full rank or not.
+        /// </summary>
+        /// <value><c>true</c> if the matrix is full rank; otherwise <c>false</c>.</value>
+        public override bool IsFullRank
+        {
+            get
+            {
+                return Pivots == null ? base.IsFullRank : _rank == MatrixR.ColumnCount;
+            }
+        }
+
+        /// <summary>
+        /// Gets orthogonal Q matrix
+        /// </summary>
+        public override Matrix<double> Q
+        {
+            get
+            {
+                if (MatrixQ == null)
+                {
+                    // Q = Q*I, applied from the reflectors kept in R.
+                    var q = DenseMatrix.Identity(MatrixR.RowCount);
+                    Control.LinearAlgebraProvider.QRApplyQ(Transpose.DontTranspose, ((DenseMatrix)MatrixR).Data, MatrixR.RowCount, MatrixR.ColumnCount, Tau, q.Data, MatrixR.RowCount);
+                    MatrixQ = q;
+                }
+
+                return base.Q;
+            }
         }
 
         /// <summary>
@@ -127,7 +224,7 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
                 throw new NotSupportedException("Can only do QR factorization for dense matrices at the moment.");
             }
 
-            Control.LinearAlgebraProvider.QRSolveFactored(((DenseMatrix)MatrixQ).Data, ((DenseMatrix)MatrixR).Data, MatrixR.RowCount, MatrixR.ColumnCount, null, dinput.Data, input.ColumnCount, dresult.Data);
+            SolveFactored(dinput.Data, input.ColumnCount, dresult.Data);
         }
 
         /// <summary>
@@ -172,7 +269,63 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
                 throw new NotSupportedException("Can only do QR factorization for dense vectors at the moment.");
             }
 
-            Control.LinearAlgebraProvider.QRSolveFactored(((DenseMatrix)MatrixQ).Data, ((DenseMatrix)MatrixR).Data, MatrixR.RowCount, MatrixR.ColumnCount, null, dinput.Data, 1, dresult.Data);
+            SolveFactored(dinput.Data, 1, dresult.Data);
+        }
+
+        /// <summary>
+        /// Solves A*X=B as R*X = Q'*B, applying Q' from the reflectors and using only the top rows of R.
+        /// With pivoting only the leading <see cref="Rank"/> columns of A*P are solved for, which gives
+        /// the basic solution that is zero in the other components.
+        /// </summary>
+        /// <param name="input">The B matrix.</param>
+        /// <param name="columnsB">The number of columns of B.</param>
+        /// <param name="result">On exit, the X matrix.</param>
+        private void SolveFactored(double[] input, int columnsB, double[] result)
+        {
+            var rows = MatrixR.RowCount;
+            var columns = MatrixR.ColumnCount;
+            var order = Pivots == null ? columns : _rank;
+            var r = ((DenseMatrix)MatrixR).Data;
+
+            var qtb = new double[rows * columnsB];
+            Array.Copy(input, qtb, qtb.Length);
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.Transpose, r, rows, columns, Tau, qtb, columnsB);
+
+            var x = Pivots == null ? result : new double[order * columnsB];
+            for (var j = 0; j < columnsB; j++)
+            {
+                Array.Copy(qtb, j * rows, x, j * order, order);
+            }
+
+            if (rows != order)
+            {
+                // The top rows of R are not contiguous.
+                var squareR = new double[order * order];
+                for (var j = 0; j < order; j++)
+                {
+                    Array.Copy(r, j * rows, squareR, j * order, order);
+                }
+
+                r = squareR;
+            }
+
+            if (order > 0)
+            {
+                Control.LinearAlgebraProvider.TriangularSolve(Side.Left, Triangle.Upper, Transpose.DontTranspose, DiagonalType.NonUnit, 1.0, r, x, order, columnsB);
+            }
+
+            if (Pivots != null)
+            {
+                // Component i of the solution for A*P is component Pivots[i] of the solution for A.
+                Array.Clear(result, 0, columns * columnsB);
+                for (var j = 0; j < columnsB; j++)
+                {
+                    for (var i = 0; i < order; i++)
+                    {
+                        result[(j * columns) + Pivots[i]] = x[(j * order) + i];
+                    }
+                }
+            }
         }
     }
 }
@@ -84,7 +84,7 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
         {
             get
             {
-                var tmp = Math.Min(MatrixU.RowCount, MatrixVT.ColumnCount) - 1;
+                var tmp = Math.Min(RowCount, ColumnCount) - 1;
                 return Math.Abs(VectorS[0]) / Math.Abs(VectorS[tmp]);
             }
         }
@@ -96,7 +96,7 @@ namespace MathNet.Numerics.LinearAlgebra.Double.Factorization
         {
             get
             {
-                if (MatrixU.RowCount != MatrixVT.ColumnCount)
+                if (RowCount != ColumnCount)
                 {
                     throw new ArgumentException(Resources.ArgumentMatrixSquare);
                 }
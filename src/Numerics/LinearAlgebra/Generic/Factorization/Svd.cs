@@ -64,6 +64,24 @@ namespace MathNet.Numerics.LinearAlgebra.Generic.Factorization
             set;
         }
 
+        /// <summary>
+        /// Gets or sets the number of rows of the factored matrix.
+        /// </summary>
+        protected int RowCount
+        {
+            get;
+            set;
+        }
+
+        /// <summary>
+        /// Gets or sets the number of columns of the factored matrix.
+        /// </summary>
+        protected int ColumnCount
+        {
+            get;
+            set;
+        }
+
         /// <summary>
         /// Gets or sets the singular values (Σ) of matrix in ascending value.
         /// </summary>
@@ -197,12 +215,13 @@ namespace MathNet.Numerics.LinearAlgebra.Generic.Factorization
         }
 
         /// <summary>Returns the singular values as a diagonal <see cref="Matrix{T}"/>.</summary>
-        /// <returns>The singular values as a diagonal <see cref="Matrix{T}"/>.</returns>        
+        /// <returns>The singular values as a diagonal <see cref="Matrix{T}"/>, shaped to fit between U and VT:
+        /// M by N for the full factors, Min(M, N) square for the economy ones.</returns>        
         public Matrix<T> W()
         {
-            var rows = MatrixU.RowCount;
-            var columns = MatrixVT.ColumnCount;
-            var result = MatrixU.CreateMatrix(rows, columns);
+            var rows = ComputeVectors ? MatrixU.ColumnCount : RowCount;
+            var columns = ComputeVectors ? MatrixVT.RowCount : ColumnCount;
+            var result = VectorS.CreateMatrix(rows, columns);
             for (var i = 0; i < rows; i++)
             {
                 for (var j = 0; j < columns; j++)
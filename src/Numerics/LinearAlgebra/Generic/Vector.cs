@@ -760,13 +760,22 @@ namespace MathNet.Numerics.LinearAlgebra.Generic
             }
 
             var matrix = u.CreateMatrix(u.Count, v.Count);
+            u.DoOuterProduct(v, matrix);
+            return matrix;
+        }
 
-            for (var i = 0; i < u.Count; i++)
+        /// <summary>
+        /// Computes the outer product of this vector and another into a zero matrix.
+        /// </summary>
+        /// <param name="other">The right vector of the product.</param>
+        /// <param name="result">A zero matrix with as many rows as this vector and as many columns as <paramref name="other"/>,
+        /// which receives M[i,j] = this[i]*other[j].</param>
+        protected virtual void DoOuterProduct(Vector<T> other, Matrix<T> result)
+        {
+            for (var i = 0; i < Count; i++)
             {
-                matrix.SetRow(i, v.Multiply(u[i]));
+                result.SetRow(i, other.Multiply(this[i]));
             }
-            
-            return matrix;
         }
 
         /// <summary>
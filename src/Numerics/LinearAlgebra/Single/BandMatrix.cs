@@ -0,0 +1,515 @@
+﻿// <copyright file="BandMatrix.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+// Copyright (c) 2009-2010 Math.NET
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+namespace MathNet.Numerics.LinearAlgebra.Single
+{
+    using System;
+    using Generic;
+    using Properties;
+
+    /// <summary>
+    /// A matrix type for square band matrices.
+    /// </summary>
+    /// <remarks>
+    /// Only the diagonals inside the band are stored, column by column in the LAPACK band layout:
+    /// element (i,j) with <c>j - UpperBandwidth &lt;= i &lt;= j + LowerBandwidth</c> is kept at
+    /// <c>Data[(j * (LowerBandwidth + UpperBandwidth + 1)) + UpperBandwidth + i - j]</c>.
+    /// A band matrix will throw an exception if entries outside the band are set. The exception
+    /// to this is when the value is 0.0 or NaN; these settings will cause no change to the matrix.
+    /// </remarks>
+    public class BandMatrix : Matrix
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="BandMatrix"/> class. This matrix is square with a given size.
+        /// </summary>
+        /// <param name="order">The size of the square matrix.</param>
+        /// <param name="lowerBandwidth">The number of subdiagonals inside the band.</param>
+        /// <param name="upperBandwidth">The number of superdiagonals inside the band.</param>
+        /// <exception cref="ArgumentException">
+        /// If <paramref name="order"/> is less than one.
+        /// </exception>
+        /// <exception cref="ArgumentOutOfRangeException">
+        /// If <paramref name="lowerBandwidth"/> or <paramref name="upperBandwidth"/> is negative.
+        /// </exception>
+        public BandMatrix(int order, int lowerBandwidth, int upperBandwidth) : base(order)
+        {
+            if (lowerBandwidth < 0)
+            {
+                throw new ArgumentOutOfRangeException("lowerBandwidth");
+            }
+
+            if (upperBandwidth < 0)
+            {
+                throw new ArgumentOutOfRangeException("upperBandwidth");
+            }
+
+            LowerBandwidth = lowerBandwidth;
+            UpperBandwidth = upperBandwidth;
+            Data = new float[(lowerBandwidth + upperBandwidth + 1) * order];
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the <see cref="BandMatrix"/> class from a one dimensional array in
+        /// band storage. This constructor will reference the one dimensional array and not copy it.
+        /// </summary>
+        /// <param name="order">The size of the square matrix.</param>
+        /// <param name="lowerBandwidth">The number of subdiagonals inside the band.</param>
+        /// <param name="upperBandwidth">The number of superdiagonals inside the band.</param>
+        /// <param name="bandArray">The one dimensional array which contains the band, column by column.</param>
+        /// <exception cref="ArgumentOutOfRangeException">
+        /// If <paramref name="lowerBandwidth"/> or <paramref name="upperBandwidth"/> is negative.
+        /// </exception>
+        /// <exception cref="ArgumentException">
+        /// If the length of <paramref name="bandArray"/> is not <c>(lowerBandwidth + upperBandwidth + 1) * order</c>.
+        /// </exception>
+        public BandMatrix(int order, int lowerBandwidth, int upperBandwidth, float[] bandArray) : base(order)
+        {
+            if (lowerBandwidth < 0)
+            {
+                throw new ArgumentOutOfRangeException("lowerBandwidth");
+            }
+
+            if (upperBandwidth < 0)
+            {
+                throw new ArgumentOutOfRangeException("upperBandwidth");
+            }
+
+            if (bandArray == null)
+            {
+                throw new ArgumentNullException("bandArray");
+            }
+
+            if (bandArray.Length != (lowerBandwidth + upperBandwidth + 1) * order)
+            {
+                throw new ArgumentException(Resources.ArgumentArrayWrongLength, "bandArray");
+            }
+
+            LowerBandwidth = lowerBandwidth;
+            UpperBandwidth = upperBandwidth;
+            Data = bandArray;
+        }
+
+        /// <summary>
+        /// Gets the number of subdiagonals inside the band.
+        /// </summary>
+        public int LowerBandwidth
+        {
+            get;
+            private set;
+        }
+
+        /// <summary>
+        /// Gets the number of superdiagonals inside the band.
+        /// </summary>
+        public int UpperBandwidth
+        {
+            get;
+            private set;
+        }
+
+        /// <summary>
+        /// Gets the matrix's data.
+        /// </summary>
+        /// <value>The matrix's data.</value>
+        internal float[] Data
+        {
+            get;
+            private set;
+        }
+
+        /// <summary>
+        /// Retrieves the requested element without range checking.
+        /// </summary>
+        /// <param name="row">
+        /// The row of the element.
+        /// </param>
+        /// <param name="column">
+        /// The column of the element.
+        /// </param>
+        /// <returns>
+        /// The requested element.
+        /// </returns>
+        public override float At(int row, int column)
+        {
+            if (row - column > LowerBandwidth || column - row > UpperBandwidth)
+            {
+                return 0.0f;
+            }
+
+            return Data[(column * (LowerBandwidth + UpperBandwidth + 1)) + UpperBandwidth + row - column];
+        }
+
+        /// <summary>
+        /// Sets the value of the given element.
+        /// </summary>
+        /// <param name="row">
+        /// The row of the element.
+        /// </param>
+        /// <param name="column">
+        /// The column of the element.
+        /// </param>
+        /// <param name="value">
+        /// The value to set the element to.
+        /// </param>
+        /// <exception cref="IndexOutOfRangeException">When trying to set an element outside the band.</exception>
+        public override void At(int row, int column, float value)
+        {
+            if (row - column > LowerBandwidth || column - row > UpperBandwidth)
+            {
+                if (value != 0.0 && !float.IsNaN(value))
+                {
+                    throw new IndexOutOfRangeException("Cannot set an element outside the band of a band matrix.");
+                }
+
+                return;
+            }
+
+            Data[(column * (LowerBandwidth + UpperBandwidth + 1)) + UpperBandwidth + row - column] = value;
+        }
+
+        /// <summary>
+        /// Creates a <c>SparseMatrix</c> for the given number of rows and columns.
+        /// </summary>
+        /// <param name="numberOfRows">
+        /// The number of rows.
+        /// </param>
+        /// <param name="numberOfColumns">
+        /// The number of columns.
+        /// </param>
+        /// <returns>
+        /// A <c>SparseMatrix</c> with the given dimensions.
+        /// </returns>
+        /// <remarks>
+        /// The result of a general operation on a band matrix does not keep its band, so a sparse matrix is used instead.
+        /// </remarks>
+        public override Matrix<float> CreateMatrix(int numberOfRows, int numberOfColumns)
+        {
+            return new SparseMatrix(numberOfRows, numberOfColumns);
+        }
+
+        /// <summary>
+        /// Creates a <see cref="Vector{T}"/> with a the given dimension.
+        /// </summary>
+        /// <param name="size">The size of the vector.</param>
+        /// <returns>
+        /// A <see cref="Vector{T}"/> with the given dimension.
+        /// </returns>
+        public override Vector<float> CreateVector(int size)
+        {
+            return new DenseVector(size);
+        }
+
+        /// <summary>
+        /// Sets all values to zero.
+        /// </summary>
+        public override void Clear()
+        {
+            Array.Clear(Data, 0, Data.Length);
+        }
+
+        /// <summary>
+        /// Creates a clone of this instance.
+        /// </summary>
+        /// <returns>
+        /// A clone of the instance.
+        /// </returns>
+        public override Matrix<float> Clone()
+        {
+            var ret = new BandMatrix(RowCount, LowerBandwidth, UpperBandwidth);
+            Buffer.BlockCopy(Data, 0, ret.Data, 0, Data.Length * Constants.SizeOfFloat);
+            return ret;
+        }
+
+        /// <summary>
+        /// Returns the transpose of this matrix.
+        /// </summary>
+        /// <returns>The transpose of this matrix.</returns>
+        public override Matrix<float> Transpose()
+        {
+            var ret = new BandMatrix(RowCount, UpperBandwidth, LowerBandwidth);
+            var ld = LowerBandwidth + UpperBandwidth + 1;
+            for (var j = 0; j < ColumnCount; j++)
+            {
+                var start = Math.Max(0, j - UpperBandwidth);
+                var end = Math.Min(RowCount - 1, j + LowerBandwidth);
+                for (var i = start; i <= end; i++)
+                {
+                    ret.Data[(i * ld) + LowerBandwidth + j - i] = Data[(j * ld) + UpperBandwidth + i - j];
+                }
+            }
+
+            return ret;
+        }
+
+        /// <summary>
+        /// Multiplies this matrix with a vector and places the results into the result vector.
+        /// </summary>
+        /// <param name="rightSide">The vector to multiply with.</param>
+        /// <param name="result">The result of the multiplication.</param>
+        /// <exception cref="ArgumentNullException">If <paramref name="rightSide"/> is <see langword="null" />.</exception>
+        /// <exception cref="ArgumentNullException">If the result vector is <see langword="null" />.</exception>
+        /// <exception cref="ArgumentException">If <strong>this.ColumnCount != rightSide.Count</strong>.</exception>
+        /// <exception cref="ArgumentException">If <strong>this.RowCount != result.Count</strong>.</exception>
+        public override void Multiply(Vector<float> rightSide, Vector<float> result)
+        {
+            if (rightSide == null)
+            {
+                throw new ArgumentNullException("rightSide");
+            }
+
+            if (ColumnCount != rightSide.Count)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "rightSide");
+            }
+
+            if (result == null)
+            {
+                throw new ArgumentNullException("result");
+            }
+
+            if (RowCount != result.Count)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "result");
+            }
+
+            if (ReferenceEquals(rightSide, result))
+            {
+                var tmp = result.CreateVector(result.Count);
+                Multiply(rightSide, tmp);
+                tmp.CopyTo(result);
+            }
+            else
+            {
+                // Only the entries inside the band contribute to each row.
+                var ld = LowerBandwidth + UpperBandwidth + 1;
+                for (var i = 0; i < RowCount; i++)
+                {
+                    var start = Math.Max(0, i - LowerBandwidth);
+                    var end = Math.Min(ColumnCount - 1, i + UpperBandwidth);
+                    var s = 0.0f;
+                    for (var j = start; j <= end; j++)
+                    {
+                        s += Data[(j * ld) + UpperBandwidth + i - j] * rightSide[j];
+                    }
+
+                    result[i] = s;
+                }
+            }
+        }
+
+        /// <summary>Calculates the L1 norm.</summary>
+        /// <returns>The L1 norm of the matrix.</returns>
+        public override float L1Norm()
+        {
+            var ld = LowerBandwidth + UpperBandwidth + 1;
+            var norm = 0.0f;
+            for (var j = 0; j < ColumnCount; j++)
+            {
+                var start = Math.Max(0, j - UpperBandwidth);
+                var end = Math.Min(RowCount - 1, j + LowerBandwidth);
+                var s = 0.0f;
+                for (var i = start; i <= end; i++)
+                {
+                    s += Math.Abs(Data[(j * ld) + UpperBandwidth + i - j]);
+                }
+
+                norm = Math.Max(norm, s);
+            }
+
+            return norm;
+        }
+
+        /// <summary>Calculates the Frobenius norm of this matrix.</summary>
+        /// <returns>The Frobenius norm of this matrix.</returns>
+        public override float FrobeniusNorm()
+        {
+            var ld = LowerBandwidth + UpperBandwidth + 1;
+            var norm = 0.0f;
+            for (var j = 0; j < ColumnCount; j++)
+            {
+                var start = Math.Max(0, j - UpperBandwidth);
+                var end = Math.Min(RowCount - 1, j + LowerBandwidth);
+                for (var i = start; i <= end; i++)
+                {
+                    var abs = Math.Abs(Data[(j * ld) + UpperBandwidth + i - j]);
+                    norm += abs * abs;
+                }
+            }
+
+            return Convert.ToSingle(Math.Sqrt(norm));
+        }
+
+        /// <summary>Calculates the infinity norm of this matrix.</summary>
+        /// <returns>The infinity norm of this matrix.</returns>
+        public override float InfinityNorm()
+        {
+            var ld = LowerBandwidth + UpperBandwidth + 1;
+            var norm = 0.0f;
+            for (var i = 0; i < RowCount; i++)
+            {
+                var start = Math.Max(0, i - LowerBandwidth);
+                var end = Math.Min(ColumnCount - 1, i + UpperBandwidth);
+                var s = 0.0f;
+                for (var j = start; j <= end; j++)
+                {
+                    s += Math.Abs(Data[(j * ld) + UpperBandwidth + i - j]);
+                }
+
+                norm = Math.Max(norm, s);
+            }
+
+            return norm;
+        }
+
+        /// <summary>
+        /// Solves A*x=b with a banded LU factorization with partial pivoting, where A is this matrix.
+        /// </summary>
+        /// <param name="input">The right hand side vector, <c>b</c>.</param>
+        /// <returns>The left hand side vector, <c>x</c>.</returns>
+        /// <remarks>The factorization runs in O(n*kl*(kl+ku)) time and this matrix is left unchanged.</remarks>
+        /// <exception cref="ArgumentNullException">If <paramref name="input"/> is <see langword="null" />.</exception>
+        /// <exception cref="ArgumentException">If <strong>this.RowCount != input.Count</strong>.</exception>
+        /// <exception cref="ArgumentException">If this matrix is singular.</exception>
+        public Vector<float> LUSolve(Vector<float> input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            if (RowCount != input.Count)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "input");
+            }
+
+            var x = input.ToArray();
+            Control.LinearAlgebraProvider.BandLUSolve(Data, RowCount, LowerBandwidth, UpperBandwidth, x, 1);
+            return new DenseVector(x);
+        }
+
+        /// <summary>
+        /// Solves A*X=B with a banded LU factorization with partial pivoting, where A is this matrix.
+        /// </summary>
+        /// <param name="input">The right hand side matrix, <c>B</c>.</param>
+        /// <returns>The left hand side matrix, <c>X</c>.</returns>
+        /// <remarks>The factorization runs in O(n*kl*(kl+ku)) time and this matrix is left unchanged.</remarks>
+        /// <exception cref="ArgumentNullException">If <paramref name="input"/> is <see langword="null" />.</exception>
+        /// <exception cref="ArgumentException">If <strong>this.RowCount != input.RowCount</strong>.</exception>
+        /// <exception cref="ArgumentException">If this matrix is singular.</exception>
+        public Matrix<float> LUSolve(Matrix<float> input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            if (RowCount != input.RowCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "input");
+            }
+
+            var x = input.ToColumnWiseArray();
+            Control.LinearAlgebraProvider.BandLUSolve(Data, RowCount, LowerBandwidth, UpperBandwidth, x, input.ColumnCount);
+            return new DenseMatrix(input.RowCount, input.ColumnCount, x);
+        }
+
+        /// <summary>
+        /// Solves A*x=b with a banded Cholesky factorization, where A is this symmetric positive definite matrix.
+        /// </summary>
+        /// <param name="input">The right hand side vector, <c>b</c>.</param>
+        /// <returns>The left hand side vector, <c>x</c>.</returns>
+        /// <remarks>Only the lower half of the band is read. The factorization runs in O(n*kd^2) time and this matrix is left unchanged.</remarks>
+        /// <exception cref="ArgumentNullException">If <paramref name="input"/> is <see langword="null" />.</exception>
+        /// <exception cref="ArgumentException">If <strong>this.RowCount != input.Count</strong>.</exception>
+        /// <exception cref="ArgumentException">If the lower and upper bandwidths differ.</exception>
+        /// <exception cref="ArgumentException">If this matrix is not positive definite.</exception>
+        public Vector<float> CholeskySolve(Vector<float> input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            if (RowCount != input.Count)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "input");
+            }
+
+            var x = input.ToArray();
+            Control.LinearAlgebraProvider.BandCholeskySolve(LowerBand(), RowCount, LowerBandwidth, x, 1);
+            return new DenseVector(x);
+        }
+
+        /// <summary>
+        /// Solves A*X=B with a banded Cholesky factorization, where A is this symmetric positive definite matrix.
+        /// </summary>
+        /// <param name="input">The right hand side matrix, <c>B</c>.</param>
+        /// <returns>The left hand side matrix, <c>X</c>.</returns>
+        /// <remarks>Only the lower half of the band is read. The factorization runs in O(n*kd^2) time and this matrix is left unchanged.</remarks>
+        /// <exception cref="ArgumentNullException">If <paramref name="input"/> is <see langword="null" />.</exception>
+        /// <exception cref="ArgumentException">If <strong>this.RowCount != input.RowCount</strong>.</exception>
+        /// <exception cref="ArgumentException">If the lower and upper bandwidths differ.</exception>
+        /// <exception cref="ArgumentException">If this matrix is not positive definite.</exception>
+        public Matrix<float> CholeskySolve(Matrix<float> input)
+        {
+            if (input == null)
+            {
+                throw new ArgumentNullException("input");
+            }
+
+            if (RowCount != input.RowCount)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixDimensions, "input");
+            }
+
+            var x = input.ToColumnWiseArray();
+            Control.LinearAlgebraProvider.BandCholeskySolve(LowerBand(), RowCount, LowerBandwidth, x, input.ColumnCount);
+            return new DenseMatrix(input.RowCount, input.ColumnCount, x);
+        }
+
+        /// <summary>
+        /// Copies the diagonal and the subdiagonals into the (kd+1) by n lower band storage used by the banded Cholesky solver.
+        /// </summary>
+        /// <returns>The lower band, with A(i,j) at <c>[(j * (kd + 1)) + i - j]</c>.</returns>
+        private float[] LowerBand()
+        {
+            if (LowerBandwidth != UpperBandwidth)
+            {
+                throw new ArgumentException(Resources.ArgumentMatrixSymmetric);
+            }
+
+            var ld = LowerBandwidth + UpperBandwidth + 1;
+            var ldlower = LowerBandwidth + 1;
+            var lower = new float[ldlower * RowCount];
+            for (var j = 0; j < RowCount; j++)
+            {
+                Array.Copy(Data, (j * ld) + UpperBandwidth, lower, j * ldlower, ldlower);
+            }
+
+            return lower;
+        }
+    }
+}
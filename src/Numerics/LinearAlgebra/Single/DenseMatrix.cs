@@ -403,16 +403,13 @@ namespace MathNet.Numerics.LinearAlgebra.Single
             }
             else
             {
-                Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
+                Control.LinearAlgebraProvider.MatrixVectorMultiply(
                     Algorithms.LinearAlgebra.Transpose.DontTranspose,
                     1.0f,
                     Data,
                     RowCount,
                     ColumnCount,
                     denseRight.Data,
-                    denseRight.Count,
-                    1,
                     0.0f,
                     denseResult.Data);
             }
@@ -434,16 +431,13 @@ namespace MathNet.Numerics.LinearAlgebra.Single
             }
             else
             {
-                Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
+                Control.LinearAlgebraProvider.MatrixVectorMultiply(
+                    Algorithms.LinearAlgebra.Transpose.Transpose,
                     1.0f,
-                    denseLeft.Data,
-                    1,
-                    denseLeft.Count,
                     Data,
                     RowCount,
                     ColumnCount,
+                    denseLeft.Data,
                     0.0f,
                     denseResult.Data);
             }
@@ -494,6 +488,19 @@ namespace MathNet.Numerics.LinearAlgebra.Single
             {
                 base.DoTransposeAndMultiply(other, result);
             }
+            else if (ReferenceEquals(denseOther, this))
+            {
+                // this*this' is symmetric, so only one triangle needs to be computed.
+                Control.LinearAlgebraProvider.SymmetricRankKUpdate(
+                                  Algorithms.LinearAlgebra.Transpose.DontTranspose,
+                                  1.0f,
+                                  Data,
+                                  RowCount,
+                                  ColumnCount,
+                                  0.0f,
+                                  denseResult.Data,
+                                  true);
+            }
             else
             {
                 Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
@@ -527,16 +534,13 @@ namespace MathNet.Numerics.LinearAlgebra.Single
             }
             else
             {
-                Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
+                Control.LinearAlgebraProvider.MatrixVectorMultiply(
                     Algorithms.LinearAlgebra.Transpose.Transpose,
-                    Algorithms.LinearAlgebra.Transpose.DontTranspose,
                     1.0f,
                     Data,
                     RowCount,
                     ColumnCount,
                     denseRight.Data,
-                    denseRight.Count,
-                    1,
                     0.0f,
                     denseResult.Data);
             }
@@ -556,6 +560,19 @@ namespace MathNet.Numerics.LinearAlgebra.Single
             {
                 base.DoTransposeThisAndMultiply(other, result);
             }
+            else if (ReferenceEquals(denseOther, this))
+            {
+                // this'*this is symmetric, so only one triangle needs to be computed.
+                Control.LinearAlgebraProvider.SymmetricRankKUpdate(
+                                  Algorithms.LinearAlgebra.Transpose.Transpose,
+                                  1.0f,
+                                  Data,
+                                  RowCount,
+                                  ColumnCount,
+                                  0.0f,
+                                  denseResult.Data,
+                                  true);
+            }
             else
             {
                 Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(
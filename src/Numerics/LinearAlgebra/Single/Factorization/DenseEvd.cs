@@ -94,17 +94,11 @@ namespace MathNet.Numerics.LinearAlgebra.Single.Factorization
             if (IsSymmetric)
             {
                 matrix.CopyTo(MatrixEv);
-                d = MatrixEv.Row(order - 1).ToArray();
-
-                SymmetricTridiagonalize(((DenseMatrix)MatrixEv).Data, d, e, order);
-                SymmetricDiagonalize(((DenseMatrix)MatrixEv).Data, d, e, order);
+                Control.LinearAlgebraProvider.EigenDecomposition(((DenseMatrix)MatrixEv).Data, order, d);
             }
             else
             {
-                var matrixH = matrix.ToArray();
-
-                NonsymmetricReduceToHessenberg(((DenseMatrix)MatrixEv).Data, matrixH, order);
-                NonsymmetricReduceHessenberToRealSchur(((DenseMatrix)MatrixEv).Data, matrixH, d, e, order);
+                Control.LinearAlgebraProvider.EigenDecomposition(false, true, matrix.ToColumnWiseArray(), order, d, e, null, ((DenseMatrix)MatrixEv).Data);
             }
 
             for (var i = 0; i < order; i++)
@@ -127,955 +121,6 @@ namespace MathNet.Numerics.LinearAlgebra.Single.Factorization
             }
         }
 
-        /// <summary>
-        /// Symmetric Householder reduction to tridiagonal form.
-        /// </summary>
-        /// <param name="a">Data array of matrix V (eigenvectors)</param>
-        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
-        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedures tred2 by 
-        /// Bowdler, Martin, Reinsch, and Wilkinson, Handbook for 
-        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding 
-        /// Fortran subroutine in EISPACK.</remarks>
-        private static void SymmetricTridiagonalize(float[] a, float[] d, float[] e, int order)
-        {
-            // Householder reduction to tridiagonal form.
-            for (var i = order - 1; i > 0; i--)
-            {
-                // Scale to avoid under/overflow.
-                var scale = 0.0f;
-                var h = 0.0f;
-
-                for (var k = 0; k < i; k++)
-                {
-                    scale = scale + Math.Abs(d[k]);
-                }
-
-                if (scale == 0.0f)
-                {
-                    e[i] = d[i - 1];
-                    for (var j = 0; j < i; j++)
-                    {
-                        d[j] = a[(j * order) + i - 1];
-                        a[(j * order) + i] = 0.0f;
-                        a[(i * order) + j] = 0.0f;
-                    }
-                }
-                else
-                {
-                    // Generate Householder vector.
-                    for (var k = 0; k < i; k++)
-                    {
-                        d[k] /= scale;
-                        h += d[k] * d[k];
-                    }
-
-                    var f = d[i - 1];
-                    var g = (float)Math.Sqrt(h);
-                    if (f > 0)
-                    {
-                        g = -g;
-                    }
-
-                    e[i] = scale * g;
-                    h = h - (f * g);
-                    d[i - 1] = f - g;
-
-                    for (var j = 0; j < i; j++)
-                    {
-                        e[j] = 0.0f;
-                    }
-
-                    // Apply similarity transformation to remaining columns.
-                    for (var j = 0; j < i; j++)
-                    {
-                        f = d[j];
-                        a[(i * order) + j] = f;
-                        g = e[j] + (a[(j * order) + j] * f);
-
-                        for (var k = j + 1; k <= i - 1; k++)
-                        {
-                            g += a[(j * order) + k] * d[k];
-                            e[k] += a[(j * order) + k] * f;
-                        }
-
-                        e[j] = g;
-                    }
-
-                    f = 0.0f;
-
-                    for (var j = 0; j < i; j++)
-                    {
-                        e[j] /= h;
-                        f += e[j] * d[j];
-                    }
-
-                    var hh = f / (h + h);
-
-                    for (var j = 0; j < i; j++)
-                    {
-                        e[j] -= hh * d[j];
-                    }
-
-                    for (var j = 0; j < i; j++)
-                    {
-                        f = d[j];
-                        g = e[j];
-
-                        for (var k = j; k <= i - 1; k++)
-                        {
-                            a[(j * order) + k] -= (f * e[k]) + (g * d[k]);
-                        }
-
-                        d[j] = a[(j * order) + i - 1];
-                        a[(j * order) + i] = 0.0f;
-                    }
-                }
-
-                d[i] = h;
-            }
-
-            // Accumulate transformations.
-            for (var i = 0; i < order - 1; i++)
-            {
-                a[(i * order) + order - 1] = a[(i * order) + i];
-                a[(i * order) + i] = 1.0f;
-                var h = d[i + 1];
-                if (h != 0.0f)
-                {
-                    for (var k = 0; k <= i; k++)
-                    {
-                        d[k] = a[((i + 1) * order) + k] / h;
-                    }
-
-                    for (var j = 0; j <= i; j++)
-                    {
-                        var g = 0.0f;
-                        for (var k = 0; k <= i; k++)
-                        {
-                            g += a[((i + 1) * order) + k] * a[(j * order) + k];
-                        }
-
-                        for (var k = 0; k <= i; k++)
-                        {
-                            a[(j * order) + k] -= g * d[k];
-                        }
-                    }
-                }
-
-                for (var k = 0; k <= i; k++)
-                {
-                    a[((i + 1) * order) + k] = 0.0f;
-                }
-            }
-
-            for (var j = 0; j < order; j++)
-            {
-                d[j] = a[(j * order) + order - 1];
-                a[(j * order) + order - 1] = 0.0f;
-            }
-
-            a[(order * order) - 1] = 1.0f;
-            e[0] = 0.0f;
-        }
-
-        /// <summary>
-        /// Symmetric tridiagonal QL algorithm.
-        /// </summary>
-        /// <param name="a">Data array of matrix V (eigenvectors)</param>
-        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
-        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedures tql2, by
-        /// Bowdler, Martin, Reinsch, and Wilkinson, Handbook for
-        /// Auto. Comp., Vol.ii-Linear Algebra, and the corresponding
-        /// Fortran subroutine in EISPACK.</remarks>
-        private static void SymmetricDiagonalize(float[] a, float[] d, float[] e, int order)
-        {
-            const int Maxiter = 1000;
-
-            for (var i = 1; i < order; i++)
-            {
-                e[i - 1] = e[i];
-            }
-
-            e[order - 1] = 0.0f;
-
-            var f = 0.0f;
-            var tst1 = 0.0f;
-            var eps = Precision.DoubleMachinePrecision;
-            for (var l = 0; l < order; l++)
-            {
-                // Find small subdiagonal element
-                tst1 = Math.Max(tst1, Math.Abs(d[l]) + Math.Abs(e[l]));
-                var m = l;
-                while (m < order)
-                {
-                    if (Math.Abs(e[m]) <= eps * tst1)
-                    {
-                        break;
-                    }
-
-                    m++;
-                }
-
-                // If m == l, d[l] is an eigenvalue,
-                // otherwise, iterate.
-                if (m > l)
-                {
-                    var iter = 0;
-                    do
-                    {
-                        iter = iter + 1; // (Could check iteration count here.)
-
-                        // Compute implicit shift
-                        var g = d[l];
-                        var p = (d[l + 1] - g) / (2.0f * e[l]);
-                        var r = SpecialFunctions.Hypotenuse(p, 1.0f);
-                        if (p < 0)
-                        {
-                            r = -r;
-                        }
-
-                        d[l] = e[l] / (p + r);
-                        d[l + 1] = e[l] * (p + r);
-
-                        var dl1 = d[l + 1];
-                        var h = g - d[l];
-                        for (var i = l + 2; i < order; i++)
-                        {
-                            d[i] -= h;
-                        }
-
-                        f = f + h;
-
-                        // Implicit QL transformation.
-                        p = d[m];
-                        var c = 1.0f;
-                        var c2 = c;
-                        var c3 = c;
-                        var el1 = e[l + 1];
-                        var s = 0.0f;
-                        var s2 = 0.0f;
-                        for (var i = m - 1; i >= l; i--)
-                        {
-                            c3 = c2;
-                            c2 = c;
-                            s2 = s;
-                            g = c * e[i];
-                            h = c * p;
-                            r = SpecialFunctions.Hypotenuse(p, e[i]);
-                            e[i + 1] = s * r;
-                            s = e[i] / r;
-                            c = p / r;
-                            p = (c * d[i]) - (s * g);
-                            d[i + 1] = h + (s * ((c * g) + (s * d[i])));
-
-                            // Accumulate transformation.
-                            for (var k = 0; k < order; k++)
-                            {
-                                h = a[((i + 1) * order) + k];
-                                a[((i + 1) * order) + k] = (s * a[(i * order) + k]) + (c * h);
-                                a[(i * order) + k] = (c * a[(i * order) + k]) - (s * h);
-                            }
-                        }
-
-                        p = (-s) * s2 * c3 * el1 * e[l] / dl1;
-                        e[l] = s * p;
-                        d[l] = c * p;
-
-                        // Check for convergence. If too many iterations have been performed, 
-                        // throw exception that Convergence Failed
-                        if (iter >= Maxiter)
-                        {
-                            throw new ArgumentException(Resources.ConvergenceFailed);
-                        }
-                    }
-                    while (Math.Abs(e[l]) > eps * tst1);
-                }
-
-                d[l] = d[l] + f;
-                e[l] = 0.0f;
-            }
-
-            // Sort eigenvalues and corresponding vectors.
-            for (var i = 0; i < order - 1; i++)
-            {
-                var k = i;
-                var p = d[i];
-                for (var j = i + 1; j < order; j++)
-                {
-                    if (d[j] < p)
-                    {
-                        k = j;
-                        p = d[j];
-                    }
-                }
-
-                if (k != i)
-                {
-                    d[k] = d[i];
-                    d[i] = p;
-                    for (var j = 0; j < order; j++)
-                    {
-                        p = a[(i * order) + j];
-                        a[(i * order) + j] = a[(k * order) + j];
-                        a[(k * order) + j] = p;
-                    }
-                }
-            }
-        }
-
-        /// <summary>
-        /// Nonsymmetric reduction to Hessenberg form.
-        /// </summary>
-        /// <param name="a">Data array of matrix V (eigenvectors)</param>
-        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedures orthes and ortran,
-        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
-        /// Vol.ii-Linear Algebra, and the corresponding
-        /// Fortran subroutines in EISPACK.</remarks>
-        private static void NonsymmetricReduceToHessenberg(float[] a, float[,] matrixH, int order)
-        {
-            var ort = new float[order];
-
-            for (var m = 1; m < order - 1; m++)
-            {
-                // Scale column.
-                var scale = 0.0f;
-                for (var i = m; i < order; i++)
-                {
-                    scale = scale + Math.Abs(matrixH[i, m - 1]);
-                }
-
-                if (scale != 0.0f)
-                {
-                    // Compute Householder transformation.
-                    var h = 0.0f;
-                    for (var i = order - 1; i >= m; i--)
-                    {
-                        ort[i] = matrixH[i, m - 1] / scale;
-                        h += ort[i] * ort[i];
-                    }
-
-                    var g = (float)Math.Sqrt(h);
-                    if (ort[m] > 0)
-                    {
-                        g = -g;
-                    }
-
-                    h = h - (ort[m] * g);
-                    ort[m] = ort[m] - g;
-
-                    // Apply Householder similarity transformation
-                    // H = (I-u*u'/h)*H*(I-u*u')/h)
-                    for (var j = m; j < order; j++)
-                    {
-                        var f = 0.0f;
-                        for (var i = order - 1; i >= m; i--)
-                        {
-                            f += ort[i] * matrixH[i, j];
-                        }
-
-                        f = f / h;
-                        for (var i = m; i < order; i++)
-                        {
-                            matrixH[i, j] -= f * ort[i];
-                        }
-                    }
-
-                    for (var i = 0; i < order; i++)
-                    {
-                        var f = 0.0f;
-                        for (var j = order - 1; j >= m; j--)
-                        {
-                            f += ort[j] * matrixH[i, j];
-                        }
-
-                        f = f / h;
-                        for (var j = m; j < order; j++)
-                        {
-                            matrixH[i, j] -= f * ort[j];
-                        }
-                    }
-
-                    ort[m] = scale * ort[m];
-                    matrixH[m, m - 1] = scale * g;
-                }
-            }
-
-            // Accumulate transformations (Algol's ortran).
-            for (var i = 0; i < order; i++)
-            {
-                for (var j = 0; j < order; j++)
-                {
-                    a[(j * order) + i] = i == j ? 1.0f : 0.0f;
-                }
-            }
-
-            for (var m = order - 2; m >= 1; m--)
-            {
-                if (matrixH[m, m - 1] != 0.0f)
-                {
-                    for (var i = m + 1; i < order; i++)
-                    {
-                        ort[i] = matrixH[i, m - 1];
-                    }
-
-                    for (var j = m; j < order; j++)
-                    {
-                        var g = 0.0f;
-                        for (var i = m; i < order; i++)
-                        {
-                            g += ort[i] * a[(j * order) + i];
-                        }
-
-                        // Double division avoids possible underflow
-                        g = (g / ort[m]) / matrixH[m, m - 1];
-                        for (var i = m; i < order; i++)
-                        {
-                            a[(j * order) + i] += g * ort[i];
-                        }
-                    }
-                }
-            }
-        }
-
-        /// <summary>
-        /// Nonsymmetric reduction from Hessenberg to real Schur form.
-        /// </summary>
-        /// <param name="a">Data array of matrix V (eigenvectors)</param>
-        /// <param name="matrixH">Array for internal storage of nonsymmetric Hessenberg form.</param>
-        /// <param name="d">Arrays for internal storage of real parts of eigenvalues</param>
-        /// <param name="e">Arrays for internal storage of imaginary parts of eigenvalues</param>
-        /// <param name="order">Order of initial matrix</param>
-        /// <remarks>This is derived from the Algol procedure hqr2,
-        /// by Martin and Wilkinson, Handbook for Auto. Comp.,
-        /// Vol.ii-Linear Algebra, and the corresponding
-        /// Fortran subroutine in EISPACK.</remarks>
-        private static void NonsymmetricReduceHessenberToRealSchur(float[] a, float[,] matrixH, float[] d, float[] e, int order)
-        {
-            // Initialize
-            var n = order - 1;
-            var eps = (float)Precision.SingleMachinePrecision;
-            var exshift = 0.0f;
-            float p = 0, q = 0, r = 0, s = 0, z = 0, w, x, y;
-
-            // Store roots isolated by balanc and compute matrix norm
-            var norm = 0.0f;
-            for (var i = 0; i < order; i++)
-            {
-                for (var j = Math.Max(i - 1, 0); j < order; j++)
-                {
-                    norm = norm + Math.Abs(matrixH[i, j]);
-                }
-            }
-
-            // Outer loop over eigenvalue index
-            var iter = 0;
-            while (n >= 0)
-            {
-                // Look for single small sub-diagonal element
-                var l = n;
-                while (l > 0)
-                {
-                    s = Math.Abs(matrixH[l - 1, l - 1]) + Math.Abs(matrixH[l, l]);
-
-                    if (s == 0.0f)
-                    {
-                        s = norm;
-                    }
-
-                    if (Math.Abs(matrixH[l, l - 1]) < eps * s)
-                    {
-                        break;
-                    }
-
-                    l--;
-                }
-
-                // Check for convergence
-                // One root found
-                if (l == n)
-                {
-                    matrixH[n, n] = matrixH[n, n] + exshift;
-                    d[n] = matrixH[n, n];
-                    e[n] = 0.0f;
-                    n--;
-                    iter = 0;
-
-                    // Two roots found
-                }
-                else if (l == n - 1)
-                {
-                    w = matrixH[n, n - 1] * matrixH[n - 1, n];
-                    p = (matrixH[n - 1, n - 1] - matrixH[n, n]) / 2.0f;
-                    q = (p * p) + w;
-                    z = (float)Math.Sqrt(Math.Abs(q));
-                    matrixH[n, n] = matrixH[n, n] + exshift;
-                    matrixH[n - 1, n - 1] = matrixH[n - 1, n - 1] + exshift;
-                    x = matrixH[n, n];
-
-                    // Real pair
-                    if (q >= 0)
-                    {
-                        if (p >= 0)
-                        {
-                            z = p + z;
-                        }
-                        else
-                        {
-                            z = p - z;
-                        }
-
-                        d[n - 1] = x + z;
-
-                        d[n] = d[n - 1];
-                        if (z != 0.0f)
-                        {
-                            d[n] = x - (w / z);
-                        }
-
-                        e[n - 1] = 0.0f;
-                        e[n] = 0.0f;
-                        x = matrixH[n, n - 1];
-                        s = Math.Abs(x) + Math.Abs(z);
-                        p = x / s;
-                        q = z / s;
-                        r = (float)Math.Sqrt((p * p) + (q * q));
-                        p = p / r;
-                        q = q / r;
-
-                        // Row modification
-                        for (var j = n - 1; j < order; j++)
-                        {
-                            z = matrixH[n - 1, j];
-                            matrixH[n - 1, j] = (q * z) + (p * matrixH[n, j]);
-                            matrixH[n, j] = (q * matrixH[n, j]) - (p * z);
-                        }
-
-                        // Column modification
-                        for (var i = 0; i <= n; i++)
-                        {
-                            z = matrixH[i, n - 1];
-                            matrixH[i, n - 1] = (q * z) + (p * matrixH[i, n]);
-                            matrixH[i, n] = (q * matrixH[i, n]) - (p * z);
-                        }
-
-                        // Accumulate transformations
-                        for (var i = 0; i < order; i++)
-                        {
-                            z = a[((n - 1) * order) + i];
-                            a[((n - 1) * order) + i] = (q * z) + (p * a[(n * order) + i]);
-                            a[(n * order) + i] = (q * a[(n * order) + i]) - (p * z);
-                        }
-
-                        // Complex pair
-                    }
-                    else
-                    {
-                        d[n - 1] = x + p;
-                        d[n] = x + p;
-                        e[n - 1] = z;
-                        e[n] = -z;
-                    }
-
-                    n = n - 2;
-                    iter = 0;
-
-                    // No convergence yet
-                }
-                else
-                {
-                    // Form shift
-                    x = matrixH[n, n];
-                    y = 0.0f;
-                    w = 0.0f;
-                    if (l < n)
-                    {
-                        y = matrixH[n - 1, n - 1];
-                        w = matrixH[n, n - 1] * matrixH[n - 1, n];
-                    }
-
-                    // Wilkinson's original ad hoc shift
-                    if (iter == 10)
-                    {
-                        exshift += x;
-                        for (var i = 0; i <= n; i++)
-                        {
-                            matrixH[i, i] -= x;
-                        }
-
-                        s = Math.Abs(matrixH[n, n - 1]) + Math.Abs(matrixH[n - 1, n - 2]);
-                        x = y = 0.75f * s;
-                        w = (-0.4375f) * s * s;
-                    }
-
-                    // MATLAB's new ad hoc shift
-                    if (iter == 30)
-                    {
-                        s = (y - x) / 2.0f;
-                        s = (s * s) + w;
-                        if (s > 0)
-                        {
-                            s = (float)Math.Sqrt(s);
-                            if (y < x)
-                            {
-                                s = -s;
-                            }
-
-                            s = x - (w / (((y - x) / 2.0f) + s));
-                            for (var i = 0; i <= n; i++)
-                            {
-                                matrixH[i, i] -= s;
-                            }
-
-                            exshift += s;
-                            x = y = w = 0.964f;
-                        }
-                    }
-
-                    iter = iter + 1; // (Could check iteration count here.)
-
-                    // Look for two consecutive small sub-diagonal elements
-                    var m = n - 2;
-                    while (m >= l)
-                    {
-                        z = matrixH[m, m];
-                        r = x - z;
-                        s = y - z;
-                        p = (((r * s) - w) / matrixH[m + 1, m]) + matrixH[m, m + 1];
-                        q = matrixH[m + 1, m + 1] - z - r - s;
-                        r = matrixH[m + 2, m + 1];
-                        s = Math.Abs(p) + Math.Abs(q) + Math.Abs(r);
-                        p = p / s;
-                        q = q / s;
-                        r = r / s;
-
-                        if (m == l)
-                        {
-                            break;
-                        }
-
-                        if (Math.Abs(matrixH[m, m - 1]) * (Math.Abs(q) + Math.Abs(r)) < eps * (Math.Abs(p) * (Math.Abs(matrixH[m - 1, m - 1]) + Math.Abs(z) + Math.Abs(matrixH[m + 1, m + 1]))))
-                        {
-                            break;
-                        }
-
-                        m--;
-                    }
-
-                    for (var i = m + 2; i <= n; i++)
-                    {
-                        matrixH[i, i - 2] = 0.0f;
-                        if (i > m + 2)
-                        {
-                            matrixH[i, i - 3] = 0.0f;
-                        }
-                    }
-
-                    // Double QR step involving rows l:n and columns m:n
-                    for (var k = m; k <= n - 1; k++)
-                    {
-                        bool notlast = k != n - 1;
-
-                        if (k != m)
-                        {
-                            p = matrixH[k, k - 1];
-                            q = matrixH[k + 1, k - 1];
-                            r = notlast ? matrixH[k + 2, k - 1] : 0.0f;
-                            x = Math.Abs(p) + Math.Abs(q) + Math.Abs(r);
-                            if (x != 0.0f)
-                            {
-                                p = p / x;
-                                q = q / x;
-                                r = r / x;
-                            }
-                        }
-
-                        if (x == 0.0f)
-                        {
-                            break;
-                        }
-
-                        s = (float)Math.Sqrt((p * p) + (q * q) + (r * r));
-                        if (p < 0)
-                        {
-                            s = -s;
-                        }
-
-                        if (s != 0.0f)
-                        {
-                            if (k != m)
-                            {
-                                matrixH[k, k - 1] = (-s) * x;
-                            }
-                            else if (l != m)
-                            {
-                                matrixH[k, k - 1] = -matrixH[k, k - 1];
-                            }
-
-                            p = p + s;
-                            x = p / s;
-                            y = q / s;
-                            z = r / s;
-                            q = q / p;
-                            r = r / p;
-
-                            // Row modification
-                            for (var j = k; j < order; j++)
-                            {
-                                p = matrixH[k, j] + (q * matrixH[k + 1, j]);
-
-                                if (notlast)
-                                {
-                                    p = p + (r * matrixH[k + 2, j]);
-                                    matrixH[k + 2, j] = matrixH[k + 2, j] - (p * z);
-                                }
-
-                                matrixH[k, j] = matrixH[k, j] - (p * x);
-                                matrixH[k + 1, j] = matrixH[k + 1, j] - (p * y);
-                            }
-
-                            // Column modification
-                            for (var i = 0; i <= Math.Min(n, k + 3); i++)
-                            {
-                                p = (x * matrixH[i, k]) + (y * matrixH[i, k + 1]);
-
-                                if (notlast)
-                                {
-                                    p = p + (z * matrixH[i, k + 2]);
-                                    matrixH[i, k + 2] = matrixH[i, k + 2] - (p * r);
-                                }
-
-                                matrixH[i, k] = matrixH[i, k] - p;
-                                matrixH[i, k + 1] = matrixH[i, k + 1] - (p * q);
-                            }
-
-                            // Accumulate transformations
-                            for (var i = 0; i < order; i++)
-                            {
-                                p = (x * a[(k * order) + i]) + (y * a[((k + 1) * order) + i]);
-
-                                if (notlast)
-                                {
-                                    p = p + (z * a[((k + 2) * order) + i]);
-                                    a[((k + 2) * order) + i] -= p * r;
-                                }
-
-                                a[(k * order) + i] -= p;
-                                a[((k + 1) * order) + i] -= p * q;
-                            }
-                        } // (s != 0)
-                    } // k loop
-                } // check convergence
-            } // while (n >= low)
-
-            // Backsubstitute to find vectors of upper triangular form
-            if (norm == 0.0f)
-            {
-                return;
-            }
-
-            for (n = order - 1; n >= 0; n--)
-            {
-                float t;
-
-                p = d[n];
-                q = e[n];
-
-                // Real vector
-                if (q == 0.0f)
-                {
-                    var l = n;
-                    matrixH[n, n] = 1.0f;
-                    for (var i = n - 1; i >= 0; i--)
-                    {
-                        w = matrixH[i, i] - p;
-                        r = 0.0f;
-                        for (var j = l; j <= n; j++)
-                        {
-                            r = r + (matrixH[i, j] * matrixH[j, n]);
-                        }
-
-                        if (e[i] < 0.0f)
-                        {
-                            z = w;
-                            s = r;
-                        }
-                        else
-                        {
-                            l = i;
-                            if (e[i] == 0.0f)
-                            {
-                                if (w != 0.0f)
-                                {
-                                    matrixH[i, n] = (-r) / w;
-                                }
-                                else
-                                {
-                                    matrixH[i, n] = (-r) / (eps * norm);
-                                }
-
-                                // Solve real equations
-                            }
-                            else
-                            {
-                                x = matrixH[i, i + 1];
-                                y = matrixH[i + 1, i];
-                                q = ((d[i] - p) * (d[i] - p)) + (e[i] * e[i]);
-                                t = ((x * s) - (z * r)) / q;
-                                matrixH[i, n] = t;
-                                if (Math.Abs(x) > Math.Abs(z))
-                                {
-                                    matrixH[i + 1, n] = (-r - (w * t)) / x;
-                                }
-                                else
-                                {
-                                    matrixH[i + 1, n] = (-s - (y * t)) / z;
-                                }
-                            }
-
-                            // Overflow control
-                            t = Math.Abs(matrixH[i, n]);
-                            if ((eps * t) * t > 1)
-                            {
-                                for (var j = i; j <= n; j++)
-                                {
-                                    matrixH[j, n] = matrixH[j, n] / t;
-                                }
-                            }
-                        }
-                    }
-
-                    // Complex vector
-                }
-                else if (q < 0)
-                {
-                    var l = n - 1;
-
-                    // Last vector component imaginary so matrix is triangular
-                    if (Math.Abs(matrixH[n, n - 1]) > Math.Abs(matrixH[n - 1, n]))
-                    {
-                        matrixH[n - 1, n - 1] = q / matrixH[n, n - 1];
-                        matrixH[n - 1, n] = (-(matrixH[n, n] - p)) / matrixH[n, n - 1];
-                    }
-                    else
-                    {
-                        var res = Cdiv(0.0f, -matrixH[n - 1, n], matrixH[n - 1, n - 1] - p, q);
-                        matrixH[n - 1, n - 1] = res.Real;
-                        matrixH[n - 1, n] = res.Imaginary;
-                    }
-
-                    matrixH[n, n - 1] = 0.0f;
-                    matrixH[n, n] = 1.0f;
-                    for (var i = n - 2; i >= 0; i--)
-                    {
-                        float ra = 0.0f;
-                        float sa = 0.0f;
-                        for (var j = l; j <= n; j++)
-                        {
-                            ra = ra + (matrixH[i, j] * matrixH[j, n - 1]);
-                            sa = sa + (matrixH[i, j] * matrixH[j, n]);
-                        }
-
-                        w = matrixH[i, i] - p;
-
-                        if (e[i] < 0.0f)
-                        {
-                            z = w;
-                            r = ra;
-                            s = sa;
-                        }
-                        else
-                        {
-                            l = i;
-                            if (e[i] == 0.0f)
-                            {
-                                var res = Cdiv(-ra, -sa, w, q);
-                                matrixH[i, n - 1] = res.Real;
-                                matrixH[i, n] = res.Imaginary;
-                            }
-                            else
-                            {
-                                // Solve complex equations
-                                x = matrixH[i, i + 1];
-                                y = matrixH[i + 1, i];
-
-                                float vr = ((d[i] - p) * (d[i] - p)) + (e[i] * e[i]) - (q * q);
-                                float vi = (d[i] - p) * 2.0f * q;
-                                if ((vr == 0.0f) && (vi == 0.0f))
-                                {
-                                    vr = eps * norm * (Math.Abs(w) + Math.Abs(q) + Math.Abs(x) + Math.Abs(y) + Math.Abs(z));
-                                }
-
-                                var res = Cdiv((x * r) - (z * ra) + (q * sa), (x * s) - (z * sa) - (q * ra), vr, vi);
-                                matrixH[i, n - 1] = res.Real;
-                                matrixH[i, n] = res.Imaginary;
-                                if (Math.Abs(x) > (Math.Abs(z) + Math.Abs(q)))
-                                {
-                                    matrixH[i + 1, n - 1] = (-ra - (w * matrixH[i, n - 1]) + (q * matrixH[i, n])) / x;
-                                    matrixH[i + 1, n] = (-sa - (w * matrixH[i, n]) - (q * matrixH[i, n - 1])) / x;
-                                }
-                                else
-                                {
-                                    res = Cdiv(-r - (y * matrixH[i, n - 1]), -s - (y * matrixH[i, n]), z, q);
-                                    matrixH[i + 1, n - 1] = res.Real;
-                                    matrixH[i + 1, n] = res.Imaginary;
-                                }
-                            }
-
-                            // Overflow control
-                            t = Math.Max(Math.Abs(matrixH[i, n - 1]), Math.Abs(matrixH[i, n]));
-                            if ((eps * t) * t > 1)
-                            {
-                                for (var j = i; j <= n; j++)
-                                {
-                                    matrixH[j, n - 1] = matrixH[j, n - 1] / t;
-                                    matrixH[j, n] = matrixH[j, n] / t;
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-
-            // Back transformation to get eigenvectors of original matrix
-            for (var j = order - 1; j >= 0; j--)
-            {
-                for (var i = 0; i < order; i++)
-                {
-                    z = 0.0f;
-                    for (var k = 0; k <= j; k++)
-                    {
-                        z = z + (a[(k * order) + i] * matrixH[k, j]);
-                    }
-
-                    a[(j * order) + i] = z;
-                }
-            }
-        }
-
-        /// <summary>
-        /// Complex scalar division X/Y.
-        /// </summary>
-        /// <param name="xreal">Real part of X</param>
-        /// <param name="ximag">Imaginary part of X</param>
-        /// <param name="yreal">Real part of Y</param>
-        /// <param name="yimag">Imaginary part of Y</param>
-        /// <returns>Division result as a <see cref="Complex"/> number.</returns>
-        private static Complex32 Cdiv(float xreal, float ximag, float yreal, float yimag)
-        {
-            if (Math.Abs(yimag) < Math.Abs(yreal))
-            {
-                return new Complex32((xreal + (ximag * (yimag / yreal))) / (yreal + (yimag * (yimag / yreal))), (ximag - (xreal * (yimag / yreal))) / (yreal + (yimag * (yimag / yreal))));
-            }
-
-            return new Complex32((ximag + (xreal * (yreal / yimag))) / (yimag + (yreal * (yreal / yimag))), (-xreal + (ximag * (yreal / yimag))) / (yimag + (yreal * (yreal / yimag))));
-        }
-
         /// <summary>
         /// Solves a system of linear equations, <b>AX = B</b>, with A SVD factorized.
         /// </summary>
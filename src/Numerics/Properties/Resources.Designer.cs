@@ -195,6 +195,15 @@ namespace MathNet.Numerics.Properties {
             }
         }
         
+        /// <summary>
+        ///   Looks up a localized string similar to Matrix {0} of the batch must not be singular..
+        /// </summary>
+        internal static string ArgumentMatrixNotSingularInBatch {
+            get {
+                return ResourceManager.GetString("ArgumentMatrixNotSingularInBatch", resourceCulture);
+            }
+        }
+        
         /// <summary>
         ///   Looks up a localized string similar to Matrix must be positive definite..
         /// </summary>
@@ -537,6 +546,15 @@ namespace MathNet.Numerics.Properties {
             }
         }
         
+        /// <summary>
+        ///   Looks up a localized string similar to Line {0} of the crossover profile is not valid..
+        /// </summary>
+        internal static string InvalidCrossoverProfileLine {
+            get {
+                return ResourceManager.GetString("InvalidCrossoverProfileLine", resourceCulture);
+            }
+        }
+        
         /// <summary>
         ///   Looks up a localized string similar to Invalid parameterization for the distribution..
         /// </summary>
@@ -36,6 +36,7 @@ namespace MathNet.Numerics.Threading
 #if !SILVERLIGHT
     using System.Collections.Concurrent;
     using System.Threading.Tasks;
+    using Algorithms.LinearAlgebra;
 #endif
 
     /// <summary>
@@ -43,6 +44,31 @@ namespace MathNet.Numerics.Threading
     /// </summary>
     public static class CommonParallel
     {
+#if !SILVERLIGHT
+        /// <summary>
+        /// Whether loops started on the calling thread run serially.
+        /// </summary>
+        [ThreadStatic]
+        private static bool _serial;
+
+        /// <summary>
+        /// Gets or sets a value indicating whether loops started on the calling thread run serially. A linear
+        /// algebra provider sets it for calls too small to gain from more threads.
+        /// </summary>
+        internal static bool Serial
+        {
+            get
+            {
+                return _serial;
+            }
+
+            set
+            {
+                _serial = value;
+            }
+        }
+
+#endif
         /// <summary>
         /// Executes a for loop in which iterations may run in parallel. 
         /// </summary>
@@ -56,7 +82,7 @@ namespace MathNet.Numerics.Threading
 #if SILVERLIGHT
             Parallel.For(fromInclusive, toExclusive, body);
 #else
-            if (Control.DisableParallelization || Control.NumberOfParallelWorkerThreads < 2)
+            if (Control.DisableParallelization || Control.NumberOfParallelWorkerThreads < 2 || _serial)
             {
                 for (var index = fromInclusive; index < toExclusive; index++)
                 {
@@ -70,9 +96,12 @@ namespace MathNet.Numerics.Threading
                     new ParallelOptions { MaxDegreeOfParallelism = Control.NumberOfParallelWorkerThreads },
                     (range, loopState) =>
                     {
-                        for (var i = range.Item1; i < range.Item2; i++)
+                        using (ParallelRegion.Enter())
                         {
-                            body(i);
+                            for (var i = range.Item1; i < range.Item2; i++)
+                            {
+                                body(i);
+                            }
                         }
                     });
             }
@@ -121,9 +150,12 @@ namespace MathNet.Numerics.Threading
                     () => 0.0,
                     (range, loopState, localData) =>
                     {
-                        for (var i = range.Item1; i < range.Item2; i++)
+                        using (ParallelRegion.Enter())
                         {
-                            localData += body(i);
+                            for (var i = range.Item1; i < range.Item2; i++)
+                            {
+                                localData += body(i);
+                            }
                         }
 
                         return localData;
@@ -182,9 +214,12 @@ namespace MathNet.Numerics.Threading
                     () => 0.0f,
                     (range, loopState, localData) =>
                     {
-                        for (var i = range.Item1; i < range.Item2; i++)
+                        using (ParallelRegion.Enter())
                         {
-                            localData += body(i);
+                            for (var i = range.Item1; i < range.Item2; i++)
+                            {
+                                localData += body(i);
+                            }
                         }
 
                         return localData;
@@ -243,9 +278,12 @@ namespace MathNet.Numerics.Threading
                     () => Complex.Zero,
                     (range, loopState, localData) =>
                     {
-                        for (var i = range.Item1; i < range.Item2; i++)
+                        using (ParallelRegion.Enter())
                         {
-                            localData += body(i);
+                            for (var i = range.Item1; i < range.Item2; i++)
+                            {
+                                localData += body(i);
+                            }
                         }
 
                         return localData;
@@ -304,9 +342,12 @@ namespace MathNet.Numerics.Threading
                     () => Complex32.Zero,
                     (range, loopState, localData) =>
                     {
-                        for (var i = range.Item1; i < range.Item2; i++)
+                        using (ParallelRegion.Enter())
                         {
-                            localData += body(i);
+                            for (var i = range.Item1; i < range.Item2; i++)
+                            {
+                                localData += body(i);
+                            }
                         }
 
                         return localData;
@@ -335,6 +376,24 @@ namespace MathNet.Numerics.Threading
 #if SILVERLIGHT
             Parallel.Invoke(actions);
 #else
+            if (_serial)
+            {
+                maxThreads = 1;
+            }
+
+            if (maxThreads > 1 && actions != null)
+            {
+                actions = Array.ConvertAll(
+                    actions,
+                    action => action == null ? null : (Action)(() =>
+                    {
+                        using (ParallelRegion.Enter())
+                        {
+                            action();
+                        }
+                    }));
+            }
+
             Parallel.Invoke(
                 new ParallelOptions
                 {
@@ -371,16 +430,19 @@ namespace MathNet.Numerics.Threading
                     }
                 });
 #else
-            var maxThreads = Control.DisableParallelization ? 1 : Control.NumberOfParallelWorkerThreads;
+            var maxThreads = Control.DisableParallelization || _serial ? 1 : Control.NumberOfParallelWorkerThreads;
             Parallel.ForEach(
                 Partitioner.Create(fromInclusive, toExclusive),
                 new ParallelOptions { MaxDegreeOfParallelism = maxThreads },
                 () => 0.0, 
                 (range, loop, localData) =>
                 {
-                    for (var i = range.Item1; i < range.Item2; i++)
+                    using (ParallelRegion.Enter())
                     {
-                        localData = body(i, localData);
+                        for (var i = range.Item1; i < range.Item2; i++)
+                        {
+                            localData = body(i, localData);
+                        }
                     }
 
                     return localData;
@@ -424,16 +486,19 @@ namespace MathNet.Numerics.Threading
                     }
                 });
 #else
-            var maxThreads = Control.DisableParallelization ? 1 : Control.NumberOfParallelWorkerThreads;
+            var maxThreads = Control.DisableParallelization || _serial ? 1 : Control.NumberOfParallelWorkerThreads;
             Parallel.ForEach(
                 Partitioner.Create(fromInclusive, toExclusive),
                 new ParallelOptions { MaxDegreeOfParallelism = maxThreads },
                 () => 0.0f,
                 (range, loop, localData) =>
                 {
-                    for (var i = range.Item1; i < range.Item2; i++)
+                    using (ParallelRegion.Enter())
                     {
-                        localData = body(i, localData);
+                        for (var i = range.Item1; i < range.Item2; i++)
+                        {
+                            localData = body(i, localData);
+                        }
                     }
 
                     return localData;
@@ -449,5 +514,67 @@ namespace MathNet.Numerics.Threading
 
             return ret;
         }
+
+#if !SILVERLIGHT
+        /// <summary>
+        /// Marks the calling thread as running parallel loop bodies while it is open. The linear algebra
+        /// provider is told, so that a native library does not start a full thread team from every worker.
+        /// Nested regions are ignored.
+        /// </summary>
+        private sealed class ParallelRegion : IDisposable
+        {
+            /// <summary>
+            /// Whether the calling thread is inside a region.
+            /// </summary>
+            [ThreadStatic]
+            private static bool _active;
+
+            /// <summary>
+            /// The provider that was told about the region.
+            /// </summary>
+            private readonly ManagedLinearAlgebraProvider _provider;
+
+            /// <summary>
+            /// The state the provider returned on entering the region.
+            /// </summary>
+            private readonly int _state;
+
+            /// <summary>
+            /// Initializes a new instance of the <see cref="ParallelRegion"/> class.
+            /// </summary>
+            /// <param name="provider">The provider to tell about the region, or <c>null</c>.</param>
+            private ParallelRegion(ManagedLinearAlgebraProvider provider)
+            {
+                _provider = provider;
+                if (provider != null)
+                {
+                    _state = provider.EnterParallelRegion();
+                }
+
+                _active = true;
+            }
+
+            /// <summary>
+            /// Opens a region on the calling thread.
+            /// </summary>
+            /// <returns>The region to dispose when the bodies are done, or <c>null</c> if one is open already.</returns>
+            public static IDisposable Enter()
+            {
+                return _active ? null : new ParallelRegion(Control.LinearAlgebraProvider as ManagedLinearAlgebraProvider);
+            }
+
+            /// <summary>
+            /// Closes the region.
+            /// </summary>
+            public void Dispose()
+            {
+                _active = false;
+                if (_provider != null)
+                {
+                    _provider.ExitParallelRegion(_state);
+                }
+            }
+        }
+#endif
     }
 }
\ No newline at end of file
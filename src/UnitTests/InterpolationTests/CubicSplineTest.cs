@@ -183,5 +183,58 @@ namespace MathNet.Numerics.UnitTests.InterpolationTests
                 Assert.AreEqual(ytest[i], interpolation.Interpolate(xtest[i]), 1e-15, "Linear with {0} samples, sample {1}", samples, i);
             }
         }
+
+        /// <summary>
+        /// Verifies that curves sharing their sample points fit the same as when built one at a time.
+        /// </summary>
+        [Test]
+        public void BatchWithSharedPointsMatchesSingleCurves()
+        {
+            var values = new[] { _x, new[] { 0.0, 1.0, 4.0, 1.0, 0.0 }, new[] { -3.0, 2.0, 0.5, 1.0, 7.0 } };
+            IInterpolation[] interpolations = Interpolate.CubicSplines(_t, values);
+
+            Assert.AreEqual(values.Length, interpolations.Length);
+            for (int k = 0; k < values.Length; k++)
+            {
+                IInterpolation expected = new CubicSplineInterpolation(_t, values[k]);
+                foreach (double t in new[] { -2.4, -0.9, -0.5, -0.1, 0.1, 0.4, 1.2 })
+                {
+                    Assert.AreEqual(expected.Interpolate(t), interpolations[k].Interpolate(t), 1e-14, "Curve {0} at {1}", k, t);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Verifies that curves with their own sample points fit the same as when built one at a time.
+        /// </summary>
+        [Test]
+        public void BatchWithSeparatePointsMatchesSingleCurves()
+        {
+            var points = new[] { _t, new[] { 0.0, 0.5, 2.0, 2.5, 4.0 } };
+            var values = new[] { _x, new[] { 1.0, -1.0, 3.0, 2.0, 0.0 } };
+            double[][] derivatives = CubicSplineInterpolation.EvaluateSplineDerivativesBatch(
+                points,
+                values,
+                SplineBoundaryCondition.FirstDerivative,
+                1.0,
+                SplineBoundaryCondition.SecondDerivative,
+                -1.0);
+
+            for (int k = 0; k < points.Length; k++)
+            {
+                double[] expected = CubicSplineInterpolation.EvaluateSplineDerivatives(
+                    points[k],
+                    values[k],
+                    SplineBoundaryCondition.FirstDerivative,
+                    1.0,
+                    SplineBoundaryCondition.SecondDerivative,
+                    -1.0);
+
+                for (int i = 0; i < expected.Length; i++)
+                {
+                    Assert.AreEqual(expected[i], derivatives[k][i], 1e-14, "Curve {0} derivative {1}", k, i);
+                }
+            }
+        }
     }
 }
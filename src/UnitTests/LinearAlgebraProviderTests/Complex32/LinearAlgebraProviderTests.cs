@@ -385,6 +385,387 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Complex32
             }
         }
 
+        /// <summary>
+        /// Can multiply blocks of larger matrices and update a block of another.
+        /// </summary>
+        [Test]
+        public void CanMultiplySubMatricesWithUpdate()
+        {
+            var x = _matrices["Square4x4"];
+            var y = _matrices["Square4x4"];
+            var c = new DenseMatrix(4, 4);
+
+            // a = x[1..2, 0..2], b = y[1..3, 2..3], written to c[2..3, 1..2]
+            Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(Transpose.DontTranspose, Transpose.DontTranspose, 2.2f, 2, 2, 3, x.Data, 1, 4, y.Data, 9, 4, 1.0f, c.Data, 6, 4);
+
+            var expected = x.SubMatrix(1, 2, 0, 3) * y.SubMatrix(1, 3, 2, 2);
+            for (var i = 0; i < c.RowCount; i++)
+            {
+                for (var j = 0; j < c.ColumnCount; j++)
+                {
+                    if (i >= 2 && j >= 1 && j <= 2)
+                    {
+                        AssertHelpers.AlmostEqual(2.2f * expected[i - 2, j - 1], c[i, j], 6);
+                    }
+                    else
+                    {
+                        Assert.AreEqual(Complex32.Zero, c[i, j]);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can multiply a batch of matrices that share their right operand.
+        /// </summary>
+        [Test]
+        public void CanMultiplyMatricesBatch()
+        {
+            var x = _matrices["Tall3x2"];
+            var y = _matrices["Wide2x3"];
+            var a = new Complex32[3 * 6];
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 6; j++)
+                {
+                    a[(i * 6) + j] = x.Data[j] * (i + 1);
+                }
+            }
+
+            // The results are 10 elements apart; the gaps must stay untouched.
+            var c = new Complex32[3 * 10];
+            Control.LinearAlgebraProvider.MatrixMultiplyBatch(Transpose.DontTranspose, Transpose.DontTranspose, 2.2f, 3, 3, 2, a, 6, y.Data, 0, 1.0f, c, 10, 3);
+
+            var expected = x * y;
+            for (var i = 0; i < 3; i++)
+            {
+                for (var col = 0; col < 3; col++)
+                {
+                    for (var row = 0; row < 3; row++)
+                    {
+                        AssertHelpers.AlmostEqual(2.2f * (i + 1) * expected[row, col], c[(i * 10) + (col * 3) + row], 6);
+                    }
+                }
+
+                Assert.AreEqual(Complex32.Zero, c[(i * 10) + 9]);
+            }
+        }
+
+        /// <summary>
+        /// Can multiply a matrix with a vector, transposed or not.
+        /// </summary>
+        [Test]
+        public void CanMultiplyMatrixWithVector()
+        {
+            var a = _matrices["Wide2x3"];
+            var x = new[] { new Complex32(1.1f, 0.5f), new Complex32(-2.2f, 1.0f), new Complex32(3.3f, -0.25f) };
+            var y = new[] { new Complex32(1.0f, -1.0f), new Complex32(2.0f, 0.5f) };
+            var y0 = (Complex32[])y.Clone();
+            var alpha = new Complex32(2.2f, 0.0f);
+            var beta = new Complex32(0.5f, 0.0f);
+
+            Control.LinearAlgebraProvider.MatrixVectorMultiply(Transpose.DontTranspose, alpha, a.Data, 2, 3, x, beta, y);
+            for (var i = 0; i < 2; i++)
+            {
+                var expected = beta * y0[i];
+                for (var j = 0; j < 3; j++)
+                {
+                    expected += alpha * a[i, j] * x[j];
+                }
+
+                AssertHelpers.AlmostEqual(expected, y[i], 5);
+            }
+
+            var z = new Complex32[3];
+            Control.LinearAlgebraProvider.MatrixVectorMultiply(Transpose.ConjugateTranspose, new Complex32(1.0f, 0.0f), a.Data, 2, 3, y, Complex32.Zero, z);
+            for (var j = 0; j < 3; j++)
+            {
+                var expected = Complex32.Zero;
+                for (var i = 0; i < 2; i++)
+                {
+                    expected += a[i, j].Conjugate() * y[i];
+                }
+
+                AssertHelpers.AlmostEqual(expected, z[j], 5);
+            }
+        }
+
+        /// <summary>
+        /// Can add the outer product of two vectors to a matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeRankOneUpdate()
+        {
+            var a = _matrices["Tall3x2"];
+            var x = new[] { new Complex32(1.1f, 0.5f), new Complex32(-2.2f, 1.0f), new Complex32(3.3f, -0.25f) };
+            var y = new[] { new Complex32(1.0f, -1.0f), new Complex32(2.0f, 0.5f) };
+            var result = (Complex32[])a.Data.Clone();
+
+            Control.LinearAlgebraProvider.RankOneUpdate(new Complex32(2.2f, 0.0f), x, y, result);
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 2; j++)
+                {
+                    AssertHelpers.AlmostEqual(a[i, j] + (new Complex32(2.2f, 0.0f) * x[i] * y[j]), result[(j * 3) + i], 5);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the product of a matrix with its own transpose from one triangle.
+        /// </summary>
+        [Test]
+        public void CanComputeSymmetricRankKUpdate()
+        {
+            var a = _matrices["Tall3x2"];
+
+            // Without mirroring, the upper triangle must be left alone.
+            var lower = new Complex32[9];
+            lower[3] = lower[6] = lower[7] = new Complex32(100.0f, 0.0f);
+            Control.LinearAlgebraProvider.SymmetricRankKUpdate(Transpose.DontTranspose, new Complex32(2.2f, 0.0f), a.Data, 3, 2, Complex32.Zero, lower, false);
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 3; j++)
+                {
+                    if (i < j)
+                    {
+                        Assert.AreEqual(new Complex32(100.0f, 0.0f), lower[(j * 3) + i]);
+                        continue;
+                    }
+
+                    var expected = Complex32.Zero;
+                    for (var l = 0; l < 2; l++)
+                    {
+                        expected += a[i, l] * a[j, l];
+                    }
+
+                    AssertHelpers.AlmostEqual(new Complex32(2.2f, 0.0f) * expected, lower[(j * 3) + i], 5);
+                }
+            }
+
+            var full = new Complex32[4];
+            Control.LinearAlgebraProvider.SymmetricRankKUpdate(Transpose.Transpose, new Complex32(2.2f, 0.0f), a.Data, 3, 2, Complex32.Zero, full, true);
+            for (var i = 0; i < 2; i++)
+            {
+                for (var j = 0; j < 2; j++)
+                {
+                    var expected = Complex32.Zero;
+                    for (var l = 0; l < 3; l++)
+                    {
+                        expected += a[l, i] * a[l, j];
+                    }
+
+                    AssertHelpers.AlmostEqual(new Complex32(2.2f, 0.0f) * expected, full[(j * 2) + i], 5);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the product of a matrix with its own conjugate transpose from one triangle.
+        /// </summary>
+        [Test]
+        public void CanComputeHermitianRankKUpdate()
+        {
+            var a = new[] { new Complex32(1.1f, 0.5f), new Complex32(-2.2f, 1.0f), new Complex32(3.3f, -0.25f), new Complex32(1.0f, -1.0f), new Complex32(2.0f, 0.5f), new Complex32(0.0f, 1.5f) };
+
+            var c = new Complex32[9];
+            Control.LinearAlgebraProvider.HermitianRankKUpdate(Transpose.DontTranspose, 2.2f, a, 3, 2, 0.0f, c, true);
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 3; j++)
+                {
+                    var expected = Complex32.Zero;
+                    for (var l = 0; l < 2; l++)
+                    {
+                        expected += a[(l * 3) + i] * a[(l * 3) + j].Conjugate();
+                    }
+
+                    AssertHelpers.AlmostEqual(2.2f * expected, c[(j * 3) + i], 5);
+                }
+            }
+
+            var d = new Complex32[4];
+            Control.LinearAlgebraProvider.HermitianRankKUpdate(Transpose.ConjugateTranspose, 2.2f, a, 3, 2, 0.0f, d, true);
+            for (var i = 0; i < 2; i++)
+            {
+                for (var j = 0; j < 2; j++)
+                {
+                    var expected = Complex32.Zero;
+                    for (var l = 0; l < 3; l++)
+                    {
+                        expected += a[(i * 3) + l].Conjugate() * a[(j * 3) + l];
+                    }
+
+                    AssertHelpers.AlmostEqual(2.2f * expected, d[(j * 2) + i], 5);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can multiply with a triangular matrix and solve with it again.
+        /// </summary>
+        /// <param name="side">The side of the triangular matrix.</param>
+        /// <param name="triangle">The triangle that is read.</param>
+        /// <param name="transpose">How to transpose the triangular matrix.</param>
+        /// <param name="diagonal">Whether the diagonal is implicit.</param>
+        [Test, Sequential]
+        public void CanMultiplyAndSolveTriangular(
+            [Values(Side.Left, Side.Left, Side.Right, Side.Right)] Side side,
+            [Values(Triangle.Lower, Triangle.Upper, Triangle.Lower, Triangle.Upper)] Triangle triangle,
+            [Values(Transpose.DontTranspose, Transpose.Transpose, Transpose.Transpose, Transpose.DontTranspose)] Transpose transpose,
+            [Values(DiagonalType.NonUnit, DiagonalType.Unit, DiagonalType.NonUnit, DiagonalType.Unit)] DiagonalType diagonal)
+        {
+            var a = _matrices["Square3x3"];
+            var b = side == Side.Left ? _matrices["Tall3x2"] : _matrices["Wide2x3"];
+            var rows = b.RowCount;
+            var columns = b.ColumnCount;
+
+            var t = new DenseMatrix(3, 3);
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 3; j++)
+                {
+                    if (i == j && diagonal == DiagonalType.Unit)
+                    {
+                        t[i, j] = Complex32.One;
+                    }
+                    else if (triangle == Triangle.Lower ? i >= j : i <= j)
+                    {
+                        t[i, j] = a[i, j];
+                    }
+                }
+            }
+
+            var op = transpose == Transpose.DontTranspose ? t : t.Transpose();
+            var expected = side == Side.Left ? op * b : b * op;
+
+            var result = (Complex32[])b.Data.Clone();
+            Control.LinearAlgebraProvider.TriangularMultiply(side, triangle, transpose, diagonal, new Complex32(2.0f, 0.0f), a.Data, result, rows, columns);
+            for (var i = 0; i < rows; i++)
+            {
+                for (var j = 0; j < columns; j++)
+                {
+                    AssertHelpers.AlmostEqual(new Complex32(2.0f, 0.0f) * expected[i, j], result[(j * rows) + i], 5);
+                }
+            }
+
+            Control.LinearAlgebraProvider.TriangularSolve(side, triangle, transpose, diagonal, new Complex32(0.5f, 0.0f), a.Data, result, rows, columns);
+            for (var i = 0; i < rows; i++)
+            {
+                for (var j = 0; j < columns; j++)
+                {
+                    AssertHelpers.AlmostEqual(b[i, j], result[(j * rows) + i], 4);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the eigenvalue decomposition of a Hermitian matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeEigenDecomposition()
+        {
+            var matrix = _matrices["Square3x3"];
+            var order = matrix.RowCount;
+
+            // Only the lower triangle is passed in; the upper one is left zero.
+            var hermitian = new DenseMatrix(order, order);
+            var a = new Complex32[order * order];
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = j; i < order; i++)
+                {
+                    hermitian[i, j] = new Complex32(matrix[i, j].Real + matrix[j, i].Real, matrix[i, j].Real - matrix[j, i].Real);
+                    hermitian[j, i] = hermitian[i, j].Conjugate();
+                    a[(j * order) + i] = hermitian[i, j];
+                }
+            }
+
+            var eigenvalues = new Complex32[order];
+            Control.LinearAlgebraProvider.EigenDecomposition(a, order, eigenvalues);
+
+            var vectors = new DenseMatrix(order, order, a);
+            var product = hermitian * vectors;
+            var gram = vectors.ConjugateTranspose() * vectors;
+            for (var j = 0; j < order; j++)
+            {
+                Assert.AreEqual(0.0f, eigenvalues[j].Imaginary);
+                if (j > 0)
+                {
+                    Assert.LessOrEqual(eigenvalues[j - 1].Real, eigenvalues[j].Real);
+                }
+
+                for (var i = 0; i < order; i++)
+                {
+                    Assert.AreEqual(0.0, (product[i, j] - (eigenvalues[j] * vectors[i, j])).Magnitude, 1e-4);
+                    Assert.AreEqual(0.0, (gram[i, j] - (i == j ? Complex32.One : Complex32.Zero)).Magnitude, 1e-4);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the eigenvalue decomposition of a general matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeGeneralEigenDecomposition()
+        {
+            var matrix = _matrices["Square3x3"];
+            var order = matrix.RowCount;
+            var a = matrix.ToColumnWiseArray();
+
+            var eigenvalues = new Complex32[order];
+            var left = new Complex32[order * order];
+            var right = new Complex32[order * order];
+            Control.LinearAlgebraProvider.EigenDecomposition(true, true, a, order, eigenvalues, left, right);
+
+            var vectorsRight = new DenseMatrix(order, order, right);
+            var vectorsLeft = new DenseMatrix(order, order, left);
+            var productRight = matrix * vectorsRight;
+            var productLeft = matrix.ConjugateTranspose() * vectorsLeft;
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = 0; i < order; i++)
+                {
+                    Assert.AreEqual(0.0, (productRight[i, j] - (eigenvalues[j] * vectorsRight[i, j])).Magnitude, 1e-3);
+                    Assert.AreEqual(0.0, (productLeft[i, j] - (eigenvalues[j].Conjugate() * vectorsLeft[i, j])).Magnitude, 1e-3);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the Schur decomposition of a general matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeSchurDecomposition()
+        {
+            var matrix = _matrices["Square3x3"];
+            var order = matrix.RowCount;
+            var a = matrix.ToColumnWiseArray();
+
+            var eigenvalues = new Complex32[order];
+            var schurVectors = new Complex32[order * order];
+            Control.LinearAlgebraProvider.SchurDecomposition(a, order, eigenvalues, schurVectors);
+
+            var t = new DenseMatrix(order, order, a);
+            var z = new DenseMatrix(order, order, schurVectors);
+            var product = z * t * z.ConjugateTranspose();
+            var gram = z.ConjugateTranspose() * z;
+            for (var j = 0; j < order; j++)
+            {
+                Assert.AreEqual(0.0, (t[j, j] - eigenvalues[j]).Magnitude, 1e-3);
+                for (var i = 0; i < order; i++)
+                {
+                    if (i > j)
+                    {
+                        Assert.AreEqual(0.0, t[i, j].Magnitude, 1e-3);
+                    }
+
+                    Assert.AreEqual(0.0, (product[i, j] - matrix[i, j]).Magnitude, 1e-3);
+                    Assert.AreEqual(0.0, (gram[i, j] - (i == j ? Complex32.One : Complex32.Zero)).Magnitude, 1e-3);
+                }
+            }
+        }
+
         /// <summary>
         /// Can compute the LU factor of a matrix.
         /// </summary>
@@ -413,6 +794,47 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Complex32
             Assert.AreEqual(ipiv[2], 2);
         }
 
+        /// <summary>
+        /// Can compute the LU factor of a block of a larger matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeLuFactorOfSubMatrix()
+        {
+            var matrix = _matrices["Square3x3"];
+            var a = new Complex32[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+            var ipiv = new int[matrix.RowCount];
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+
+            var parent = new Complex32[5 * 5];
+            for (var i = 0; i < parent.Length; i++)
+            {
+                parent[i] = 9;
+            }
+
+            for (var j = 0; j < 3; j++)
+            {
+                Array.Copy(matrix.Data, j * 3, parent, 6 + (j * 5), 3);
+            }
+
+            var parentIpiv = new int[3];
+            Control.LinearAlgebraProvider.LUFactor(parent, 6, 5, 3, parentIpiv);
+
+            for (var j = 0; j < 3; j++)
+            {
+                for (var i = 0; i < 3; i++)
+                {
+                    AssertHelpers.AlmostEqual(a[(j * 3) + i], parent[6 + (j * 5) + i], 6);
+                }
+
+                Assert.AreEqual(ipiv[j], parentIpiv[j]);
+            }
+
+            Assert.AreEqual(new Complex32(9.0f, 0.0f), parent[0]);
+            Assert.AreEqual(new Complex32(9.0f, 0.0f), parent[5]);
+            Assert.AreEqual(new Complex32(9.0f, 0.0f), parent[24]);
+        }
+
         /// <summary>
         /// Can compute the inverse of a matrix using LU factorization.
         /// </summary>
@@ -564,6 +986,55 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Complex32
             AssertHelpers.AlmostEqual(b[5], 8.522727272727266f, 6);
         }
 
+        /// <summary>
+        /// Can estimate the reciprocal condition number from an LU factorization.
+        /// </summary>
+        /// <param name="norm">The norm to measure the condition in.</param>
+        [Test]
+        public void CanEstimateConditionUsingLUOnFactoredMatrix([Values(Norm.OneNorm, Norm.InfinityNorm)] Norm norm)
+        {
+            var matrix = _matrices["Square3x3"];
+            var a = new Complex32[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+            var matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(norm, matrix.RowCount, matrix.ColumnCount, matrix.Data);
+
+            var ipiv = new int[matrix.RowCount];
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+            var rcond = Control.LinearAlgebraProvider.LUCondition(norm, a, matrix.RowCount, matrixNorm);
+
+            // The estimate is exact for a matrix this small.
+            var inverse = matrix.Inverse();
+            var inverseNorm = norm == Norm.OneNorm ? inverse.L1Norm() : inverse.InfinityNorm();
+            AssertHelpers.AlmostEqual(1.0f / (matrixNorm.Real * inverseNorm.Real), rcond.Real, 5);
+        }
+
+        /// <summary>
+        /// Can compute the logarithm of the determinant and its sign from an LU factorization.
+        /// </summary>
+        [Test]
+        public void CanComputeDeterminantUsingLUOnFactoredMatrix()
+        {
+            var matrix = _matrices["Square3x3"];
+            var a = new Complex32[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+
+            var ipiv = new int[matrix.RowCount];
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+
+            Complex32 sign;
+            var logAbs = Control.LinearAlgebraProvider.LUDeterminant(a, matrix.RowCount, ipiv, out sign);
+            AssertHelpers.AlmostEqual(matrix.Determinant(), sign * (float)Math.Exp(logAbs.Real), 5);
+
+            matrix = _matrices["Singular3x3"];
+            a = new Complex32[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+
+            logAbs = Control.LinearAlgebraProvider.LUDeterminant(a, matrix.RowCount, ipiv, out sign);
+            Assert.AreEqual(float.NegativeInfinity, logAbs.Real);
+            Assert.AreEqual(Complex32.Zero, sign);
+        }
+
         /// <summary>
         /// Can compute the <c>Cholesky</c> factorization.
         /// </summary>
@@ -633,6 +1104,201 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Complex32
             AssertHelpers.AlmostEqual(b[5], 0, 6);
         }
 
+        /// <summary>
+        /// Can solve Ax=b using Cholesky factorization on blocks of larger matrices.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingCholeskyOnFactoredSubMatrix()
+        {
+            var block = new Complex32[] { 1, 1, 1, 1, 2, 3, 1, 3, 6 };
+            var a = new Complex32[5 * 5];
+            for (var j = 0; j < 3; j++)
+            {
+                Array.Copy(block, j * 3, a, 6 + (j * 5), 3);
+            }
+
+            Control.LinearAlgebraProvider.CholeskyFactor(a, 6, 5, 3);
+
+            var b = new Complex32[] { 0, 1, 2, 3, 0, 4, 5, 6 };
+            Control.LinearAlgebraProvider.CholeskySolveFactored(a, 6, 5, 3, b, 1, 4, 2);
+
+            Assert.AreEqual(Complex32.Zero, b[0]);
+            AssertHelpers.AlmostEqual(b[1], 0, 6);
+            AssertHelpers.AlmostEqual(b[2], 1, 6);
+            AssertHelpers.AlmostEqual(b[3], 0, 6);
+            Assert.AreEqual(Complex32.Zero, b[4]);
+            AssertHelpers.AlmostEqual(b[5], 3, 6);
+            AssertHelpers.AlmostEqual(b[6], 1, 6);
+            AssertHelpers.AlmostEqual(b[7], 0, 6);
+        }
+
+        /// <summary>
+        /// Can estimate the reciprocal condition number from a Cholesky factorization.
+        /// </summary>
+        [Test]
+        public void CanEstimateConditionUsingCholeskyOnFactoredMatrix()
+        {
+            var a = new Complex32[] { 1, 1, 1, 1, 1, 5, 5, 5, 1, 5, 14, 14, 1, 5, 14, 15 };
+            var matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(Norm.OneNorm, 4, 4, a);
+            Control.LinearAlgebraProvider.CholeskyFactor(a, 4);
+            var rcond = Control.LinearAlgebraProvider.CholeskyCondition(a, 4, matrixNorm);
+
+            // The one norms of the matrix and its inverse are 35 and 20/9. The estimate of the latter
+            // is a lower bound, and rarely off by more than a factor of three.
+            var exact = 9.0 / 700.0;
+            Assert.GreaterOrEqual(rcond.Real, exact * (1 - 1e-4));
+            Assert.LessOrEqual(rcond.Real, 3 * exact);
+        }
+
+        /// <summary>
+        /// Can solve a symmetric indefinite system using the LDL' factorization.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingLDLT()
+        {
+            var a = new Complex32[] { 0, 1, 2, 3, 1, 0, 4, 5, 2, 4, 0, 6, 3, 5, 6, 0 };
+            var acopy = (Complex32[])a.Clone();
+            var b = new Complex32[] { 20, 33, 34, 31 };
+            Control.LinearAlgebraProvider.LDLTSolve(a, 4, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+            }
+
+            CollectionAssert.AreEqual(acopy, a);
+        }
+
+        /// <summary>
+        /// Can solve a symmetric indefinite system using a previously computed LDL' factorization. The zero diagonal
+        /// forces a 2 by 2 pivot block.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingLDLTOnFactoredMatrix()
+        {
+            var a = new Complex32[] { 0, 1, 2, 3, 1, 0, 4, 5, 2, 4, 0, 6, 3, 5, 6, 0 };
+            var ipiv = new int[4];
+            Control.LinearAlgebraProvider.LDLTFactor(a, 4, ipiv);
+
+            Assert.Less(ipiv[0], 0);
+            Assert.AreEqual(ipiv[0], ipiv[1]);
+
+            var b = new Complex32[] { 20, 33, 34, 31 };
+            Control.LinearAlgebraProvider.LDLTSolveFactored(a, 4, ipiv, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a tridiagonal system in band storage; the large subdiagonal forces row interchanges.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingBandLU()
+        {
+            // Columns of [A(j-1,j), A(j,j), A(j+1,j)].
+            var ab = new Complex32[] { 0, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 0 };
+            var b = new Complex32[] { 5, 11, 17, 13 };
+            Control.LinearAlgebraProvider.BandLUSolve(ab, 4, 1, 1, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a positive definite tridiagonal system in lower band storage.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingBandCholesky()
+        {
+            // Columns of [A(j,j), A(j+1,j)].
+            var ab = new Complex32[] { 4, 1, 4, 1, 4, 1, 4, 0 };
+            var b = new Complex32[] { 6, 12, 18, 19 };
+            Control.LinearAlgebraProvider.BandCholeskySolve(ab, 4, 1, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a general tridiagonal system; the large subdiagonal forces row interchanges.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingTridiagonal()
+        {
+            var dl = new Complex32[] { 3, 3, 3 };
+            var d = new Complex32[] { 1, 1, 1, 1 };
+            var du = new Complex32[] { 2, 2, 2 };
+            var b = new Complex32[] { 5, 11, 17, 13 };
+            Control.LinearAlgebraProvider.TridiagonalSolve(dl, d, du, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a batch of tridiagonal systems.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingTridiagonalBatch()
+        {
+            var dl = new Complex32[] { 3, 3, 3, 3, 3, 3 };
+            var d = new Complex32[] { 1, 1, 1, 1, 1, 1, 1, 1 };
+            var du = new Complex32[] { 2, 2, 2, 2, 2, 2 };
+            var b = new Complex32[] { 5, 11, 17, 13, 10, 22, 34, 26 };
+            Control.LinearAlgebraProvider.TridiagonalSolveBatch(dl, d, du, b, 4, 1, 2);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+                AssertHelpers.AlmostEqual((Complex32)(2 * (i + 1)), b[i + 4], 5);
+            }
+        }
+
+        /// <summary>
+        /// A singular system in a tridiagonal batch throws, but the other systems are still solved.
+        /// </summary>
+        [Test]
+        public void TridiagonalBatchWithSingularSystemSolvesTheOthers()
+        {
+            var dl = new Complex32[] { 3, 3, 3, 0, 0, 0, 3, 3, 3 };
+            var d = new Complex32[] { 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1 };
+            var du = new Complex32[] { 2, 2, 2, 2, 2, 2, 2, 2, 2 };
+            var b = new Complex32[] { 5, 11, 17, 13, 1, 1, 1, 1, 15, 33, 51, 39 };
+            Assert.Throws<ArgumentException>(() => Control.LinearAlgebraProvider.TridiagonalSolveBatch(dl, d, du, b, 4, 1, 3));
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+                AssertHelpers.AlmostEqual((Complex32)(3 * (i + 1)), b[i + 8], 5);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a positive definite tridiagonal system.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingPositiveDefiniteTridiagonal()
+        {
+            var d = new Complex32[] { 4, 4, 4, 4 };
+            var e = new Complex32[] { 1, 1, 1 };
+            var b = new Complex32[] { 6, 12, 18, 19 };
+            Control.LinearAlgebraProvider.PositiveDefiniteTridiagonalSolve(d, e, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), b[i], 5);
+            }
+        }
+
         /// <summary>
         /// Can compute QR factorization of a square matrix.
         /// </summary>
@@ -798,6 +1464,100 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Complex32
             }
         }
 
+        /// <summary>
+        /// Can compute the QR factorization without forming Q.
+        /// </summary>
+        /// <param name="name">Matrix name.</param>
+        [Test]
+        public void CanComputeQRFactorWithoutFormingQ([Values("Square3x3", "Tall3x2", "Wide2x3")] string name)
+        {
+            var matrix = _matrices[name];
+            var r = new Complex32[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, r, r.Length);
+
+            var tau = new Complex32[Math.Min(matrix.RowCount, matrix.ColumnCount)];
+            Control.LinearAlgebraProvider.QRFactor(r, matrix.RowCount, matrix.ColumnCount, tau);
+
+            var q = DenseMatrix.Identity(matrix.RowCount).Data;
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.DontTranspose, r, matrix.RowCount, matrix.ColumnCount, tau, q, matrix.RowCount);
+
+            var mr = new DenseMatrix(matrix.RowCount, matrix.ColumnCount, r).UpperTriangle();
+            var mq = new DenseMatrix(matrix.RowCount, matrix.RowCount, q);
+            var a = mq * mr;
+
+            for (var row = 0; row < matrix.RowCount; row++)
+            {
+                for (var col = 0; col < matrix.ColumnCount; col++)
+                {
+                    AssertHelpers.AlmostEqual(matrix[row, col], a[row, col], 6);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Applying the adjoint of Q and then Q returns the original right hand side.
+        /// </summary>
+        [Test]
+        public void CanApplyQRFactorQAndItsAdjoint()
+        {
+            var matrix = _matrices["Tall3x2"];
+            var r = new Complex32[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, r, r.Length);
+
+            var tau = new Complex32[matrix.ColumnCount];
+            Control.LinearAlgebraProvider.QRFactor(r, matrix.RowCount, matrix.ColumnCount, tau);
+
+            var expected = new Complex32[] { 1, 2, 3, 4, 5, 6 };
+            var b = new Complex32[expected.Length];
+            Array.Copy(expected, b, b.Length);
+
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.ConjugateTranspose, r, matrix.RowCount, matrix.ColumnCount, tau, b, 2);
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.DontTranspose, r, matrix.RowCount, matrix.ColumnCount, tau, b, 2);
+
+            for (var i = 0; i < expected.Length; i++)
+            {
+                AssertHelpers.AlmostEqual(expected[i], b[i], 6);
+            }
+        }
+
+        /// <summary>
+        /// Can compute the column-pivoted QR factorization of a rank deficient matrix.
+        /// </summary>
+        [Test]
+        public void CanComputePivotedQRFactorOfRankDeficientMatrix()
+        {
+            // The last column is the sum of the first two.
+            var matrix = new DenseMatrix(new[,] { { new Complex32(1.0f, 1.0f), 2.0f, new Complex32(3.0f, 1.0f) }, { 4.0f, new Complex32(5.0f, -2.0f), new Complex32(9.0f, -2.0f) }, { 7.0f, 8.5f, 15.5f }, { -1.0f, new Complex32(0.5f, 3.0f), new Complex32(-0.5f, 3.0f) } });
+            var r = new Complex32[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, r, r.Length);
+
+            var tau = new Complex32[matrix.ColumnCount];
+            var pivots = new int[matrix.ColumnCount];
+            var rank = Control.LinearAlgebraProvider.QRFactorPivoted(r, matrix.RowCount, matrix.ColumnCount, tau, pivots);
+
+            Assert.AreEqual(2, rank);
+
+            var q = DenseMatrix.Identity(matrix.RowCount).Data;
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.DontTranspose, r, matrix.RowCount, matrix.ColumnCount, tau, q, matrix.RowCount);
+
+            var mr = new DenseMatrix(matrix.RowCount, matrix.ColumnCount, r).UpperTriangle();
+            var mq = new DenseMatrix(matrix.RowCount, matrix.RowCount, q);
+            var a = mq * mr;
+
+            for (var col = 0; col < matrix.ColumnCount; col++)
+            {
+                if (col > 0)
+                {
+                    Assert.LessOrEqual(mr[col, col].Magnitude, mr[col - 1, col - 1].Magnitude);
+                }
+
+                for (var row = 0; row < matrix.RowCount; row++)
+                {
+                    AssertHelpers.AlmostEqual(matrix[row, pivots[col]], a[row, col], 4);
+                }
+            }
+        }
+
         /// <summary>
         /// Can solve Ax=b using QR factorization with a square A matrix.
         /// </summary>
@@ -1292,6 +2052,33 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Complex32
             AssertHelpers.AlmostEqual(test[1, 1], x[3], 6);
         }
 
+        /// <summary>
+        /// Can solve Ax=b using SVD factorization with a wide A matrix, giving the minimum norm solution.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingSVDWideMatrix()
+        {
+            var matrix = _matrices["Wide2x3"];
+            var a = new Complex32[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, a, a.Length);
+
+            var b = new[] { new Complex32(1.0f, 0.0f), 2.0f, 3.0f, 4.0f };
+            var x = new Complex32[matrix.ColumnCount * 2];
+            Control.LinearAlgebraProvider.SvdSolve(a, matrix.RowCount, matrix.ColumnCount, b, 2, x);
+
+            NotModified(2, 3, a, matrix);
+
+            var mb = new DenseMatrix(matrix.RowCount, 2, b);
+            var test = matrix.Transpose() * (matrix * matrix.Transpose()).Inverse() * mb;
+
+            AssertHelpers.AlmostEqual(test[0, 0], x[0], 5);
+            AssertHelpers.AlmostEqual(test[1, 0], x[1], 5);
+            AssertHelpers.AlmostEqual(test[2, 0], x[2], 5);
+            AssertHelpers.AlmostEqual(test[0, 1], x[3], 5);
+            AssertHelpers.AlmostEqual(test[1, 1], x[4], 5);
+            AssertHelpers.AlmostEqual(test[2, 1], x[5], 5);
+        }
+
         /// <summary>
         /// Can solve Ax=b using SVD factorization with a square A matrix
         /// using a factored matrix.
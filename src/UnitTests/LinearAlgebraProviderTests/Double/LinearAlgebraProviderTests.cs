@@ -376,6 +376,385 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Double
             }
         }
 
+        /// <summary>
+        /// Can multiply blocks of larger matrices and update a block of another.
+        /// </summary>
+        [Test]
+        public void CanMultiplySubMatricesWithUpdate()
+        {
+            var x = _matrices["Square4x4"];
+            var y = _matrices["Square4x4"];
+            var c = new DenseMatrix(4, 4);
+
+            // a = x[1..2, 0..2], b = y[1..3, 2..3], written to c[2..3, 1..2]
+            Control.LinearAlgebraProvider.MatrixMultiplyWithUpdate(Transpose.DontTranspose, Transpose.DontTranspose, 2.2, 2, 2, 3, x.Data, 1, 4, y.Data, 9, 4, 1.0, c.Data, 6, 4);
+
+            var expected = x.SubMatrix(1, 2, 0, 3) * y.SubMatrix(1, 3, 2, 2);
+            for (var i = 0; i < c.RowCount; i++)
+            {
+                for (var j = 0; j < c.ColumnCount; j++)
+                {
+                    if (i >= 2 && j >= 1 && j <= 2)
+                    {
+                        AssertHelpers.AlmostEqual(2.2 * expected[i - 2, j - 1], c[i, j], 14);
+                    }
+                    else
+                    {
+                        Assert.AreEqual(0.0, c[i, j]);
+                    }
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can multiply a batch of matrices that share their right operand.
+        /// </summary>
+        [Test]
+        public void CanMultiplyMatricesBatch()
+        {
+            var x = _matrices["Tall3x2"];
+            var y = _matrices["Wide2x3"];
+            var a = new double[3 * 6];
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 6; j++)
+                {
+                    a[(i * 6) + j] = x.Data[j] * (i + 1);
+                }
+            }
+
+            // The results are 10 elements apart; the gaps must stay untouched.
+            var c = new double[3 * 10];
+            Control.LinearAlgebraProvider.MatrixMultiplyBatch(Transpose.DontTranspose, Transpose.DontTranspose, 2.2, 3, 3, 2, a, 6, y.Data, 0, 1.0, c, 10, 3);
+
+            var expected = x * y;
+            for (var i = 0; i < 3; i++)
+            {
+                for (var col = 0; col < 3; col++)
+                {
+                    for (var row = 0; row < 3; row++)
+                    {
+                        AssertHelpers.AlmostEqual(2.2 * (i + 1) * expected[row, col], c[(i * 10) + (col * 3) + row], 14);
+                    }
+                }
+
+                Assert.AreEqual(0.0, c[(i * 10) + 9]);
+            }
+        }
+
+        /// <summary>
+        /// Can multiply a matrix with a vector, transposed or not.
+        /// </summary>
+        [Test]
+        public void CanMultiplyMatrixWithVector()
+        {
+            var a = _matrices["Wide2x3"];
+            var x = new[] { 1.1, -2.2, 3.3 };
+            var y = new[] { 1.0, 2.0 };
+            var y0 = (double[])y.Clone();
+            var alpha = 2.2;
+            var beta = 0.5;
+
+            Control.LinearAlgebraProvider.MatrixVectorMultiply(Transpose.DontTranspose, alpha, a.Data, 2, 3, x, beta, y);
+            for (var i = 0; i < 2; i++)
+            {
+                var expected = beta * y0[i];
+                for (var j = 0; j < 3; j++)
+                {
+                    expected += alpha * a[i, j] * x[j];
+                }
+
+                AssertHelpers.AlmostEqual(expected, y[i], 14);
+            }
+
+            var z = new double[3];
+            Control.LinearAlgebraProvider.MatrixVectorMultiply(Transpose.Transpose, 1.0, a.Data, 2, 3, y, 0.0, z);
+            for (var j = 0; j < 3; j++)
+            {
+                var expected = 0.0;
+                for (var i = 0; i < 2; i++)
+                {
+                    expected += a[i, j] * y[i];
+                }
+
+                AssertHelpers.AlmostEqual(expected, z[j], 14);
+            }
+        }
+
+        /// <summary>
+        /// Can add the outer product of two vectors to a matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeRankOneUpdate()
+        {
+            var a = _matrices["Tall3x2"];
+            var x = new[] { 1.1, -2.2, 3.3 };
+            var y = new[] { 1.0, 2.0 };
+            var result = (double[])a.Data.Clone();
+
+            Control.LinearAlgebraProvider.RankOneUpdate(2.2, x, y, result);
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 2; j++)
+                {
+                    AssertHelpers.AlmostEqual(a[i, j] + (2.2 * x[i] * y[j]), result[(j * 3) + i], 14);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can multiply a symmetric matrix with a vector reading only its lower triangle.
+        /// </summary>
+        [Test]
+        public void CanMultiplySymmetricMatrixWithVector()
+        {
+            var a = _matrices["Square3x3"];
+            var symmetric = (DenseMatrix)(a + a.Transpose());
+
+            // Spoil the upper triangle, which must not be read.
+            var data = (double[])symmetric.Data.Clone();
+            data[3] = data[6] = data[7] = double.NaN;
+
+            var x = new[] { 1.1, -2.2, 3.3 };
+            var y = new double[3];
+            Control.LinearAlgebraProvider.SymmetricMatrixVectorMultiply(1.0, data, 3, x, 0.0, y);
+            for (var i = 0; i < 3; i++)
+            {
+                var expected = 0.0;
+                for (var j = 0; j < 3; j++)
+                {
+                    expected += symmetric[i, j] * x[j];
+                }
+
+                AssertHelpers.AlmostEqual(expected, y[i], 14);
+            }
+        }
+
+        /// <summary>
+        /// Can compute the product of a matrix with its own transpose from one triangle.
+        /// </summary>
+        [Test]
+        public void CanComputeSymmetricRankKUpdate()
+        {
+            var a = _matrices["Tall3x2"];
+
+            // Without mirroring, the upper triangle must be left alone.
+            var lower = new double[9];
+            lower[3] = lower[6] = lower[7] = 100.0;
+            Control.LinearAlgebraProvider.SymmetricRankKUpdate(Transpose.DontTranspose, 2.2, a.Data, 3, 2, 0.0, lower, false);
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 3; j++)
+                {
+                    if (i < j)
+                    {
+                        Assert.AreEqual(100.0, lower[(j * 3) + i]);
+                        continue;
+                    }
+
+                    var expected = 0.0;
+                    for (var l = 0; l < 2; l++)
+                    {
+                        expected += a[i, l] * a[j, l];
+                    }
+
+                    AssertHelpers.AlmostEqual(2.2 * expected, lower[(j * 3) + i], 14);
+                }
+            }
+
+            var full = new double[4];
+            Control.LinearAlgebraProvider.SymmetricRankKUpdate(Transpose.Transpose, 2.2, a.Data, 3, 2, 0.0, full, true);
+            for (var i = 0; i < 2; i++)
+            {
+                for (var j = 0; j < 2; j++)
+                {
+                    var expected = 0.0;
+                    for (var l = 0; l < 3; l++)
+                    {
+                        expected += a[l, i] * a[l, j];
+                    }
+
+                    AssertHelpers.AlmostEqual(2.2 * expected, full[(j * 2) + i], 14);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can multiply with a triangular matrix and solve with it again.
+        /// </summary>
+        /// <param name="side">The side of the triangular matrix.</param>
+        /// <param name="triangle">The triangle that is read.</param>
+        /// <param name="transpose">How to transpose the triangular matrix.</param>
+        /// <param name="diagonal">Whether the diagonal is implicit.</param>
+        [Test, Sequential]
+        public void CanMultiplyAndSolveTriangular(
+            [Values(Side.Left, Side.Left, Side.Right, Side.Right)] Side side,
+            [Values(Triangle.Lower, Triangle.Upper, Triangle.Lower, Triangle.Upper)] Triangle triangle,
+            [Values(Transpose.DontTranspose, Transpose.Transpose, Transpose.Transpose, Transpose.DontTranspose)] Transpose transpose,
+            [Values(DiagonalType.NonUnit, DiagonalType.Unit, DiagonalType.NonUnit, DiagonalType.Unit)] DiagonalType diagonal)
+        {
+            var a = _matrices["Square3x3"];
+            var b = side == Side.Left ? _matrices["Tall3x2"] : _matrices["Wide2x3"];
+            var rows = b.RowCount;
+            var columns = b.ColumnCount;
+
+            var t = new DenseMatrix(3, 3);
+            for (var i = 0; i < 3; i++)
+            {
+                for (var j = 0; j < 3; j++)
+                {
+                    if (i == j && diagonal == DiagonalType.Unit)
+                    {
+                        t[i, j] = 1.0;
+                    }
+                    else if (triangle == Triangle.Lower ? i >= j : i <= j)
+                    {
+                        t[i, j] = a[i, j];
+                    }
+                }
+            }
+
+            var op = transpose == Transpose.DontTranspose ? t : t.Transpose();
+            var expected = side == Side.Left ? op * b : b * op;
+
+            var result = (double[])b.Data.Clone();
+            Control.LinearAlgebraProvider.TriangularMultiply(side, triangle, transpose, diagonal, 2.0, a.Data, result, rows, columns);
+            for (var i = 0; i < rows; i++)
+            {
+                for (var j = 0; j < columns; j++)
+                {
+                    AssertHelpers.AlmostEqual(2.0 * expected[i, j], result[(j * rows) + i], 13);
+                }
+            }
+
+            Control.LinearAlgebraProvider.TriangularSolve(side, triangle, transpose, diagonal, 0.5, a.Data, result, rows, columns);
+            for (var i = 0; i < rows; i++)
+            {
+                for (var j = 0; j < columns; j++)
+                {
+                    AssertHelpers.AlmostEqual(b[i, j], result[(j * rows) + i], 12);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the eigenvalue decomposition of a symmetric matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeEigenDecomposition()
+        {
+            var matrix = _matrices["Square3x3"];
+            var order = matrix.RowCount;
+
+            // Only the lower triangle is passed in; the upper one is left zero.
+            var symmetric = new DenseMatrix(order, order);
+            var a = new double[order * order];
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = j; i < order; i++)
+                {
+                    symmetric[i, j] = symmetric[j, i] = matrix[i, j] + matrix[j, i];
+                    a[(j * order) + i] = symmetric[i, j];
+                }
+            }
+
+            var eigenvalues = new double[order];
+            Control.LinearAlgebraProvider.EigenDecomposition(a, order, eigenvalues);
+
+            var vectors = new DenseMatrix(order, order, a);
+            var product = symmetric * vectors;
+            var gram = vectors.Transpose() * vectors;
+            for (var j = 0; j < order; j++)
+            {
+                if (j > 0)
+                {
+                    Assert.LessOrEqual(eigenvalues[j - 1], eigenvalues[j]);
+                }
+
+                for (var i = 0; i < order; i++)
+                {
+                    Assert.AreEqual(eigenvalues[j] * vectors[i, j], product[i, j], 1e-12);
+                    Assert.AreEqual(i == j ? 1.0 : 0.0, gram[i, j], 1e-12);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the eigenvalue decomposition of a general matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeGeneralEigenDecomposition()
+        {
+            var matrix = _matrices["Square3x3"];
+            var order = matrix.RowCount;
+            var a = matrix.ToColumnWiseArray();
+
+            var realEigenvalues = new double[order];
+            var imaginaryEigenvalues = new double[order];
+            var left = new double[order * order];
+            var right = new double[order * order];
+            Control.LinearAlgebraProvider.EigenDecomposition(true, true, a, order, realEigenvalues, imaginaryEigenvalues, left, right);
+
+            // In real form a complex pair j, j+1 becomes the 2 by 2 block [re im; -im re] of D.
+            var d = new DenseMatrix(order, order);
+            for (var j = 0; j < order; j++)
+            {
+                d[j, j] = realEigenvalues[j];
+                if (imaginaryEigenvalues[j] > 0)
+                {
+                    d[j, j + 1] = imaginaryEigenvalues[j];
+                    d[j + 1, j] = imaginaryEigenvalues[j + 1];
+                }
+            }
+
+            var vectorsRight = new DenseMatrix(order, order, right);
+            var vectorsLeft = new DenseMatrix(order, order, left);
+            var productRight = matrix * vectorsRight - vectorsRight * d;
+            var productLeft = matrix.Transpose() * vectorsLeft - vectorsLeft * d.Transpose();
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = 0; i < order; i++)
+                {
+                    Assert.AreEqual(0.0, productRight[i, j], 1e-10);
+                    Assert.AreEqual(0.0, productLeft[i, j], 1e-10);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can compute the Schur decomposition of a general matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeSchurDecomposition()
+        {
+            var matrix = _matrices["Square3x3"];
+            var order = matrix.RowCount;
+            var a = matrix.ToColumnWiseArray();
+
+            var realEigenvalues = new double[order];
+            var imaginaryEigenvalues = new double[order];
+            var schurVectors = new double[order * order];
+            Control.LinearAlgebraProvider.SchurDecomposition(a, order, realEigenvalues, imaginaryEigenvalues, schurVectors);
+
+            var t = new DenseMatrix(order, order, a);
+            var z = new DenseMatrix(order, order, schurVectors);
+            var product = z * t * z.Transpose();
+            var gram = z.Transpose() * z;
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = 0; i < order; i++)
+                {
+                    if (i > j + 1)
+                    {
+                        Assert.AreEqual(0.0, t[i, j]);
+                    }
+
+                    Assert.AreEqual(matrix[i, j], product[i, j], 1e-10);
+                    Assert.AreEqual(i == j ? 1.0 : 0.0, gram[i, j], 1e-10);
+                }
+            }
+        }
+
         /// <summary>
         /// Can compute the LU factor of a matrix.
         /// </summary>
@@ -404,6 +783,47 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Double
             Assert.AreEqual(ipiv[2], 2);
         }
 
+        /// <summary>
+        /// Can compute the LU factor of a block of a larger matrix.
+        /// </summary>
+        [Test]
+        public void CanComputeLuFactorOfSubMatrix()
+        {
+            var matrix = _matrices["Square3x3"];
+            var a = new double[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+            var ipiv = new int[matrix.RowCount];
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+
+            var parent = new double[5 * 5];
+            for (var i = 0; i < parent.Length; i++)
+            {
+                parent[i] = 9;
+            }
+
+            for (var j = 0; j < 3; j++)
+            {
+                Array.Copy(matrix.Data, j * 3, parent, 6 + (j * 5), 3);
+            }
+
+            var parentIpiv = new int[3];
+            Control.LinearAlgebraProvider.LUFactor(parent, 6, 5, 3, parentIpiv);
+
+            for (var j = 0; j < 3; j++)
+            {
+                for (var i = 0; i < 3; i++)
+                {
+                    AssertHelpers.AlmostEqual(a[(j * 3) + i], parent[6 + (j * 5) + i], 14);
+                }
+
+                Assert.AreEqual(ipiv[j], parentIpiv[j]);
+            }
+
+            Assert.AreEqual(9.0, parent[0]);
+            Assert.AreEqual(9.0, parent[5]);
+            Assert.AreEqual(9.0, parent[24]);
+        }
+
         /// <summary>
         /// Can compute the inverse of a matrix using LU factorization.
         /// </summary>
@@ -555,6 +975,55 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Double
             AssertHelpers.AlmostEqual(b[5], 8.522727272727266, 14);
         }
 
+        /// <summary>
+        /// Can estimate the reciprocal condition number from an LU factorization.
+        /// </summary>
+        /// <param name="norm">The norm to measure the condition in.</param>
+        [Test]
+        public void CanEstimateConditionUsingLUOnFactoredMatrix([Values(Norm.OneNorm, Norm.InfinityNorm)] Norm norm)
+        {
+            var matrix = _matrices["Square3x3"];
+            var a = new double[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+            var matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(norm, matrix.RowCount, matrix.ColumnCount, matrix.Data);
+
+            var ipiv = new int[matrix.RowCount];
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+            var rcond = Control.LinearAlgebraProvider.LUCondition(norm, a, matrix.RowCount, matrixNorm);
+
+            // The estimate is exact for a matrix this small.
+            var inverse = matrix.Inverse();
+            var inverseNorm = norm == Norm.OneNorm ? inverse.L1Norm() : inverse.InfinityNorm();
+            AssertHelpers.AlmostEqual(1.0 / (matrixNorm * inverseNorm), rcond, 13);
+        }
+
+        /// <summary>
+        /// Can compute the logarithm of the determinant and its sign from an LU factorization.
+        /// </summary>
+        [Test]
+        public void CanComputeDeterminantUsingLUOnFactoredMatrix()
+        {
+            var matrix = _matrices["Square3x3"];
+            var a = new double[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+
+            var ipiv = new int[matrix.RowCount];
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+
+            double sign;
+            var logAbs = Control.LinearAlgebraProvider.LUDeterminant(a, matrix.RowCount, ipiv, out sign);
+            AssertHelpers.AlmostEqual(matrix.Determinant(), sign * Math.Exp(logAbs), 13);
+
+            matrix = _matrices["Singular3x3"];
+            a = new double[matrix.RowCount * matrix.RowCount];
+            Array.Copy(matrix.Data, a, a.Length);
+            Control.LinearAlgebraProvider.LUFactor(a, matrix.RowCount, ipiv);
+
+            logAbs = Control.LinearAlgebraProvider.LUDeterminant(a, matrix.RowCount, ipiv, out sign);
+            Assert.AreEqual(double.NegativeInfinity, logAbs);
+            Assert.AreEqual(0.0, sign);
+        }
+
         /// <summary>
         /// Can compute the <c>Cholesky</c> factorization.
         /// </summary>
@@ -624,6 +1093,201 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Double
             AssertHelpers.AlmostEqual(b[5], 0, 14);
         }
 
+        /// <summary>
+        /// Can solve Ax=b using Cholesky factorization on blocks of larger matrices.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingCholeskyOnFactoredSubMatrix()
+        {
+            var block = new double[] { 1, 1, 1, 1, 2, 3, 1, 3, 6 };
+            var a = new double[5 * 5];
+            for (var j = 0; j < 3; j++)
+            {
+                Array.Copy(block, j * 3, a, 6 + (j * 5), 3);
+            }
+
+            Control.LinearAlgebraProvider.CholeskyFactor(a, 6, 5, 3);
+
+            var b = new double[] { 0, 1, 2, 3, 0, 4, 5, 6 };
+            Control.LinearAlgebraProvider.CholeskySolveFactored(a, 6, 5, 3, b, 1, 4, 2);
+
+            Assert.AreEqual(0.0, b[0]);
+            AssertHelpers.AlmostEqual(b[1], 0, 14);
+            AssertHelpers.AlmostEqual(b[2], 1, 14);
+            AssertHelpers.AlmostEqual(b[3], 0, 14);
+            Assert.AreEqual(0.0, b[4]);
+            AssertHelpers.AlmostEqual(b[5], 3, 14);
+            AssertHelpers.AlmostEqual(b[6], 1, 14);
+            AssertHelpers.AlmostEqual(b[7], 0, 14);
+        }
+
+        /// <summary>
+        /// Can estimate the reciprocal condition number from a Cholesky factorization.
+        /// </summary>
+        [Test]
+        public void CanEstimateConditionUsingCholeskyOnFactoredMatrix()
+        {
+            var a = new double[] { 1, 1, 1, 1, 1, 5, 5, 5, 1, 5, 14, 14, 1, 5, 14, 15 };
+            var matrixNorm = Control.LinearAlgebraProvider.MatrixNorm(Norm.OneNorm, 4, 4, a);
+            Control.LinearAlgebraProvider.CholeskyFactor(a, 4);
+            var rcond = Control.LinearAlgebraProvider.CholeskyCondition(a, 4, matrixNorm);
+
+            // The one norms of the matrix and its inverse are 35 and 20/9. The estimate of the latter
+            // is a lower bound, and rarely off by more than a factor of three.
+            var exact = 9.0 / 700.0;
+            Assert.GreaterOrEqual(rcond, exact * (1 - 1e-10));
+            Assert.LessOrEqual(rcond, 3 * exact);
+        }
+
+        /// <summary>
+        /// Can solve a symmetric indefinite system using the LDL' factorization.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingLDLT()
+        {
+            var a = new double[] { 0, 1, 2, 3, 1, 0, 4, 5, 2, 4, 0, 6, 3, 5, 6, 0 };
+            var acopy = (double[])a.Clone();
+            var b = new double[] { 20, 33, 34, 31 };
+            Control.LinearAlgebraProvider.LDLTSolve(a, 4, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+            }
+
+            CollectionAssert.AreEqual(acopy, a);
+        }
+
+        /// <summary>
+        /// Can solve a symmetric indefinite system using a previously computed LDL' factorization. The zero diagonal
+        /// forces a 2 by 2 pivot block.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingLDLTOnFactoredMatrix()
+        {
+            var a = new double[] { 0, 1, 2, 3, 1, 0, 4, 5, 2, 4, 0, 6, 3, 5, 6, 0 };
+            var ipiv = new int[4];
+            Control.LinearAlgebraProvider.LDLTFactor(a, 4, ipiv);
+
+            Assert.Less(ipiv[0], 0);
+            Assert.AreEqual(ipiv[0], ipiv[1]);
+
+            var b = new double[] { 20, 33, 34, 31 };
+            Control.LinearAlgebraProvider.LDLTSolveFactored(a, 4, ipiv, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a tridiagonal system in band storage; the large subdiagonal forces row interchanges.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingBandLU()
+        {
+            // Columns of [A(j-1,j), A(j,j), A(j+1,j)].
+            var ab = new double[] { 0, 1, 3, 2, 1, 3, 2, 1, 3, 2, 1, 0 };
+            var b = new double[] { 5, 11, 17, 13 };
+            Control.LinearAlgebraProvider.BandLUSolve(ab, 4, 1, 1, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a positive definite tridiagonal system in lower band storage.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingBandCholesky()
+        {
+            // Columns of [A(j,j), A(j+1,j)].
+            var ab = new double[] { 4, 1, 4, 1, 4, 1, 4, 0 };
+            var b = new double[] { 6, 12, 18, 19 };
+            Control.LinearAlgebraProvider.BandCholeskySolve(ab, 4, 1, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a general tridiagonal system; the large subdiagonal forces row interchanges.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingTridiagonal()
+        {
+            var dl = new double[] { 3, 3, 3 };
+            var d = new double[] { 1, 1, 1, 1 };
+            var du = new double[] { 2, 2, 2 };
+            var b = new double[] { 5, 11, 17, 13 };
+            Control.LinearAlgebraProvider.TridiagonalSolve(dl, d, du, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a batch of tridiagonal systems.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingTridiagonalBatch()
+        {
+            var dl = new double[] { 3, 3, 3, 3, 3, 3 };
+            var d = new double[] { 1, 1, 1, 1, 1, 1, 1, 1 };
+            var du = new double[] { 2, 2, 2, 2, 2, 2 };
+            var b = new double[] { 5, 11, 17, 13, 10, 22, 34, 26 };
+            Control.LinearAlgebraProvider.TridiagonalSolveBatch(dl, d, du, b, 4, 1, 2);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+                AssertHelpers.AlmostEqual((double)(2 * (i + 1)), b[i + 4], 12);
+            }
+        }
+
+        /// <summary>
+        /// A singular system in a tridiagonal batch throws, but the other systems are still solved.
+        /// </summary>
+        [Test]
+        public void TridiagonalBatchWithSingularSystemSolvesTheOthers()
+        {
+            var dl = new double[] { 3, 3, 3, 0, 0, 0, 3, 3, 3 };
+            var d = new double[] { 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1 };
+            var du = new double[] { 2, 2, 2, 2, 2, 2, 2, 2, 2 };
+            var b = new double[] { 5, 11, 17, 13, 1, 1, 1, 1, 15, 33, 51, 39 };
+            Assert.Throws<ArgumentException>(() => Control.LinearAlgebraProvider.TridiagonalSolveBatch(dl, d, du, b, 4, 1, 3));
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+                AssertHelpers.AlmostEqual((double)(3 * (i + 1)), b[i + 8], 12);
+            }
+        }
+
+        /// <summary>
+        /// Can solve a positive definite tridiagonal system.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingPositiveDefiniteTridiagonal()
+        {
+            var d = new double[] { 4, 4, 4, 4 };
+            var e = new double[] { 1, 1, 1 };
+            var b = new double[] { 6, 12, 18, 19 };
+            Control.LinearAlgebraProvider.PositiveDefiniteTridiagonalSolve(d, e, b, 1);
+
+            for (var i = 0; i < 4; i++)
+            {
+                AssertHelpers.AlmostEqual((double)(i + 1), b[i], 12);
+            }
+        }
+
         /// <summary>
         /// Can compute QR factorization of a square matrix.
         /// </summary>
@@ -789,6 +1453,100 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Double
             }
         }
 
+        /// <summary>
+        /// Can compute the QR factorization without forming Q.
+        /// </summary>
+        /// <param name="name">Matrix name.</param>
+        [Test]
+        public void CanComputeQRFactorWithoutFormingQ([Values("Square3x3", "Tall3x2", "Wide2x3")] string name)
+        {
+            var matrix = _matrices[name];
+            var r = new double[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, r, r.Length);
+
+            var tau = new double[Math.Min(matrix.RowCount, matrix.ColumnCount)];
+            Control.LinearAlgebraProvider.QRFactor(r, matrix.RowCount, matrix.ColumnCount, tau);
+
+            var q = DenseMatrix.Identity(matrix.RowCount).Data;
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.DontTranspose, r, matrix.RowCount, matrix.ColumnCount, tau, q, matrix.RowCount);
+
+            var mr = new DenseMatrix(matrix.RowCount, matrix.ColumnCount, r).UpperTriangle();
+            var mq = new DenseMatrix(matrix.RowCount, matrix.RowCount, q);
+            var a = mq * mr;
+
+            for (var row = 0; row < matrix.RowCount; row++)
+            {
+                for (var col = 0; col < matrix.ColumnCount; col++)
+                {
+                    AssertHelpers.AlmostEqual(matrix[row, col], a[row, col], 14);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Applying the adjoint of Q and then Q returns the original right hand side.
+        /// </summary>
+        [Test]
+        public void CanApplyQRFactorQAndItsAdjoint()
+        {
+            var matrix = _matrices["Tall3x2"];
+            var r = new double[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, r, r.Length);
+
+            var tau = new double[matrix.ColumnCount];
+            Control.LinearAlgebraProvider.QRFactor(r, matrix.RowCount, matrix.ColumnCount, tau);
+
+            var expected = new double[] { 1, 2, 3, 4, 5, 6 };
+            var b = new double[expected.Length];
+            Array.Copy(expected, b, b.Length);
+
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.Transpose, r, matrix.RowCount, matrix.ColumnCount, tau, b, 2);
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.DontTranspose, r, matrix.RowCount, matrix.ColumnCount, tau, b, 2);
+
+            for (var i = 0; i < expected.Length; i++)
+            {
+                AssertHelpers.AlmostEqual(expected[i], b[i], 14);
+            }
+        }
+
+        /// <summary>
+        /// Can compute the column-pivoted QR factorization of a rank deficient matrix.
+        /// </summary>
+        [Test]
+        public void CanComputePivotedQRFactorOfRankDeficientMatrix()
+        {
+            // The last column is the sum of the first two.
+            var matrix = new DenseMatrix(new[,] { { 1.0, 2.0, 3.0 }, { 4.0, 5.0, 9.0 }, { 7.0, 8.5, 15.5 }, { -1.0, 0.5, -0.5 } });
+            var r = new double[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, r, r.Length);
+
+            var tau = new double[matrix.ColumnCount];
+            var pivots = new int[matrix.ColumnCount];
+            var rank = Control.LinearAlgebraProvider.QRFactorPivoted(r, matrix.RowCount, matrix.ColumnCount, tau, pivots);
+
+            Assert.AreEqual(2, rank);
+
+            var q = DenseMatrix.Identity(matrix.RowCount).Data;
+            Control.LinearAlgebraProvider.QRApplyQ(Transpose.DontTranspose, r, matrix.RowCount, matrix.ColumnCount, tau, q, matrix.RowCount);
+
+            var mr = new DenseMatrix(matrix.RowCount, matrix.ColumnCount, r).UpperTriangle();
+            var mq = new DenseMatrix(matrix.RowCount, matrix.RowCount, q);
+            var a = mq * mr;
+
+            for (var col = 0; col < matrix.ColumnCount; col++)
+            {
+                if (col > 0)
+                {
+                    Assert.LessOrEqual(Math.Abs(mr[col, col]), Math.Abs(mr[col - 1, col - 1]));
+                }
+
+                for (var row = 0; row < matrix.RowCount; row++)
+                {
+                    AssertHelpers.AlmostEqual(matrix[row, pivots[col]], a[row, col], 13);
+                }
+            }
+        }
+
         /// <summary>
         /// Can solve Ax=b using QR factorization with a square A matrix.
         /// </summary>
@@ -1283,6 +2041,33 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraProviderTests.Double
             AssertHelpers.AlmostEqual(test[1, 1], x[3], 14);
         }
 
+        /// <summary>
+        /// Can solve Ax=b using SVD factorization with a wide A matrix, giving the minimum norm solution.
+        /// </summary>
+        [Test]
+        public void CanSolveUsingSVDWideMatrix()
+        {
+            var matrix = _matrices["Wide2x3"];
+            var a = new double[matrix.RowCount * matrix.ColumnCount];
+            Array.Copy(matrix.Data, a, a.Length);
+
+            var b = new[] { 1.0, 2.0, 3.0, 4.0 };
+            var x = new double[matrix.ColumnCount * 2];
+            Control.LinearAlgebraProvider.SvdSolve(a, matrix.RowCount, matrix.ColumnCount, b, 2, x);
+
+            NotModified(2, 3, a, matrix);
+
+            var mb = new DenseMatrix(matrix.RowCount, 2, b);
+            var test = matrix.Transpose() * (matrix * matrix.Transpose()).Inverse() * mb;
+
+            AssertHelpers.AlmostEqual(test[0, 0], x[0], 12);
+            AssertHelpers.AlmostEqual(test[1, 0], x[1], 12);
+            AssertHelpers.AlmostEqual(test[2, 0], x[2], 12);
+            AssertHelpers.AlmostEqual(test[0, 1], x[3], 12);
+            AssertHelpers.AlmostEqual(test[1, 1], x[4], 12);
+            AssertHelpers.AlmostEqual(test[2, 1], x[5], 12);
+        }
+
         /// <summary>
         /// Can solve Ax=b using SVD factorization with a square A matrix
         /// using a factored matrix.
@@ -29,6 +29,7 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
     using System;
     using System.Numerics;
     using LinearAlgebra.Complex;
+    using LinearAlgebra.Complex.Factorization;
     using LinearAlgebra.Generic.Factorization;
     using NUnit.Framework;
 
@@ -70,6 +71,17 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
             Assert.Throws<ArgumentException>(() => matrixI.Cholesky());
         }
 
+        /// <summary>
+        /// Batch Cholesky factorization fails if one of the matrices is not positive definite.
+        /// </summary>
+        [Test]
+        public void CholeskyBatchFailsWithNonPositiveDefiniteMatrix()
+        {
+            var matrices = new[] { DenseMatrix.Identity(4), DenseMatrix.Identity(4), DenseMatrix.Identity(4) };
+            matrices[1][2, 2] = -4.0;
+            Assert.Throws<ArgumentException>(() => DenseCholesky.FactorBatch(matrices));
+        }
+
         /// <summary>
         /// Cholesky factorization fails with a non-square matrix.
         /// </summary>
@@ -93,6 +105,22 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
             Assert.AreEqual(Complex.Zero, factorC.DeterminantLn);
         }
 
+        /// <summary>
+        /// Can estimate the condition number of a random positive definite matrix from its factor.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanEstimateConditionNumber([Values(1, 2, 5, 10, 50, 100)] int order)
+        {
+            var matrixA = (DenseMatrix)MatrixLoader.GenerateRandomPositiveDefiniteHermitianDenseMatrix(order);
+            var factorC = new DenseCholesky(matrixA);
+
+            // The estimate of the norm of the inverse is a lower bound, and rarely off by more than a factor of three.
+            var exact = (matrixA.L1Norm() * matrixA.Inverse().L1Norm()).Real;
+            Assert.LessOrEqual(factorC.ConditionNumber, exact * (1 + 1.0e-10));
+            Assert.GreaterOrEqual(factorC.ConditionNumber, exact / 3);
+        }
+
         /// <summary>
         /// Can factorize a random square matrix.
         /// </summary>
@@ -161,6 +189,38 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
             }
         }
 
+        /// <summary>
+        /// Can solve a batch of systems and get the same answers as solving them one at a time.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanSolveBatchOfRandomVectors([Values(1, 6, 12)] int order)
+        {
+            var matrices = new DenseMatrix[5];
+            var inputs = new DenseVector[5];
+            for (var i = 0; i < matrices.Length; i++)
+            {
+                matrices[i] = (DenseMatrix)MatrixLoader.GenerateRandomPositiveDefiniteHermitianDenseMatrix(order);
+                inputs[i] = (DenseVector)MatrixLoader.GenerateRandomDenseVector(order);
+            }
+
+            var results = DenseCholesky.SolveBatch(matrices, inputs);
+            var factorizations = DenseCholesky.FactorBatch(matrices);
+
+            Assert.AreEqual(matrices.Length, results.Length);
+            Assert.AreEqual(matrices.Length, factorizations.Length);
+            for (var i = 0; i < matrices.Length; i++)
+            {
+                var expected = matrices[i].Cholesky().Solve(inputs[i]);
+                var factored = factorizations[i].Solve(inputs[i]);
+                for (var j = 0; j < order; j++)
+                {
+                    AssertHelpers.AlmostEqual(expected[j], results[i][j], 12);
+                    AssertHelpers.AlmostEqual(expected[j], factored[j], 12);
+                }
+            }
+        }
+
         /// <summary>
         /// Can solve a system of linear equations for a random matrix (AX=B).
         /// </summary>
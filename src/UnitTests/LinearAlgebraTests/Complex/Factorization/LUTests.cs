@@ -29,6 +29,7 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
     using System;
     using System.Numerics;
     using LinearAlgebra.Complex;
+    using LinearAlgebra.Complex.Factorization;
     using LinearAlgebra.Generic.Factorization;
     using NUnit.Framework;
 
@@ -94,6 +95,43 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
             Assert.AreEqual(Complex.One, lu.Determinant);
         }
 
+        /// <summary>
+        /// Can estimate the condition number of a random matrix from its factors.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanEstimateConditionNumber([Values(1, 2, 5, 10, 50, 100)] int order)
+        {
+            var matrixA = (DenseMatrix)MatrixLoader.GenerateRandomDenseMatrix(order, order);
+            var factorLU = new DenseLU(matrixA);
+
+            // The estimate of the norm of the inverse is a lower bound, and rarely off by more than a factor of three.
+            var exact = (matrixA.L1Norm() * factorLU.Inverse().L1Norm()).Real;
+            Assert.LessOrEqual(factorLU.ConditionNumber, exact * (1 + 1.0e-10));
+            Assert.GreaterOrEqual(factorLU.ConditionNumber, exact / 3);
+        }
+
+        /// <summary>
+        /// The logarithm of the determinant does not overflow where the determinant itself does.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void DeterminantLnDoesNotOverflow([Values(1, 10, 100)] int order)
+        {
+            var matrixA = DenseMatrix.Identity(order);
+            for (var i = 0; i < order; i++)
+            {
+                matrixA[i, i] = 1.0e10;
+            }
+
+            matrixA[0, 0] = -1.0e10;
+
+            Complex sign;
+            var logAbs = new DenseLU(matrixA).DeterminantLn(out sign);
+            Assert.AreEqual(-Complex.One, sign);
+            Assert.AreEqual(order * Math.Log(1.0e10), logAbs, 1.0e-9 * order);
+        }
+
         /// <summary>
         /// Can factorize a random square matrix.
         /// </summary>
@@ -178,6 +216,38 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
             }
         }
 
+        /// <summary>
+        /// Can solve a batch of systems and get the same answers as solving them one at a time.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanSolveBatchOfRandomVectors([Values(1, 6, 12)] int order)
+        {
+            var matrices = new DenseMatrix[5];
+            var inputs = new DenseVector[5];
+            for (var i = 0; i < matrices.Length; i++)
+            {
+                matrices[i] = (DenseMatrix)MatrixLoader.GenerateRandomDenseMatrix(order, order);
+                inputs[i] = (DenseVector)MatrixLoader.GenerateRandomDenseVector(order);
+            }
+
+            var results = DenseLU.SolveBatch(matrices, inputs);
+            var factorizations = DenseLU.FactorBatch(matrices);
+
+            Assert.AreEqual(matrices.Length, results.Length);
+            Assert.AreEqual(matrices.Length, factorizations.Length);
+            for (var i = 0; i < matrices.Length; i++)
+            {
+                var expected = matrices[i].LU().Solve(inputs[i]);
+                var factored = factorizations[i].Solve(inputs[i]);
+                for (var j = 0; j < order; j++)
+                {
+                    AssertHelpers.AlmostEqual(expected[j], results[i][j], 12);
+                    AssertHelpers.AlmostEqual(expected[j], factored[j], 12);
+                }
+            }
+        }
+
         /// <summary>
         /// Can solve a system of linear equations for a random matrix (AX=B).
         /// </summary>
@@ -28,6 +28,7 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
 {
     using System;
     using System.Numerics;
+    using Algorithms.LinearAlgebra;
     using LinearAlgebra.Complex;
     using LinearAlgebra.Complex.Factorization;
     using LinearAlgebra.Generic.Factorization;
@@ -109,6 +110,76 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex.Factorization
             }
         }
 
+        /// <summary>
+        /// Can factorize a random matrix into the economy factors.
+        /// </summary>
+        /// <param name="mode">How to compute the factors.</param>
+        /// <param name="row">Matrix row number.</param>
+        /// <param name="column">Matrix column number.</param>
+        [Test, Sequential]
+        public void CanFactorizeRandomMatrixEconomy([Values(SvdMode.Economy, SvdMode.DivideAndConquer, SvdMode.Economy, SvdMode.DivideAndConquer)] SvdMode mode, [Values(1, 50, 10, 100)] int row, [Values(5, 10, 48, 98)] int column)
+        {
+            var matrixA = MatrixLoader.GenerateRandomDenseMatrix(row, column);
+            var factorSvd = new DenseSvd((DenseMatrix)matrixA, mode);
+            var mn = Math.Min(row, column);
+
+            // U and VT keep only the leading Min(M, N) singular vectors, and W fits between them.
+            Assert.AreEqual(row, factorSvd.U().RowCount);
+            Assert.AreEqual(mn, factorSvd.U().ColumnCount);
+            Assert.AreEqual(mn, factorSvd.VT().RowCount);
+            Assert.AreEqual(column, factorSvd.VT().ColumnCount);
+            Assert.AreEqual(mn, factorSvd.W().RowCount);
+            Assert.AreEqual(mn, factorSvd.W().ColumnCount);
+
+            // Make sure the U*W*VT is the original matrix.
+            var matrix = factorSvd.U() * factorSvd.W() * factorSvd.VT();
+            for (var i = 0; i < matrix.RowCount; i++)
+            {
+                for (var j = 0; j < matrix.ColumnCount; j++)
+                {
+                    AssertHelpers.AlmostEqual(matrixA[i, j], matrix[i, j], 9);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can solve a least squares problem with the economy factors.
+        /// </summary>
+        /// <param name="mode">How to compute the factors.</param>
+        [Test]
+        public void CanSolveWithEconomyFactors([Values(SvdMode.Economy, SvdMode.DivideAndConquer)] SvdMode mode)
+        {
+            var matrixA = MatrixLoader.GenerateRandomDenseMatrix(20, 8);
+            var vectorb = MatrixLoader.GenerateRandomDenseVector(20);
+
+            var expected = matrixA.Svd(true).Solve(vectorb);
+            var actual = new DenseSvd((DenseMatrix)matrixA, mode).Solve(vectorb);
+            for (var i = 0; i < expected.Count; i++)
+            {
+                AssertHelpers.AlmostEqual(expected[i], actual[i], 9);
+            }
+        }
+
+        /// <summary>
+        /// Computing only the singular values gives the values of the full decomposition.
+        /// </summary>
+        [Test]
+        public void CanComputeValuesOnly()
+        {
+            var matrixA = MatrixLoader.GenerateRandomDenseMatrix(30, 12);
+            var factorSvd = new DenseSvd((DenseMatrix)matrixA, SvdMode.ValuesOnly);
+            var expected = matrixA.Svd(true).S();
+
+            Assert.IsNull(factorSvd.U());
+            Assert.IsNull(factorSvd.VT());
+            Assert.AreEqual(30, factorSvd.W().RowCount);
+            Assert.AreEqual(12, factorSvd.W().ColumnCount);
+            for (var i = 0; i < expected.Count; i++)
+            {
+                AssertHelpers.AlmostEqual(expected[i], factorSvd.S()[i], 9);
+            }
+        }
+
         /// <summary>
         /// Can check rank of a non-square matrix.
         /// </summary>
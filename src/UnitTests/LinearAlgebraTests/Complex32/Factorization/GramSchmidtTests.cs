@@ -251,6 +251,33 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex32.Factorization
             }
         }
 
+        /// <summary>
+        /// Can solve a least squares problem for a tall random matrix (AX=B).
+        /// </summary>
+        /// <param name="columns">Number of columns of A.</param>
+        [Test]
+        public void CanSolveLeastSquaresForTallRandomMatrix([Values(1, 2, 5, 10, 50)] int columns)
+        {
+            var matrixA = MatrixLoader.GenerateRandomDenseMatrix(2 * columns, columns);
+            var factorGramSchmidt = matrixA.GramSchmidt();
+
+            var matrixB = MatrixLoader.GenerateRandomDenseMatrix(2 * columns, 3);
+            var matrixX = factorGramSchmidt.Solve(matrixB);
+
+            Assert.AreEqual(columns, matrixX.RowCount);
+            Assert.AreEqual(3, matrixX.ColumnCount);
+
+            // The residual of a least squares solution is orthogonal to the columns of A.
+            var normal = matrixA.ConjugateTranspose() * ((matrixA * matrixX) - matrixB);
+            for (var i = 0; i < normal.RowCount; i++)
+            {
+                for (var j = 0; j < normal.ColumnCount; j++)
+                {
+                    Assert.AreEqual(0.0f, normal[i, j].Magnitude, 1.0e-3f);
+                }
+            }
+        }
+
         /// <summary>
         /// Can solve for a random vector into a result vector.
         /// </summary>
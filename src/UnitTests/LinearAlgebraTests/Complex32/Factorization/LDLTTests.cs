@@ -0,0 +1,158 @@
+﻿// <copyright file="LDLTTests.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+// Copyright (c) 2009-2010 Math.NET
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex32.Factorization
+{
+    using System;
+    using LinearAlgebra.Complex32;
+    using LinearAlgebra.Complex32.Factorization;
+    using NUnit.Framework;
+    using Complex32 = Numerics.Complex32;
+
+    /// <summary>
+    /// LDL' factorization tests for a dense matrix.
+    /// </summary>
+    public class LDLTTests
+    {
+        /// <summary>
+        /// Can solve a saddle point (KKT) system, which is Hermitian but indefinite.
+        /// </summary>
+        [Test]
+        public void CanSolveSaddlePointSystem()
+        {
+            // [H A'; A 0] with H = diag(2, 3, 4) and two equality constraints.
+            var matrixK = new DenseMatrix(new Complex32[,] { { 2, 0, 0, 1, 1 }, { 0, 3, 0, 1, -1 }, { 0, 0, 4, 1, 0 }, { 1, 1, 1, 0, 0 }, { 1, -1, 0, 0, 0 } });
+            var vectorB = new DenseVector(new Complex32[] { 11, 5, 16, 6, -1 });
+            var x = new DenseLDLT(matrixK).Solve(vectorB);
+
+            for (var i = 0; i < x.Count; i++)
+            {
+                AssertHelpers.AlmostEqual((Complex32)(i + 1), x[i], 5);
+            }
+        }
+
+        /// <summary>
+        /// LDL' factorization fails with a singular matrix.
+        /// </summary>
+        [Test]
+        public void LDLTFailsWithSingularMatrix()
+        {
+            var matrix = new DenseMatrix(4);
+            Assert.Throws<ArgumentException>(() => new DenseLDLT(matrix));
+        }
+
+        /// <summary>
+        /// LDL' factorization fails with a non-square matrix.
+        /// </summary>
+        [Test]
+        public void LDLTFailsWithNonSquareMatrix()
+        {
+            var matrix = new DenseMatrix(3, 2);
+            Assert.Throws<ArgumentException>(() => new DenseLDLT(matrix));
+        }
+
+        /// <summary>
+        /// Can solve a system of linear equations for a random vector (Ax=b).
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanSolveForRandomVector([Values(1, 2, 5, 10, 50, 100)] int order)
+        {
+            var matrixA = GenerateIndefiniteMatrix(order);
+            var matrixACopy = matrixA.Clone();
+            var ldlt = new DenseLDLT(matrixA);
+            var matrixB = MatrixLoader.GenerateRandomDenseVector(order);
+            var x = ldlt.Solve(matrixB);
+
+            Assert.AreEqual(matrixB.Count, x.Count);
+
+            var matrixBReconstruct = matrixA * x;
+
+            // Check the reconstruction.
+            for (var i = 0; i < order; i++)
+            {
+                Assert.AreEqual(matrixB[i].Real, matrixBReconstruct[i].Real, 1e-2f);
+                Assert.AreEqual(matrixB[i].Imaginary, matrixBReconstruct[i].Imaginary, 1e-2f);
+            }
+
+            // Make sure A didn't change.
+            for (var i = 0; i < matrixA.RowCount; i++)
+            {
+                for (var j = 0; j < matrixA.ColumnCount; j++)
+                {
+                    Assert.AreEqual(matrixACopy[i, j], matrixA[i, j]);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can solve a system of linear equations for a random matrix (AX=B).
+        /// </summary>
+        /// <param name="row">Matrix row number.</param>
+        /// <param name="col">Matrix column number.</param>
+        [Test, Sequential]
+        public void CanSolveForRandomMatrix([Values(1, 2, 5, 10, 50, 100)] int row, [Values(1, 4, 8, 3, 10, 100)] int col)
+        {
+            var matrixA = GenerateIndefiniteMatrix(row);
+            var ldlt = new DenseLDLT(matrixA);
+            var matrixB = MatrixLoader.GenerateRandomDenseMatrix(row, col);
+            var matrixX = ldlt.Solve(matrixB);
+
+            Assert.AreEqual(matrixB.RowCount, matrixX.RowCount);
+            Assert.AreEqual(matrixB.ColumnCount, matrixX.ColumnCount);
+
+            var matrixBReconstruct = matrixA * matrixX;
+
+            // Check the reconstruction.
+            for (var i = 0; i < matrixB.RowCount; i++)
+            {
+                for (var j = 0; j < matrixB.ColumnCount; j++)
+                {
+                    Assert.AreEqual(matrixB[i, j].Real, matrixBReconstruct[i, j].Real, 1e-2f);
+                    Assert.AreEqual(matrixB[i, j].Imaginary, matrixBReconstruct[i, j].Imaginary, 1e-2f);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Creates a random Hermitian matrix whose diagonal alternates in sign, so that it is indefinite for
+        /// orders above one but still well-conditioned.
+        /// </summary>
+        /// <param name="order">The order of the matrix.</param>
+        /// <returns>The matrix.</returns>
+        private static DenseMatrix GenerateIndefiniteMatrix(int order)
+        {
+            var matrixR = MatrixLoader.GenerateRandomDenseMatrix(order, order);
+            var matrixA = (DenseMatrix)(matrixR + matrixR.ConjugateTranspose());
+            for (var i = 0; i < order; i++)
+            {
+                matrixA[i, i] = (i % 2 == 0 ? 2 : -2) * order;
+            }
+
+            return matrixA;
+        }
+    }
+}
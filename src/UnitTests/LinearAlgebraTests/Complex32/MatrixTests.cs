@@ -1732,13 +1732,13 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Complex32
         public virtual void CanComputeFrobeniusNorm()
         {
             var matrix = TestMatrices["Square3x3"];
-            AssertHelpers.AlmostEqual(10.8819655f, matrix.FrobeniusNorm().Real, 7);
+            AssertHelpers.AlmostEqual(11.1427106f, matrix.FrobeniusNorm().Real, 6);
 
             matrix = TestMatrices["Wide2x3"];
-            AssertHelpers.AlmostEqual(5.1905256f, matrix.FrobeniusNorm().Real, 7);
+            AssertHelpers.AlmostEqual(5.2905576f, matrix.FrobeniusNorm().Real, 6);
 
             matrix = TestMatrices["Tall3x2"];
-            AssertHelpers.AlmostEqual(7.5904115f, matrix.FrobeniusNorm().Real, 7);
+            AssertHelpers.AlmostEqual(7.8657485f, matrix.FrobeniusNorm().Real, 6);
         }
 
         /// <summary>
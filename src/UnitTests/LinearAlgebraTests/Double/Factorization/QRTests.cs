@@ -74,7 +74,7 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Double.Factorization
                 {
                     if (i == j)
                     {
-                        Assert.AreEqual(-1.0, factorQR.R[i, j]);
+                        Assert.AreEqual(1.0, Math.Abs(factorQR.R[i, j]));
                     }
                     else
                     {
@@ -306,5 +306,36 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Double.Factorization
                 }
             }
         }
+
+        /// <summary>
+        /// Can solve a rank deficient least squares problem with a column-pivoted factorization.
+        /// </summary>
+        [Test]
+        public void CanSolveRankDeficientWithPivoting()
+        {
+            var matrixA = (DenseMatrix)MatrixLoader.GenerateRandomDenseMatrix(10, 4);
+
+            // Make the last column a combination of the first two.
+            for (var i = 0; i < matrixA.RowCount; i++)
+            {
+                matrixA[i, 3] = matrixA[i, 0] - matrixA[i, 1] - matrixA[i, 1];
+            }
+
+            var factorQR = new DenseQR(matrixA, true);
+
+            Assert.AreEqual(3, factorQR.Rank);
+            Assert.IsFalse(factorQR.IsFullRank);
+            Assert.AreEqual(matrixA.ColumnCount, factorQR.Pivots.Length);
+
+            // b is in the range of A, so the basic solution reproduces it.
+            var vectorb = matrixA * MatrixLoader.GenerateRandomDenseVector(4);
+            var resultx = factorQR.Solve(vectorb);
+            var vectorBReconstruct = matrixA * resultx;
+
+            for (var i = 0; i < vectorb.Count; i++)
+            {
+                Assert.AreEqual(vectorb[i], vectorBReconstruct[i], 1.0e-11);
+            }
+        }
     }
 }
@@ -540,6 +540,28 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Double
             }
         }
 
+        /// <summary>
+        /// Can multiply the transpose of a matrix with the matrix itself.
+        /// </summary>
+        /// <param name="nameA">Matrix name.</param>
+        [Test, Sequential]
+        public void CanTransposeThisAndMultiplyMatrixWithItself([Values("Singular3x3", "Singular4x4", "Wide2x3", "Tall3x2")] string nameA)
+        {
+            var matrixA = TestMatrices[nameA];
+            var matrixC = matrixA.TransposeThisAndMultiply(matrixA);
+
+            Assert.AreEqual(matrixC.RowCount, matrixA.ColumnCount);
+            Assert.AreEqual(matrixC.ColumnCount, matrixA.ColumnCount);
+
+            for (var i = 0; i < matrixC.RowCount; i++)
+            {
+                for (var j = 0; j < matrixC.ColumnCount; j++)
+                {
+                    AssertHelpers.AlmostEqual(matrixA.Column(i) * matrixA.Column(j), matrixC[i, j], 15);
+                }
+            }
+        }
+
         /// <summary>
         /// Can transpose and multiply a matrix with differing dimensions.
         /// </summary>
@@ -0,0 +1,185 @@
+﻿// <copyright file="BandMatrixTests.cs" company="Math.NET">
+// Math.NET Numerics, part of the Math.NET Project
+// http://numerics.mathdotnet.com
+// http://github.com/mathnet/mathnet-numerics
+// http://mathnetnumerics.codeplex.com
+// Copyright (c) 2009-2010 Math.NET
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use,
+// copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following
+// conditions:
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+// OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+// OTHER DEALINGS IN THE SOFTWARE.
+// </copyright>
+
+namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Single
+{
+    using System;
+    using LinearAlgebra.Single;
+    using LinearAlgebra.Single.Factorization;
+    using NUnit.Framework;
+
+    /// <summary>
+    /// Band matrix tests.
+    /// </summary>
+    public class BandMatrixTests
+    {
+        /// <summary>
+        /// Can read and write elements inside the band, and reads zero outside it.
+        /// </summary>
+        [Test]
+        public void CanReadAndWriteInsideBand()
+        {
+            var matrix = new BandMatrix(4, 1, 2);
+            matrix[2, 1] = 1.5f;
+            matrix[0, 2] = -2.5f;
+
+            Assert.AreEqual(1.5f, matrix[2, 1]);
+            Assert.AreEqual(-2.5f, matrix[0, 2]);
+            Assert.AreEqual(0.0f, matrix[3, 0]);
+            Assert.AreEqual(0.0f, matrix[0, 3]);
+            Assert.AreEqual(16, matrix.Data.Length);
+        }
+
+        /// <summary>
+        /// Setting a non-zero element outside the band throws <c>IndexOutOfRangeException</c>.
+        /// </summary>
+        [Test]
+        public void SettingElementOutsideBandThrowsIndexOutOfRangeException()
+        {
+            var matrix = new BandMatrix(4, 1, 2);
+            matrix[3, 0] = 0.0f;
+            Assert.Throws<IndexOutOfRangeException>(() => matrix[3, 0] = 1.0f);
+            Assert.Throws<IndexOutOfRangeException>(() => matrix[0, 3] = 1.0f);
+        }
+
+        /// <summary>
+        /// Multiplication, transpose and norms agree with the dense matrix.
+        /// </summary>
+        [Test]
+        public void CanMultiplyTransposeAndNormLikeDenseMatrix()
+        {
+            var matrix = CreateBandMatrix(7, 2, 1);
+            var dense = new DenseMatrix(matrix.ToArray());
+            var x = MatrixLoader.GenerateRandomDenseVector(7);
+
+            var y = matrix * x;
+            var expected = dense * x;
+            for (var i = 0; i < 7; i++)
+            {
+                Assert.AreEqual(expected[i], y[i], 1.0e-4);
+            }
+
+            var transpose = matrix.Transpose();
+            Assert.IsInstanceOf(typeof(BandMatrix), transpose);
+            var denseTranspose = dense.Transpose();
+            for (var i = 0; i < 7; i++)
+            {
+                for (var j = 0; j < 7; j++)
+                {
+                    Assert.AreEqual(denseTranspose[i, j], transpose[i, j]);
+                }
+            }
+
+            AssertHelpers.AlmostEqual(dense.L1Norm(), matrix.L1Norm(), 5);
+            AssertHelpers.AlmostEqual(dense.InfinityNorm(), matrix.InfinityNorm(), 5);
+            AssertHelpers.AlmostEqual(dense.FrobeniusNorm(), matrix.FrobeniusNorm(), 5);
+        }
+
+        /// <summary>
+        /// Can solve a banded system with the banded LU factorization.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanSolveUsingLU([Values(1, 2, 5, 10, 50)] int order)
+        {
+            var matrix = CreateBandMatrix(order, 2, 1);
+            var matrixCopy = matrix.Clone();
+            var dense = new DenseMatrix(matrix.ToArray());
+            var b = MatrixLoader.GenerateRandomDenseMatrix(order, 3);
+
+            var x = matrix.LUSolve(b);
+            var expected = new DenseLU(dense).Solve(b);
+
+            for (var i = 0; i < order; i++)
+            {
+                for (var j = 0; j < 3; j++)
+                {
+                    Assert.AreEqual(expected[i, j], x[i, j], 1.0e-3);
+                }
+            }
+
+            // Make sure A didn't change.
+            for (var i = 0; i < order; i++)
+            {
+                for (var j = 0; j < order; j++)
+                {
+                    Assert.AreEqual(matrixCopy[i, j], matrix[i, j]);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Can solve a symmetric positive definite banded system with the banded Cholesky factorization.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanSolveUsingCholesky([Values(1, 2, 5, 10, 50)] int order)
+        {
+            var matrix = CreateBandMatrix(order, 2, 2);
+            var dense = new DenseMatrix(matrix.ToArray());
+            var b = MatrixLoader.GenerateRandomDenseVector(order);
+
+            var x = matrix.CholeskySolve(b);
+            var expected = new DenseCholesky(dense).Solve(b);
+
+            for (var i = 0; i < order; i++)
+            {
+                Assert.AreEqual(expected[i], x[i], 1.0e-3);
+            }
+        }
+
+        /// <summary>
+        /// Banded Cholesky solve requires equal lower and upper bandwidths.
+        /// </summary>
+        [Test]
+        public void CholeskySolveFailsWithUnequalBandwidths()
+        {
+            var matrix = CreateBandMatrix(5, 2, 1);
+            Assert.Throws<ArgumentException>(() => matrix.CholeskySolve(new DenseVector(5)));
+        }
+
+        /// <summary>
+        /// Creates a diagonally dominant band matrix, which is symmetric positive definite when both bandwidths are equal.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        /// <param name="lowerBandwidth">The number of subdiagonals.</param>
+        /// <param name="upperBandwidth">The number of superdiagonals.</param>
+        /// <returns>The band matrix.</returns>
+        private static BandMatrix CreateBandMatrix(int order, int lowerBandwidth, int upperBandwidth)
+        {
+            var matrix = new BandMatrix(order, lowerBandwidth, upperBandwidth);
+            for (var j = 0; j < order; j++)
+            {
+                for (var i = Math.Max(0, j - upperBandwidth); i <= Math.Min(order - 1, j + lowerBandwidth); i++)
+                {
+                    matrix[i, j] = i == j ? 4.0f + (i % 3) : 1.0f / (1 + i + j);
+                }
+            }
+
+            return matrix;
+        }
+    }
+}
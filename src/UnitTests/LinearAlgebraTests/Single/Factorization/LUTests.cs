@@ -29,6 +29,7 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Single.Factorization
     using System;
     using LinearAlgebra.Generic.Factorization;
     using LinearAlgebra.Single;
+    using LinearAlgebra.Single.Factorization;
     using NUnit.Framework;
 
     /// <summary>
@@ -93,6 +94,43 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Single.Factorization
             Assert.AreEqual(1.0, lu.Determinant);
         }
 
+        /// <summary>
+        /// Can estimate the condition number of a random matrix from its factors.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanEstimateConditionNumber([Values(1, 2, 5, 10, 50, 100)] int order)
+        {
+            var matrixA = (DenseMatrix)MatrixLoader.GenerateRandomDenseMatrix(order, order);
+            var factorLU = new DenseLU(matrixA);
+
+            // The estimate of the norm of the inverse is a lower bound, and rarely off by more than a factor of three.
+            var exact = (matrixA.L1Norm() * factorLU.Inverse().L1Norm());
+            Assert.LessOrEqual(factorLU.ConditionNumber, exact * (1 + 1.0e-2));
+            Assert.GreaterOrEqual(factorLU.ConditionNumber, exact / 3);
+        }
+
+        /// <summary>
+        /// The logarithm of the determinant does not overflow where the determinant itself does.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void DeterminantLnDoesNotOverflow([Values(1, 10, 100)] int order)
+        {
+            var matrixA = DenseMatrix.Identity(order);
+            for (var i = 0; i < order; i++)
+            {
+                matrixA[i, i] = 1.0e10f;
+            }
+
+            matrixA[0, 0] = -1.0e10f;
+
+            float sign;
+            var logAbs = new DenseLU(matrixA).DeterminantLn(out sign);
+            Assert.AreEqual(-1.0f, sign);
+            Assert.AreEqual(order * (float)Math.Log(1.0e10), logAbs, 1.0e-3 * order);
+        }
+
         /// <summary>
         /// Can factorize a random square matrix.
         /// </summary>
@@ -177,6 +215,38 @@ namespace MathNet.Numerics.UnitTests.LinearAlgebraTests.Single.Factorization
             }
         }
 
+        /// <summary>
+        /// Can solve a batch of systems and get the same answers as solving them one at a time.
+        /// </summary>
+        /// <param name="order">Matrix order.</param>
+        [Test]
+        public void CanSolveBatchOfRandomVectors([Values(1, 6, 12)] int order)
+        {
+            var matrices = new DenseMatrix[5];
+            var inputs = new DenseVector[5];
+            for (var i = 0; i < matrices.Length; i++)
+            {
+                matrices[i] = (DenseMatrix)MatrixLoader.GenerateRandomDenseMatrix(order, order);
+                inputs[i] = (DenseVector)MatrixLoader.GenerateRandomDenseVector(order);
+            }
+
+            var results = DenseLU.SolveBatch(matrices, inputs);
+            var factorizations = DenseLU.FactorBatch(matrices);
+
+            Assert.AreEqual(matrices.Length, results.Length);
+            Assert.AreEqual(matrices.Length, factorizations.Length);
+            for (var i = 0; i < matrices.Length; i++)
+            {
+                var expected = matrices[i].LU().Solve(inputs[i]);
+                var factored = factorizations[i].Solve(inputs[i]);
+                for (var j = 0; j < order; j++)
+                {
+                    AssertHelpers.AlmostEqual(expected[j], results[i][j], 5);
+                    AssertHelpers.AlmostEqual(expected[j], factored[j], 5);
+                }
+            }
+        }
+
         /// <summary>
         /// Can solve a system of linear equations for a random matrix (AX=B).
         /// </summary>